@@ -0,0 +1,268 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/automotive-dlt-config.cmake.in"
+  "/root/repo/automotive-dlt.pc.in"
+  "/root/repo/automotive-dlt.spec.in"
+  "/root/repo/cmake/CMakeLists.txt"
+  "/root/repo/cmake/dlt_version.h.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/include/dlt/CMakeLists.txt"
+  "/root/repo/include/dlt/dlt_user.h.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/adaptor/CMakeLists.txt"
+  "/root/repo/src/console/CMakeLists.txt"
+  "/root/repo/src/console/logstorage/CMakeLists.txt"
+  "/root/repo/src/core_dump_handler/50-coredump.conf.cmake"
+  "/root/repo/src/core_dump_handler/CMakeLists.txt"
+  "/root/repo/src/daemon/CMakeLists.txt"
+  "/root/repo/src/examples/CMakeLists.txt"
+  "/root/repo/src/gateway/CMakeLists.txt"
+  "/root/repo/src/lib/CMakeLists.txt"
+  "/root/repo/src/system/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/components/CMakeLists.txt"
+  "/root/repo/tests/components/dlt-logd-converter/CMakeLists.txt"
+  "/root/repo/tests/components/dlt-logd-converter/abnormal-dlt-logd-converter.conf"
+  "/root/repo/tests/components/dlt-logd-converter/dlt-logd-converter.conf"
+  "/root/repo/tests/components/dlt-logd-converter/dlt-logdctxt.json"
+  "/root/repo/tests/components/dlt-logd-converter/dlt.conf.in"
+  "/root/repo/tests/components/dlt-logd-converter/run_test.sh"
+  "/root/repo/tests/components/logstorage/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/disable_network/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/disable_network/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/disable_network/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/disable_network/run_test.sh"
+  "/root/repo/tests/components/logstorage/logstorage_filepath/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/logstorage_filepath/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/logstorage_filepath/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/logstorage_filepath/run_test.sh"
+  "/root/repo/tests/components/logstorage/logstorage_fsync/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/logstorage_fsync/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/logstorage_fsync/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/logstorage_fsync/run_test.sh"
+  "/root/repo/tests/components/logstorage/logstorage_max_cache_size/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/logstorage_max_cache_size/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/logstorage_max_cache_size/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/logstorage_max_cache_size/run_test.sh"
+  "/root/repo/tests/components/logstorage/logstorage_multi_file/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/logstorage_multi_file/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/logstorage_multi_file/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/logstorage_multi_file/run_test.sh"
+  "/root/repo/tests/components/logstorage/logstorage_one_file/CMakeLists.txt"
+  "/root/repo/tests/components/logstorage/logstorage_one_file/dlt.conf.in"
+  "/root/repo/tests/components/logstorage/logstorage_one_file/dlt_logstorage.conf"
+  "/root/repo/tests/components/logstorage/logstorage_one_file/run_test.sh"
+  "/root/repo/tests/gtest_dlt_daemon_gateway.sh"
+  "/root/repo/tests/gtest_dlt_daemon_offline_log.sh"
+  "/root/repo/tests/gtest_dlt_teardown.sh"
+  "/root/repo/tests/gtest_dlt_user.sh"
+  "/root/repo/tests/test_dlt.conf"
+  "/root/repo/tests/testfile-v2.dlt"
+  "/root/repo/tests/testfile.dlt"
+  "/root/repo/tests/testfile_filetransfer.txt"
+  "/root/repo/tests/testfilter.txt"
+  "/root/repo/testscripts/CMakeLists.txt"
+  "/root/repo/util/gtest_dlt_actuator.py"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "automotive-dlt.spec"
+  "automotive-dlt.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/dlt/dlt_version.h"
+  "cmake/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "automotive-dlt-config.cmake"
+  "src/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/daemon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gateway/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/console/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/console/logstorage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/adaptor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "core_dump_handler/50-coredump.conf"
+  "src/core_dump_handler/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/dlt/dlt_user.h"
+  "include/dlt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testscripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testfile.dlt"
+  "tests/testfile-v2.dlt"
+  "tests/testfilter.txt"
+  "tests/testfile_filetransfer.txt"
+  "tests/gtest_dlt_actuator.py"
+  "tests/gtest_dlt_teardown.sh"
+  "tests/test_dlt.conf"
+  "tests/gtest_dlt_user.sh"
+  "tests/gtest_dlt_daemon_gateway.sh"
+  "tests/gtest_dlt_daemon_offline_log.sh"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/logstorage_filepath/dlt.conf"
+  "tests/components/logstorage/logstorage_filepath/dlt_logstorage.conf"
+  "tests/components/logstorage/logstorage_filepath/run_test.sh"
+  "tests/components/logstorage/logstorage_filepath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/logstorage_multi_file/dlt.conf"
+  "tests/components/logstorage/logstorage_multi_file/dlt_logstorage.conf"
+  "tests/components/logstorage/logstorage_multi_file/run_test.sh"
+  "tests/components/logstorage/logstorage_multi_file/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/logstorage_one_file/dlt.conf"
+  "tests/components/logstorage/logstorage_one_file/dlt_logstorage.conf"
+  "tests/components/logstorage/logstorage_one_file/run_test.sh"
+  "tests/components/logstorage/logstorage_one_file/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/logstorage_max_cache_size/dlt.conf"
+  "tests/components/logstorage/logstorage_max_cache_size/dlt_logstorage.conf"
+  "tests/components/logstorage/logstorage_max_cache_size/run_test.sh"
+  "tests/components/logstorage/logstorage_max_cache_size/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/logstorage_fsync/dlt_logstorage.conf"
+  "tests/components/logstorage/logstorage_fsync/run_test.sh"
+  "tests/components/logstorage/logstorage_fsync/dlt.conf"
+  "tests/components/logstorage/logstorage_fsync/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/logstorage/disable_network/dlt.conf"
+  "tests/components/logstorage/disable_network/dlt_logstorage.conf"
+  "tests/components/logstorage/disable_network/run_test.sh"
+  "tests/components/logstorage/disable_network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/components/dlt-logd-converter/dlt.conf"
+  "tests/components/dlt-logd-converter/dlt-logd-converter.conf"
+  "tests/components/dlt-logd-converter/dlt-logdctxt.json"
+  "tests/components/dlt-logd-converter/abnormal-dlt-logd-converter.conf"
+  "tests/components/dlt-logd-converter/run_test.sh"
+  "tests/components/dlt-logd-converter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  "src/daemon/CMakeFiles/dlt-daemon.dir/DependInfo.cmake"
+  "src/daemon/CMakeFiles/dlt_daemon.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt_control_common_lib.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-receive.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-receive-v2.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-convert.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-convert-v2.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-control.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-control-v2.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-passive-node-ctrl.dir/DependInfo.cmake"
+  "src/console/CMakeFiles/dlt-sortbytimestamp.dir/DependInfo.cmake"
+  "src/console/logstorage/CMakeFiles/dlt-logstorage-ctrl.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-user-func-v2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-filetransfer.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-user.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-user-v2.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-user-common-api.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dlt-example-multicast-clientmsg-view.dir/DependInfo.cmake"
+  "src/adaptor/CMakeFiles/dlt-adaptor-stdin.dir/DependInfo.cmake"
+  "src/adaptor/CMakeFiles/dlt-adaptor-udp.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-multi-process.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-multi-process-client.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-user.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-client.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress-user.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress-client.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-fork-handler.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-init-free.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-preregister-context.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-filetransfer.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-multi-process-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-multi-process-client-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-user-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-client-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress-user-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress-client-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-stress-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-fork-handler-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-preregister-context-v2.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/dlt-test-non-verbose.dir/DependInfo.cmake"
+  "src/system/CMakeFiles/dlt-system.dir/DependInfo.cmake"
+  "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dlt_test_receiver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_common.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_user.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_common.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_common_v2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_user_v2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_v2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_common_v2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/dlt_env_ll_unit_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_gateway.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_offline_log.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_event_handler.dir/DependInfo.cmake"
+  "tests/CMakeFiles/gtest_dlt_daemon_multiple_files_logging.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_filepath/CMakeFiles/logstorage_filepath.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_multi_file/CMakeFiles/logstorage_multi_file.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_one_file/CMakeFiles/logstorage_one_file.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_max_cache_size/CMakeFiles/logstorage_max_cache_size.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_fsync/CMakeFiles/logfsync.dir/DependInfo.cmake"
+  "tests/components/logstorage/logstorage_fsync/CMakeFiles/logstorage_fsync.dir/DependInfo.cmake"
+  "tests/components/logstorage/disable_network/CMakeFiles/disable_network.dir/DependInfo.cmake"
+  "tests/components/dlt-logd-converter/CMakeFiles/gtest_dlt_logd_converter.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_comp_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("cmake")
+subdirs("doc")
+subdirs("src")
+subdirs("include")
+subdirs("testscripts")
+subdirs("tests")
@@ -0,0 +1,65 @@
+# Install script for directory: /root/repo/include/dlt
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "devel" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/dlt" TYPE FILE FILES
+    "/root/repo/include/dlt/dlt.h"
+    "/root/repo/include/dlt/dlt_user_macros.h"
+    "/root/repo/include/dlt/dlt_client.h"
+    "/root/repo/include/dlt/dlt_protocol.h"
+    "/root/repo/include/dlt/dlt_common.h"
+    "/root/repo/include/dlt/dlt_log.h"
+    "/root/repo/include/dlt/dlt_types.h"
+    "/root/repo/include/dlt/dlt_shm.h"
+    "/root/repo/include/dlt/dlt_offline_trace.h"
+    "/root/repo/include/dlt/dlt_filetransfer.h"
+    "/root/repo/include/dlt/dlt_common_api.h"
+    "/root/repo/include/dlt/dlt_multiple_files.h"
+    "/root/repo/include/dlt/dlt_file_index.h"
+    "/root/repo/include/dlt/dlt_filter_engine.h"
+    "/root/repo/_comp_build/include/dlt/dlt_version.h"
+    "/root/repo/_comp_build/include/dlt/dlt_user.h"
+    )
+endif()
+
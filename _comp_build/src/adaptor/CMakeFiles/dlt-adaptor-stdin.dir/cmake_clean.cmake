@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-adaptor-stdin.dir/dlt-adaptor-stdin.c.o"
+  "CMakeFiles/dlt-adaptor-stdin.dir/dlt-adaptor-stdin.c.o.d"
+  "dlt-adaptor-stdin"
+  "dlt-adaptor-stdin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-adaptor-stdin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-adaptor-udp.dir/dlt-adaptor-udp.c.o"
+  "CMakeFiles/dlt-adaptor-udp.dir/dlt-adaptor-udp.c.o.d"
+  "dlt-adaptor-udp"
+  "dlt-adaptor-udp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-adaptor-udp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-control-v2.dir/dlt-control-v2.c.o"
+  "CMakeFiles/dlt-control-v2.dir/dlt-control-v2.c.o.d"
+  "dlt-control-v2"
+  "dlt-control-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-control-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
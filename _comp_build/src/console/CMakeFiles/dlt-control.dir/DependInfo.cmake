@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/console/dlt-control.c" "src/console/CMakeFiles/dlt-control.dir/dlt-control.c.o" "gcc" "src/console/CMakeFiles/dlt-control.dir/dlt-control.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/console/CMakeFiles/dlt_control_common_lib.dir/DependInfo.cmake"
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-control.dir/dlt-control.c.o"
+  "CMakeFiles/dlt-control.dir/dlt-control.c.o.d"
+  "dlt-control"
+  "dlt-control.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-control.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-convert-v2.dir/dlt-convert-v2.c.o"
+  "CMakeFiles/dlt-convert-v2.dir/dlt-convert-v2.c.o.d"
+  "dlt-convert-v2"
+  "dlt-convert-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-convert-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
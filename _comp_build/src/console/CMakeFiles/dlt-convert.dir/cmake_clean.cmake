@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-convert.dir/dlt-convert.c.o"
+  "CMakeFiles/dlt-convert.dir/dlt-convert.c.o.d"
+  "dlt-convert"
+  "dlt-convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-passive-node-ctrl.dir/dlt-passive-node-ctrl.c.o"
+  "CMakeFiles/dlt-passive-node-ctrl.dir/dlt-passive-node-ctrl.c.o.d"
+  "dlt-passive-node-ctrl"
+  "dlt-passive-node-ctrl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-passive-node-ctrl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
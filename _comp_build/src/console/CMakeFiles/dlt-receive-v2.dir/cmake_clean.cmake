@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-receive-v2.dir/dlt-receive-v2.c.o"
+  "CMakeFiles/dlt-receive-v2.dir/dlt-receive-v2.c.o.d"
+  "dlt-receive-v2"
+  "dlt-receive-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-receive-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-receive.dir/dlt-receive.c.o"
+  "CMakeFiles/dlt-receive.dir/dlt-receive.c.o.d"
+  "dlt-receive"
+  "dlt-receive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-receive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-sortbytimestamp.dir/dlt-sortbytimestamp.c.o"
+  "CMakeFiles/dlt-sortbytimestamp.dir/dlt-sortbytimestamp.c.o.d"
+  "dlt-sortbytimestamp"
+  "dlt-sortbytimestamp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-sortbytimestamp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt_control_common_lib.dir/dlt-control-common.c.o"
+  "CMakeFiles/dlt_control_common_lib.dir/dlt-control-common.c.o.d"
+  "libdlt_control_common_lib.a"
+  "libdlt_control_common_lib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt_control_common_lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdlt_control_common_lib.a"
+)
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-logstorage-ctrl.dir/__/dlt-control-common.c.o"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/__/dlt-control-common.c.o.d"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-common.c.o"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-common.c.o.d"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-ctrl.c.o"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-ctrl.c.o.d"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-list.c.o"
+  "CMakeFiles/dlt-logstorage-ctrl.dir/dlt-logstorage-list.c.o.d"
+  "dlt-logstorage-ctrl"
+  "dlt-logstorage-ctrl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-logstorage-ctrl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
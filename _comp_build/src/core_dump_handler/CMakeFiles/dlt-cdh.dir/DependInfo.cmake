@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core_dump_handler/dlt_cdh.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh.c.o.d"
+  "/root/repo/src/core_dump_handler/dlt_cdh_context.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_context.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_context.c.o.d"
+  "/root/repo/src/core_dump_handler/dlt_cdh_coredump.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_coredump.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_coredump.c.o.d"
+  "/root/repo/src/core_dump_handler/dlt_cdh_crashid.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_crashid.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_crashid.c.o.d"
+  "/root/repo/src/core_dump_handler/dlt_cdh_streamer.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_streamer.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/dlt_cdh_streamer.c.o.d"
+  "/root/repo/src/core_dump_handler/x86_64/dlt_cdh_cpuinfo.c" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/x86_64/dlt_cdh_cpuinfo.c.o" "gcc" "src/core_dump_handler/CMakeFiles/dlt-cdh.dir/x86_64/dlt_cdh_cpuinfo.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh.c.o"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh.c.o.d"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_context.c.o"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_context.c.o.d"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_coredump.c.o"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_coredump.c.o.d"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_crashid.c.o"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_crashid.c.o.d"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_streamer.c.o"
+  "CMakeFiles/dlt-cdh.dir/dlt_cdh_streamer.c.o.d"
+  "CMakeFiles/dlt-cdh.dir/x86_64/dlt_cdh_cpuinfo.c.o"
+  "CMakeFiles/dlt-cdh.dir/x86_64/dlt_cdh_cpuinfo.c.o.d"
+  "dlt-cdh"
+  "dlt-cdh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-cdh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/gateway/dlt_gateway.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/gateway/dlt_gateway.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/gateway/dlt_gateway.c.o.d"
+  "/root/repo/src/lib/dlt_client.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/lib/dlt_client.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/lib/dlt_client.c.o.d"
+  "/root/repo/src/offlinelogstorage/dlt_offline_logstorage.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage.c.o.d"
+  "/root/repo/src/offlinelogstorage/dlt_offline_logstorage_behavior.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage_behavior.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage_behavior.c.o.d"
+  "/root/repo/src/shared/dlt_common.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_common.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_common.c.o.d"
+  "/root/repo/src/shared/dlt_config_file_parser.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_config_file_parser.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_config_file_parser.c.o.d"
+  "/root/repo/src/shared/dlt_filter_engine.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_filter_engine.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_filter_engine.c.o.d"
+  "/root/repo/src/shared/dlt_log.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_log.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_log.c.o.d"
+  "/root/repo/src/shared/dlt_multiple_files.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_multiple_files.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_multiple_files.c.o.d"
+  "/root/repo/src/shared/dlt_offline_trace.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_offline_trace.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_offline_trace.c.o.d"
+  "/root/repo/src/shared/dlt_protocol.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_protocol.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_protocol.c.o.d"
+  "/root/repo/src/shared/dlt_user_shared.c" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_user_shared.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/__/shared/dlt_user_shared.c.o.d"
+  "/root/repo/src/daemon/dlt-daemon.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt-daemon.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt-daemon.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_client.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_client.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_client.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_common.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_common.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_common.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_compression.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_compression.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_compression.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_connection.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_connection.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_connection.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_event_handler.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_event_handler.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_event_handler.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_load_shedding.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_load_shedding.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_load_shedding.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_offline_logstorage.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_offline_logstorage.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_offline_logstorage.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_serial.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_serial.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_serial.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_socket.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_socket.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_socket.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_unix_socket.c" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_unix_socket.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/dlt_daemon_unix_socket.c.o.d"
+  "/root/repo/src/daemon/udp_connection/dlt_daemon_udp_socket.c" "src/daemon/CMakeFiles/dlt_daemon.dir/udp_connection/dlt_daemon_udp_socket.c.o" "gcc" "src/daemon/CMakeFiles/dlt_daemon.dir/udp_connection/dlt_daemon_udp_socket.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_comp_build/src/daemon/libdlt_daemon.so" "/root/repo/_comp_build/src/daemon/libdlt_daemon.so.3.0.1"
+  "/root/repo/_comp_build/src/daemon/libdlt_daemon.so.3" "/root/repo/_comp_build/src/daemon/libdlt_daemon.so.3.0.1"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
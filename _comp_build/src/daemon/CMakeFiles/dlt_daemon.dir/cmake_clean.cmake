@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt_daemon.dir/__/gateway/dlt_gateway.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/gateway/dlt_gateway.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/lib/dlt_client.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/lib/dlt_client.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage_behavior.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/offlinelogstorage/dlt_offline_logstorage_behavior.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_common.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_common.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_config_file_parser.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_config_file_parser.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_filter_engine.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_filter_engine.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_log.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_log.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_multiple_files.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_multiple_files.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_offline_trace.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_offline_trace.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_protocol.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_protocol.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_user_shared.c.o"
+  "CMakeFiles/dlt_daemon.dir/__/shared/dlt_user_shared.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt-daemon.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt-daemon.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_client.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_client.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_common.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_common.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_compression.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_compression.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_connection.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_connection.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_event_handler.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_event_handler.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_load_shedding.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_load_shedding.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_offline_logstorage.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_offline_logstorage.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_serial.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_serial.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_socket.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_socket.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_unix_socket.c.o"
+  "CMakeFiles/dlt_daemon.dir/dlt_daemon_unix_socket.c.o.d"
+  "CMakeFiles/dlt_daemon.dir/udp_connection/dlt_daemon_udp_socket.c.o"
+  "CMakeFiles/dlt_daemon.dir/udp_connection/dlt_daemon_udp_socket.c.o.d"
+  "libdlt_daemon.pdb"
+  "libdlt_daemon.so"
+  "libdlt_daemon.so.3"
+  "libdlt_daemon.so.3.0.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt_daemon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-example-filetransfer.dir/dlt-example-filetransfer.c.o"
+  "CMakeFiles/dlt-example-filetransfer.dir/dlt-example-filetransfer.c.o.d"
+  "dlt-example-filetransfer"
+  "dlt-example-filetransfer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-example-filetransfer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
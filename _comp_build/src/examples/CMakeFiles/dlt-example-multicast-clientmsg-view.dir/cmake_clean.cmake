@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-example-multicast-clientmsg-view.dir/dlt-example-multicast-clientmsg-view.c.o"
+  "CMakeFiles/dlt-example-multicast-clientmsg-view.dir/dlt-example-multicast-clientmsg-view.c.o.d"
+  "dlt-example-multicast-clientmsg-view"
+  "dlt-example-multicast-clientmsg-view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-example-multicast-clientmsg-view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-example-user-common-api.dir/dlt-example-user-common-api.c.o"
+  "CMakeFiles/dlt-example-user-common-api.dir/dlt-example-user-common-api.c.o.d"
+  "dlt-example-user-common-api"
+  "dlt-example-user-common-api.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-example-user-common-api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
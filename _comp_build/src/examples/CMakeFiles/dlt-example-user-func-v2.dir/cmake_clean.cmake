@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-example-user-func-v2.dir/dlt-example-user-func-v2.c.o"
+  "CMakeFiles/dlt-example-user-func-v2.dir/dlt-example-user-func-v2.c.o.d"
+  "dlt-example-user-func-v2"
+  "dlt-example-user-func-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-example-user-func-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
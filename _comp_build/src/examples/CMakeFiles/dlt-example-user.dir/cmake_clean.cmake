@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-example-user.dir/dlt-example-user.c.o"
+  "CMakeFiles/dlt-example-user.dir/dlt-example-user.c.o.d"
+  "dlt-example-user"
+  "dlt-example-user.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-example-user.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
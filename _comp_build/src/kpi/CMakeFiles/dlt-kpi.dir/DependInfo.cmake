@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/kpi/dlt-kpi-common.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-common.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-common.c.o.d"
+  "/root/repo/src/kpi/dlt-kpi-interrupt.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-interrupt.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-interrupt.c.o.d"
+  "/root/repo/src/kpi/dlt-kpi-options.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-options.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-options.c.o.d"
+  "/root/repo/src/kpi/dlt-kpi-process-list.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-process-list.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-process-list.c.o.d"
+  "/root/repo/src/kpi/dlt-kpi-process.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-process.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi-process.c.o.d"
+  "/root/repo/src/kpi/dlt-kpi.c" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi.c.o" "gcc" "src/kpi/CMakeFiles/dlt-kpi.dir/dlt-kpi.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
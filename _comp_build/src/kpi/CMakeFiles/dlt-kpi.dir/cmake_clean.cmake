@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-common.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-common.c.o.d"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-interrupt.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-interrupt.c.o.d"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-options.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-options.c.o.d"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-process-list.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-process-list.c.o.d"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-process.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi-process.c.o.d"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi.c.o"
+  "CMakeFiles/dlt-kpi.dir/dlt-kpi.c.o.d"
+  "dlt-kpi"
+  "dlt-kpi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-kpi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/shared/dlt_common.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_common.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_common.c.o.d"
+  "/root/repo/src/shared/dlt_file_index.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_file_index.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_file_index.c.o.d"
+  "/root/repo/src/shared/dlt_filter_engine.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_filter_engine.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_filter_engine.c.o.d"
+  "/root/repo/src/shared/dlt_log.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_log.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_log.c.o.d"
+  "/root/repo/src/shared/dlt_multiple_files.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_multiple_files.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_multiple_files.c.o.d"
+  "/root/repo/src/shared/dlt_protocol.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_protocol.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_protocol.c.o.d"
+  "/root/repo/src/shared/dlt_user_shared.c" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_user_shared.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/__/shared/dlt_user_shared.c.o.d"
+  "/root/repo/src/lib/dlt_client.c" "src/lib/CMakeFiles/dlt.dir/dlt_client.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/dlt_client.c.o.d"
+  "/root/repo/src/lib/dlt_env_ll.c" "src/lib/CMakeFiles/dlt.dir/dlt_env_ll.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/dlt_env_ll.c.o.d"
+  "/root/repo/src/lib/dlt_filetransfer.c" "src/lib/CMakeFiles/dlt.dir/dlt_filetransfer.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/dlt_filetransfer.c.o.d"
+  "/root/repo/src/lib/dlt_user.c" "src/lib/CMakeFiles/dlt.dir/dlt_user.c.o" "gcc" "src/lib/CMakeFiles/dlt.dir/dlt_user.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_comp_build/src/lib/libdlt.so" "/root/repo/_comp_build/src/lib/libdlt.so.3.0.1"
+  "/root/repo/_comp_build/src/lib/libdlt.so.3" "/root/repo/_comp_build/src/lib/libdlt.so.3.0.1"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt.dir/__/shared/dlt_common.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_common.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_file_index.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_file_index.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_filter_engine.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_filter_engine.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_log.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_log.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_multiple_files.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_multiple_files.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_protocol.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_protocol.c.o.d"
+  "CMakeFiles/dlt.dir/__/shared/dlt_user_shared.c.o"
+  "CMakeFiles/dlt.dir/__/shared/dlt_user_shared.c.o.d"
+  "CMakeFiles/dlt.dir/dlt_client.c.o"
+  "CMakeFiles/dlt.dir/dlt_client.c.o.d"
+  "CMakeFiles/dlt.dir/dlt_env_ll.c.o"
+  "CMakeFiles/dlt.dir/dlt_env_ll.c.o.d"
+  "CMakeFiles/dlt.dir/dlt_filetransfer.c.o"
+  "CMakeFiles/dlt.dir/dlt_filetransfer.c.o.d"
+  "CMakeFiles/dlt.dir/dlt_user.c.o"
+  "CMakeFiles/dlt.dir/dlt_user.c.o.d"
+  "libdlt.pdb"
+  "libdlt.so"
+  "libdlt.so.3"
+  "libdlt.so.3.0.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
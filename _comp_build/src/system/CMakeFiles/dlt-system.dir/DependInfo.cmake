@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/system/dlt-system-filetransfer.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-filetransfer.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-filetransfer.c.o.d"
+  "/root/repo/src/system/dlt-system-journal.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-journal.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-journal.c.o.d"
+  "/root/repo/src/system/dlt-system-logfile.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-logfile.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-logfile.c.o.d"
+  "/root/repo/src/system/dlt-system-options.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-options.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-options.c.o.d"
+  "/root/repo/src/system/dlt-system-process-handling.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-process-handling.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-process-handling.c.o.d"
+  "/root/repo/src/system/dlt-system-processes.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-processes.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-processes.c.o.d"
+  "/root/repo/src/system/dlt-system-shell.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-shell.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-shell.c.o.d"
+  "/root/repo/src/system/dlt-system-syslog.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-syslog.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-syslog.c.o.d"
+  "/root/repo/src/system/dlt-system-watchdog.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system-watchdog.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system-watchdog.c.o.d"
+  "/root/repo/src/system/dlt-system.c" "src/system/CMakeFiles/dlt-system.dir/dlt-system.c.o" "gcc" "src/system/CMakeFiles/dlt-system.dir/dlt-system.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
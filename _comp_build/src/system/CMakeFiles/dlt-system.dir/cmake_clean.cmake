@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-system.dir/dlt-system-filetransfer.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-filetransfer.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-journal.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-journal.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-logfile.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-logfile.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-options.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-options.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-process-handling.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-process-handling.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-processes.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-processes.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-shell.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-shell.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-syslog.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-syslog.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system-watchdog.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system-watchdog.c.o.d"
+  "CMakeFiles/dlt-system.dir/dlt-system.c.o"
+  "CMakeFiles/dlt-system.dir/dlt-system.c.o.d"
+  "dlt-system"
+  "dlt-system.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-client.dir/dlt-test-client.c.o"
+  "CMakeFiles/dlt-test-client.dir/dlt-test-client.c.o.d"
+  "dlt-test-client"
+  "dlt-test-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-filetransfer.dir/dlt-test-filetransfer.c.o"
+  "CMakeFiles/dlt-test-filetransfer.dir/dlt-test-filetransfer.c.o.d"
+  "dlt-test-filetransfer"
+  "dlt-test-filetransfer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-filetransfer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-fork-handler.dir/dlt-test-fork-handler.c.o"
+  "CMakeFiles/dlt-test-fork-handler.dir/dlt-test-fork-handler.c.o.d"
+  "dlt-test-fork-handler"
+  "dlt-test-fork-handler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-fork-handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
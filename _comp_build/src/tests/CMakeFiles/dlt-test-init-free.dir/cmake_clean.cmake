@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-init-free.dir/dlt-test-init-free.c.o"
+  "CMakeFiles/dlt-test-init-free.dir/dlt-test-init-free.c.o.d"
+  "dlt-test-init-free"
+  "dlt-test-init-free.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-init-free.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-multi-process-client.dir/dlt-test-multi-process-client.c.o"
+  "CMakeFiles/dlt-test-multi-process-client.dir/dlt-test-multi-process-client.c.o.d"
+  "dlt-test-multi-process-client"
+  "dlt-test-multi-process-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-multi-process-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
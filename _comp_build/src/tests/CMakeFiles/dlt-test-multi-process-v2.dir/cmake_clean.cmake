@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-multi-process-v2.dir/dlt-test-multi-process-v2.c.o"
+  "CMakeFiles/dlt-test-multi-process-v2.dir/dlt-test-multi-process-v2.c.o.d"
+  "dlt-test-multi-process-v2"
+  "dlt-test-multi-process-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-multi-process-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-multi-process.dir/dlt-test-multi-process.c.o"
+  "CMakeFiles/dlt-test-multi-process.dir/dlt-test-multi-process.c.o.d"
+  "dlt-test-multi-process"
+  "dlt-test-multi-process.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-multi-process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-non-verbose.dir/dlt-test-non-verbose.c.o"
+  "CMakeFiles/dlt-test-non-verbose.dir/dlt-test-non-verbose.c.o.d"
+  "dlt-test-non-verbose"
+  "dlt-test-non-verbose.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-non-verbose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-preregister-context-v2.dir/dlt-test-preregister-context-v2.c.o"
+  "CMakeFiles/dlt-test-preregister-context-v2.dir/dlt-test-preregister-context-v2.c.o.d"
+  "dlt-test-preregister-context-v2"
+  "dlt-test-preregister-context-v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-preregister-context-v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-preregister-context.dir/dlt-test-preregister-context.c.o"
+  "CMakeFiles/dlt-test-preregister-context.dir/dlt-test-preregister-context.c.o.d"
+  "dlt-test-preregister-context"
+  "dlt-test-preregister-context.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-preregister-context.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
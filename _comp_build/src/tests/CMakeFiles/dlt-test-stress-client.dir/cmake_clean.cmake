@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-stress-client.dir/dlt-test-stress-client.c.o"
+  "CMakeFiles/dlt-test-stress-client.dir/dlt-test-stress-client.c.o.d"
+  "dlt-test-stress-client"
+  "dlt-test-stress-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-stress-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
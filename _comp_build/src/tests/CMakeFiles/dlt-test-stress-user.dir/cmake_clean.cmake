@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-stress-user.dir/dlt-test-stress-user.c.o"
+  "CMakeFiles/dlt-test-stress-user.dir/dlt-test-stress-user.c.o.d"
+  "dlt-test-stress-user"
+  "dlt-test-stress-user.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-stress-user.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-stress.dir/dlt-test-stress.c.o"
+  "CMakeFiles/dlt-test-stress.dir/dlt-test-stress.c.o.d"
+  "dlt-test-stress"
+  "dlt-test-stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
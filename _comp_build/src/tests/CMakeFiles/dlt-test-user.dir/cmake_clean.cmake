@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt-test-user.dir/dlt-test-user.c.o"
+  "CMakeFiles/dlt-test-user.dir/dlt-test-user.c.o.d"
+  "dlt-test-user"
+  "dlt-test-user.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt-test-user.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
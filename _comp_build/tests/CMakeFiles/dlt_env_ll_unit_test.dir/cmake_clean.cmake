@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt_env_ll_unit_test.dir/dlt_env_ll_unit_test.cpp.o"
+  "CMakeFiles/dlt_env_ll_unit_test.dir/dlt_env_ll_unit_test.cpp.o.d"
+  "dlt_env_ll_unit_test"
+  "dlt_env_ll_unit_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dlt_env_ll_unit_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dlt_test_receiver.dir/dlt_test_receiver.c.o"
+  "CMakeFiles/dlt_test_receiver.dir/dlt_test_receiver.c.o.d"
+  "dlt_test_receiver"
+  "dlt_test_receiver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dlt_test_receiver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
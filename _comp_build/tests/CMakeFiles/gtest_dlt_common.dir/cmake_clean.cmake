@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_common.dir/gtest_dlt_common.cpp.o"
+  "CMakeFiles/gtest_dlt_common.dir/gtest_dlt_common.cpp.o.d"
+  "gtest_dlt_common"
+  "gtest_dlt_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/daemon/dlt-daemon.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt-daemon.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt-daemon.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_client.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_client.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_client.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_common.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_common.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_common.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_compression.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_compression.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_compression.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_connection.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_connection.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_connection.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_event_handler.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_event_handler.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_event_handler.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_load_shedding.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_load_shedding.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_load_shedding.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_offline_logstorage.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_offline_logstorage.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_offline_logstorage.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_serial.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_serial.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_serial.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_socket.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_socket.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_socket.c.o.d"
+  "/root/repo/src/daemon/dlt_daemon_unix_socket.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_unix_socket.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/daemon/dlt_daemon_unix_socket.c.o.d"
+  "/root/repo/src/gateway/dlt_gateway.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/gateway/dlt_gateway.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/gateway/dlt_gateway.c.o.d"
+  "/root/repo/src/offlinelogstorage/dlt_offline_logstorage.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/offlinelogstorage/dlt_offline_logstorage.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/offlinelogstorage/dlt_offline_logstorage.c.o.d"
+  "/root/repo/src/offlinelogstorage/dlt_offline_logstorage_behavior.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/offlinelogstorage/dlt_offline_logstorage_behavior.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/offlinelogstorage/dlt_offline_logstorage_behavior.c.o.d"
+  "/root/repo/src/shared/dlt_config_file_parser.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/shared/dlt_config_file_parser.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/shared/dlt_config_file_parser.c.o.d"
+  "/root/repo/src/shared/dlt_offline_trace.c" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/shared/dlt_offline_trace.c.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/__/src/shared/dlt_offline_trace.c.o.d"
+  "/root/repo/tests/gtest_dlt_daemon.cpp" "tests/CMakeFiles/gtest_dlt_daemon.dir/gtest_dlt_daemon.cpp.o" "gcc" "tests/CMakeFiles/gtest_dlt_daemon.dir/gtest_dlt_daemon.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_common.dir/__/src/daemon/dlt_daemon_common.c.o"
+  "CMakeFiles/gtest_dlt_daemon_common.dir/__/src/daemon/dlt_daemon_common.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_common.dir/gtest_dlt_daemon_common.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_common.dir/gtest_dlt_daemon_common.cpp.o.d"
+  "gtest_dlt_daemon_common"
+  "gtest_dlt_daemon_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gtest_dlt_daemon_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_common_v2.dir/__/src/daemon/dlt_daemon_common.c.o"
+  "CMakeFiles/gtest_dlt_daemon_common_v2.dir/__/src/daemon/dlt_daemon_common.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_common_v2.dir/gtest_dlt_daemon_common_v2.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_common_v2.dir/gtest_dlt_daemon_common_v2.cpp.o.d"
+  "gtest_dlt_daemon_common_v2"
+  "gtest_dlt_daemon_common_v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gtest_dlt_daemon_common_v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
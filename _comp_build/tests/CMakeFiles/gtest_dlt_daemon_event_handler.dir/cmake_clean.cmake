@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_event_handler.dir/gtest_dlt_daemon_event_handler.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_event_handler.dir/gtest_dlt_daemon_event_handler.cpp.o.d"
+  "gtest_dlt_daemon_event_handler"
+  "gtest_dlt_daemon_event_handler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_daemon_event_handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_gateway.dir/gtest_dlt_daemon_gateway.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_gateway.dir/gtest_dlt_daemon_gateway.cpp.o.d"
+  "gtest_dlt_daemon_gateway"
+  "gtest_dlt_daemon_gateway.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_daemon_gateway.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_multiple_files_logging.dir/gtest_dlt_daemon_multiple_files_logging.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_multiple_files_logging.dir/gtest_dlt_daemon_multiple_files_logging.cpp.o.d"
+  "gtest_dlt_daemon_multiple_files_logging"
+  "gtest_dlt_daemon_multiple_files_logging.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_daemon_multiple_files_logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
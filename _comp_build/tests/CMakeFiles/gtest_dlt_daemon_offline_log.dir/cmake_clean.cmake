@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_offline_log.dir/gtest_dlt_daemon_offline_log.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_offline_log.dir/gtest_dlt_daemon_offline_log.cpp.o.d"
+  "gtest_dlt_daemon_offline_log"
+  "gtest_dlt_daemon_offline_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_daemon_offline_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt-daemon.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt-daemon.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_client.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_client.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_common.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_common.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_compression.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_compression.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_connection.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_connection.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_event_handler.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_event_handler.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_load_shedding.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_load_shedding.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_offline_logstorage.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_offline_logstorage.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_serial.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_serial.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_socket.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_socket.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_unix_socket.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/daemon/dlt_daemon_unix_socket.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/gateway/dlt_gateway.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/gateway/dlt_gateway.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/offlinelogstorage/dlt_offline_logstorage.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/offlinelogstorage/dlt_offline_logstorage.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/offlinelogstorage/dlt_offline_logstorage_behavior.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/offlinelogstorage/dlt_offline_logstorage_behavior.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/shared/dlt_config_file_parser.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/shared/dlt_config_file_parser.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/shared/dlt_offline_trace.c.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/__/src/shared/dlt_offline_trace.c.o.d"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/gtest_dlt_daemon_v2.cpp.o"
+  "CMakeFiles/gtest_dlt_daemon_v2.dir/gtest_dlt_daemon_v2.cpp.o.d"
+  "gtest_dlt_daemon_v2"
+  "gtest_dlt_daemon_v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gtest_dlt_daemon_v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
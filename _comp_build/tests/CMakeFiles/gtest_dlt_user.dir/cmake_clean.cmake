@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_user.dir/gtest_dlt_user.cpp.o"
+  "CMakeFiles/gtest_dlt_user.dir/gtest_dlt_user.cpp.o.d"
+  "gtest_dlt_user"
+  "gtest_dlt_user.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_user.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
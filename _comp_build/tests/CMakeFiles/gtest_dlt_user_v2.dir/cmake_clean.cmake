@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_user_v2.dir/gtest_dlt_user_v2.cpp.o"
+  "CMakeFiles/gtest_dlt_user_v2.dir/gtest_dlt_user_v2.cpp.o.d"
+  "gtest_dlt_user_v2"
+  "gtest_dlt_user_v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_user_v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
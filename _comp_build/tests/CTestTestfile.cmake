@@ -0,0 +1,33 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_comp_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[gtest_dlt_common]=] "/root/repo/_comp_build/tests/gtest_dlt_common")
+set_tests_properties([=[gtest_dlt_common]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_user]=] "/bin/sh" "-e" "-c" "sh /root/repo/_comp_build/tests/gtest_dlt_user.sh;TEST_FAILED=0;/root/repo/_comp_build/tests/gtest_dlt_user || TEST_FAILED=1;sleep 0.5;env  sh /root/repo/_comp_build/tests/gtest_dlt_teardown.sh || true;exit \$TEST_FAILED")
+set_tests_properties([=[gtest_dlt_user]=] PROPERTIES  ENVIRONMENT "PATH=/root/repo/_comp_build/src/daemon:/root/.rbenv/bin:/root/.rbenv/shims:/root/.dotnet:/usr/local/go/bin:/root/go/bin:/root/.pyenv/bin:/root/.pyenv/shims:/root/.cargo/bin:/root/miniconda/bin:/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin;DLT_UT_DAEMON_PATH=/root/repo/_comp_build/src/daemon/dlt-daemon;DLT_IPv6_LO=::1" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;154;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon")
+set_tests_properties([=[gtest_dlt_daemon]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_common]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon_common")
+set_tests_properties([=[gtest_dlt_daemon_common]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_common_v2]=] "/root/repo/_comp_build/tests/gtest_dlt_common_v2")
+set_tests_properties([=[gtest_dlt_common_v2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_user_v2]=] "/root/repo/_comp_build/tests/gtest_dlt_user_v2")
+set_tests_properties([=[gtest_dlt_user_v2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_v2]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon_v2")
+set_tests_properties([=[gtest_dlt_daemon_v2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_common_v2]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon_common_v2")
+set_tests_properties([=[gtest_dlt_daemon_common_v2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dlt_env_ll_unit_test]=] "/root/repo/_comp_build/tests/dlt_env_ll_unit_test")
+set_tests_properties([=[dlt_env_ll_unit_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;164;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_gateway]=] "/bin/sh" "-e" "-c" "sh /root/repo/_comp_build/tests/gtest_dlt_daemon_gateway.sh;TEST_FAILED=0;/root/repo/_comp_build/tests/gtest_dlt_daemon_gateway || TEST_FAILED=1;sleep 0.5;env  sh /root/repo/_comp_build/tests/gtest_dlt_teardown.sh || true;exit \$TEST_FAILED")
+set_tests_properties([=[gtest_dlt_daemon_gateway]=] PROPERTIES  ENVIRONMENT "PATH=/root/repo/_comp_build/src/daemon:/root/.rbenv/bin:/root/.rbenv/shims:/root/.dotnet:/usr/local/go/bin:/root/go/bin:/root/.pyenv/bin:/root/.pyenv/shims:/root/.cargo/bin:/root/miniconda/bin:/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin;DLT_UT_DAEMON_PATH=/root/repo/_comp_build/src/daemon/dlt-daemon;DLT_IPv6_LO=::1" TIMEOUT "5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;203;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_offline_log]=] "/bin/sh" "-e" "-c" "sh /root/repo/_comp_build/tests/gtest_dlt_daemon_offline_log.sh;TEST_FAILED=0;/root/repo/_comp_build/tests/gtest_dlt_daemon_offline_log || TEST_FAILED=1;sleep 0.5;env  sh /root/repo/_comp_build/tests/gtest_dlt_teardown.sh || true;exit \$TEST_FAILED")
+set_tests_properties([=[gtest_dlt_daemon_offline_log]=] PROPERTIES  ENVIRONMENT "PATH=/root/repo/_comp_build/src/daemon:/root/.rbenv/bin:/root/.rbenv/shims:/root/.dotnet:/usr/local/go/bin:/root/go/bin:/root/.pyenv/bin:/root/.pyenv/shims:/root/.cargo/bin:/root/miniconda/bin:/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin;DLT_UT_DAEMON_PATH=/root/repo/_comp_build/src/daemon/dlt-daemon;DLT_IPv6_LO=::1" TIMEOUT "5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;203;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_event_handler]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon_event_handler")
+set_tests_properties([=[gtest_dlt_daemon_event_handler]=] PROPERTIES  TIMEOUT "5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;213;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[gtest_dlt_daemon_multiple_files_logging]=] "/root/repo/_comp_build/tests/gtest_dlt_daemon_multiple_files_logging")
+set_tests_properties([=[gtest_dlt_daemon_multiple_files_logging]=] PROPERTIES  TIMEOUT "5" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;213;add_test;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("components")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components
+# Build directory: /root/repo/_comp_build/tests/components
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("logstorage")
+subdirs("dlt-logd-converter")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/android/dlt-logd-converter.cpp" "tests/components/dlt-logd-converter/CMakeFiles/gtest_dlt_logd_converter.dir/__/__/__/src/android/dlt-logd-converter.cpp.o" "gcc" "tests/components/dlt-logd-converter/CMakeFiles/gtest_dlt_logd_converter.dir/__/__/__/src/android/dlt-logd-converter.cpp.o.d"
+  "/root/repo/tests/components/dlt-logd-converter/gtest_dlt_logd_converter.cpp" "tests/components/dlt-logd-converter/CMakeFiles/gtest_dlt_logd_converter.dir/gtest_dlt_logd_converter.cpp.o" "gcc" "tests/components/dlt-logd-converter/CMakeFiles/gtest_dlt_logd_converter.dir/gtest_dlt_logd_converter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_dlt_logd_converter.dir/__/__/__/src/android/dlt-logd-converter.cpp.o"
+  "CMakeFiles/gtest_dlt_logd_converter.dir/__/__/__/src/android/dlt-logd-converter.cpp.o.d"
+  "CMakeFiles/gtest_dlt_logd_converter.dir/gtest_dlt_logd_converter.cpp.o"
+  "CMakeFiles/gtest_dlt_logd_converter.dir/gtest_dlt_logd_converter.cpp.o.d"
+  "gtest_dlt_logd_converter"
+  "gtest_dlt_logd_converter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_dlt_logd_converter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/dlt-logd-converter
+# Build directory: /root/repo/_comp_build/tests/components/dlt-logd-converter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[gtest_dlt_logd_converter]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/dlt-logd-converter/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/dlt-logd-converter/gtest_dlt_logd_converter")
+set_tests_properties([=[gtest_dlt_logd_converter]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" _BACKTRACE_TRIPLES "/root/repo/tests/components/dlt-logd-converter/CMakeLists.txt;13;add_test;/root/repo/tests/components/dlt-logd-converter/CMakeLists.txt;0;")
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage
+# Build directory: /root/repo/_comp_build/tests/components/logstorage
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("logstorage_filepath")
+subdirs("logstorage_multi_file")
+subdirs("logstorage_one_file")
+subdirs("logstorage_max_cache_size")
+subdirs("logstorage_fsync")
+subdirs("disable_network")
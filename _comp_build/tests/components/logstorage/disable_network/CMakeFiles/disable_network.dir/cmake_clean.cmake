@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/disable_network.dir/disable_network.cpp.o"
+  "CMakeFiles/disable_network.dir/disable_network.cpp.o.d"
+  "disable_network"
+  "disable_network.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/disable_network.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/disable_network
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/disable_network
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[disable_network]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/disable_network/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/src/console/dlt-receive" "/root/repo/_comp_build/tests/components/logstorage/disable_network/disable_network" "2" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[disable_network]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" FAIL_REGULAR_EXPRESSION "Result from network.*ECU1 DSNW CT01 log info V 4 \\[Log message 1 #.*Result from file.*ECU1 DSNW CT02 log info V 4 \\[Log message 2 #.*" PASS_REGULAR_EXPRESSION "(Result from network.*ECU1 DSNW CT02 log info V 4 \\[Log message 2 # [0-9]+\\].*ECU1 DSNW CT02 log info V 4 \\[Log message 2 # [0-9]+\\].*Result from file.*ECU1 DSNW CT01 log info V 4 \\[Log message 1 # [0-9]+\\].*ECU1 DSNW CT01 log info V 4 \\[Log message 1 # [0-9]+\\].*)|(Result from file.*ECU1 DSNW CT01 log info V 4 \\[Log message 1 # [0-9]+\\].*ECU1 DSNW CT01 log info V 4 \\[Log message 1 # [0-9]+\\].*Result from network.*ECU1 DSNW CT02 log info V 4 \\[Log message 2 # [0-9]+\\].*ECU1 DSNW CT02 log info V 4 \\[Log message 2 # [0-9]+\\].*)" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/disable_network/CMakeLists.txt;17;add_test;/root/repo/tests/components/logstorage/disable_network/CMakeLists.txt;0;")
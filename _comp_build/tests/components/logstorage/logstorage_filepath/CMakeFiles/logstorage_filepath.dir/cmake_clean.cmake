@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logstorage_filepath.dir/logstorage_filepath.cpp.o"
+  "CMakeFiles/logstorage_filepath.dir/logstorage_filepath.cpp.o.d"
+  "logstorage_filepath"
+  "logstorage_filepath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstorage_filepath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/logstorage_filepath
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/logstorage_filepath
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[logstorage_filepath]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/logstorage_filepath/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/logstorage/logstorage_filepath/logstorage_filepath" "2" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[logstorage_filepath]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" FAIL_REGULAR_EXPRESSION "FPTH_FAIL.dlt existsECU1 FPTH CT01 log info V 4 \\[Log message 1" PASS_REGULAR_EXPRESSION "Skip filename \\[aa/FPTH_FAIL\\] because maxmimum trial has been reached..*FPTH_OK.dlt exists.*ECU1 FPTH CT02 log info V 4 \\[Log message 2 # [0-9]+\\]" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/logstorage_filepath/CMakeLists.txt;17;add_test;/root/repo/tests/components/logstorage/logstorage_filepath/CMakeLists.txt;0;")
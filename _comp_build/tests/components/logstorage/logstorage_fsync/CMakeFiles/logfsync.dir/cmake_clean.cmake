@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logfsync.dir/logfsync.cpp.o"
+  "CMakeFiles/logfsync.dir/logfsync.cpp.o.d"
+  "liblogfsync.pdb"
+  "liblogfsync.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logfsync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logstorage_fsync.dir/logstorage_fsync.cpp.o"
+  "CMakeFiles/logstorage_fsync.dir/logstorage_fsync.cpp.o.d"
+  "logstorage_fsync"
+  "logstorage_fsync.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstorage_fsync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
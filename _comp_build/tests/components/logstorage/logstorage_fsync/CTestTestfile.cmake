@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/logstorage_fsync
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/logstorage_fsync
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[logstorage_fsync]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/logstorage_fsync/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/logstorage/logstorage_fsync/logstorage_fsync" "1" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[logstorage_fsync]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=;LD_PRELOAD=/root/repo/_comp_build/tests/components/logstorage/logstorage_fsync/liblogfsync.so" PASS_REGULAR_EXPRESSION "fsync" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/logstorage_fsync/CMakeLists.txt;24;add_test;/root/repo/tests/components/logstorage/logstorage_fsync/CMakeLists.txt;0;")
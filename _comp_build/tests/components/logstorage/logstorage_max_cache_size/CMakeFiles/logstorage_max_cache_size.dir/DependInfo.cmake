@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/components/logstorage/logstorage_max_cache_size/logstorage_max_cache_size.cpp" "tests/components/logstorage/logstorage_max_cache_size/CMakeFiles/logstorage_max_cache_size.dir/logstorage_max_cache_size.cpp.o" "gcc" "tests/components/logstorage/logstorage_max_cache_size/CMakeFiles/logstorage_max_cache_size.dir/logstorage_max_cache_size.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_comp_build/src/lib/CMakeFiles/dlt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
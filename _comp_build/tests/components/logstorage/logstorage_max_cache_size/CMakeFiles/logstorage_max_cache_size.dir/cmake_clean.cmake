@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logstorage_max_cache_size.dir/logstorage_max_cache_size.cpp.o"
+  "CMakeFiles/logstorage_max_cache_size.dir/logstorage_max_cache_size.cpp.o.d"
+  "logstorage_max_cache_size"
+  "logstorage_max_cache_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstorage_max_cache_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/logstorage_max_cache_size
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/logstorage_max_cache_size
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[logstorage_max_cache_size]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/logstorage_max_cache_size/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/logstorage/logstorage_max_cache_size/logstorage_max_cache_size" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[logstorage_max_cache_size]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" PASS_REGULAR_EXPRESSION "Max size of Logstorage Cache already used" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/logstorage_max_cache_size/CMakeLists.txt;15;add_test;/root/repo/tests/components/logstorage/logstorage_max_cache_size/CMakeLists.txt;0;")
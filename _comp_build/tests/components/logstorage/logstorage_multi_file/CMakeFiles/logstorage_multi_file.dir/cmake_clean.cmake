@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logstorage_multi_file.dir/logstorage_multi_file.cpp.o"
+  "CMakeFiles/logstorage_multi_file.dir/logstorage_multi_file.cpp.o.d"
+  "logstorage_multi_file"
+  "logstorage_multi_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstorage_multi_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
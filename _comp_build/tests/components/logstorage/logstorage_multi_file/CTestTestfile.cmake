@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/logstorage_multi_file
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/logstorage_multi_file
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[logstorage_multi_file]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/logstorage_multi_file/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/logstorage/logstorage_multi_file/logstorage_multi_file" "/root/repo/_comp_build/src/console/logstorage/dlt-logstorage-ctrl" "12" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[logstorage_multi_file]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" FAIL_REGULAR_EXPRESSION "MLTI.*.dlt is bigger than 1000" PASS_REGULAR_EXPRESSION "dlt_logstorage_open_log_file: logstorage limit reached, stopping capture for filter: MLTIS" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/logstorage_multi_file/CMakeLists.txt;17;add_test;/root/repo/tests/components/logstorage/logstorage_multi_file/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logstorage_one_file.dir/logstorage_one_file.cpp.o"
+  "CMakeFiles/logstorage_one_file.dir/logstorage_one_file.cpp.o.d"
+  "logstorage_one_file"
+  "logstorage_one_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logstorage_one_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/components/logstorage/logstorage_one_file
+# Build directory: /root/repo/_comp_build/tests/components/logstorage/logstorage_one_file
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[logstorage_one_file]=] "/bin/sh" "-e" "/root/repo/_comp_build/tests/components/logstorage/logstorage_one_file/run_test.sh" "/root/repo/_comp_build/src/daemon/dlt-daemon" "/root/repo/_comp_build/tests/components/logstorage/logstorage_one_file/logstorage_one_file" "12" "/root/repo/_comp_build/src/console/dlt-convert")
+set_tests_properties([=[logstorage_one_file]=] PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=" FAIL_REGULAR_EXPRESSION "LONE.*.dlt is bigger than 2000" PASS_REGULAR_EXPRESSION "dlt_logstorage_open_log_file: logstorage limit reached, stopping capture for filter: LONE" _BACKTRACE_TRIPLES "/root/repo/tests/components/logstorage/logstorage_one_file/CMakeLists.txt;18;add_test;/root/repo/tests/components/logstorage/logstorage_one_file/CMakeLists.txt;0;")
@@ -75,6 +75,7 @@
 
 #   include "dlt_types.h"
 #   include "dlt_common.h"
+#   include "dlt_filter_engine.h"
 #include <stdbool.h>
 
 // DLTV2 - Definitions for DLT Version 2
@@ -109,6 +110,53 @@ typedef struct
     int resync_serial_header;  /**< (Boolean) Resync to serial header on all connection */
 } DltClient;
 
+struct addrinfo;
+
+/**
+ * Addresses of a connection started with dlt_client_connect_start(). The
+ * structure is owned by the caller and has to be zero initialised.
+ */
+typedef struct
+{
+    struct addrinfo *addrinfo;      /**< addresses of the host, NULL if no connection is in progress */
+    struct addrinfo *addrinfo_next; /**< address tried when the connection in progress fails */
+} DltClientConnectState;
+
+/**
+ * Callback of a client stream, called with a batch of received messages.
+ * The views point into the receive buffer of the stream and are only valid
+ * until the callback returns. They have no storage header.
+ * @param client client the messages were received from
+ * @param views views of the messages
+ * @param count number of views
+ * @param data pointer given to dlt_client_stream_init()
+ * @return 0 to continue receiving, any other value to stop
+ */
+typedef int (*DltClientStreamCallback)(DltClient *client, const DltMessageView *views, uint32_t count, void *data);
+
+/**
+ * Zero-copy receiver of a client. Unlike dlt_client_main_loop(), messages
+ * are not copied into a DltMessage but delivered in batches as views into
+ * the receive buffer, and each stream has its own callback, so several
+ * clients can be handled independently in one process.
+ * Only DLT version 1 messages are supported.
+ */
+typedef struct
+{
+    DltClient *client;                /**< client the stream receives from */
+    DltClientStreamCallback callback; /**< callback for the received messages */
+    void *data;                       /**< pointer passed to the callback */
+    uint8_t *buffer;                  /**< receive buffer */
+    uint32_t size;                    /**< size of receive buffer */
+    uint32_t start;                   /**< offset of the first byte not yet parsed */
+    uint32_t end;                     /**< offset of the end of the received data */
+    DltMessageView *views;            /**< views of the current batch */
+    uint32_t batch_max;               /**< maximum number of views in one batch */
+    uint64_t bytes;                   /**< number of received bytes */
+    uint64_t messages;                /**< number of delivered messages */
+    uint64_t skipped;                 /**< number of bytes skipped while resyncing */
+} DltClientStream;
+
 #   ifdef __cplusplus
 extern "C" {
 #   endif
@@ -144,6 +192,38 @@ DltReturnValue dlt_client_init(DltClient *client, int verbose);
  */
 DltReturnValue dlt_client_connect(DltClient *client, int verbose);
 
+/**
+ * Start to connect a dlt client without waiting for the connection to be
+ * established. Only TCP connections are made without waiting, the other modes
+ * are connected like with dlt_client_connect().
+ * @param client pointer to dlt client structure
+ * @param state addresses of the connection, kept until it is established or failed
+ * @param verbose if set to true verbose information is printed out.
+ * @return DLT_RETURN_OK if connected, DLT_RETURN_TRUE if the connection is in
+ * progress and has to be completed with dlt_client_connect_finish(),
+ * negative value if there was an error
+ */
+DltReturnValue dlt_client_connect_start(DltClient *client, DltClientConnectState *state, int verbose);
+
+/**
+ * Check if a connection started with dlt_client_connect_start() is established.
+ * Does not wait. The socket is closed if the connection failed, and the
+ * connection to the next address of the host is started if there is one.
+ * @param client pointer to dlt client structure
+ * @param state addresses of the connection, see dlt_client_connect_start()
+ * @param verbose if set to true verbose information is printed out.
+ * @return DLT_RETURN_OK if connected, DLT_RETURN_TRUE if the connection is
+ * still in progress, negative value if there was an error
+ */
+DltReturnValue dlt_client_connect_finish(DltClient *client, DltClientConnectState *state, int verbose);
+
+/**
+ * Free the addresses of a connection in progress, e.g. when it is given up.
+ * The socket of the client is not closed.
+ * @param state addresses of the connection, see dlt_client_connect_start()
+ */
+void dlt_client_connect_free(DltClientConnectState *state);
+
 /**
  * Cleanup dlt client structure
  * @param client pointer to dlt client structure
@@ -400,6 +480,74 @@ DltReturnValue dlt_client_send_all_trace_status(DltClient *client, uint8_t trace
  */
 DltReturnValue dlt_client_send_all_trace_status_v2(DltClient *client, uint8_t traceStatus);
 
+/**
+ * Send a filter to the dlt daemon. The daemon then only sends the messages
+ * matching the application id, context id, log level and message type of
+ * one of the rules to this client. Other conditions of the rules are not
+ * sent and have to be checked by the client.
+ * @param client pointer to dlt client structure
+ * @param engine rules of the filter to be set, NULL or empty to receive all messages again
+ * @return Value from DltReturnValue enum
+ */
+DltReturnValue dlt_client_send_client_filter(DltClient *client, const DltFilterEngine *engine);
+
+/**
+ * Ask the dlt daemon to compress everything it sends to this client after
+ * the response. The stream then consists of frames as described by
+ * DltServiceSetStreamCompression, which the client has to decompress.
+ * @param client pointer to dlt client structure
+ * @param method DLT_STREAM_COMPRESSION_ZLIB, or DLT_STREAM_COMPRESSION_NONE to stop compression
+ * @param level compression level, 1 (fastest) to 9 (best)
+ * @param batch_size maximum number of message bytes per frame, 0 for the default of the daemon
+ * @return Value from DltReturnValue enum
+ */
+DltReturnValue dlt_client_send_stream_compression(DltClient *client, uint8_t method, uint8_t level,
+                                                  uint32_t batch_size);
+
+/**
+ * Initialise a stream receiving from a connected client.
+ * @param stream pointer to stream structure
+ * @param client connected dlt client, see dlt_client_connect()
+ * @param buffer_size size of the receive buffer, 0 for DLT_CLIENT_STREAM_BUFFER_SIZE
+ * @param batch_max maximum number of messages per callback, 0 for DLT_CLIENT_STREAM_BATCH_MAX
+ * @param callback callback for the received messages
+ * @param data pointer to data to be provided to the callback
+ * @return Value from DltReturnValue enum
+ */
+DltReturnValue dlt_client_stream_init(DltClientStream *stream,
+                                      DltClient *client,
+                                      uint32_t buffer_size,
+                                      uint32_t batch_max,
+                                      DltClientStreamCallback callback,
+                                      void *data);
+
+/**
+ * Release the buffers of a stream. The client is not closed.
+ * @param stream pointer to stream structure
+ * @return Value from DltReturnValue enum
+ */
+DltReturnValue dlt_client_stream_free(DltClientStream *stream);
+
+/**
+ * Receive once from the client of a stream and deliver all complete messages
+ * to the callback. Blocks if the client has no data, so it can be called
+ * when poll() or epoll reports the client socket as readable.
+ * @param stream pointer to stream structure
+ * @param verbose if set to true verbose information is printed out.
+ * @return DLT_RETURN_TRUE to continue, DLT_RETURN_OK if the connection was
+ * closed or the callback requested to stop, negative value if there was an error
+ */
+DltReturnValue dlt_client_stream_process(DltClientStream *stream, int verbose);
+
+/**
+ * Receive from the client of a stream until the connection is closed or
+ * the callback requests to stop.
+ * @param stream pointer to stream structure
+ * @param verbose if set to true verbose information is printed out.
+ * @return Value from DltReturnValue enum
+ */
+DltReturnValue dlt_client_stream_loop(DltClientStream *stream, int verbose);
+
 /**
  * Send the timing pakets status to the dlt daemon
  * @param client pointer to dlt client structure
@@ -474,6 +474,11 @@ extern const char dltSerialHeader[DLT_ID_SIZE];
  */
 extern char dltSerialHeaderChar[DLT_ID_SIZE];
 
+/**
+ * The definition of the UDP datagram header pattern containing the characters "DLU" + 0x01.
+ */
+extern const char dltUdpDatagramHeader[DLT_ID_SIZE];
+
 #if defined DLT_DAEMON_USE_FIFO_IPC || defined DLT_LIB_USE_FIFO_IPC
 /**
  * The common base-path of the dlt-daemon-fifo and application-generated fifos
@@ -534,6 +539,16 @@ typedef struct
     char ecid[DLT_V2_ID_SIZE]; /**< ECU id v2 */
 } DLT_PACKED DltStorageHeaderV2;
 
+/**
+ * The structure of the DLT UDP datagram header. If enabled, the daemon puts it in front
+ * of every multicast datagram, which carries one or more complete DLT messages.
+ */
+typedef struct
+{
+    char pattern[DLT_ID_SIZE]; /**< This pattern should be DLU0x01 */
+    uint32_t sequence;         /**< Datagram sequence number in big endian, to detect lost datagrams */
+} DLT_PACKED DltUdpDatagramHeader;
+
 /**
  * The structure of the DLT standard header. This header is used in each DLT message.
  */
@@ -928,10 +943,49 @@ typedef struct
     char node_id[DLT_ENTRY_MAX];               /**< list of passive node IDs */
 } DLT_PACKED DltServicePassiveNodeConnectionInfo;
 
+/**
+ * The structure of the DLT Service Set Client Filter.
+ * It is followed by count DltServiceClientFilterRule.
+ */
+typedef struct
+{
+    uint32_t service_id;            /**< service ID */
+    uint16_t count;                 /**< number of rules, 0 removes the filter */
+} DLT_PACKED DltServiceSetClientFilter;
+
+/**
+ * One rule of the DLT Service Set Client Filter.
+ */
+typedef struct
+{
+    char apid[DLT_ID_SIZE];         /**< application id, empty for all */
+    char ctid[DLT_ID_SIZE];         /**< context id, empty for all */
+    uint8_t log_level;              /**< log level, 0 for all */
+    uint8_t message_types;          /**< bit mask of the message types (1 << DLT_TYPE_*), 0 for all */
+} DLT_PACKED DltServiceClientFilterRule;
+
+/* Compression methods of the DLT Service Set Stream Compression */
+#define DLT_STREAM_COMPRESSION_NONE 0   /**< messages are sent as they are */
+#define DLT_STREAM_COMPRESSION_ZLIB 1   /**< batches of messages are sent as zlib compressed frames */
+
+/**
+ * The structure of the DLT Service Set Stream Compression.
+ * After the response with status OK, everything the daemon sends on the
+ * connection is framed and compressed.
+ */
+typedef struct
+{
+    uint32_t service_id;            /**< service ID */
+    uint8_t method;                 /**< DLT_STREAM_COMPRESSION_* */
+    uint8_t level;                  /**< compression level, 1 (fastest) to 9 (best) */
+    uint32_t batch_size;            /**< maximum number of message bytes per frame, 0 for default */
+} DLT_PACKED DltServiceSetStreamCompression;
+
 /**
  * Structure to store filter parameters.
  * ID are maximal four characters. Unused values are filled with zeros.
  * If every value as filter is valid, the id should be empty by having only zero values.
+ * For more rules, or to check many messages, see the filter engine in dlt_filter_engine.h.
  */
 typedef struct
 {
@@ -974,8 +1028,40 @@ typedef struct sDltFile
     /* current loaded message */
     DltMessage msg;     /**< pointer to message */
     DltMessageV2 msgv2; /**< pointer to v2 message */
+
+    /* state private to libdlt, e.g. the mapping of dlt_file_open_mmap() */
+    struct sDltFilePrivate *priv; /**< allocated on demand, released by dlt_file_free() */
 } DltFile;
 
+/**
+ * Zero-copy view of a message in a memory mapped DLT file or in the receive
+ * buffer of a client stream.
+ * For files all pointers refer to the mapping and stay valid until the file is
+ * closed or grows and is remapped by a following read. Messages received from
+ * a stream have no storage header.
+ */
+typedef struct
+{
+    uint64_t offset;                          /**< file or stream offset of the message including storage header */
+    const uint8_t *header;                    /**< start of the message including storage header if available */
+    int32_t headersize;                       /**< size of complete header including storage header if available */
+    const uint8_t *payload;                   /**< start of the payload */
+    int32_t datasize;                         /**< size of the payload */
+    const DltStorageHeader *storageheader;    /**< pointer to storage header, NULL if not available */
+    const DltStandardHeader *standardheader;  /**< pointer to standard header */
+    DltStandardHeaderExtra headerextra;       /**< extra parameters of the standard header in host byte order */
+    const DltExtendedHeader *extendedheader;  /**< pointer to extended header, NULL if not available */
+} DltMessageView;
+
+/**
+ * Sequential iterator over the messages of a memory mapped DLT file.
+ */
+typedef struct
+{
+    DltFile *file;      /**< file to iterate */
+    uint64_t position;  /**< file offset at which the next message is searched */
+} DltFileIterator;
+
 /**
  * The structure is used to organise the receiving of data
  * including buffer handling.
@@ -1051,9 +1137,9 @@ extern "C"
 /* For trace load control */
 
 /**
- * Number of slots in window for recording trace load (Default: 60)
+ * Size of the window for recording trace load in slots (Default: 60)
  * Average trace load in this window will be used as trace load
- * Older time data than this size will be removed from trace load
+ * Trace load older than this decays out of the window
  */
 #define DLT_TRACE_LOAD_WINDOW_SIZE        (60)
 
@@ -1096,18 +1182,18 @@ extern "C"
 
 typedef struct
 {
-    // Window for recording total bytes for each slots [bytes]
-    uint64_t window[DLT_TRACE_LOAD_WINDOW_SIZE];
-    uint64_t total_bytes_of_window;         // Grand total bytes of whole window [bytes]
-    uint32_t curr_slot;                     // Current slot No. of window [slot No.]
-    uint32_t last_slot;                     // Last slot No. of window [slot No.]
-    uint32_t curr_abs_slot;                 // Current absolute slot No. of window [slot No.]
-    uint32_t last_abs_slot;                 // Last absolute slot No. of window [slot No.]
+    /* Trace load of the window, updated lock-free with one compare-and-swap:
+     * time of the last update in 6.4 msec units in the upper 26 bits, bytes of the window in
+     * the lower 38 bits, so that hard limits up to UINT32_MAX bytes/sec can be reached.
+     * The bytes decay linearly with the time passed, relative to the window size, so that
+     * bytes / window size is the average trace load. dlt_check_trace_load() accesses the
+     * fields with atomic operations, so it can be called from several threads at once. */
+    uint64_t window_load;
     uint64_t avg_trace_load;                // Average trace load of whole window [bytes/sec]
     uint32_t hard_limit_over_counter;       // Discarded message counter due to hard limit over [msg]
     uint32_t hard_limit_over_bytes;         // Discarded message bytes due to hard limit over [msg]
-    uint32_t slot_left_soft_limit_warn;     // Slot left to output next warning of soft limit over [slot No.]
-    uint32_t slot_left_hard_limit_warn;     // Slot left to output next warning of hard limit over [slot No.]
+    uint32_t last_soft_limit_warn;          // Timestamp of the last warning of soft limit over, 0 if none
+    uint32_t last_hard_limit_warn;          // Timestamp of the last warning of hard limit over, 0 if none
     bool is_over_soft_limit;                // Flag if trace load has been over soft limit
     bool is_over_hard_limit;                // Flag if trace load has been over hard limit
 } DltTraceLoadStat;
@@ -1136,7 +1222,7 @@ extern pthread_rwlock_t trace_load_rw_lock;
 #endif
 
 /* Precomputation  */
-static const uint64_t TIMESTAMP_BASED_WINDOW_SIZE = DLT_TRACE_LOAD_WINDOW_SIZE * DLT_TRACE_LOAD_WINDOW_RESOLUTION;
+static const uint64_t TIMESTAMP_BASED_WINDOW_SIZE = (uint64_t)DLT_TRACE_LOAD_WINDOW_SIZE * DLT_TRACE_LOAD_WINDOW_RESOLUTION;
 typedef DltReturnValue (DltLogInternal)(DltLogLevelType loglevel, const char *text, void* params);
 
 /**
@@ -1637,6 +1723,8 @@ DltReturnValue dlt_file_init_v2(DltFile *file, int verbose);
  * This function should be called before loading a DLT file, if filters should be used.
  * A filter list is an array of filters. Several filters are combined logically by or operation.
  * The filter list is not copied, so take care to keep list in memory.
+ * The filter is compiled when it is set, see dlt_filter_compile(). If the filter
+ * is changed afterwards, its rules are checked one by one.
  * @param file pointer to structure of organising access to DLT file
  * @param filter pointer to filter list array
  * @param verbose if set to true verbose information is printed out.
@@ -1756,6 +1844,85 @@ DltReturnValue dlt_file_free(DltFile *file, int verbose);
  */
 DltReturnValue dlt_file_free_v2(DltFile *file, int verbose);
 
+/**
+ * Open a DLT file and map its content into memory.
+ * All following calls of dlt_file_read() and dlt_file_message() parse the
+ * messages directly from the mapping instead of using stdio, and
+ * dlt_file_message() extends the index on demand, so the file does not need
+ * to be read completely before accessing a message. If the file grows, the
+ * mapping is renewed when the end of the mapped content is reached.
+ * Empty files and files which cannot be mapped are read with stdio.
+ * @param file pointer to structure of organising access to DLT file
+ * @param filename filename of file to be opened
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_open_mmap(DltFile *file, const char *filename, int verbose);
+
+/**
+ * Check if the content of a DLT file is memory mapped, see dlt_file_open_mmap().
+ * @param file pointer to structure of organising access to DLT file
+ * @return DLT_RETURN_TRUE if the file is mapped, DLT_RETURN_OK if it is read with stdio, negative value if there was an error
+ */
+DltReturnValue dlt_file_is_mapped(const DltFile *file);
+
+/**
+ * Build the index of all messages of an opened DLT file.
+ * The result is the same as calling dlt_file_read() until the end of the
+ * file, including the set filter. For memory mapped files the file is split
+ * into chunks which are parsed by several threads.
+ * @param file pointer to structure of organising access to DLT file
+ * @param threads number of threads to be used, 0 for number of online CPUs
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_build_index(DltFile *file, int threads, int verbose);
+
+/**
+ * Get a zero-copy view of a message of a memory mapped file selected by the index.
+ * If filters are set, index is based on the filtered list.
+ * Messages which are already indexed are accessed without changing the file
+ * structure, so several threads can take views once the index is built.
+ * @param file pointer to structure of organising access to DLT file
+ * @param index position of message in the files beginning from zero
+ * @param view view to be filled
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_message_view(DltFile *file, int index, DltMessageView *view, int verbose);
+
+/**
+ * Initialise an iterator over the messages of a memory mapped file.
+ * @param iterator pointer to iterator
+ * @param file opened file, see dlt_file_open_mmap()
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_iterator_init(DltFileIterator *iterator, DltFile *file);
+
+/**
+ * Get a zero-copy view of the next message of a memory mapped file.
+ * Messages not matching the filter of the file are skipped. The index of
+ * the file is not changed.
+ * @param iterator pointer to iterator
+ * @param view view to be filled
+ * @param verbose if set to true verbose information is printed out.
+ * @return DLT_RETURN_TRUE if a message was found, DLT_RETURN_OK at the end of the file, negative value if there was an error
+ */
+DltReturnValue dlt_file_iterator_next(DltFileIterator *iterator, DltMessageView *view, int verbose);
+
+/**
+ * Copy headers and payload of a message view into a message structure,
+ * e.g. to format it with dlt_message_header() and dlt_message_payload().
+ * The payload buffer of the message is reused if it is big enough.
+ * If the view has no storage header, the storage header of the message is
+ * cleared and can be set with dlt_set_storageheader().
+ * @param msg pointer to message to be filled
+ * @param view view of the message
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_message_copy_view(DltMessage *msg, const DltMessageView *view, int verbose);
+
 #if defined DLT_DAEMON_USE_FIFO_IPC || defined DLT_LIB_USE_FIFO_IPC
 /**
  * Set FIFO base direction
@@ -1870,6 +2037,34 @@ DltReturnValue dlt_check_storageheader(DltStorageHeader *storageheader);
  */
 DltReturnValue dlt_check_storageheader_v2(DltStorageHeaderV2 *storageheader);
 
+/**
+ * Find the first occurrence of a byte pattern in a memory buffer.
+ * This is used to resync to a storage, serial or user header after corrupted data.
+ * Depending on the target, the search is vectorized with SSE2, AVX2 or NEON.
+ * @param buffer pointer to memory buffer
+ * @param length length of the memory buffer
+ * @param pattern pointer to the pattern
+ * @param pattern_length length of the pattern
+ * @return pointer to the first occurrence in buffer, NULL if the pattern is not found
+ */
+const uint8_t *dlt_find_pattern(const uint8_t *buffer,
+                                size_t length,
+                                const uint8_t *pattern,
+                                size_t pattern_length);
+
+/**
+ * Find the last occurrence of a byte pattern in a memory buffer.
+ * @param buffer pointer to memory buffer
+ * @param length length of the memory buffer
+ * @param pattern pointer to the pattern
+ * @param pattern_length length of the pattern
+ * @return pointer to the last occurrence in buffer, NULL if the pattern is not found
+ */
+const uint8_t *dlt_find_last_pattern(const uint8_t *buffer,
+                                     size_t length,
+                                     const uint8_t *pattern,
+                                     size_t pattern_length);
+
 /**
  * Checks if received size is big enough for expected data
  * @param received size
@@ -0,0 +1,234 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_file_index.h
+ */
+
+
+#ifndef DLT_FILE_INDEX_H
+#define DLT_FILE_INDEX_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "dlt_common.h"
+#include "dlt_filter_engine.h"
+#include "dlt_types.h"
+
+/*
+ * A DLT file index is a sidecar file (<dltfile>.idx) written next to a
+ * plain DLT file. It splits the DLT file into blocks of a configurable
+ * number of messages or bytes and stores, for every block, its offset,
+ * the time range covered by the storage headers and a bloom filter of the
+ * application and context ids. Readers use it to seek directly to the
+ * blocks that may contain a requested time window or id.
+ *
+ * All values in the index file are stored in little endian byte order.
+ */
+
+#define DLT_FILE_INDEX_EXTENSION ".idx"
+#define DLT_FILE_INDEX_MAGIC "DLTI"
+#define DLT_FILE_INDEX_VERSION 1
+
+#define DLT_FILE_INDEX_BLOOM_SIZE 32 /**< size of the id bloom filter in bytes (256 bits) */
+
+#define DLT_FILE_INDEX_DEFAULT_BLOCK_MESSAGES 1000
+#define DLT_FILE_INDEX_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/* Block contains messages without extended header, which match every filter */
+#define DLT_FILE_INDEX_FLAG_NO_EXTHEADER 0x01
+
+/**
+ * Header at the beginning of every index file.
+ */
+typedef struct
+{
+    char magic[DLT_ID_SIZE];  /**< DLT_FILE_INDEX_MAGIC */
+    uint8_t version;          /**< DLT_FILE_INDEX_VERSION */
+    uint8_t reserved[3];
+    uint32_t block_messages;  /**< maximum number of messages per block */
+    uint32_t block_size;      /**< maximum number of bytes per block */
+} DLT_PACKED DltFileIndexHeader;
+
+/**
+ * One block of the indexed DLT file.
+ */
+typedef struct
+{
+    uint64_t offset;            /**< file offset of the first message of the block */
+    uint32_t size;              /**< number of bytes covered by the block */
+    uint32_t messages;          /**< number of messages in the block */
+    uint32_t min_seconds;       /**< earliest storage header time of the block */
+    int32_t min_microseconds;
+    uint32_t max_seconds;       /**< latest storage header time of the block */
+    int32_t max_microseconds;
+    uint32_t first_timestamp;   /**< timestamp of the first message (0.1 ms since ECU start) */
+    uint32_t last_timestamp;    /**< timestamp of the last message (0.1 ms since ECU start) */
+    uint32_t flags;             /**< DLT_FILE_INDEX_FLAG_* */
+    uint8_t id_bloom[DLT_FILE_INDEX_BLOOM_SIZE]; /**< bloom filter of apids and ctids */
+} DLT_PACKED DltFileIndexEntry;
+
+/**
+ * Writer state used while a DLT file is written.
+ */
+typedef struct
+{
+    FILE *handle;               /**< handle of the index file */
+    uint32_t block_messages;    /**< maximum number of messages per block */
+    uint32_t block_size;        /**< maximum number of bytes per block */
+    DltFileIndexEntry block;    /**< block currently being collected */
+} DltFileIndexWriter;
+
+/**
+ * Index loaded from a sidecar file.
+ */
+typedef struct
+{
+    DltFileIndexHeader header;
+    DltFileIndexEntry *entries; /**< blocks in file order */
+    uint32_t count;             /**< number of blocks */
+} DltFileIndex;
+
+#   ifdef __cplusplus
+extern "C"
+{
+#   endif
+
+/**
+ * Build the name of the index file belonging to a DLT file.
+ * @param dlt_filename name of the DLT file
+ * @param index_filename buffer for the resulting name
+ * @param size size of index_filename
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_filename(const char *dlt_filename, char *index_filename, size_t size);
+
+/**
+ * Create the index file for a DLT file which is about to be written.
+ * An existing index file is truncated.
+ * @param writer pointer to writer structure
+ * @param dlt_filename name of the DLT file, the index is stored next to it
+ * @param block_messages maximum number of messages per block, 0 for default
+ * @param block_size maximum number of bytes per block, 0 for default
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_writer_init(DltFileIndexWriter *writer,
+                                          const char *dlt_filename,
+                                          uint32_t block_messages,
+                                          uint32_t block_size);
+
+/**
+ * Account one message which was written to the DLT file.
+ * The storage header of the message must already be set.
+ * @param writer pointer to writer structure
+ * @param offset file offset at which the message (including storage header) was written
+ * @param msg the written message
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_writer_add(DltFileIndexWriter *writer, uint64_t offset, const DltMessage *msg);
+
+/**
+ * Write the pending block, if any, to the index file and flush it.
+ * @param writer pointer to writer structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_writer_flush(DltFileIndexWriter *writer);
+
+/**
+ * Flush the pending block and close the index file.
+ * @param writer pointer to writer structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_writer_free(DltFileIndexWriter *writer);
+
+/**
+ * Create the index file for an already existing DLT file.
+ * @param dlt_filename name of the DLT file
+ * @param block_messages maximum number of messages per block, 0 for default
+ * @param block_size maximum number of bytes per block, 0 for default
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_build(const char *dlt_filename,
+                                    uint32_t block_messages,
+                                    uint32_t block_size,
+                                    int verbose);
+
+/**
+ * Load the index file belonging to a DLT file.
+ * @param index pointer to index structure
+ * @param dlt_filename name of the DLT file
+ * @return negative value if there was an error or no valid index exists
+ */
+DltReturnValue dlt_file_index_load(DltFileIndex *index, const char *dlt_filename);
+
+/**
+ * Release the memory of a loaded index.
+ * @param index pointer to index structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_index_free(DltFileIndex *index);
+
+/**
+ * Get the storage header time of a message in microseconds since 1.1.1970.
+ * @param msg pointer to message
+ * @return time in microseconds
+ */
+uint64_t dlt_file_index_message_time(const DltMessage *msg);
+
+/**
+ * Check if a block may contain messages within a time window which pass a filter.
+ * @param entry block to check
+ * @param begin start of time window in microseconds since 1.1.1970
+ * @param end end of time window in microseconds since 1.1.1970, 0 for open end
+ * @param engine compiled filter to check the id bloom filter against, NULL for none
+ * @return true if the block has to be read
+ */
+bool dlt_file_index_entry_match(const DltFileIndexEntry *entry,
+                                uint64_t begin,
+                                uint64_t end,
+                                const DltFilterEngine *engine);
+
+/**
+ * Read all messages of an opened DLT file within a time window, using the index
+ * to skip blocks which cannot contain matching messages.
+ * Like dlt_file_read(), matching messages are added to the index of the DltFile
+ * so that they can be accessed with dlt_file_message() afterwards. A filter set
+ * with dlt_file_set_filter() is applied. Messages written after the last indexed
+ * block are read sequentially. If the index does not fit to the file, the whole
+ * file is read sequentially.
+ * @param file pointer to structure of organising access to DLT file
+ * @param index loaded index of the file, NULL to read the whole file
+ * @param begin start of time window in microseconds since 1.1.1970
+ * @param end end of time window in microseconds since 1.1.1970, 0 for open end
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_read_indexed(DltFile *file,
+                                     const DltFileIndex *index,
+                                     uint64_t begin,
+                                     uint64_t end,
+                                     int verbose);
+
+#   ifdef __cplusplus
+}
+#   endif
+
+#endif /* DLT_FILE_INDEX_H */
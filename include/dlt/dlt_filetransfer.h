@@ -152,4 +152,25 @@ extern int dlt_user_log_file_data(DltContext *fileContext, const char *filename,
  */
 extern int dlt_user_log_file_end(DltContext *fileContext, const char *filename, int deleteFlag);
 
+/* !Transfer the complete file with packages as big as a log message allows. */
+/**Like dlt_user_log_file_complete, this method logs the header, all data packages and the end of the file.
+ * The file is checked and opened only once and read with one pread per package. The package size is the
+ * maximum log message size (see DLT_LOG_MSG_BUF_LEN) and announced in the header, so that the dlt viewer
+ * can reconstruct the file. Packages are sent without delay as long as the user buffer is filled less
+ * than 50%. Above, the transfer waits until the daemon has read enough. A package which does not fit
+ * into the user buffer anymore is sent again.
+ * As no global buffer is used, several files can be transferred in parallel from different threads.
+ * @param fileContext Specific context to log the file to dlt
+ * @param filename Absolute file path
+ * @param alias Alternative name to show in the receiving end, the file path is used if NULL
+ * @param firstPackage Package to start with. A value > 1 resumes an interrupted transfer without sending the header again.
+ * @param deleteFlag Flag if the file will be deleted after transfer. 1->delete, 0->notDelete
+ * @param timeout Maximum time in ms to wait between two checks of the user buffer
+ * @param fileCancelTransferFlag is a bool pointer to cancel the filetransfer on demand
+ * @return Returns 0 if everything was okey. If there was a failure value < 0 will be returned.
+ */
+extern int dlt_user_log_file_transfer(DltContext *fileContext, const char *filename, const char *alias,
+                                      int firstPackage, int deleteFlag, int timeout,
+                                      bool *const fileCancelTransferFlag);
+
 #endif /* DLT_FILETRANSFER_H */
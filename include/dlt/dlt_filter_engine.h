@@ -0,0 +1,227 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_filter_engine.h
+ */
+
+
+#ifndef DLT_FILTER_ENGINE_H
+#define DLT_FILTER_ENGINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "dlt_common.h"
+#include "dlt_types.h"
+
+/*
+ * A filter engine holds a set of filter rules without the DLT_FILTER_MAX
+ * limit of DltFilter. Before messages are checked, the rules are compiled
+ * into a hash table keyed by the application and context id, both packed
+ * into 32 bit values. A message is then only checked against the rules with
+ * its own ids and the rules which use a wildcard for one or both ids, instead
+ * of against every rule.
+ * A message passes the filter if at least one rule matches, like with
+ * dlt_message_filter_check().
+ * The engine is owned by the caller. dlt_filter_compile() builds it from the
+ * rules of a DltFilter, dlt_filter_engine_load() from a filter file, and a
+ * DltFile compiles the filter set with dlt_file_set_filter() into an engine
+ * of its own.
+ */
+
+/* Rule has a timestamp range, see DltFilterRule */
+#define DLT_FILTER_RULE_FLAG_TIMESTAMP 0x01
+
+/**
+ * One rule of a filter. Ids and ranges which are 0 match every message.
+ */
+typedef struct
+{
+    uint32_t apid;            /**< packed application id, see dlt_filter_engine_pack_id() */
+    uint32_t ctid;            /**< packed context id */
+    int log_level;            /**< log level */
+    int32_t payload_min;      /**< lower border for payload size */
+    int32_t payload_max;      /**< upper border for payload size */
+    uint32_t timestamp_min;   /**< lower border for timestamp (0.1 ms since ECU start) */
+    uint32_t timestamp_max;   /**< upper border for timestamp (0.1 ms since ECU start) */
+    uint32_t flags;           /**< DLT_FILTER_RULE_FLAG_* */
+    uint32_t message_types;   /**< bit mask of the message types (1 << DLT_TYPE_*) */
+    uint8_t *payload;         /**< bytes the payload has to contain, NULL for none */
+    uint32_t payload_length;  /**< length of payload */
+    char *apid2;              /**< DLT v2 application id longer than four characters, NULL otherwise */
+    uint8_t apid2len;         /**< length of apid2, apid holds its first four characters */
+    char *ctid2;              /**< DLT v2 context id longer than four characters, NULL otherwise */
+    uint8_t ctid2len;         /**< length of ctid2, ctid holds its first four characters */
+} DltFilterRule;
+
+/**
+ * Slot of the hash table of a compiled filter.
+ */
+typedef struct
+{
+    uint64_t key;   /**< packed apid in the upper, packed ctid in the lower 32 bits */
+    uint32_t first; /**< first entry of the rules with this key in DltFilterEngine.order */
+    uint32_t count; /**< number of rules with this key, 0 for an empty slot */
+} DltFilterEngineSlot;
+
+/**
+ * Rule set and its compiled form.
+ */
+typedef struct DltFilterEngine
+{
+    DltFilterRule *rules;         /**< rules in the order they were added */
+    uint32_t count;               /**< number of rules */
+    uint32_t size;                /**< number of allocated rules */
+    uint32_t *order;              /**< rule numbers sorted by key */
+    DltFilterEngineSlot *slots;   /**< hash table of the keys */
+    uint32_t slot_bits;           /**< number of slots is 1 << slot_bits */
+    uint32_t wildcards;           /**< bit mask of the used wildcard combinations */
+    uint32_t payload_rules;       /**< number of rules which need the payload */
+    int compiled;                 /**< rules did not change since the last compilation */
+} DltFilterEngine;
+
+#   ifdef __cplusplus
+extern "C"
+{
+#   endif
+
+/**
+ * Pack an id of up to four characters into a 32 bit value for fast comparison.
+ * @param id id, may be shorter than four characters if terminated with zero
+ * @return packed id, 0 for an empty id or NULL
+ */
+uint32_t dlt_filter_engine_pack_id(const char *id);
+
+/**
+ * Initialise an empty filter engine.
+ * @param engine pointer to engine structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_init(DltFilterEngine *engine);
+
+/**
+ * Release all rules and the compiled tables of a filter engine.
+ * @param engine pointer to engine structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_free(DltFilterEngine *engine);
+
+/**
+ * Find a rule with exactly the same values.
+ * @param engine pointer to engine structure
+ * @param rule rule to search
+ * @return number of the rule, -1 if not found
+ */
+int dlt_filter_engine_find(const DltFilterEngine *engine, const DltFilterRule *rule);
+
+/**
+ * Add a copy of a rule. Rules which already exist are not added again.
+ * @param engine pointer to engine structure
+ * @param rule rule to add, the payload and the long ids are copied
+ * @return negative value if there was an error or the rule exists already
+ */
+DltReturnValue dlt_filter_engine_add(DltFilterEngine *engine, const DltFilterRule *rule);
+
+/**
+ * Remove a rule.
+ * @param engine pointer to engine structure
+ * @param number number of the rule to remove
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_remove(DltFilterEngine *engine, uint32_t number);
+
+/**
+ * Build the hash table of the rules. The rules of an engine which is not
+ * compiled are checked one by one.
+ * @param engine pointer to engine structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_compile(DltFilterEngine *engine);
+
+/**
+ * Check a message against the rules of an engine. Only the headers, the
+ * datasize and, if payload rules exist, the databuffer of the message are used.
+ * Messages without extended header pass every filter.
+ * @param engine pointer to engine structure
+ * @param msg pointer to message
+ * @return DLT_RETURN_TRUE if a rule matches, DLT_RETURN_OK if not, negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_match(const DltFilterEngine *engine, const DltMessage *msg);
+
+/**
+ * Check a DLT v2 message against the rules of an engine, like
+ * dlt_filter_engine_match(). Rules with a timestamp range never match, DLT v2
+ * messages have no timestamp since ECU start.
+ * @param engine pointer to engine structure
+ * @param msg pointer to message
+ * @return DLT_RETURN_TRUE if a rule matches, DLT_RETURN_OK if not, negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_match_v2(const DltFilterEngine *engine, const DltMessageV2 *msg);
+
+/**
+ * Load the rules of a filter file, like dlt_filter_load_v2(), but without
+ * the DLT_FILTER_MAX limit. The rules of the engine are replaced and compiled.
+ * @param engine pointer to engine structure
+ * @param filename filename to load filters from
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_engine_load(DltFilterEngine *engine, const char *filename, int verbose);
+
+/**
+ * Build an engine from the rules of a filter and compile it. The rules of
+ * the engine are replaced, the filter is not changed.
+ * @param filter pointer to filter
+ * @param engine pointer to engine structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_compile(const DltFilter *filter, DltFilterEngine *engine);
+
+/**
+ * Build an engine from the DLT v2 rules of a filter and compile it, see
+ * dlt_filter_compile().
+ * @param filter pointer to filter
+ * @param engine pointer to engine structure
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_filter_compile_v2(const DltFilter *filter, DltFilterEngine *engine);
+
+/**
+ * Set the rules of an engine as filter of a DLT file. The file compiles a
+ * copy of the rules, so the engine can be released afterwards. A filter set
+ * with dlt_file_set_filter() is replaced.
+ * @param file pointer to structure of organising access to DLT file
+ * @param engine pointer to engine structure, NULL to remove the filter
+ * @param verbose if set to true verbose information is printed out.
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_file_set_filter_engine(DltFile *file, const DltFilterEngine *engine, int verbose);
+
+/**
+ * Get the compiled filter of a DLT file.
+ * @param file pointer to structure of organising access to DLT file
+ * @return the engine, NULL if no filter is set or the filter was assigned to the file directly
+ */
+const DltFilterEngine *dlt_file_get_filter_engine(const DltFile *file);
+
+#   ifdef __cplusplus
+}
+#   endif
+
+#endif /* DLT_FILTER_ENGINE_H */
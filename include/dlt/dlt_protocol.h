@@ -242,7 +242,9 @@ enum dlt_user_services {
     DLT_SERVICE_ID_PASSIVE_NODE_CONNECTION_STATUS = 0xF07,
     DLT_SERVICE_ID_SET_ALL_LOG_LEVEL = 0xF08,
     DLT_SERVICE_ID_SET_ALL_TRACE_STATUS = 0xF09,
-    DLT_SERVICE_ID_RESERVED_B = 0xF0B,
+    DLT_SERVICE_ID_SET_CLIENT_FILTER = 0xF0A,
+    DLT_SERVICE_ID_SET_STREAM_COMPRESSION = 0xF0B,
+    DLT_SERVICE_ID_RESERVED_B = DLT_SERVICE_ID_SET_STREAM_COMPRESSION, /* Former name of 0xF0B, kept for compatibility */
     DLT_SERVICE_ID_RESERVED_C = 0xF0C,
     DLT_SERVICE_ID_RESERVED_D = 0xF0D,
     DLT_SERVICE_ID_RESERVED_E = 0xF0E,
@@ -66,6 +66,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <errno.h>
 
 #include "dlt_common.h"
 #include "dlt_user.h"
@@ -73,6 +75,12 @@
 
 #define MAXSTRLEN 1024
 
+/* Bytes read from stdin at once in bulk mode */
+#define BULK_BUFFER_SIZE (1024 * 1024)
+
+/* Time to wait for the daemon to read the user buffer in bulk mode */
+#define BULK_WAIT_US 1000
+
 #define PS_DLT_APP_DESC      "stdin adaptor application"
 #define PS_DLT_CONTEXT_DESC  "stdin adaptor context"
 
@@ -81,6 +89,104 @@
 
 DLT_DECLARE_CONTEXT(mycontext)
 
+/*
+ * Wait until the user buffer of the library is at most half full. Reading
+ * stdin stops meanwhile, so the writer is slowed down instead of messages
+ * being discarded.
+ */
+static void wait_for_user_buffer(void)
+{
+    int total_size, used_size;
+
+    for (;;) {
+        dlt_user_check_buffer(&total_size, &used_size);
+
+        if ((total_size - used_size) >= (total_size / 2))
+            return;
+
+        if (dlt_user_log_resend_buffer() != DLT_RETURN_OK)
+            usleep(BULK_WAIT_US);
+    }
+}
+
+/*
+ * Read stdin in large blocks and log each line, without the line break, as
+ * one message. Lines longer than MAXSTRLEN - 1 are split like in line mode.
+ */
+static int log_stdin_bulk(int verbosity)
+{
+    char *buffer;
+    char *line, *end, *newline, *next;
+    size_t used = 0;
+    size_t length;
+    ssize_t bytes;
+    int enabled = 0;
+
+    buffer = malloc(BULK_BUFFER_SIZE);
+
+    if (buffer == NULL) {
+        fprintf(stderr, "Cannot allocate memory for bulk mode\n");
+        return -1;
+    }
+
+    for (;;) {
+        bytes = read(STDIN_FILENO, buffer + used, BULK_BUFFER_SIZE - used);
+
+        if ((bytes < 0) && (errno == EINTR))
+            continue;
+
+        if (bytes <= 0)
+            break;
+
+        used += (size_t)bytes;
+        line = buffer;
+        end = buffer + used;
+
+        /* the log level is checked once for all lines of a block */
+        enabled = (dlt_user_is_logLevel_enabled(&mycontext, (DltLogLevelType)verbosity) == DLT_RETURN_TRUE);
+
+        for (;;) {
+            length = (size_t)(end - line);
+            newline = memchr(line, '\n', (length < MAXSTRLEN) ? length : MAXSTRLEN);
+
+            if (newline != NULL) {
+                length = (size_t)(newline - line);
+                next = newline + 1;
+            }
+            else if (length >= MAXSTRLEN) {
+                length = MAXSTRLEN - 1;
+                next = line + length;
+            }
+            else {
+                break;
+            }
+
+            if ((length > 0) && (line[length - 1] == '\r'))
+                length--;
+
+            if (enabled) {
+                wait_for_user_buffer();
+                DLT_LOG(mycontext, verbosity, DLT_SIZED_STRING(line, (uint16_t)length));
+            }
+
+            line = next;
+        }
+
+        used = (size_t)(end - line);
+        memmove(buffer, line, used);
+    }
+
+    /* last line without line break */
+    if ((used > 0) && enabled) {
+        wait_for_user_buffer();
+        DLT_LOG(mycontext, verbosity, DLT_SIZED_STRING(buffer, (uint16_t)used));
+    }
+
+    free(buffer);
+
+    return (bytes < 0) ? -1 : 0;
+}
+
 int main(int argc, char *argv[])
 {
     char str[MAXSTRLEN];
@@ -92,11 +198,13 @@ int main(int argc, char *argv[])
     int timeout = -1;
     int verbosity = DLT_LOG_INFO;
     int bflag = 0;
+    int bulk = 0;
+    int ret = 0;
 
     dlt_set_id(apid, PS_DLT_APP);
     dlt_set_id(ctid, PS_DLT_CONTEXT);
 
-    while ((opt = getopt(argc, argv, "a:c:bht:v:")) != -1)
+    while ((opt = getopt(argc, argv, "a:c:bBht:v:")) != -1)
         switch (opt) {
         case 'a':
         {
@@ -113,6 +221,11 @@ int main(int argc, char *argv[])
             bflag = 1;
             break;
         }
+        case 'B':
+        {
+            bulk = 1;
+            break;
+        }
         case 't':
         {
             timeout = atoi(optarg);
@@ -129,6 +242,8 @@ int main(int argc, char *argv[])
             printf("  -a apid      - Set application id to apid (default: SINA)\n");
             printf("  -c ctid      - Set context id to ctid (default: SINC)\n");
             printf("  -b           - Flush buffered logs before unregistering app\n");
+            printf("  -B           - Bulk mode: read large blocks, log lines without line break,\n");
+            printf("                 slow down stdin instead of discarding messages\n");
             printf("  -t timeout   - Set timeout when sending messages at exit, in ms (Default: 10000 = 10sec)\n");
             printf(
                 "  -v verbosity level - Set verbosity level (Default: INFO, values: FATAL ERROR WARN INFO DEBUG VERBOSE)\n");
@@ -189,9 +304,12 @@ int main(int argc, char *argv[])
     if (timeout > -1)
         dlt_set_resend_timeout_atexit((uint32_t)timeout);
 
-    while (fgets(str, MAXSTRLEN, stdin))
-        if (strcmp(str, "") != 0)
-            DLT_LOG(mycontext, verbosity, DLT_STRING(str));
+    if (bulk)
+        ret = log_stdin_bulk(verbosity);
+    else
+        while (fgets(str, MAXSTRLEN, stdin))
+            if (strcmp(str, "") != 0)
+                DLT_LOG(mycontext, verbosity, DLT_STRING(str));
 
     DLT_UNREGISTER_CONTEXT(mycontext);
 
@@ -200,5 +318,5 @@ int main(int argc, char *argv[])
     else
         DLT_UNREGISTER_APP();
 
-    return 0;
+    return ret;
 }
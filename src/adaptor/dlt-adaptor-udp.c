@@ -84,6 +84,9 @@
 
 #define MAXSTRLEN             1024
 
+/* Datagrams received with one call */
+#define RECV_BATCH            32
+
 #define PU_DLT_APP_DESC      "udp adaptor application"
 #define PU_DLT_CONTEXT_DESC  "udp adaptor context"
 
@@ -95,11 +98,18 @@ DLT_DECLARE_CONTEXT(mycontext)
 int main(int argc, char *argv[])
 {
     int sock;
-    int bytes_read;
-    socklen_t addr_len;
+    int received;
     int opt, port;
-    char recv_data[MAXSTRLEN];
-    struct sockaddr_in client_addr, server_addr;
+    int rcvbuf = 0;
+    int i;
+    static char recv_data[RECV_BATCH][MAXSTRLEN];
+    struct mmsghdr msgs[RECV_BATCH];
+    struct iovec iov[RECV_BATCH];
+#ifdef DLT_USE_IPv6
+    struct sockaddr_in6 server_addr;
+#else
+    struct sockaddr_in server_addr;
+#endif
 
     char apid[DLT_ID_SIZE];
     char ctid[DLT_ID_SIZE];
@@ -111,7 +121,7 @@ int main(int argc, char *argv[])
 
     port = RCVPORT;
 
-    while ((opt = getopt(argc, argv, "a:c:hp:v:")) != -1)
+    while ((opt = getopt(argc, argv, "a:c:hp:r:v:")) != -1)
         switch (opt) {
         case 'a':
         {
@@ -134,6 +144,7 @@ int main(int argc, char *argv[])
             printf("-a apid      - Set application id to apid (default: UDPA)\n");
             printf("-c ctid      - Set context id to ctid (default: UDPC)\n");
             printf("-p           - Set receive port number for UDP messages (default: %d) \n", port);
+            printf("-r size      - Set receive buffer size of the socket in bytes, for bursts (default: system default)\n");
             printf(
                 "-v verbosity level - Set verbosity level (Default: INFO, values: FATAL ERROR WARN INFO DEBUG VERBOSE)\n");
             printf("-h           - This help\n");
@@ -145,6 +156,11 @@ int main(int argc, char *argv[])
             port = atoi(optarg);
             break;
         }
+        case 'r':
+        {
+            rcvbuf = atoi(optarg);
+            break;
+        }
         case 'v':
         {
             if (!strcmp(optarg, "FATAL")) {
@@ -206,32 +222,43 @@ int main(int argc, char *argv[])
         exit(1);
     }
 
+    /* a larger buffer keeps bursts of datagrams until they are read, limited by rmem_max */
+    if ((rcvbuf > 0) && (setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) == -1))
+        perror("Receive buffer size");
+
+    memset(&server_addr, 0, sizeof(server_addr));
 #ifdef DLT_USE_IPv6
-    server_addr.sin_family = AF_INET6;
+    server_addr.sin6_family = AF_INET6;
+    server_addr.sin6_port = htons((uint16_t)port);
+    server_addr.sin6_addr = in6addr_any;
 #else
     server_addr.sin_family = AF_INET;
-#endif
     server_addr.sin_port = htons((uint16_t)port);
     server_addr.sin_addr.s_addr = INADDR_ANY;
-    memset(&(server_addr.sin_zero), 0, 8);
+#endif
     if (bind(sock, (struct sockaddr *)&server_addr,
-             sizeof(struct sockaddr)) == -1) {
+             sizeof(server_addr)) == -1) {
         perror("Bind");
         return -1;
     }
 
-    addr_len = sizeof(struct sockaddr);
+    memset(msgs, 0, sizeof(msgs));
+
+    for (i = 0; i < RECV_BATCH; i++) {
+        iov[i].iov_base = recv_data[i];
+        iov[i].iov_len = MAXSTRLEN;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
 
     DLT_REGISTER_APP(apid, PU_DLT_APP_DESC);
     DLT_REGISTER_CONTEXT(mycontext, ctid, PU_DLT_CONTEXT_DESC);
 
     while (1) {
-        bytes_read = 0;
+        /* waits for the first datagram, then takes all which are already queued */
+        received = recvmmsg(sock, msgs, RECV_BATCH, MSG_WAITFORONE, NULL);
 
-        bytes_read = (int)recvfrom(sock, recv_data, MAXSTRLEN, 0,
-                                   (struct sockaddr *)&client_addr, &addr_len);
-
-        if (bytes_read == -1) {
+        if (received == -1) {
             if (errno == EINTR) {
                 continue;
             }
@@ -242,10 +269,16 @@ int main(int argc, char *argv[])
             }
         }
 
-        recv_data[bytes_read] = '\0';
+        if (dlt_user_is_logLevel_enabled(&mycontext, (DltLogLevelType)verbosity) != DLT_RETURN_TRUE)
+            continue;
+
+        for (i = 0; i < received; i++) {
+            /* a longer datagram was truncated to MAXSTRLEN */
+            size_t length = strnlen(recv_data[i], msgs[i].msg_len);
 
-        if (bytes_read != 0)
-            DLT_LOG(mycontext, verbosity, DLT_STRING(recv_data));
+            if (length != 0)
+                DLT_LOG(mycontext, verbosity, DLT_SIZED_STRING(recv_data[i], (uint16_t)length));
+        }
     }
 
     DLT_UNREGISTER_CONTEXT(mycontext);
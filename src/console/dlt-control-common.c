@@ -59,6 +59,7 @@
 #include <sys/socket.h>
 
 #include "dlt_common.h"
+#include "dlt_filter_engine.h"
 #include "dlt_protocol.h"
 #include "dlt_client.h"
 
@@ -688,30 +689,92 @@ int dlt_control_deinit(void)
 
 
 #ifdef EXTENDED_FILTERING /* EXTENDED_FILTERING */
+/**
+ * Add one filter of a json filter file and print it.
+ * @param engine pointer to engine structure
+ * @param app_id application id
+ * @param context_id context id
+ * @param rule rule with the remaining values of the filter
+ * @param payload text the payload has to contain, NULL or empty for none
+ */
+static void dlt_json_filter_add(DltFilterEngine *engine,
+                                const char *app_id,
+                                const char *context_id,
+                                DltFilterRule *rule,
+                                const char *payload)
+{
+    rule->apid = dlt_filter_engine_pack_id(app_id);
+    rule->ctid = dlt_filter_engine_pack_id(context_id);
+
+    if ((payload != NULL) && (payload[0] != 0)) {
+        rule->payload_length = (uint32_t)strlen(payload);
+        rule->payload = (uint8_t *)malloc(rule->payload_length);
+
+        if (rule->payload == NULL) {
+            pr_error("Cannot allocate memory for payload filter, ignoring filter!\n");
+            return;
+        }
+
+        memcpy(rule->payload, payload, rule->payload_length);
+    }
+
+    if (dlt_filter_engine_add(engine, rule) < DLT_RETURN_OK)
+        pr_error("Filter could not be added, ignoring it!\n");
+
+    /* the engine keeps its own copy */
+    free(rule->payload);
+
+    printf("\tAppId: %.*s\n", DLT_ID_SIZE, app_id);
+    pr_verbose("\tAppId: %.*s\n", DLT_ID_SIZE, app_id);
+    printf("\tConextId: %.*s\n", DLT_ID_SIZE, context_id);
+    pr_verbose("\tConextId: %.*s\n", DLT_ID_SIZE, context_id);
+    printf("\tLogLevel: %i\n", rule->log_level);
+    pr_verbose("\tLogLevel: %i\n", rule->log_level);
+    printf("\tPayloadMin: %i\n", rule->payload_min);
+    pr_verbose("\tPayloadMin: %i\n", rule->payload_min);
+    printf("\tPayloadMax: %i\n", rule->payload_max);
+    pr_verbose("\tPayloadMax: %i\n", rule->payload_max);
+
+    if (rule->payload_length > 0) {
+        printf("\tPayload: %s\n", payload);
+        pr_verbose("\tPayload: %s\n", payload);
+    }
+
+    if (rule->flags & DLT_FILTER_RULE_FLAG_TIMESTAMP) {
+        printf("\tTimestampMin: %u\n", rule->timestamp_min);
+        pr_verbose("\tTimestampMin: %u\n", rule->timestamp_min);
+        printf("\tTimestampMax: %u\n", rule->timestamp_max);
+        pr_verbose("\tTimestampMax: %u\n", rule->timestamp_max);
+    }
+}
+
 #   if defined(__linux__) || defined(__ANDROID_API__)
-DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int verbose)
+DltReturnValue dlt_json_filter_load(DltFilterEngine *engine, const char *filename, int verbose)
 {
-    if ((filter == NULL) || (filename == NULL))
+    if ((engine == NULL) || (filename == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
     if(verbose)
         pr_verbose("dlt_json_filter_load()\n");
 
     FILE *handle;
-    char buffer[JSON_FILTER_SIZE*DLT_FILTER_MAX];
+    char *buffer;
+    long size;
     struct json_object *j_parsed_json;
     struct json_object *j_app_id;
     struct json_object *j_context_id;
     struct json_object *j_log_level;
     struct json_object *j_payload_min;
     struct json_object *j_payload_max;
+    struct json_object *j_payload;
+    struct json_object *j_timestamp_min;
+    struct json_object *j_timestamp_max;
     enum json_tokener_error jerr;
 
     char app_id[DLT_ID_SIZE + 1] = "";
     char context_id[DLT_ID_SIZE + 1] = "";
-    int32_t log_level = 0;
-    int32_t payload_max = INT32_MAX;
-    int32_t payload_min = 0;
+    const char *payload;
+    DltFilterRule rule;
 
     handle = fopen(filename, "r");
 
@@ -720,34 +783,52 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
         return DLT_RETURN_ERROR;
     }
 
-    if (fread(buffer, sizeof(buffer), 1, handle) != 0) {
-        if (!feof(handle)) {
-            pr_error("Filter file %s is to big for reading it with current buffer!\n", filename);
-            return DLT_RETURN_ERROR;
-        }
+    /* the number of filters is not limited, so read the whole file */
+    if ((fseek(handle, 0, SEEK_END) != 0) || ((size = ftell(handle)) < 0) ||
+        (fseek(handle, 0, SEEK_SET) != 0)) {
+        pr_error("Filter file %s cannot be read!\n", filename);
+        fclose(handle);
+        return DLT_RETURN_ERROR;
     }
 
+    buffer = (char *)malloc((size_t)size + 1);
+
+    if (buffer == NULL) {
+        pr_error("Cannot allocate memory for filter file %s!\n", filename);
+        fclose(handle);
+        return DLT_RETURN_ERROR;
+    }
+
+    if (fread(buffer, 1, (size_t)size, handle) != (size_t)size) {
+        pr_error("Filter file %s cannot be read!\n", filename);
+        free(buffer);
+        fclose(handle);
+        return DLT_RETURN_ERROR;
+    }
+
+    buffer[size] = 0;
+    fclose(handle);
+
     j_parsed_json = json_tokener_parse_verbose(buffer, &jerr);
+    free(buffer);
 
     if (jerr != json_tokener_success) {
         pr_error("Faild to parse given filter %s: %s\n", filename, json_tokener_error_desc(jerr));
         return DLT_RETURN_ERROR;
     }
 
+    /* Reset filters */
+    dlt_filter_engine_free(engine);
+
     printf("The following filter(s) are applied: \n");
     pr_verbose("The following filter(s) are applied: \n");
-    int iterator = 0;
     json_object_object_foreach(j_parsed_json, key, val)
     {
-        if (iterator >= DLT_FILTER_MAX) {
-            pr_error("Maximum number (%d) of allowed filters reached, ignoring rest of filters!\n",
-                     DLT_FILTER_MAX);
-            break;
-        }
-
         printf("%s:\n", key);
         pr_verbose("%s:\n", key);
 
+        memset(&rule, 0, sizeof(rule));
+
         if (json_object_object_get_ex(val, "AppId", &j_app_id))
             strncpy(app_id, json_object_get_string(j_app_id), DLT_ID_SIZE);
         else
@@ -759,46 +840,44 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
             dlt_set_id(context_id, "");
 
         if (json_object_object_get_ex(val, "LogLevel", &j_log_level))
-            log_level = json_object_get_int(j_log_level);
-        else
-            log_level = 0;
+            rule.log_level = json_object_get_int(j_log_level);
 
         if (json_object_object_get_ex(val, "PayloadMin", &j_payload_min))
-            payload_min = json_object_get_int(j_payload_min);
-        else
-            payload_min = 0;
+            rule.payload_min = json_object_get_int(j_payload_min);
 
         if (json_object_object_get_ex(val, "PayloadMax", &j_payload_max))
-            payload_max = json_object_get_int(j_payload_max);
+            rule.payload_max = json_object_get_int(j_payload_max);
         else
-            payload_max = INT32_MAX;
+            rule.payload_max = INT32_MAX;
 
-        dlt_filter_add(filter, app_id, context_id, log_level, payload_min, payload_max, verbose);
+        if (json_object_object_get_ex(val, "Payload", &j_payload))
+            payload = json_object_get_string(j_payload);
+        else
+            payload = NULL;
+
+        if (json_object_object_get_ex(val, "TimestampMin", &j_timestamp_min)) {
+            rule.timestamp_min = (uint32_t)json_object_get_int64(j_timestamp_min);
+            rule.flags |= DLT_FILTER_RULE_FLAG_TIMESTAMP;
+        }
 
-        printf("\tAppId: %.*s\n", DLT_ID_SIZE, app_id);
-        pr_verbose("\tAppId: %.*s\n", DLT_ID_SIZE, app_id);
-        printf("\tConextId: %.*s\n", DLT_ID_SIZE, context_id);
-        pr_verbose("\tConextId: %.*s\n", DLT_ID_SIZE, context_id);
-        printf("\tLogLevel: %i\n", log_level);
-        pr_verbose("\tLogLevel: %i\n", log_level);
-        printf("\tPayloadMin: %i\n", payload_min);
-        pr_verbose("\tPayloadMin: %i\n", payload_min);
-        printf("\tPayloadMax: %i\n", payload_max);
-        pr_verbose("\tPayloadMax: %i\n", payload_max);
+        if (json_object_object_get_ex(val, "TimestampMax", &j_timestamp_max)) {
+            rule.timestamp_max = (uint32_t)json_object_get_int64(j_timestamp_max);
+            rule.flags |= DLT_FILTER_RULE_FLAG_TIMESTAMP;
+        }
 
-        iterator++;
+        dlt_json_filter_add(engine, app_id, context_id, &rule, payload);
     }
 
-    fclose(handle);
+    json_object_put(j_parsed_json);
 
-    return DLT_RETURN_OK;
+    return dlt_filter_engine_compile(engine);
 }
 #   endif /* __Linux__ */
 
 #   ifdef __QNX__
-DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int verbose)
+DltReturnValue dlt_json_filter_load(DltFilterEngine *engine, const char *filename, int verbose)
 {
-    if ((filter == NULL) || (filename == NULL))
+    if ((engine == NULL) || (filename == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
     if(verbose)
@@ -808,9 +887,9 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
 
     const char *s_app_id;
     const char *s_context_id;
-    int32_t log_level = 0;
-    int32_t payload_max = INT32_MAX;
-    int32_t payload_min = 0;
+    const char *s_payload;
+    int32_t timestamp;
+    DltFilterRule rule;
 
     json_decoder_error_t ret = json_decoder_parse_file(j_decoder, filename);
 
@@ -819,18 +898,14 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
         return DLT_RETURN_ERROR;
     }
 
+    /* Reset filters */
+    dlt_filter_engine_free(engine);
+
     json_decoder_push_object(j_decoder, NULL, true);
 
-    int iterator = 0;
     bool end_of_json = false;
 
     while (!end_of_json) {
-        if (iterator >= DLT_FILTER_MAX) {
-            pr_error("Maximum number (%d) of allowed filters reached, ignoring rest of filters!\n",
-                     DLT_FILTER_MAX);
-            break;
-        }
-
         if (json_decoder_next(j_decoder) == JSON_DECODER_NOT_FOUND)
             end_of_json = true;
 
@@ -839,20 +914,35 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
         printf("%s:\n", json_decoder_name(j_decoder));
         json_decoder_push_object(j_decoder, NULL, true);
 
+        memset(&rule, 0, sizeof(rule));
+
         if (json_decoder_get_string(j_decoder, "AppId", &s_app_id, true) != JSON_DECODER_OK)
             s_app_id = "";
 
         if (json_decoder_get_string(j_decoder, "ContextId", &s_context_id, true) != JSON_DECODER_OK)
             s_context_id = "";
 
-        if (json_decoder_get_int(j_decoder, "LogLevel", &log_level, true) != JSON_DECODER_OK)
-            log_level = 0;
+        if (json_decoder_get_int(j_decoder, "LogLevel", &rule.log_level, true) != JSON_DECODER_OK)
+            rule.log_level = 0;
+
+        if (json_decoder_get_int(j_decoder, "PayloadMin", &rule.payload_min, true) != JSON_DECODER_OK)
+            rule.payload_min = 0;
+
+        if (json_decoder_get_int(j_decoder, "PayloadMax", &rule.payload_max, true) != JSON_DECODER_OK)
+            rule.payload_max = INT32_MAX;
 
-        if (json_decoder_get_int(j_decoder, "PayloadMin", &payload_min, true) != JSON_DECODER_OK)
-            payload_min = 0;
+        if (json_decoder_get_string(j_decoder, "Payload", &s_payload, true) != JSON_DECODER_OK)
+            s_payload = NULL;
 
-        if (json_decoder_get_int(j_decoder, "PayloadMax", &payload_max, true) != JSON_DECODER_OK)
-            payload_max = INT32_MAX;
+        if (json_decoder_get_int(j_decoder, "TimestampMin", &timestamp, true) == JSON_DECODER_OK) {
+            rule.timestamp_min = (uint32_t)timestamp;
+            rule.flags |= DLT_FILTER_RULE_FLAG_TIMESTAMP;
+        }
+
+        if (json_decoder_get_int(j_decoder, "TimestampMax", &timestamp, true) == JSON_DECODER_OK) {
+            rule.timestamp_max = (uint32_t)timestamp;
+            rule.flags |= DLT_FILTER_RULE_FLAG_TIMESTAMP;
+        }
 
         char app_id[DLT_ID_SIZE];
         char context_id[DLT_ID_SIZE];
@@ -863,72 +953,75 @@ DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int
         strncpy(context_id, s_context_id, DLT_ID_SIZE);
         #pragma GCC diagnostic pop
 
-        dlt_filter_add(filter, app_id, context_id, log_level, payload_min, payload_max, verbose);
-
-        printf("\tAppId: %.*s\n", DLT_ID_SIZE, app_id);
-        printf("\tConextId: %.*s\n", DLT_ID_SIZE, context_id);
-        printf("\tLogLevel: %i\n", log_level);
-        printf("\tPayloadMin: %i\n", payload_min);
-        printf("\tPayloadMax: %i\n", payload_max);
+        dlt_json_filter_add(engine, app_id, context_id, &rule, s_payload);
 
         json_decoder_pop(j_decoder);
-
-        iterator++;
     }
 
     json_decoder_destroy(j_decoder);
 
-    return DLT_RETURN_OK;
+    return dlt_filter_engine_compile(engine);
 }
 #   endif /* __QNX__ */
 #endif /* EXTENDED_FILTERING */
 
 #ifdef EXTENDED_FILTERING /* EXTENDED_FILTERING */
 #   if defined(__linux__) || defined(__ANDROID_API__)
-DltReturnValue dlt_json_filter_save(DltFilter *filter, const char *filename, int verbose)
+DltReturnValue dlt_json_filter_save(DltFilterEngine *engine, const char *filename, int verbose)
 {
-    if ((filter == NULL) || (filename == NULL))
+    if ((engine == NULL) || (filename == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
     if(verbose)
         pr_verbose("dlt_json_filter_save()\n");
 
     struct json_object *json_filter_obj = json_object_new_object();
+    DltFilterRule rule;
+    char app_id[DLT_ID_SIZE + 1];
+    char context_id[DLT_ID_SIZE + 1];
 
-    for (int num = 0; num < filter->counter; num++) {
+    for (uint32_t num = 0; num < engine->count; num++) {
+        rule = engine->rules[num];
         struct json_object *tmp_json_obj = json_object_new_object();
         char filter_name[JSON_FILTER_NAME_SIZE + 1];
-        snprintf(filter_name, sizeof(filter_name), "filter%i", num);
-
-        if (filter->apid[num][DLT_ID_SIZE - 1] != 0)
-            json_object_object_add(tmp_json_obj, "AppId", json_object_new_string_len(filter->apid[num], DLT_ID_SIZE));
-        else
-            json_object_object_add(tmp_json_obj, "AppId", json_object_new_string(filter->apid[num]));
-
-        if (filter->ctid[num][DLT_ID_SIZE - 1] != 0)
-            json_object_object_add(tmp_json_obj, "ContextId",
-                                   json_object_new_string_len(filter->ctid[num], DLT_ID_SIZE));
-        else
-            json_object_object_add(tmp_json_obj, "ContextId", json_object_new_string(filter->ctid[num]));
-
-        json_object_object_add(tmp_json_obj, "LogLevel", json_object_new_int(filter->log_level[num]));
-        json_object_object_add(tmp_json_obj, "PayloadMin", json_object_new_int(filter->payload_min[num]));
-        json_object_object_add(tmp_json_obj, "PayloadMax", json_object_new_int(filter->payload_max[num]));
+        snprintf(filter_name, sizeof(filter_name), "filter%u", num);
+
+        memcpy(app_id, &rule.apid, DLT_ID_SIZE);
+        app_id[DLT_ID_SIZE] = 0;
+        memcpy(context_id, &rule.ctid, DLT_ID_SIZE);
+        context_id[DLT_ID_SIZE] = 0;
+
+        json_object_object_add(tmp_json_obj, "AppId", json_object_new_string(app_id));
+        json_object_object_add(tmp_json_obj, "ContextId", json_object_new_string(context_id));
+        json_object_object_add(tmp_json_obj, "LogLevel", json_object_new_int(rule.log_level));
+        json_object_object_add(tmp_json_obj, "PayloadMin", json_object_new_int(rule.payload_min));
+        json_object_object_add(tmp_json_obj, "PayloadMax", json_object_new_int(rule.payload_max));
+
+        if (rule.payload_length > 0)
+            json_object_object_add(tmp_json_obj, "Payload",
+                                   json_object_new_string_len((const char *)rule.payload,
+                                                              (int)rule.payload_length));
+
+        if (rule.flags & DLT_FILTER_RULE_FLAG_TIMESTAMP) {
+            json_object_object_add(tmp_json_obj, "TimestampMin", json_object_new_int64(rule.timestamp_min));
+            json_object_object_add(tmp_json_obj, "TimestampMax", json_object_new_int64(rule.timestamp_max));
+        }
 
         json_object_object_add(json_filter_obj, filter_name, tmp_json_obj);
     }
 
     printf("Saving current filter into '%s'\n", filename);
     json_object_to_file(filename, json_filter_obj);
+    json_object_put(json_filter_obj);
 
     return DLT_RETURN_OK;
 }
 #   endif /* __Linux__ */
 
 #   ifdef __QNX__
-DltReturnValue dlt_json_filter_save(DltFilter *filter, const char *filename, int verbose)
+DltReturnValue dlt_json_filter_save(DltFilterEngine *engine, const char *filename, int verbose)
 {
-    if ((filter == NULL) || (filename == NULL))
+    if ((engine == NULL) || (filename == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
     if(verbose)
@@ -936,30 +1029,39 @@ DltReturnValue dlt_json_filter_save(DltFilter *filter, const char *filename, int
 
     char s_app_id[DLT_ID_SIZE + 1];
     char s_context_id[DLT_ID_SIZE + 1];
+    DltFilterRule rule;
 
     json_encoder_t *j_encoder = json_encoder_create();
     json_encoder_start_object(j_encoder, NULL);
 
-    for (int num = 0; num < filter->counter; num++) {
+    for (uint32_t num = 0; num < engine->count; num++) {
+        rule = engine->rules[num];
         char filter_name[JSON_FILTER_NAME_SIZE + 1];
-        snprintf(filter_name, sizeof(filter_name), "filter%i", num);
+        snprintf(filter_name, sizeof(filter_name), "filter%u", num);
         json_encoder_start_object(j_encoder, filter_name);
 
-        strncpy(s_app_id, filter->apid[num], DLT_ID_SIZE);
-
-        if (filter->apid[num][DLT_ID_SIZE - 1] != 0)
-            s_app_id[DLT_ID_SIZE] = '\0';
-
-        strncpy(s_context_id, filter->ctid[num], DLT_ID_SIZE);
-
-        if (filter->ctid[num][DLT_ID_SIZE - 1] != 0)
-            s_context_id[DLT_ID_SIZE] = '\0';
+        memcpy(s_app_id, &rule.apid, DLT_ID_SIZE);
+        s_app_id[DLT_ID_SIZE] = '\0';
+        memcpy(s_context_id, &rule.ctid, DLT_ID_SIZE);
+        s_context_id[DLT_ID_SIZE] = '\0';
 
         json_encoder_add_string(j_encoder, "AppId", s_app_id);
         json_encoder_add_string(j_encoder, "ContextId", s_context_id);
-        json_encoder_add_int(j_encoder, "LogLevel", filter->log_level[num]);
-        json_encoder_add_int(j_encoder, "PayloadMin", filter->payload_min[num]);
-        json_encoder_add_int(j_encoder, "PayloadMax", filter->payload_max[num]);
+        json_encoder_add_int(j_encoder, "LogLevel", rule.log_level);
+        json_encoder_add_int(j_encoder, "PayloadMin", rule.payload_min);
+        json_encoder_add_int(j_encoder, "PayloadMax", rule.payload_max);
+
+        if (rule.payload_length > 0) {
+            char s_payload[rule.payload_length + 1];
+            memcpy(s_payload, rule.payload, rule.payload_length);
+            s_payload[rule.payload_length] = '\0';
+            json_encoder_add_string(j_encoder, "Payload", s_payload);
+        }
+
+        if (rule.flags & DLT_FILTER_RULE_FLAG_TIMESTAMP) {
+            json_encoder_add_int(j_encoder, "TimestampMin", (int)rule.timestamp_min);
+            json_encoder_add_int(j_encoder, "TimestampMax", (int)rule.timestamp_max);
+        }
 
         json_encoder_end_object(j_encoder);
     }
@@ -968,10 +1070,7 @@ DltReturnValue dlt_json_filter_save(DltFilter *filter, const char *filename, int
 
     printf("Saving current filter into '%s'\n", filename);
     FILE *handle = fopen(filename, "w");
-    int filter_buffer_size = 100 * (filter->counter);
-    char filter_buffer[filter_buffer_size];
-    snprintf(filter_buffer, filter_buffer_size, json_encoder_buffer(j_encoder));
-    fprintf(handle, filter_buffer);
+    fputs(json_encoder_buffer(j_encoder), handle);
 
     fclose(handle);
     json_encoder_destroy(j_encoder);
@@ -25,6 +25,7 @@
 #include <stdio.h>
 
 #include "dlt_common.h"
+#include "dlt_filter_engine.h"
 
 #define DLT_CTRL_TIMEOUT 10
 
@@ -97,20 +98,20 @@ int dlt_control_deinit(void);
 
 #ifdef EXTENDED_FILTERING
 /**
- * Load json filter from file.
- * @param filter pointer to structure of organising DLT filter
+ * Load json filter from file. The rules of the engine are replaced and compiled.
+ * @param engine pointer to engine structure
  * @param filename filename to load filters from
  * @param verbose if set to true verbose information is printed out.
  * @return negative value if there was an error
  */
-DltReturnValue dlt_json_filter_load(DltFilter *filter, const char *filename, int verbose);
+DltReturnValue dlt_json_filter_load(DltFilterEngine *engine, const char *filename, int verbose);
 /**
  * Save filter in json format to file.
- * @param filter pointer to structure of organising DLT filter
+ * @param engine pointer to engine structure
  * @param filename filename to safe filters into
  * @param verbose if set to true verbose information is printed out.
  * @return negative value if there was an error
  */
-DltReturnValue dlt_json_filter_save(DltFilter *filter, const char *filename, int verbose);
+DltReturnValue dlt_json_filter_save(DltFilterEngine *engine, const char *filename, int verbose);
 #endif
 #endif
@@ -82,6 +82,8 @@
 #include <string.h>
 #include <ctype.h>
 #include <errno.h>
+#include <stdarg.h>
+#include <pthread.h>
 
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -89,12 +91,53 @@
 #include <sys/uio.h> /* writev() */
 
 #include "dlt_common.h"
+#include "dlt_file_index.h"
+#include "dlt_filter_engine.h"
 
 #define COMMAND_SIZE        1024    /* Size of command */
 #define FILENAME_SIZE       1024    /* Size of filename */
 #define DLT_EXTENSION       "dlt"
 #define DLT_CONVERT_WS      "/tmp/dlt_convert_workspace/"
 
+#define DLT_CONVERT_BATCH_MESSAGES 1024 /* Messages formatted by a thread at once */
+#define DLT_CONVERT_MAX_JOBS       256
+
+typedef enum {
+    DLT_CONVERT_FORMAT_HEX,
+    DLT_CONVERT_FORMAT_ASCII,
+    DLT_CONVERT_FORMAT_MIXED,
+    DLT_CONVERT_FORMAT_HEADER
+} DltConvertFormat;
+
+/* Formatted output of one batch of messages */
+typedef struct {
+    char *text;
+    size_t length;
+    size_t size;
+    int ready;      /* number of the batch whose output is stored, -1 if none */
+} DltConvertSlot;
+
+/* State shared by the threads of the parallel conversion */
+typedef struct {
+    DltFile *file;
+    int begin;
+    int end;
+    int batches;
+    int jobs;
+    DltConvertFormat format;
+    int vflag;
+    DltConvertSlot *slots;
+    int num_slots;
+    int written;    /* number of batches written to stdout */
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} DltConvertParallel;
+
+typedef struct {
+    DltConvertParallel *conv;
+    int worker;
+} DltConvertWorker;
+
 /**
  * Print usage information of tool.
  */
@@ -125,6 +168,65 @@ void usage(void)
     printf("  -e number     Last <number> messages to be handled\n");
     printf("  -w            Follow dlt file while file is increasing\n");
     printf("  -t            Handling input compressed files (tar.gz)\n");
+    printf("  -T begin,end  Handle only messages stored in the given time window\n");
+    printf("                (seconds since 1.1.1970, e.g. 1305022475.5,1305022480).\n");
+    printf("                A sidecar index (file.dlt.idx) is used to seek, if available\n");
+    printf("  -I            Write a sidecar index for the output file (-o),\n");
+    printf("                or for the input files if no output file is given\n");
+    printf("  -M            Map input files into memory and index them in parallel\n");
+    printf("  -j number     Index, filter and format messages with <number> threads;\n");
+    printf("                output order is kept (implies -M)\n");
+}
+
+/**
+ * Parse a time in seconds with optional fraction into microseconds.
+ */
+static int parse_time_us(const char *str, char **end, uint64_t *us)
+{
+    uint64_t seconds;
+    uint64_t fraction = 0;
+    uint64_t scale = 100000;
+
+    if (!isdigit((unsigned char)*str))
+        return -1;
+
+    seconds = strtoull(str, end, 10);
+
+    if (**end == '.') {
+        for ((*end)++; isdigit((unsigned char)**end); (*end)++) {
+            fraction += (uint64_t)(**end - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    *us = seconds * 1000000U + fraction;
+
+    return 0;
+}
+
+/**
+ * Parse time window given as "begin,end". The end is optional.
+ */
+static int parse_time_window(const char *arg, uint64_t *begin, uint64_t *end)
+{
+    char *next = NULL;
+
+    *begin = 0;
+    *end = 0;
+
+    if (parse_time_us(arg, &next, begin) < 0)
+        return -1;
+
+    if (*next == '\0')
+        return 0;
+
+    if ((*next != ',') || (next[1] == '\0'))
+        return -1;
+
+    if ((parse_time_us(next + 1, &next, end) < 0) || (*next != '\0') || (*end < *begin))
+        return -1;
+
+    return 0;
 }
 
 void empty_dir(const char *dir)
@@ -193,6 +295,247 @@ void empty_dir(const char *dir)
         fprintf(stderr, "ERROR: Failed to stat %s with error %s\n", dir, strerror(errno));
 }
 
+/**
+ * Append formatted text to the output of a batch.
+ */
+static void convert_append(DltConvertSlot *slot, const char *format, ...) PRINTF_FORMAT(2, 3);
+static void convert_append(DltConvertSlot *slot, const char *format, ...)
+{
+    va_list args;
+    int len;
+    char *text;
+
+    while (1) {
+        va_start(args, format);
+        len = vsnprintf(slot->text + slot->length, slot->size - slot->length, format, args);
+        va_end(args);
+
+        if (len < 0)
+            return;
+
+        if (slot->length + (size_t)len < slot->size) {
+            slot->length += (size_t)len;
+            return;
+        }
+
+        text = (char *)realloc(slot->text, slot->size * 2 + (size_t)len);
+
+        if (text == NULL)
+            return;
+
+        slot->text = text;
+        slot->size = slot->size * 2 + (size_t)len;
+    }
+}
+
+/**
+ * Format one message the same way as the sequential conversion does.
+ */
+static void convert_format_message(DltConvertParallel *conv, DltConvertSlot *slot,
+                                   DltMessage *msg, int num, char *text)
+{
+    convert_append(slot, "%d ", num);
+
+    if (dlt_message_header(msg, text, DLT_CONVERT_TEXTBUFSIZE, conv->vflag) < DLT_RETURN_OK)
+        return;
+
+    switch (conv->format) {
+    case DLT_CONVERT_FORMAT_HEX:
+        convert_append(slot, "%s ", text);
+
+        if (dlt_message_payload(msg, text, DLT_CONVERT_TEXTBUFSIZE, DLT_OUTPUT_HEX, conv->vflag) == DLT_RETURN_OK)
+            convert_append(slot, "[%s]\n", text);
+
+        break;
+    case DLT_CONVERT_FORMAT_ASCII:
+        convert_append(slot, "%s ", text);
+
+        if (dlt_message_payload(msg, text, DLT_CONVERT_TEXTBUFSIZE, DLT_OUTPUT_ASCII, conv->vflag) == DLT_RETURN_OK)
+            convert_append(slot, "[%s]\n", text);
+
+        break;
+    case DLT_CONVERT_FORMAT_MIXED:
+        convert_append(slot, "%s \n", text);
+
+        if (dlt_message_payload(msg, text, DLT_CONVERT_TEXTBUFSIZE, DLT_OUTPUT_MIXED_FOR_PLAIN,
+                                conv->vflag) == DLT_RETURN_OK)
+            convert_append(slot, "[%s]\n", text);
+
+        break;
+    case DLT_CONVERT_FORMAT_HEADER:
+    default:
+        convert_append(slot, "%s \n", text);
+        break;
+    }
+}
+
+/**
+ * Thread formatting every jobs-th batch of messages.
+ */
+static void *convert_worker(void *arg)
+{
+    DltConvertWorker *worker = (DltConvertWorker *)arg;
+    DltConvertParallel *conv = worker->conv;
+    DltConvertSlot *slot;
+    DltMessageView view;
+    DltMessage msg;
+    char *text;
+    int batch;
+    int num;
+    int last;
+
+    text = (char *)malloc(DLT_CONVERT_TEXTBUFSIZE);
+
+    if ((text == NULL) || (dlt_message_init(&msg, 0) < DLT_RETURN_OK)) {
+        free(text);
+        return NULL;
+    }
+
+    for (batch = worker->worker; batch < conv->batches; batch += conv->jobs) {
+        /* wait until the slot of the batch was written */
+        pthread_mutex_lock(&conv->mutex);
+
+        while (batch >= conv->written + conv->num_slots)
+            pthread_cond_wait(&conv->cond, &conv->mutex);
+
+        pthread_mutex_unlock(&conv->mutex);
+
+        slot = &conv->slots[batch % conv->num_slots];
+        slot->length = 0;
+        slot->text[0] = '\0';
+
+        num = conv->begin + batch * DLT_CONVERT_BATCH_MESSAGES;
+        last = num + DLT_CONVERT_BATCH_MESSAGES - 1;
+
+        if (last > conv->end)
+            last = conv->end;
+
+        for (; num <= last; num++) {
+            if ((dlt_file_message_view(conv->file, num, &view, conv->vflag) < DLT_RETURN_OK) ||
+                (dlt_message_copy_view(&msg, &view, conv->vflag) < DLT_RETURN_OK))
+                continue;
+
+            convert_format_message(conv, slot, &msg, num, text);
+        }
+
+        pthread_mutex_lock(&conv->mutex);
+        slot->ready = batch;
+        pthread_cond_broadcast(&conv->cond);
+        pthread_mutex_unlock(&conv->mutex);
+    }
+
+    dlt_message_free(&msg, 0);
+    free(text);
+
+    return NULL;
+}
+
+/**
+ * Format the messages begin to end of an indexed, memory mapped file with
+ * several threads. Batches of messages are formatted in parallel and
+ * written to stdout in the order of the file.
+ */
+static int convert_parallel(DltFile *file, int begin, int end, int jobs,
+                            DltConvertFormat format, int vflag)
+{
+    DltConvertParallel conv;
+    DltConvertWorker *workers;
+    pthread_t *tids;
+    DltConvertSlot *slot;
+    int started = 0;
+    int batch;
+    int i;
+    int ret = 0;
+
+    memset(&conv, 0, sizeof(conv));
+    conv.file = file;
+    conv.begin = begin;
+    conv.end = end;
+    conv.batches = (end - begin) / DLT_CONVERT_BATCH_MESSAGES + 1;
+    conv.jobs = jobs;
+    conv.format = format;
+    conv.vflag = vflag;
+    conv.num_slots = 2 * jobs;
+
+    conv.slots = (DltConvertSlot *)calloc((size_t)conv.num_slots, sizeof(DltConvertSlot));
+    workers = (DltConvertWorker *)calloc((size_t)jobs, sizeof(DltConvertWorker));
+    tids = (pthread_t *)calloc((size_t)jobs, sizeof(pthread_t));
+
+    if ((conv.slots == NULL) || (workers == NULL) || (tids == NULL)) {
+        free(conv.slots);
+        free(workers);
+        free(tids);
+        return -1;
+    }
+
+    for (i = 0; i < conv.num_slots; i++) {
+        conv.slots[i].ready = -1;
+        conv.slots[i].size = DLT_CONVERT_TEXTBUFSIZE;
+        conv.slots[i].text = (char *)malloc(conv.slots[i].size);
+
+        if (conv.slots[i].text == NULL)
+            ret = -1;
+    }
+
+    pthread_mutex_init(&conv.mutex, NULL);
+    pthread_cond_init(&conv.cond, NULL);
+
+    for (i = 0; (i < jobs) && (ret == 0); i++) {
+        workers[i].conv = &conv;
+        workers[i].worker = i;
+
+        if (pthread_create(&tids[i], NULL, convert_worker, &workers[i]) != 0) {
+            fprintf(stderr, "ERROR: Cannot create conversion thread!\n");
+            ret = -1;
+            break;
+        }
+
+        started++;
+    }
+
+    /* write the batches in order as soon as they are formatted */
+    for (batch = 0; (batch < conv.batches) && (ret == 0); batch++) {
+        slot = &conv.slots[batch % conv.num_slots];
+
+        pthread_mutex_lock(&conv.mutex);
+
+        while (slot->ready != batch)
+            pthread_cond_wait(&conv.cond, &conv.mutex);
+
+        pthread_mutex_unlock(&conv.mutex);
+
+        fwrite(slot->text, 1, slot->length, stdout);
+
+        pthread_mutex_lock(&conv.mutex);
+        conv.written = batch + 1;
+        pthread_cond_broadcast(&conv.cond);
+        pthread_mutex_unlock(&conv.mutex);
+    }
+
+    if (ret < 0) {
+        /* release waiting threads */
+        pthread_mutex_lock(&conv.mutex);
+        conv.written = conv.batches;
+        pthread_cond_broadcast(&conv.cond);
+        pthread_mutex_unlock(&conv.mutex);
+    }
+
+    for (i = 0; i < started; i++)
+        pthread_join(tids[i], NULL);
+
+    pthread_cond_destroy(&conv.cond);
+    pthread_mutex_destroy(&conv.mutex);
+
+    for (i = 0; i < conv.num_slots; i++)
+        free(conv.slots[i].text);
+
+    free(conv.slots);
+    free(workers);
+    free(tids);
+
+    return ret;
+}
+
 /**
  * Main function of tool.
  */
@@ -206,7 +549,11 @@ int main(int argc, char *argv[])
     int mflag = 0;
     int wflag = 0;
     int tflag = 0;
+    int iflag = 0;
+    int Mflag = 0;
+    int jobs = 1;
     char *fvalue = 0;
+    char *Tvalue = 0;
     char *bvalue = 0;
     char *evalue = 0;
     char *ovalue = 0;
@@ -215,7 +562,12 @@ int main(int argc, char *argv[])
     int c;
 
     DltFile file;
-    DltFilter filter;
+    DltFilterEngine filter;
+    DltFileIndex findex;
+    DltFileIndexWriter iwriter;
+    uint64_t tbegin = 0;
+    uint64_t tend = 0;
+    uint64_t ooffset = 0;
 
     int ohandle = -1;
 
@@ -236,7 +588,7 @@ int main(int argc, char *argv[])
 
     opterr = 0;
 
-    while ((c = getopt (argc, argv, "vcashxmwtf:b:e:o:")) != -1) {
+    while ((c = getopt (argc, argv, "vcashxmwtIMf:b:e:o:T:j:")) != -1) {
         switch (c)
         {
         case 'v':
@@ -279,6 +631,33 @@ int main(int argc, char *argv[])
             tflag = 1;
             break;
         }
+        case 'I':
+        {
+            iflag = 1;
+            break;
+        }
+        case 'M':
+        {
+            Mflag = 1;
+            break;
+        }
+        case 'j':
+        {
+            jobs = atoi(optarg);
+
+            if ((jobs < 1) || (jobs > DLT_CONVERT_MAX_JOBS)) {
+                fprintf(stderr, "ERROR: Number of threads must be between 1 and %d!\n", DLT_CONVERT_MAX_JOBS);
+                return -1;
+            }
+
+            Mflag = 1;
+            break;
+        }
+        case 'T':
+        {
+            Tvalue = optarg;
+            break;
+        }
         case 'h':
         {
             usage();
@@ -306,7 +685,8 @@ int main(int argc, char *argv[])
         }
         case '?':
         {
-            if ((optopt == 'f') || (optopt == 'b') || (optopt == 'e') || (optopt == 'o'))
+            if ((optopt == 'f') || (optopt == 'b') || (optopt == 'e') || (optopt == 'o') || (optopt == 'T') ||
+                (optopt == 'j'))
                 fprintf (stderr, "Option -%c requires an argument.\n", optopt);
             else if (isprint (optopt))
                 fprintf (stderr, "Unknown option `-%c'.\n", optopt);
@@ -324,17 +704,28 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (Tvalue && (parse_time_window(Tvalue, &tbegin, &tend) < 0)) {
+        fprintf(stderr, "ERROR: Invalid time window %s!\n", Tvalue);
+        usage();
+        return -1;
+    }
+
     /* Initialize structure to use DLT file */
     dlt_file_init(&file, vflag);
 
     /* first parse filter file if filter parameter is used */
     if (fvalue) {
-        if (dlt_filter_load(&filter, fvalue, vflag) < DLT_RETURN_OK) {
+        dlt_filter_engine_init(&filter);
+
+        if ((dlt_filter_engine_load(&filter, fvalue, vflag) < DLT_RETURN_OK) ||
+            (dlt_file_set_filter_engine(&file, &filter, vflag) < DLT_RETURN_OK)) {
+            dlt_filter_engine_free(&filter);
             dlt_file_free(&file, vflag);
             return -1;
         }
 
-        dlt_file_set_filter(&file, &filter, vflag);
+        /* the file keeps a compiled copy of the rules */
+        dlt_filter_engine_free(&filter);
     }
 
     if (ovalue) {
@@ -345,6 +736,11 @@ int main(int argc, char *argv[])
             fprintf(stderr, "ERROR: Output file %s cannot be opened!\n", ovalue);
             return -1;
         }
+
+        if (iflag && (dlt_file_index_writer_init(&iwriter, ovalue, 0, 0) < DLT_RETURN_OK)) {
+            fprintf(stderr, "ERROR: Index for output file %s cannot be created!\n", ovalue);
+            iflag = 0;
+        }
     }
 
     if (tflag) {
@@ -409,9 +805,28 @@ int main(int argc, char *argv[])
             argv[index] = tmp_filename;
         }
 
+        if (iflag && !ovalue && (dlt_file_index_build(argv[index], 0, 0, vflag) < DLT_RETURN_OK))
+            fprintf(stderr, "ERROR: Index for %s cannot be created!\n", argv[index]);
+
         /* load, analyze data file and create index list */
-        if (dlt_file_open(&file, argv[index], vflag) >= DLT_RETURN_OK) {
-            while (dlt_file_read(&file, vflag) >= DLT_RETURN_OK) {
+        if ((Mflag ? dlt_file_open_mmap(&file, argv[index], vflag) :
+             dlt_file_open(&file, argv[index], vflag)) >= DLT_RETURN_OK) {
+            if (Tvalue) {
+                /* seek with the sidecar index if there is one */
+                if (dlt_file_index_load(&findex, argv[index]) < DLT_RETURN_OK) {
+                    if (vflag)
+                        printf("No index found for %s, reading whole file\n", argv[index]);
+                }
+
+                dlt_file_read_indexed(&file, &findex, tbegin, tend, vflag);
+                dlt_file_index_free(&findex);
+            }
+            else if (Mflag) {
+                dlt_file_build_index(&file, (jobs > 1) ? jobs : 0, vflag);
+            }
+            else {
+                while (dlt_file_read(&file, vflag) >= DLT_RETURN_OK) {
+                }
             }
         }
 
@@ -446,77 +861,94 @@ int main(int argc, char *argv[])
                 return -1;
             }
 
-            for (num = begin; num <= end; num++) {
-                if (dlt_file_message(&file, num, vflag) < DLT_RETURN_OK)
-                    continue;
+            if ((jobs > 1) && !ovalue && !wflag && (dlt_file_is_mapped(&file) == DLT_RETURN_TRUE)) {
+                DltConvertFormat format = xflag ? DLT_CONVERT_FORMAT_HEX :
+                                          aflag ? DLT_CONVERT_FORMAT_ASCII :
+                                          mflag ? DLT_CONVERT_FORMAT_MIXED : DLT_CONVERT_FORMAT_HEADER;
 
-                if (xflag) {
-                    printf("%d ", num);
-                    if (dlt_message_print_hex(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
+                if (convert_parallel(&file, begin, end, jobs, format, vflag) < 0)
+                    fprintf(stderr, "ERROR: Parallel conversion failed!\n");
+            }
+            else {
+                for (num = begin; num <= end; num++) {
+                    if (dlt_file_message(&file, num, vflag) < DLT_RETURN_OK)
                         continue;
-                }
-                else if (aflag) {
-                    printf("%d ", num);
 
-                    if (dlt_message_header(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
-                        continue;
+                    if (xflag) {
+                        printf("%d ", num);
+                        if (dlt_message_print_hex(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
+                            continue;
+                    }
+                    else if (aflag) {
+                        printf("%d ", num);
 
-                    printf("%s ", text);
+                        if (dlt_message_header(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
+                            continue;
 
-                    if (dlt_message_payload(&file.msg, text, DLT_CONVERT_TEXTBUFSIZE, DLT_OUTPUT_ASCII, vflag) < DLT_RETURN_OK)
-                        continue;
+                        printf("%s ", text);
 
-                    printf("[%s]\n", text);
-                }
-                else if (mflag) {
-                    printf("%d ", num);
-                    if (dlt_message_print_mixed_plain(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
-                        continue;
-                }
-                else if (sflag) {
-                    printf("%d ", num);
+                        if (dlt_message_payload(&file.msg, text, DLT_CONVERT_TEXTBUFSIZE, DLT_OUTPUT_ASCII, vflag) < DLT_RETURN_OK)
+                            continue;
 
-                    if (dlt_message_header(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
-                        continue;
+                        printf("[%s]\n", text);
+                    }
+                    else if (mflag) {
+                        printf("%d ", num);
+                        if (dlt_message_print_mixed_plain(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
+                            continue;
+                    }
+                    else if (sflag) {
+                        printf("%d ", num);
 
-                    printf("%s \n", text);
-                }
+                        if (dlt_message_header(&(file.msg), text, DLT_CONVERT_TEXTBUFSIZE, vflag) < DLT_RETURN_OK)
+                            continue;
 
-                /* if file output enabled write message */
-                if (ovalue) {
-                    iov[0].iov_base = file.msg.headerbuffer;
-                    iov[0].iov_len = (uint32_t) file.msg.headersize;
-                    iov[1].iov_base = file.msg.databuffer;
-                    iov[1].iov_len = (uint32_t) file.msg.datasize;
-
-                    bytes_written =(int) writev(ohandle, iov, 2);
-
-                    if (0 > bytes_written) {
-                        printf("in main: writev(ohandle, iov, 2); returned an error!");
-                        close(ohandle);
-                        ohandle = -1;
-                        dlt_file_free(&file, vflag);
-                        return -1;
+                        printf("%s \n", text);
                     }
-                }
 
-                /* check for new messages if follow flag set */
-                if (wflag && (num == end)) {
-                    while (1) {
-                        while (dlt_file_read(&file, 0) >= 0){
+                    /* if file output enabled write message */
+                    if (ovalue) {
+                        iov[0].iov_base = file.msg.headerbuffer;
+                        iov[0].iov_len = (uint32_t) file.msg.headersize;
+                        iov[1].iov_base = file.msg.databuffer;
+                        iov[1].iov_len = (uint32_t) file.msg.datasize;
+
+                        bytes_written =(int) writev(ohandle, iov, 2);
+
+                        if (0 > bytes_written) {
+                            printf("in main: writev(ohandle, iov, 2); returned an error!");
+                            close(ohandle);
+                            ohandle = -1;
+                            if (iflag)
+                                dlt_file_index_writer_free(&iwriter);
+                            dlt_file_free(&file, vflag);
+                            return -1;
                         }
 
-                        if (end == (file.counter - 1)) {
-                            /* Sleep if no new message was received */
-                            struct timespec req;
-                            req.tv_sec = 0;
-                            req.tv_nsec = 100000000;
-                            nanosleep(&req, NULL);
-                        }
-                        else {
-                            /* set new end of log file and continue reading */
-                            end = file.counter - 1;
-                            break;
+                        if (iflag)
+                            dlt_file_index_writer_add(&iwriter, ooffset, &file.msg);
+
+                        ooffset += (uint64_t)bytes_written;
+                    }
+
+                    /* check for new messages if follow flag set */
+                    if (wflag && (num == end)) {
+                        while (1) {
+                            while (dlt_file_read(&file, 0) >= 0){
+                            }
+
+                            if (end == (file.counter - 1)) {
+                                /* Sleep if no new message was received */
+                                struct timespec req;
+                                req.tv_sec = 0;
+                                req.tv_nsec = 100000000;
+                                nanosleep(&req, NULL);
+                            }
+                            else {
+                                /* set new end of log file and continue reading */
+                                end = file.counter - 1;
+                                break;
+                            }
                         }
                     }
                 }
@@ -526,7 +958,7 @@ int main(int argc, char *argv[])
         if (cflag) {
             printf("Total number of messages: %d\n", file.counter_total);
 
-            if (file.filter)
+            if (fvalue || Tvalue)
                 printf("Filtered number of messages: %d\n", file.counter);
         }
     }
@@ -534,6 +966,9 @@ int main(int argc, char *argv[])
     if (ovalue) {
         close(ohandle);
         ohandle = -1;
+
+        if (iflag)
+            dlt_file_index_writer_free(&iwriter);
     }
 
     if (tflag) {
@@ -136,7 +136,7 @@ typedef struct {
     int64_t totalbytes; /* bytes written so far into the output file, used to check the file size limit */
     int part_num;    /* number of current output file if limit was exceeded */
     DltFile file;
-    DltFilter filter;
+    DltFilterEngine filter;
     int port;
     char *ifaddr;
 } DltReceiveData;
@@ -560,15 +560,15 @@ int main(int argc, char *argv[])
     dlt_file_init_v2(&(dltdata.file), dltdata.vflag);
 
     /* first parse filter file if filter parameter is used */
-    dlt_filter_init(&(dltdata.filter), dltdata.vflag);
+    dlt_filter_engine_init(&(dltdata.filter));
 
     if (dltdata.fvalue) {
-        if (dlt_filter_load_v2(&(dltdata.filter), dltdata.fvalue, dltdata.vflag) < DLT_RETURN_OK) {
+        if (dlt_filter_engine_load(&(dltdata.filter), dltdata.fvalue, dltdata.vflag) < DLT_RETURN_OK) {
             dlt_file_free_v2(&(dltdata.file), dltdata.vflag);
             return -1;
         }
 
-        dlt_file_set_filter(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
+        dlt_file_set_filter_engine(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
     }
 
     #ifdef EXTENDED_FILTERING
@@ -580,7 +580,7 @@ int main(int argc, char *argv[])
             return -1;
         }
 
-        dlt_file_set_filter(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
+        dlt_file_set_filter_engine(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
     }
 
     #endif
@@ -639,7 +639,7 @@ int main(int argc, char *argv[])
 
     dlt_file_free_v2(&(dltdata.file), dltdata.vflag);
 
-    dlt_filter_free(&(dltdata.filter), dltdata.vflag);
+    dlt_filter_engine_free(&(dltdata.filter));
 
     return 0;
 }
@@ -678,7 +678,7 @@ int dlt_receive_message_callback_v2(DltMessageV2 *message, void *data)
     memcpy(message->headerbufferv2 + message->storageheadersizev2, temp_buffer, (size_t)(message->headersizev2 - (int32_t)message->storageheadersizev2));
 
     if (((dltdata->fvalue || dltdata->jvalue) == 0) ||
-        (dlt_message_filter_check_v2(message, &(dltdata->filter), dltdata->vflag) == DLT_RETURN_TRUE)) {
+        (dlt_filter_engine_match_v2(&(dltdata->filter), message) == DLT_RETURN_TRUE)) {
 
         /* if no filter set or filter is matching display message */
         if (dltdata->xflag) {
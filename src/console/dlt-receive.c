@@ -77,6 +77,8 @@
 #include <syslog.h>
 #include <signal.h>
 #include <sys/socket.h>
+#include <poll.h>
+#include <time.h>
 #ifdef __linux__
 #   include <linux/limits.h>
 #else
@@ -85,12 +87,18 @@
 #include <inttypes.h>
 #include "dlt_log.h"
 #include "dlt_client.h"
+#include "dlt_file_index.h"
+#include "dlt_multiple_files.h"
 #include "dlt-control-common.h"
 
 #define DLT_RECEIVE_ECU_ID "RECV"
 
+/* Maximum number of messages handled at once in collector mode */
+#define DLT_RECEIVE_COLLECT_BATCH_MAX 256
+
 DltClient dltclient;
 static bool sig_close_recv = false;
+static bool sig_print_stats = false;
 
 void signal_handler(int signal)
 {
@@ -103,6 +111,10 @@ void signal_handler(int signal)
         sig_close_recv = true;
         shutdown(dltclient.receiver.fd, SHUT_RD);
         break;
+    case SIGUSR1:
+        /* print statistics of collector mode */
+        sig_print_stats = true;
+        break;
     default:
         /* This case should never happen! */
         break;
@@ -122,11 +134,17 @@ typedef struct {
     int yflag;
     int uflag;
     int rflag;
+    int Iflag;
+    int Dflag;
+    int Mflag;
     char *ovalue;
     char *ovaluebase; /* ovalue without ".dlt" */
     char *fvalue;       /* filename for space separated filter file (<AppID> <ContextID>) */
     char *jvalue;       /* filename for json filter file */
     char *evalue;
+    char *dvalue;       /* directory for files per ECU in collector mode */
+    int tvalue;         /* maximum size of the files of one ECU */
+    int file_size;      /* size of one file per ECU */
     int bvalue;
     int rvalue;
     int sendSerialHeaderFlag;
@@ -137,11 +155,14 @@ typedef struct {
     int64_t totalbytes; /* bytes written so far into the output file, used to check the file size limit */
     int part_num;    /* number of current output file if limit was exceeded */
     DltFile file;
-    DltFilter filter;
+    DltFilterEngine filter;
+    DltFileIndexWriter iwriter; /* sidecar index of the output file */
     int port;
     char *ifaddr;
 } DltReceiveData;
 
+void dlt_receive_print_message(DltReceiveData *dltdata, DltMessage *message, char *text);
+
 /**
  * Print usage information of tool.
  */
@@ -176,6 +197,17 @@ void usage(void)
     printf("                suffix to specify kilo-, mega-, giga-bytes respectively\n");
     printf("  -f filename   Enable filtering of messages with space separated list (<AppID> <ContextID>)\n");
     printf("  -j filename   Enable filtering of messages with filter defined in json file\n");
+    printf("  -D            Let the daemon apply the filter of -f or -j, so that only\n");
+    printf("                matching messages are transferred\n");
+    printf("  -I            Write a sidecar index (filename.idx) next to the output file\n");
+    printf("  -M            Collector mode, receive from all given endpoints at once:\n");
+    printf("                [ecuid=]tcp:host[:port], [ecuid=]unix:path,\n");
+    printf("                [ecuid=]serial:device[:baudrate] or hostname\n");
+    printf("  -d directory  Collector mode: write the messages of each ECU also into\n");
+    printf("                rotating files <ECU>.<index>.dlt in directory, the size of\n");
+    printf("                one file is set with -c (Default: 10M)\n");
+    printf("  -t limit      Collector mode: maximum size of all files of one ECU\n");
+    printf("                (Default: 4 times the file size)\n");
     printf("  -p port       Use the given port instead the default port\n");
     printf("                Cannot be used with serial devices\n");
 }
@@ -232,6 +264,16 @@ int64_t convert_arg_to_byte_size(char *arg)
 }
 
 
+/*
+ * open sidecar index of output file
+ */
+void dlt_receive_open_index_file(DltReceiveData *dltdata)
+{
+    if (dlt_file_index_writer_init(&dltdata->iwriter, dltdata->ovalue, 0, 0) < DLT_RETURN_OK)
+        dlt_vlog(LOG_ERR, "ERROR: Index for output file %s cannot be created!\n", dltdata->ovalue);
+}
+
+
 /*
  * open output file
  */
@@ -295,16 +337,32 @@ int dlt_receive_open_output_file(DltReceiveData *dltdata)
         if (rename(dltdata->ovalue, filename) != 0)
             dlt_vlog(LOG_ERR, "ERROR: rename %s to %s failed with error %s\n",
                      dltdata->ovalue, filename, strerror(errno));
-        else if (dltdata->vflag) {
-            dlt_vlog(LOG_INFO, "Renaming existing file from %s to %s\n",
-                     dltdata->ovalue, filename);
+        else {
+            if (dltdata->vflag)
+                dlt_vlog(LOG_INFO, "Renaming existing file from %s to %s\n",
+                         dltdata->ovalue, filename);
+
             ++dltdata->part_num;
         }
+
+        if (dltdata->Iflag) {
+            /* keep the index next to the renamed file */
+            char old_index[PATH_MAX + 1];
+            char new_index[PATH_MAX + 1];
+
+            if ((dlt_file_index_filename(dltdata->ovalue, old_index, sizeof(old_index)) == DLT_RETURN_OK) &&
+                (dlt_file_index_filename(filename, new_index, sizeof(new_index)) == DLT_RETURN_OK))
+                rename(old_index, new_index);
+        }
     } /* if (file_already_exists) */
 
     globfree(&outer);
 
     dltdata->ohandle = open(dltdata->ovalue, O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if ((dltdata->ohandle >= 0) && dltdata->Iflag)
+        dlt_receive_open_index_file(dltdata);
+
     return dltdata->ohandle;
 }
 
@@ -315,6 +373,501 @@ void dlt_receive_close_output_file(DltReceiveData *dltdata)
         close(dltdata->ohandle);
         dltdata->ohandle = -1;
     }
+
+    if (dltdata->Iflag)
+        dlt_file_index_writer_free(&dltdata->iwriter);
+}
+
+
+/*
+ * Collector mode (-M): receive from several ECUs in one poll loop
+ */
+
+/* Poll timeout of the collector in milliseconds, also the resolution of reconnects */
+#define DLT_RECEIVE_COLLECT_POLL_TIMEOUT 1000
+
+/* Default file size of the per-ECU files if no limit is given with -c */
+#define DLT_RECEIVE_COLLECT_FILE_SIZE (10 * 1024 * 1024)
+
+/* Number of files kept per ECU if no total size is given with -t */
+#define DLT_RECEIVE_COLLECT_FILE_COUNT 4
+
+struct DltReceiveCollector;
+
+typedef struct {
+    struct DltReceiveCollector *collector;
+    const char *endpoint;   /* endpoint as given on the command line */
+    DltClient client;
+    DltClientStream stream;
+    char ecuid[DLT_ID_SIZE];
+    int connected;
+    int64_t reconnect;      /* time of next connection attempt in ms, -1 for none */
+    uint64_t connects;
+    uint64_t bytes;
+    uint64_t messages;
+    uint64_t written;
+    uint64_t filtered;
+    uint64_t dropped;       /* messages which could not be written */
+    uint64_t skipped;       /* bytes skipped while resyncing */
+} DltReceiveSource;
+
+typedef struct {
+    char ecuid[DLT_ID_SIZE];
+    MultipleFilesRingBuffer files;
+} DltReceiveEcuFiles;
+
+typedef struct DltReceiveCollector {
+    DltReceiveData *dltdata;
+    DltReceiveSource *sources;
+    int source_count;
+    DltReceiveEcuFiles *ecus;
+    int ecu_count;
+    int64_t start;
+    DltMessage msg;         /* copy of a message for printing */
+} DltReceiveCollector;
+
+int64_t dlt_receive_time_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*
+ * Set up the client of a source from its endpoint:
+ * [ecuid=]tcp:host[:port], [ecuid=]unix:path, [ecuid=]serial:device[:baudrate] or just a hostname
+ */
+int dlt_receive_source_init(DltReceiveSource *source, DltReceiveData *dltdata, const char *endpoint)
+{
+    char address[PATH_MAX + 1];
+    const char *separator = strchr(endpoint, '=');
+    char *port = NULL;
+
+    source->endpoint = endpoint;
+    source->reconnect = 0;
+    memcpy(source->ecuid, dltdata->ecuid, DLT_ID_SIZE);
+
+    if ((separator != NULL) && (strchr(endpoint, ':') > separator)) {
+        char ecuid[DLT_ID_SIZE + 1] = { 0 };
+        size_t length = (size_t)(separator - endpoint);
+
+        memcpy(ecuid, endpoint, length < DLT_ID_SIZE ? length : DLT_ID_SIZE);
+        dlt_set_id(source->ecuid, ecuid);
+        endpoint = separator + 1;
+    }
+
+    if (dlt_client_init(&source->client, dltdata->vflag) < DLT_RETURN_OK)
+        return -1;
+
+    source->client.send_serial_header = dltdata->sendSerialHeaderFlag;
+    source->client.resync_serial_header = dltdata->resyncSerialHeaderFlag;
+    source->client.port = (uint16_t)dltdata->port;
+
+    if (strncmp(endpoint, "unix:", 5) == 0) {
+        strncpy(address, endpoint + 5, PATH_MAX);
+        address[PATH_MAX] = 0;
+        source->client.mode = DLT_CLIENT_MODE_UNIX;
+        return dlt_client_set_socket_path(&source->client, address);
+    }
+
+    if (strncmp(endpoint, "serial:", 7) == 0) {
+        strncpy(address, endpoint + 7, PATH_MAX);
+        address[PATH_MAX] = 0;
+        port = strchr(address, ':');
+
+        if (port != NULL)
+            *port++ = 0;
+
+        source->client.mode = DLT_CLIENT_MODE_SERIAL;
+        dlt_client_setbaudrate(&source->client, port != NULL ? atoi(port) : dltdata->bvalue);
+        return dlt_client_set_serial_device(&source->client, address);
+    }
+
+    if (strncmp(endpoint, "tcp:", 4) == 0)
+        endpoint += 4;
+
+    strncpy(address, endpoint, PATH_MAX);
+    address[PATH_MAX] = 0;
+
+    /* only a single colon separates the port, IPv6 addresses have several */
+    port = strchr(address, ':');
+
+    if ((port != NULL) && (strchr(port + 1, ':') == NULL)) {
+        *port++ = 0;
+        source->client.port = (uint16_t)atoi(port);
+    }
+
+    source->client.mode = DLT_CLIENT_MODE_TCP;
+    return dlt_client_set_server_ip(&source->client, address);
+}
+
+void dlt_receive_source_disconnect(DltReceiveSource *source)
+{
+    if (!source->connected)
+        return;
+
+    source->bytes += source->stream.bytes;
+    source->messages += source->stream.messages;
+    source->skipped += source->stream.skipped;
+    dlt_client_stream_free(&source->stream);
+
+    if (source->client.sock != -1) {
+        close(source->client.sock);
+        source->client.sock = -1;
+    }
+
+    dlt_receiver_free(&source->client.receiver);
+    source->connected = 0;
+
+    if (source->collector->dltdata->rflag && !sig_close_recv)
+        source->reconnect = dlt_receive_time_ms() + source->collector->dltdata->rvalue;
+    else
+        source->reconnect = -1;
+}
+
+DltReceiveEcuFiles *dlt_receive_ecu_files(DltReceiveCollector *collector, const char *ecuid)
+{
+    DltReceiveData *dltdata = collector->dltdata;
+    DltReceiveEcuFiles *ecus;
+    char base[DLT_ID_SIZE + 1] = { 0 };
+    int i;
+
+    for (i = 0; i < collector->ecu_count; i++)
+        if (memcmp(collector->ecus[i].ecuid, ecuid, DLT_ID_SIZE) == 0)
+            return collector->ecus[i].files.ohandle >= 0 ? &collector->ecus[i] : NULL;
+
+    ecus = realloc(collector->ecus, (size_t)(collector->ecu_count + 1) * sizeof(DltReceiveEcuFiles));
+
+    if (ecus == NULL)
+        return NULL;
+
+    collector->ecus = ecus;
+    ecus = &collector->ecus[collector->ecu_count++];
+    memset(ecus, 0, sizeof(DltReceiveEcuFiles));
+    memcpy(ecus->ecuid, ecuid, DLT_ID_SIZE);
+    memcpy(base, ecuid, DLT_ID_SIZE);
+
+    /* a failed ECU is remembered with a closed handle and not tried again */
+    if (multiple_files_buffer_init(&ecus->files, dltdata->dvalue, dltdata->file_size, dltdata->tvalue,
+                                   false, false, base, ".dlt") < DLT_RETURN_OK) {
+        fprintf(stderr, "ERROR: Files for ECU %s cannot be created in %s\n", base, dltdata->dvalue);
+        ecus->files.ohandle = -1;
+        return NULL;
+    }
+
+    return ecus;
+}
+
+/*
+ * Write a batch of messages to the merged output file
+ */
+int dlt_receive_collect_write(DltReceiveCollector *collector, struct iovec *iov, int count, int64_t size)
+{
+    DltReceiveData *dltdata = collector->dltdata;
+
+    if (count == 0)
+        return 0;
+
+    if ((dltdata->climit > -1) && (dltdata->totalbytes > 0) && (size + dltdata->totalbytes > dltdata->climit)) {
+        dlt_receive_close_output_file(dltdata);
+
+        if (dlt_receive_open_output_file(dltdata) < 0) {
+            fprintf(stderr, "ERROR: Unable to open log when maximum filesize was reached!\n");
+            return -1;
+        }
+
+        dltdata->totalbytes = 0;
+    }
+
+    ssize_t bytes_written = writev(dltdata->ohandle, iov, count);
+
+    if (bytes_written < 0) {
+        fprintf(stderr, "ERROR: Writing output file failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    dltdata->totalbytes += bytes_written;
+
+    return 0;
+}
+
+/*
+ * Stream callback of the collector, called with a batch of received messages
+ */
+int dlt_receive_collect_callback(DltClient *client, const DltMessageView *views, uint32_t count, void *data)
+{
+    DltReceiveSource *source = (DltReceiveSource *)data;
+    DltReceiveCollector *collector = source->collector;
+    DltReceiveData *dltdata = collector->dltdata;
+    DltStorageHeader storageheaders[DLT_RECEIVE_COLLECT_BATCH_MAX];
+    struct iovec iov[DLT_RECEIVE_COLLECT_BATCH_MAX * 3];
+    static char text[DLT_RECEIVE_BUFSIZE];
+    DltStorageHeader now;
+    DltMessage msg;
+    int iov_count = 0;
+    int iov_messages = 0;
+    int64_t iov_size = 0;
+    uint32_t i;
+
+    (void)client;
+
+    /* all messages of a batch get the same reception time */
+    dlt_set_storageheader(&now, source->ecuid);
+
+    for (i = 0; i < count; i++) {
+        const DltMessageView *view = &views[i];
+        DltStorageHeader *storageheader = &storageheaders[i];
+        int32_t size = (int32_t)sizeof(DltStorageHeader) + view->headersize + view->datasize;
+
+        *storageheader = now;
+
+        if (DLT_IS_HTYP_WEID(view->standardheader->htyp))
+            memcpy(storageheader->ecu, view->headerextra.ecu, DLT_ID_SIZE);
+
+        /* the message refers to the receive buffer, only a printed message is copied */
+        memset(&msg, 0, sizeof(msg));
+        msg.storageheader = storageheader;
+        msg.standardheader = (DltStandardHeader *)(uintptr_t)view->standardheader;
+        msg.extendedheader = (DltExtendedHeader *)(uintptr_t)view->extendedheader;
+        msg.headerextra = view->headerextra;
+        msg.headersize = (int32_t)sizeof(DltStorageHeader) + view->headersize;
+        msg.databuffer = (uint8_t *)(uintptr_t)view->payload;
+        msg.datasize = view->datasize;
+
+        if ((dltdata->fvalue || dltdata->jvalue) &&
+            (dlt_filter_engine_match(&(dltdata->filter), &msg) != DLT_RETURN_TRUE)) {
+            source->filtered++;
+            continue;
+        }
+
+        if (dltdata->xflag || dltdata->aflag || dltdata->mflag || dltdata->sflag) {
+            dlt_message_copy_view(&collector->msg, view, dltdata->vflag);
+            *collector->msg.storageheader = *storageheader;
+            dlt_receive_print_message(dltdata, &collector->msg, text);
+        }
+
+        if (dltdata->dvalue) {
+            DltReceiveEcuFiles *ecu = dlt_receive_ecu_files(collector, storageheader->ecu);
+            struct iovec ecu_iov[3] = {
+                { storageheader, sizeof(DltStorageHeader) },
+                { (void *)(uintptr_t)view->header, (size_t)view->headersize },
+                { (void *)(uintptr_t)view->payload, (size_t)view->datasize }
+            };
+
+            if (ecu != NULL)
+                multiple_files_buffer_rotate_file(&ecu->files, size);
+
+            /* the message is still written to the merged output */
+            if ((ecu == NULL) || (ecu->files.ohandle < 0) || (writev(ecu->files.ohandle, ecu_iov, 3) != size))
+                source->dropped++;
+            else if (!dltdata->ovalue)
+                source->written++;
+        }
+
+        if (dltdata->ovalue) {
+            /* keep the batch together, unless the output file has to be rotated */
+            if ((dltdata->climit > -1) && (iov_size + size + dltdata->totalbytes > dltdata->climit)) {
+                if (dlt_receive_collect_write(collector, iov, iov_count, iov_size) < 0) {
+                    source->dropped += (uint64_t)iov_messages;
+                    source->written -= (uint64_t)iov_messages;
+                }
+
+                iov_count = 0;
+                iov_messages = 0;
+                iov_size = 0;
+            }
+
+            if (dltdata->Iflag && dltdata->iwriter.handle)
+                dlt_file_index_writer_add(&dltdata->iwriter, (uint64_t)(dltdata->totalbytes + iov_size), &msg);
+
+            iov[iov_count].iov_base = storageheader;
+            iov[iov_count++].iov_len = sizeof(DltStorageHeader);
+            iov[iov_count].iov_base = (void *)(uintptr_t)view->header;
+            iov[iov_count++].iov_len = (size_t)view->headersize;
+            iov[iov_count].iov_base = (void *)(uintptr_t)view->payload;
+            iov[iov_count++].iov_len = (size_t)view->datasize;
+            iov_messages++;
+            iov_size += size;
+            source->written++;
+        }
+    }
+
+    if (dlt_receive_collect_write(collector, iov, iov_count, iov_size) < 0) {
+        source->dropped += (uint64_t)iov_messages;
+        source->written -= (uint64_t)iov_messages;
+    }
+
+    return sig_close_recv ? 1 : 0;
+}
+
+void dlt_receive_collect_statistics(DltReceiveCollector *collector)
+{
+    double seconds = (double)(dlt_receive_time_ms() - collector->start) / 1000.0;
+    int i;
+
+    if (seconds <= 0.0)
+        seconds = 0.001;
+
+    fprintf(stderr, "%-4s %-24s %8s %12s %8s %10s %9s %10s %10s %8s %10s\n",
+            "ECU", "Endpoint", "Connects", "Bytes", "MB/s", "Messages", "Msgs/s",
+            "Written", "Filtered", "Dropped", "Skipped");
+
+    for (i = 0; i < collector->source_count; i++) {
+        DltReceiveSource *source = &collector->sources[i];
+        char ecuid[DLT_ID_SIZE + 1] = { 0 };
+        uint64_t bytes = source->bytes;
+        uint64_t messages = source->messages;
+        uint64_t skipped = source->skipped;
+
+        if (source->connected) {
+            bytes += source->stream.bytes;
+            messages += source->stream.messages;
+            skipped += source->stream.skipped;
+        }
+
+        memcpy(ecuid, source->ecuid, DLT_ID_SIZE);
+        fprintf(stderr, "%-4s %-24s %8" PRIu64 " %12" PRIu64 " %8.2f %10" PRIu64 " %9.0f %10" PRIu64
+                " %10" PRIu64 " %8" PRIu64 " %10" PRIu64 "\n",
+                ecuid, source->endpoint, source->connects, bytes,
+                (double)bytes / seconds / (1024.0 * 1024.0), messages, (double)messages / seconds,
+                source->written, source->filtered, source->dropped, skipped);
+    }
+}
+
+/*
+ * Receive from all endpoints until all connections are closed or the tool is stopped
+ */
+int dlt_receive_collect(DltReceiveData *dltdata, char **endpoints, int endpoint_count)
+{
+    DltReceiveCollector collector;
+    struct pollfd *fds;
+    DltReceiveSource **polled;
+    int ret = 0;
+    int i;
+
+    memset(&collector, 0, sizeof(collector));
+    collector.dltdata = dltdata;
+    collector.source_count = endpoint_count;
+    collector.sources = calloc((size_t)endpoint_count, sizeof(DltReceiveSource));
+    fds = calloc((size_t)endpoint_count, sizeof(struct pollfd));
+    polled = calloc((size_t)endpoint_count, sizeof(DltReceiveSource *));
+
+    if ((collector.sources == NULL) || (fds == NULL) || (polled == NULL)) {
+        fprintf(stderr, "Memory allocation failed.\n");
+        free(collector.sources);
+        free(fds);
+        free(polled);
+        return -1;
+    }
+
+    dlt_message_init(&collector.msg, dltdata->vflag);
+
+    for (i = 0; i < endpoint_count; i++) {
+        collector.sources[i].collector = &collector;
+        collector.sources[i].client.sock = -1;
+
+        if (dlt_receive_source_init(&collector.sources[i], dltdata, endpoints[i]) < 0) {
+            fprintf(stderr, "ERROR: Invalid endpoint %s\n", endpoints[i]);
+            collector.source_count = i + 1;
+            ret = -1;
+            break;
+        }
+    }
+
+    collector.start = dlt_receive_time_ms();
+
+    while ((ret == 0) && !sig_close_recv) {
+        int64_t now = dlt_receive_time_ms();
+        int timeout = DLT_RECEIVE_COLLECT_POLL_TIMEOUT;
+        int pending = 0;
+        int count = 0;
+
+        for (i = 0; i < collector.source_count; i++) {
+            DltReceiveSource *source = &collector.sources[i];
+
+            if (!source->connected && (source->reconnect >= 0) && (source->reconnect <= now)) {
+                source->reconnect = -1;
+
+                if (dlt_client_connect(&source->client, dltdata->vflag) == DLT_RETURN_OK) {
+                    source->connects++;
+
+                    /* the daemon forgets the filter with the connection */
+                    if (dltdata->Dflag &&
+                        (dlt_client_send_client_filter(&source->client, &(dltdata->filter)) < DLT_RETURN_OK))
+                        dlt_vlog(LOG_WARNING, "Filter could not be sent to %s\n", source->endpoint);
+
+                    if (dlt_client_stream_init(&source->stream, &source->client, 0,
+                                               DLT_RECEIVE_COLLECT_BATCH_MAX,
+                                               dlt_receive_collect_callback, source) == DLT_RETURN_OK)
+                        source->connected = 1;
+                    else
+                        close(source->client.sock);
+                }
+                else if (dltdata->rflag) {
+                    source->reconnect = now + dltdata->rvalue;
+                }
+            }
+
+            if (source->connected) {
+                fds[count].fd = source->client.receiver.fd;
+                fds[count].events = POLLIN;
+                fds[count].revents = 0;
+                polled[count++] = source;
+            }
+            else if (source->reconnect >= 0) {
+                pending = 1;
+
+                if (source->reconnect - now < timeout)
+                    timeout = (int)(source->reconnect > now ? source->reconnect - now : 0);
+            }
+        }
+
+        if ((count == 0) && !pending)
+            break;
+
+        int ready = poll(fds, (nfds_t)count, timeout);
+
+        if (ready < 0) {
+            if (errno != EINTR) {
+                fprintf(stderr, "ERROR: poll failed: %s\n", strerror(errno));
+                ret = -1;
+            }
+        }
+        else {
+            for (i = 0; i < count; i++)
+                if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) &&
+                    (dlt_client_stream_process(&polled[i]->stream, dltdata->vflag) != DLT_RETURN_TRUE))
+                    dlt_receive_source_disconnect(polled[i]);
+        }
+
+        if (sig_print_stats) {
+            sig_print_stats = false;
+            dlt_receive_collect_statistics(&collector);
+        }
+    }
+
+    for (i = 0; i < collector.source_count; i++) {
+        dlt_receive_source_disconnect(&collector.sources[i]);
+    }
+
+    dlt_receive_collect_statistics(&collector);
+
+    for (i = 0; i < collector.source_count; i++)
+        dlt_client_cleanup(&collector.sources[i].client, dltdata->vflag);
+
+    for (i = 0; i < collector.ecu_count; i++)
+        if (collector.ecus[i].files.ohandle >= 0)
+            multiple_files_buffer_free(&collector.ecus[i].files);
+
+    dlt_message_free(&collector.msg, dltdata->vflag);
+    free(collector.ecus);
+    free(collector.sources);
+    free(fds);
+    free(polled);
+
+    return ret;
 }
 
 
@@ -327,6 +880,7 @@ int main(int argc, char *argv[])
     memset(&dltdata, 0, sizeof(dltdata));
     int c;
     int index;
+    int ret = 0;
 
     /* Initialize dltdata */
     dltdata.climit = -1; /* default: -1 = unlimited */
@@ -345,11 +899,12 @@ int main(int argc, char *argv[])
     sigaction(SIGTERM, &act, 0);
     sigaction(SIGINT, &act, 0);
     sigaction(SIGQUIT, &act, 0);
+    sigaction(SIGUSR1, &act, 0);
 
     /* Fetch command line arguments */
     opterr = 0;
 
-    while ((c = getopt(argc, argv, "vashSRyuxmf:j:o:e:b:c:p:i:r:")) != -1)
+    while ((c = getopt(argc, argv, "vashSRyuxmIDMf:j:o:e:b:c:p:i:r:d:t:")) != -1)
         switch (c) {
         case 'v':
         {
@@ -401,6 +956,39 @@ int main(int argc, char *argv[])
             dltdata.uflag = 1;
             break;
         }
+        case 'I':
+        {
+            dltdata.Iflag = 1;
+            break;
+        }
+        case 'D':
+        {
+            dltdata.Dflag = 1;
+            break;
+        }
+        case 'M':
+        {
+            dltdata.Mflag = 1;
+            break;
+        }
+        case 'd':
+        {
+            dltdata.dvalue = optarg;
+            break;
+        }
+        case 't':
+        {
+            int64_t limit = convert_arg_to_byte_size(optarg);
+
+            if ((limit < 0) || (limit > INT_MAX)) {
+                fprintf (stderr, "Invalid argument for option -t.\n");
+                usage();
+                return -1;
+            }
+
+            dltdata.tvalue = (int)limit;
+            break;
+        }
         case 'i':
         {
             dltdata.ifaddr = optarg;
@@ -477,7 +1065,7 @@ int main(int argc, char *argv[])
         }
         case '?':
         {
-            if ((optopt == 'o') || (optopt == 'f') || (optopt == 'c'))
+            if ((optopt == 'o') || (optopt == 'f') || (optopt == 'c') || (optopt == 'd') || (optopt == 't'))
                 fprintf (stderr, "Option -%c requires an argument.\n", optopt);
             else if (isprint (optopt))
                 fprintf (stderr, "Unknown option `-%c'.\n", optopt);
@@ -509,7 +1097,31 @@ int main(int argc, char *argv[])
         dltclient.mode = dltdata.yflag;
     }
 
-    if (dltclient.mode == DLT_CLIENT_MODE_TCP || dltclient.mode == DLT_CLIENT_MODE_UDP_MULTICAST) {
+    if (dltdata.Mflag) {
+        if (optind >= argc) {
+            /* no endpoint selected, show usage and terminate */
+            fprintf(stderr, "ERROR: No endpoint selected\n");
+            usage();
+            return -1;
+        }
+
+        if (dltdata.uflag) {
+            fprintf(stderr, "ERROR: UDP multicast is not supported in collector mode\n");
+            return -1;
+        }
+
+        if (dltdata.dvalue) {
+            dltdata.file_size = DLT_RECEIVE_COLLECT_FILE_SIZE;
+
+            if (dltdata.climit > -1)
+                dltdata.file_size = dltdata.climit > INT_MAX ? INT_MAX : (int)dltdata.climit;
+
+            if (dltdata.tvalue == 0)
+                dltdata.tvalue = dltdata.file_size > INT_MAX / DLT_RECEIVE_COLLECT_FILE_COUNT ?
+                    INT_MAX : dltdata.file_size * DLT_RECEIVE_COLLECT_FILE_COUNT;
+        }
+    }
+    else if (dltclient.mode == DLT_CLIENT_MODE_TCP || dltclient.mode == DLT_CLIENT_MODE_UDP_MULTICAST) {
         dltclient.port = (uint16_t)dltdata.port;
 
         unsigned int servIPLength = 1; // Counting the terminating 0 byte
@@ -577,15 +1189,15 @@ int main(int argc, char *argv[])
     dlt_file_init(&(dltdata.file), dltdata.vflag);
 
     /* first parse filter file if filter parameter is used */
-    dlt_filter_init(&(dltdata.filter), dltdata.vflag);
+    dlt_filter_engine_init(&(dltdata.filter));
 
     if (dltdata.fvalue) {
-        if (dlt_filter_load(&(dltdata.filter), dltdata.fvalue, dltdata.vflag) < DLT_RETURN_OK) {
+        if (dlt_filter_engine_load(&(dltdata.filter), dltdata.fvalue, dltdata.vflag) < DLT_RETURN_OK) {
             dlt_file_free(&(dltdata.file), dltdata.vflag);
             return -1;
         }
 
-        dlt_file_set_filter(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
+        dlt_file_set_filter_engine(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
     }
 
     #ifdef EXTENDED_FILTERING
@@ -596,7 +1208,7 @@ int main(int argc, char *argv[])
             return -1;
         }
 
-        dlt_file_set_filter(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
+        dlt_file_set_filter_engine(&(dltdata.file), &(dltdata.filter), dltdata.vflag);
     }
 
     #endif
@@ -610,6 +1222,9 @@ int main(int argc, char *argv[])
         }
         else { /* in case no limit for the output file is given, we simply overwrite any existing file */
             dltdata.ohandle = open(dltdata.ovalue, O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+            if ((dltdata.ohandle >= 0) && dltdata.Iflag)
+                dlt_receive_open_index_file(&dltdata);
         }
 
         if (dltdata.ohandle == -1) {
@@ -624,10 +1239,20 @@ int main(int argc, char *argv[])
     else{
         dlt_set_id(dltdata.ecuid, DLT_RECEIVE_ECU_ID);}
 
-    while (true) {
+    if (dltdata.Mflag)
+        ret = dlt_receive_collect(&dltdata, &argv[optind], argc - optind);
+
+    while (!dltdata.Mflag) {
         /* Attempt to connect to TCP socket or open serial device */
         if (dlt_client_connect(&dltclient, dltdata.vflag) != DLT_RETURN_ERROR) {
 
+            /* The filter is sent again after every reconnect, the daemon
+             * forgets it with the connection. Messages are still filtered
+             * here as the daemon does not check all conditions. */
+            if (dltdata.Dflag &&
+                (dlt_client_send_client_filter(&dltclient, &(dltdata.filter)) < DLT_RETURN_OK))
+                dlt_vlog(LOG_WARNING, "Filter could not be sent to the daemon\n");
+
             /* Dlt Client Main Loop */
             dlt_client_main_loop(&dltclient, &dltdata, dltdata.vflag);
 
@@ -645,16 +1270,52 @@ int main(int argc, char *argv[])
     }
 
     /* dlt-receive cleanup */
-    if (dltdata.ovalue)
+    if (dltdata.ovalue) {
         close(dltdata.ohandle);
 
+        if (dltdata.Iflag)
+            dlt_file_index_writer_free(&dltdata.iwriter);
+    }
+
     free(dltdata.ovaluebase);
 
     dlt_file_free(&(dltdata.file), dltdata.vflag);
 
-    dlt_filter_free(&(dltdata.filter), dltdata.vflag);
+    dlt_filter_engine_free(&(dltdata.filter));
 
-    return 0;
+    return ret;
+}
+
+/*
+ * print message in the format selected on the command line
+ */
+void dlt_receive_print_message(DltReceiveData *dltdata, DltMessage *message, char *text)
+{
+    if (dltdata->xflag) {
+        dlt_message_print_hex(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
+    }
+    else if (dltdata->aflag)
+    {
+
+        dlt_message_header(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
+
+        printf("%s ", text);
+
+        dlt_message_payload(message, text, DLT_RECEIVE_BUFSIZE, DLT_OUTPUT_ASCII, dltdata->vflag);
+
+        printf("[%s]\n", text);
+    }
+    else if (dltdata->mflag)
+    {
+        dlt_message_print_mixed_plain(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
+    }
+    else if (dltdata->sflag)
+    {
+
+        dlt_message_header(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
+
+        printf("%s \n", text);
+    }
 }
 
 int dlt_receive_message_callback(DltMessage *message, void *data)
@@ -677,33 +1338,9 @@ int dlt_receive_message_callback(DltMessage *message, void *data)
         dlt_set_storageheader(message->storageheader, dltdata->ecuid);
 
     if (((dltdata->fvalue || dltdata->jvalue) == 0) ||
-        (dlt_message_filter_check(message, &(dltdata->filter), dltdata->vflag) == DLT_RETURN_TRUE)) {
+        (dlt_filter_engine_match(&(dltdata->filter), message) == DLT_RETURN_TRUE)) {
         /* if no filter set or filter is matching display message */
-        if (dltdata->xflag) {
-            dlt_message_print_hex(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
-        }
-        else if (dltdata->aflag)
-        {
-
-            dlt_message_header(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
-
-            printf("%s ", text);
-
-            dlt_message_payload(message, text, DLT_RECEIVE_BUFSIZE, DLT_OUTPUT_ASCII, dltdata->vflag);
-
-            printf("[%s]\n", text);
-        }
-        else if (dltdata->mflag)
-        {
-            dlt_message_print_mixed_plain(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
-        }
-        else if (dltdata->sflag)
-        {
-
-            dlt_message_header(message, text, DLT_RECEIVE_BUFSIZE, dltdata->vflag);
-
-            printf("%s \n", text);
-        }
+        dlt_receive_print_message(dltdata, message, text);
 
         /* if file output enabled write message */
         if (dltdata->ovalue) {
@@ -730,12 +1367,15 @@ int dlt_receive_message_callback(DltMessage *message, void *data)
 
             bytes_written = (int)writev(dltdata->ohandle, iov, 2);
 
-            dltdata->totalbytes += bytes_written;
-
             if (0 > bytes_written) {
                 printf("dlt_receive_message_callback: writev(dltdata->ohandle, iov, 2); returned an error!");
                 return -1;
             }
+
+            if (dltdata->Iflag && dltdata->iwriter.handle)
+                dlt_file_index_writer_add(&dltdata->iwriter, (uint64_t)dltdata->totalbytes, message);
+
+            dltdata->totalbytes += bytes_written;
         }
     }
 
@@ -65,6 +65,8 @@
 #include <stdarg.h>
 #include <time.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
 
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -77,12 +79,64 @@
 #define FIFTY_SEC_IN_MSEC 500000
 #define THREE_MIN_IN_SEC  180
 
+#define SORT_MAX_JOBS            256
+#define SORT_RUN_BUFFER_SIZE     (256 * 1024)       /* read buffer of every run file during merge */
+#define SORT_WRITE_BUFFER_SIZE   (4 * 1024 * 1024)  /* buffer of run files and output file */
+#define SORT_MESSAGE_MAX_SIZE    (sizeof(DltStorageHeader) + UINT16_MAX)
+
 typedef struct sTimestampIndex {
     int num;
     uint32_t tmsp;
     uint32_t systmsp;
 } TimestampIndex;
 
+/* Sort order of a message in external sort and merge mode */
+typedef struct sSortKey {
+    uint64_t primary;   /* boot cycle, or storage time when merging files */
+    uint64_t secondary; /* timestamp, or number of input file when merging files */
+    uint64_t sequence;  /* position in input, keeps the order of equal messages */
+} SortKey;
+
+/* Message of a run which is sorted in memory */
+typedef struct sSortRecord {
+    SortKey key;
+    const uint8_t *data;
+    uint32_t size;
+} SortRecord;
+
+/* Header of a message in a run file */
+typedef struct sRunRecordHeader {
+    SortKey key;
+    uint32_t size;
+} RunRecordHeader;
+
+/* Run of messages which is sorted by a thread and spilled to a temporary file */
+typedef struct sSortRun {
+    SortRecord *records;
+    uint32_t count;
+    uint32_t size;
+    FILE *handle;       /* unlinked temporary file */
+    const char *tmpdir;
+    pthread_t thread;
+    int threaded;       /* sorted by an own thread which has to be joined */
+    int error;
+} SortRun;
+
+/* Sorted input of the k-way merge, either a run file or a DLT file */
+typedef struct sMergeSource {
+    SortKey key;            /* key of current message */
+    const uint8_t *data;    /* current message */
+    uint32_t size;
+    int (*next)(struct sMergeSource *source);
+    FILE *handle;           /* run file */
+    uint8_t *buffer;
+    DltFile file;           /* DLT input file */
+    DltFileIterator iterator;
+    uint32_t number;        /* number of the input file */
+    uint64_t count;         /* messages read from the input file */
+    int error;              /* reading failed before the end */
+} MergeSource;
+
 int verbosity = 0;
 
 /**
@@ -149,6 +203,7 @@ int compare_index_systime(const void *a, const void *b) {
 void write_messages(int ohandle, DltFile *file,
         TimestampIndex *timestamps, uint32_t message_count) {
     struct iovec iov[2];
+    DltMessageView view;
     ssize_t bytes_written;
     uint32_t i = 0;
     int last_errno = 0;
@@ -163,12 +218,21 @@ void write_messages(int ohandle, DltFile *file,
         if (timestamps == NULL) {
             continue;
         }
-        if (dlt_file_message(file, timestamps[i].num, 0) < DLT_RETURN_OK)
-            continue;
-        iov[0].iov_base = file->msg.headerbuffer;
-        iov[0].iov_len = (size_t)file->msg.headersize;
-        iov[1].iov_base = file->msg.databuffer;
-        iov[1].iov_len = (size_t)file->msg.datasize;
+        if (dlt_file_message_view(file, timestamps[i].num, &view, 0) >= DLT_RETURN_OK) {
+            /* write directly from the mapped file */
+            iov[0].iov_base = (void *)(uintptr_t)view.header;
+            iov[0].iov_len = (size_t)view.headersize;
+            iov[1].iov_base = (void *)(uintptr_t)view.payload;
+            iov[1].iov_len = (size_t)view.datasize;
+        }
+        else {
+            if (dlt_file_message(file, timestamps[i].num, 0) < DLT_RETURN_OK)
+                continue;
+            iov[0].iov_base = file->msg.headerbuffer;
+            iov[0].iov_len = (size_t)file->msg.headersize;
+            iov[1].iov_base = file->msg.databuffer;
+            iov[1].iov_len = (size_t)file->msg.datasize;
+        }
 
         bytes_written = writev(ohandle, iov, 2);
         last_errno = errno;
@@ -183,13 +247,473 @@ void write_messages(int ohandle, DltFile *file,
             }
             free(timestamps);
             timestamps = NULL;
+            dlt_file_free(file, 0);
+            exit (-1);
         }
-        dlt_file_free(file, 0);
-        exit (-1);
     }
     verbose (2, "\n");
 }
 
+/**
+ * Comparison function for use with qsort and the merge heap
+ * Used for external sort and merge mode
+ */
+int compare_sort_keys(const SortKey *a, const SortKey *b) {
+    if (a->primary != b->primary)
+        return (a->primary > b->primary) ? 1 : -1;
+
+    if (a->secondary != b->secondary)
+        return (a->secondary > b->secondary) ? 1 : -1;
+
+    if (a->sequence != b->sequence)
+        return (a->sequence > b->sequence) ? 1 : -1;
+
+    return 0;
+}
+
+int compare_sort_records(const void *a, const void *b) {
+    return compare_sort_keys(&((const SortRecord *)a)->key, &((const SortRecord *)b)->key);
+}
+
+/**
+ * Sort a run in memory and write it to an unlinked temporary file
+ */
+void *sort_run(void *arg) {
+    SortRun *run = (SortRun *)arg;
+    RunRecordHeader header;
+    char filename[PATH_MAX];
+    uint32_t i;
+    int fd;
+
+    qsort(run->records, run->count, sizeof(SortRecord), compare_sort_records);
+
+    snprintf(filename, sizeof(filename), "%s/dlt-sortbytimestamp-XXXXXX", run->tmpdir);
+    fd = mkstemp(filename);
+
+    if (fd < 0) {
+        fprintf(stderr, "ERROR: Cannot create temporary file in %s: %s\n", run->tmpdir, strerror(errno));
+        run->error = 1;
+        return NULL;
+    }
+
+    unlink(filename);
+    run->handle = fdopen(fd, "w+b");
+
+    if (run->handle == NULL) {
+        close(fd);
+        run->error = 1;
+        return NULL;
+    }
+
+    setvbuf(run->handle, NULL, _IOFBF, SORT_WRITE_BUFFER_SIZE);
+
+    for (i = 0; i < run->count; i++) {
+        memset(&header, 0, sizeof(header));
+        header.key = run->records[i].key;
+        header.size = run->records[i].size;
+
+        if ((fwrite(&header, sizeof(header), 1, run->handle) != 1) ||
+            (fwrite(run->records[i].data, run->records[i].size, 1, run->handle) != 1)) {
+            fprintf(stderr, "ERROR: Cannot write temporary file: %s\n", strerror(errno));
+            run->error = 1;
+            break;
+        }
+    }
+
+    if ((fflush(run->handle) != 0) || (fseek(run->handle, 0, SEEK_SET) != 0))
+        run->error = 1;
+
+    /* records point into the mapped input and are not needed anymore */
+    free(run->records);
+    run->records = NULL;
+
+    return NULL;
+}
+
+/**
+ * Load next message of a run file, sets the error of the source if the file
+ * does not end after a complete message.
+ */
+int merge_next_run(MergeSource *source) {
+    RunRecordHeader header;
+    size_t bytes;
+
+    bytes = fread(&header, 1, sizeof(header), source->handle);
+
+    if ((bytes == 0) && feof(source->handle))
+        return 0;
+
+    if ((bytes != sizeof(header)) || (header.size > SORT_MESSAGE_MAX_SIZE) ||
+        (fread(source->buffer, header.size, 1, source->handle) != 1)) {
+        fprintf(stderr, "ERROR: Cannot read temporary file!\n");
+        source->error = 1;
+        return 0;
+    }
+
+    source->key = header.key;
+    source->data = source->buffer;
+    source->size = header.size;
+
+    return 1;
+}
+
+/**
+ * Load next message of a DLT input file
+ */
+int merge_next_file(MergeSource *source) {
+    DltMessageView view;
+
+    if (dlt_file_iterator_next(&source->iterator, &view, 0) != DLT_RETURN_TRUE)
+        return 0;
+
+    source->key.primary = (uint64_t)view.storageheader->seconds * 1000000U +
+        (uint64_t)(uint32_t)view.storageheader->microseconds;
+    source->key.secondary = source->number;
+    source->key.sequence = source->count++;
+    source->data = view.header;
+    source->size = (uint32_t)(view.headersize + view.datasize);
+
+    return 1;
+}
+
+/**
+ * Restore the heap property below position i
+ */
+void merge_heap_down(MergeSource **heap, uint32_t count, uint32_t i) {
+    MergeSource *tmp;
+    uint32_t smallest;
+
+    while (1) {
+        smallest = i;
+
+        if ((2 * i + 1 < count) && (compare_sort_keys(&heap[2 * i + 1]->key, &heap[smallest]->key) < 0))
+            smallest = 2 * i + 1;
+
+        if ((2 * i + 2 < count) && (compare_sort_keys(&heap[2 * i + 2]->key, &heap[smallest]->key) < 0))
+            smallest = 2 * i + 2;
+
+        if (smallest == i)
+            break;
+
+        tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+/**
+ * Merge sorted sources into one output file with a binary heap.
+ * Returns number of written messages, -1 on error.
+ */
+int64_t merge_sources(MergeSource *sources, uint32_t num_sources, FILE *out) {
+    MergeSource **heap;
+    uint32_t count = 0;
+    uint32_t i;
+    int64_t written = 0;
+
+    heap = (MergeSource **)calloc(num_sources ? num_sources : 1, sizeof(MergeSource *));
+
+    if (heap == NULL)
+        return -1;
+
+    for (i = 0; i < num_sources; i++)
+        if (sources[i].next(&sources[i]))
+            heap[count++] = &sources[i];
+
+    for (i = count / 2; i > 0; i--)
+        merge_heap_down(heap, count, i - 1);
+
+    while (count > 0) {
+        if (fwrite(heap[0]->data, heap[0]->size, 1, out) != 1) {
+            fprintf(stderr, "ERROR: Cannot write output file: %s\n", strerror(errno));
+            written = -1;
+            break;
+        }
+
+        written++;
+
+        if (!heap[0]->next(heap[0]))
+            heap[0] = heap[--count];
+
+        merge_heap_down(heap, count, 0);
+    }
+
+    /* a source which failed would leave its messages out */
+    for (i = 0; i < num_sources; i++)
+        if (sources[i].error)
+            written = -1;
+
+    free(heap);
+
+    return written;
+}
+
+/**
+ * Open the output file with a large write buffer
+ */
+FILE *open_output(const char *filename) {
+    FILE *out = fopen(filename, "wb");
+
+    if (out == NULL)
+        fprintf(stderr, "ERROR: Output file %s cannot be opened!\n", filename);
+    else
+        setvbuf(out, NULL, _IOFBF, SORT_WRITE_BUFFER_SIZE);
+
+    return out;
+}
+
+/**
+ * Sort a file larger than memory: the file is cut into runs of run_size bytes
+ * which are sorted by up to jobs threads and spilled to temporary files. The
+ * runs are merged into the output file afterwards.
+ *
+ * Messages are sorted by boot cycle and timestamp. A new boot cycle is
+ * detected while reading, if timestamp or storage time of two consecutive
+ * messages differ by more than the limits of the in-memory sort.
+ */
+int external_sort(const char *ivalue, const char *ovalue, DltFilter *filter,
+                  uint64_t run_size, int jobs, const char *tmpdir, int cflag) {
+    DltFile file;
+    DltFileIterator iterator;
+    DltMessageView view;
+    SortRun **runs = NULL;
+    SortRun *run = NULL;
+    MergeSource *sources;
+    uint32_t num_runs = 0;
+    uint32_t started = 0;
+    uint32_t joined = 0;
+    uint64_t bytes = 0;
+    uint64_t sequence = 0;
+    uint64_t cycle = 0;
+    uint32_t last_tmsp = 0;
+    uint32_t last_seconds = 0;
+    int64_t written;
+    uint32_t i;
+    FILE *out;
+    int ret = 0;
+
+    dlt_file_init(&file, 0);
+
+    if (filter)
+        dlt_file_set_filter(&file, filter, 0);
+
+    if ((dlt_file_open_mmap(&file, ivalue, 0) < DLT_RETURN_OK) ||
+        (dlt_file_iterator_init(&iterator, &file) < DLT_RETURN_OK)) {
+        dlt_file_free(&file, 0);
+        return -1;
+    }
+
+    verbose(1, "Sorting runs of %" PRIu64 " bytes with %d threads\n", run_size, jobs);
+
+    while (ret == 0) {
+        int found = (dlt_file_iterator_next(&iterator, &view, 0) == DLT_RETURN_TRUE);
+
+        /* hand the current run to a thread if it is full or the input ends */
+        if ((run != NULL) && (!found || (bytes + (uint64_t)view.headersize + (uint64_t)view.datasize > run_size))) {
+            /* limit the number of runs held in memory */
+            if (started - joined >= (uint32_t)jobs) {
+                if (runs[joined]->threaded)
+                    pthread_join(runs[joined]->thread, NULL);
+
+                joined++;
+            }
+
+            if (pthread_create(&run->thread, NULL, sort_run, run) == 0)
+                run->threaded = 1;
+            else
+                sort_run(run);
+
+            started++;
+            verbose(2, "Sorting run %u with %u messages\n", num_runs, run->count);
+            run = NULL;
+            bytes = 0;
+        }
+
+        if (!found)
+            break;
+
+        if (run == NULL) {
+            SortRun **tmp = (SortRun **)realloc(runs, (num_runs + 1) * sizeof(SortRun *));
+
+            if (tmp == NULL) {
+                ret = -1;
+                break;
+            }
+
+            runs = tmp;
+            run = (SortRun *)calloc(1, sizeof(SortRun));
+
+            if (run == NULL) {
+                ret = -1;
+                break;
+            }
+
+            run->tmpdir = tmpdir;
+            runs[num_runs++] = run;
+        }
+
+        if (run->count == run->size) {
+            uint32_t size = run->size ? run->size * 2 : 1024;
+            SortRecord *tmp = (SortRecord *)realloc(run->records, size * sizeof(SortRecord));
+
+            if (tmp == NULL) {
+                ret = -1;
+                break;
+            }
+
+            run->records = tmp;
+            run->size = size;
+        }
+
+        /* detect a new boot cycle */
+        if ((sequence > 0) &&
+            (((uint32_t)llabs((int64_t)view.headerextra.tmsp - last_tmsp) > FIFTY_SEC_IN_MSEC) ||
+             ((uint32_t)llabs((int64_t)view.storageheader->seconds - last_seconds) >= THREE_MIN_IN_SEC))) {
+            verbose(1, "Detected a new cycle of boot\n");
+            cycle++;
+        }
+
+        last_tmsp = view.headerextra.tmsp;
+        last_seconds = view.storageheader->seconds;
+
+        run->records[run->count].key.primary = cycle;
+        run->records[run->count].key.secondary = view.headerextra.tmsp;
+        run->records[run->count].key.sequence = sequence++;
+        run->records[run->count].data = view.header;
+        run->records[run->count].size = (uint32_t)(view.headersize + view.datasize);
+        run->count++;
+        bytes += (uint64_t)view.headersize + (uint64_t)view.datasize;
+    }
+
+    /* wait for all runs */
+    for (i = joined; i < started; i++)
+        if (runs[i]->threaded)
+            pthread_join(runs[i]->thread, NULL);
+
+    if (cflag)
+        printf("Loaded %" PRIu64 " messages in %u runs.\n", sequence, num_runs);
+
+    for (i = 0; i < num_runs; i++)
+        if (runs[i]->error || (runs[i]->handle == NULL))
+            ret = -1;
+
+    if (ret == 0) {
+        verbose(1, "Merging %u runs\n", num_runs);
+
+        sources = (MergeSource *)calloc(num_runs ? num_runs : 1, sizeof(MergeSource));
+        out = open_output(ovalue);
+
+        if ((sources == NULL) || (out == NULL))
+            ret = -1;
+
+        for (i = 0; (i < num_runs) && (ret == 0); i++) {
+            sources[i].handle = runs[i]->handle;
+            sources[i].next = merge_next_run;
+            sources[i].buffer = (uint8_t *)malloc(SORT_MESSAGE_MAX_SIZE);
+            setvbuf(sources[i].handle, NULL, _IOFBF, SORT_RUN_BUFFER_SIZE);
+
+            if (sources[i].buffer == NULL)
+                ret = -1;
+        }
+
+        if (ret == 0) {
+            written = merge_sources(sources, num_runs, out);
+
+            if (written < 0)
+                ret = -1;
+            else
+                verbose(1, "Wrote %" PRId64 " messages\n", written);
+        }
+
+        if (out && (fclose(out) != 0))
+            ret = -1;
+
+        if (sources)
+            for (i = 0; i < num_runs; i++)
+                free(sources[i].buffer);
+
+        free(sources);
+    }
+
+    for (i = 0; i < num_runs; i++) {
+        if (runs[i]->handle)
+            fclose(runs[i]->handle);
+
+        free(runs[i]->records);
+        free(runs[i]);
+    }
+
+    free(runs);
+    dlt_file_free(&file, 0);
+
+    return ret;
+}
+
+/**
+ * Merge several DLT files, which are sorted each, by storage time into one
+ * output file in one streaming pass. Messages with the same storage time
+ * are taken in the order of the input files.
+ */
+int merge_files(char **inputs, uint32_t num_inputs, const char *ovalue, DltFilter *filter, int cflag) {
+    MergeSource *sources;
+    uint64_t total = 0;
+    int64_t written;
+    uint32_t i;
+    FILE *out;
+    int ret = 0;
+
+    sources = (MergeSource *)calloc(num_inputs, sizeof(MergeSource));
+
+    if (sources == NULL)
+        return -1;
+
+    for (i = 0; i < num_inputs; i++) {
+        dlt_file_init(&sources[i].file, 0);
+
+        if (filter)
+            dlt_file_set_filter(&sources[i].file, filter, 0);
+
+        if ((dlt_file_open_mmap(&sources[i].file, inputs[i], 0) < DLT_RETURN_OK) ||
+            (dlt_file_iterator_init(&sources[i].iterator, &sources[i].file) < DLT_RETURN_OK)) {
+            fprintf(stderr, "ERROR: Input file %s cannot be opened!\n", inputs[i]);
+            ret = -1;
+        }
+
+        sources[i].next = merge_next_file;
+        sources[i].number = i;
+    }
+
+    out = (ret == 0) ? open_output(ovalue) : NULL;
+
+    if (out == NULL)
+        ret = -1;
+
+    if (ret == 0) {
+        verbose(1, "Merging %u files\n", num_inputs);
+        written = merge_sources(sources, num_inputs, out);
+
+        if (written < 0)
+            ret = -1;
+
+        if (fclose(out) != 0)
+            ret = -1;
+
+        for (i = 0; i < num_inputs; i++)
+            total += sources[i].count;
+
+        if (cflag)
+            printf("Merged %" PRIu64 " messages from %u files.\n", total, num_inputs);
+    }
+
+    for (i = 0; i < num_inputs; i++)
+        dlt_file_free(&sources[i].file, 0);
+
+    free(sources);
+
+    return ret;
+}
+
 
 /**
  * Print usage information of tool.
@@ -200,6 +724,7 @@ void usage() {
     dlt_get_version(version, DLT_VERBUFSIZE);
 
     printf("Usage: dlt-sortbytimestamp [options] [commands] file_in file_out\n");
+    printf("       dlt-sortbytimestamp -m [options] file_in1 [file_in2 ...] file_out\n");
     printf("Read DLT file, sort by timestamp and store the messages again.\n");
     printf("Use filters to filter DLT messages.\n");
     printf("Use range to cut DLT file. Indices are zero based.\n");
@@ -212,6 +737,12 @@ void usage() {
     printf("  -f filename   Enable filtering of messages\n");
     printf("  -b number     First message in range to be handled (default: first message)\n");
     printf("  -e number     Last message in range to be handled (default: last message)\n");
+    printf("  -M            Map input file into memory, index it in parallel and write without copying\n");
+    printf("  -r size       External sort for files larger than memory: sort runs of <size> MB,\n");
+    printf("                spill them to temporary files and merge them. Incompatible with range options\n");
+    printf("  -j number     Number of runs sorted in parallel (default: number of CPUs)\n");
+    printf("  -t directory  Directory for temporary files (default: TMPDIR or /tmp)\n");
+    printf("  -m            Merge several input files, which are sorted each, by storage time\n");
 }
 
 /**
@@ -220,6 +751,11 @@ void usage() {
 int main(int argc, char *argv[]) {
     int vflag = 0;
     int cflag = 0;
+    int Mflag = 0;
+    int mflag = 0;
+    int jobs = 0;
+    uint64_t run_size = 0;
+    char *tvalue = getenv("TMPDIR");
     char *fvalue = 0;
     char *bvalue = 0;
     char *evalue = 0;
@@ -249,7 +785,7 @@ int main(int argc, char *argv[]) {
 
     verbose(1, "Configuring\n");
 
-    while ((c = getopt (argc, argv, "vchf:b:e:")) != -1) {
+    while ((c = getopt (argc, argv, "vchMmf:b:e:r:j:t:")) != -1) {
         switch (c) {
         case 'v':
         {
@@ -261,6 +797,43 @@ int main(int argc, char *argv[]) {
             cflag = 1;
             break;
         }
+        case 'M':
+        {
+            Mflag = 1;
+            break;
+        }
+        case 'm':
+        {
+            mflag = 1;
+            break;
+        }
+        case 'r':
+        {
+            run_size = strtoull(optarg, NULL, 10) * 1024 * 1024;
+
+            if (run_size == 0) {
+                fprintf(stderr, "ERROR: Invalid run size %s!\n", optarg);
+                return -1;
+            }
+
+            break;
+        }
+        case 'j':
+        {
+            jobs = atoi(optarg);
+
+            if ((jobs < 1) || (jobs > SORT_MAX_JOBS)) {
+                fprintf(stderr, "ERROR: Number of threads must be between 1 and %d!\n", SORT_MAX_JOBS);
+                return -1;
+            }
+
+            break;
+        }
+        case 't':
+        {
+            tvalue = optarg;
+            break;
+        }
         case 'h':
         {
             usage();
@@ -283,7 +856,8 @@ int main(int argc, char *argv[]) {
         }
         case '?':
         {
-            if ((optopt == 'f') || (optopt == 'b') || (optopt == 'e'))
+            if ((optopt == 'f') || (optopt == 'b') || (optopt == 'e') || (optopt == 'r') ||
+                (optopt == 'j') || (optopt == 't'))
                 fprintf (stderr, "Option -%c requires an argument.\n", optopt);
             else if (isprint (optopt))
                 fprintf (stderr, "Unknown option `-%c'.\n", optopt);
@@ -319,7 +893,10 @@ int main(int argc, char *argv[]) {
             return -1;
         }
 
+        dlt_filter_init(&filter, vflag);
+
         if (dlt_filter_load(&filter, fvalue, vflag) < DLT_RETURN_OK) {
+            dlt_filter_free(&filter, vflag);
             dlt_file_free(&file, vflag);
             return -1;
         }
@@ -327,6 +904,41 @@ int main(int argc, char *argv[]) {
         dlt_file_set_filter(&file, &filter, vflag);
     }
 
+    if (tvalue == NULL)
+        tvalue = "/tmp";
+
+    if (jobs == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = (cpus > 0) ? ((cpus > SORT_MAX_JOBS) ? SORT_MAX_JOBS : (int)cpus) : 1;
+    }
+
+    if (mflag || run_size) {
+        int ret;
+
+        if (bvalue || evalue) {
+            fprintf(stderr, "ERROR: can't specify a range for external sort or merge!\n");
+            dlt_file_free(&file, vflag);
+            return -1;
+        }
+
+        if (argc - optind < 2) {
+            fprintf(stderr, "ERROR: Need input and output files!\n");
+            dlt_file_free(&file, vflag);
+            return -1;
+        }
+
+        if (mflag)
+            ret = merge_files(&argv[optind], (uint32_t)(argc - optind - 1), argv[argc - 1],
+                              fvalue ? &filter : NULL, cflag);
+        else
+            ret = external_sort(argv[optind], argv[optind + 1], fvalue ? &filter : NULL,
+                                run_size, jobs, tvalue, cflag);
+
+        verbose(1, "Tidying up.\n");
+        dlt_file_free(&file, vflag);
+        return ret;
+    }
+
     ivalue = argv[optind];
 
     if (!ivalue) {
@@ -355,7 +967,11 @@ int main(int argc, char *argv[]) {
     verbose(1, "Loading\n");
 
     /* load, analyze data file and create index list */
-    if (dlt_file_open(&file, ivalue, vflag) >= DLT_RETURN_OK) {
+    if (Mflag) {
+        if (dlt_file_open_mmap(&file, ivalue, vflag) >= DLT_RETURN_OK)
+            dlt_file_build_index(&file, 0, vflag);
+    }
+    else if (dlt_file_open(&file, ivalue, vflag) >= DLT_RETURN_OK) {
         while (dlt_file_read(&file, vflag) >= DLT_RETURN_OK) {
         }
     }
@@ -404,6 +1020,16 @@ int main(int argc, char *argv[]) {
 
     for (num = begin; num <= end; num++) {
         int curr_idx = num - begin;
+        if (dlt_file_is_mapped(&file) == DLT_RETURN_TRUE) {
+            DltMessageView view;
+
+            if (dlt_file_message_view(&file, num, &view, vflag) < DLT_RETURN_OK)
+                continue;
+            timestamp_index[curr_idx].num = num;
+            timestamp_index[curr_idx].systmsp = view.storageheader->seconds;
+            timestamp_index[curr_idx].tmsp = view.headerextra.tmsp;
+            continue;
+        }
         if (dlt_file_message(&file, num, vflag) < DLT_RETURN_OK)
             continue;
         timestamp_index[curr_idx].num = num;
@@ -412,9 +1038,9 @@ int main(int argc, char *argv[]) {
     }
 
     /* This step is extending the array one more element by copying the first element */
-    timestamp_index[message_count + 1].num = timestamp_index[0].num;
-    timestamp_index[message_count + 1].systmsp = timestamp_index[0].systmsp;
-    timestamp_index[message_count + 1].tmsp = timestamp_index[0].tmsp;
+    timestamp_index[message_count].num = timestamp_index[0].num;
+    timestamp_index[message_count].systmsp = timestamp_index[0].systmsp;
+    timestamp_index[message_count].tmsp = timestamp_index[0].tmsp;
 
     verbose(1, "Sorting\n");
     qsort((void *) timestamp_index, message_count, sizeof(TimestampIndex), compare_index_systime);
@@ -463,7 +1089,7 @@ int main(int argc, char *argv[]) {
      * all messages out.
      */
     if (count == message_count) {
-        qsort((void *) timestamp_index, message_count + 1,
+        qsort((void *) timestamp_index, message_count,
               sizeof(TimestampIndex), compare_index_timestamps);
         write_messages(ohandle, &file, timestamp_index, count);
     }
@@ -473,5 +1099,9 @@ int main(int argc, char *argv[]) {
     free(timestamp_index);
     timestamp_index = NULL;
     dlt_file_free(&file, vflag);
+
+    if (fvalue)
+        dlt_filter_free(&filter, vflag);
+
     return 0;
 }
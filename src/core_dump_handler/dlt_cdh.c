@@ -47,6 +47,10 @@
 #define COREDUMP_FILESYSTEM_MIN_SIZE_MB         40
 #define COREDUMP_HANDLER_PRIORITY               -19
 
+#define SPARSE_STACK_SIZE_DEFAULT               (256 * 1024)
+#define SPARSE_WRITABLE_SIZE_DEFAULT            (1024 * 1024)
+#define SPARSE_READONLY_SIZE_DEFAULT            4096
+
 void core_locks(const proc_info_t *p_proc, int action);
 
 /* ===================================================================
@@ -69,6 +73,10 @@ void init_proc_info(proc_info_t *p_proc)
     p_proc->signal = 0;
 
     p_proc->can_create_coredump = 1;
+    p_proc->config.mode = CDH_MODE_FULL;
+    p_proc->config.stack_size = SPARSE_STACK_SIZE_DEFAULT;
+    p_proc->config.writable_size = SPARSE_WRITABLE_SIZE_DEFAULT;
+    p_proc->config.readonly_size = SPARSE_READONLY_SIZE_DEFAULT;
     memset(&p_proc->streamer, 0, sizeof(p_proc->streamer));
 
     memset(&p_proc->m_Ehdr, 0, sizeof(p_proc->m_Ehdr));
@@ -98,7 +106,7 @@ void init_proc_info(proc_info_t *p_proc)
 cdh_status_t read_args(int argc, char **argv, proc_info_t *proc)
 {
     if (argc < 5) {
-        syslog(LOG_ERR, "Usage: cdh timestamp pid signal procname");
+        syslog(LOG_ERR, "Usage: cdh timestamp pid signal procname [configfile]");
         return CDH_NOK;
     }
 
@@ -128,6 +136,52 @@ cdh_status_t read_args(int argc, char **argv, proc_info_t *proc)
     return CDH_OK;
 }
 
+/* ===================================================================
+** Method      : read_config(...)
+**
+** Description : reads the configuration file, a missing file keeps the
+**               defaults
+**
+** Parameters  : INPUT p_filename
+**               OUTPUT pointer to configuration structure
+**
+** Returns     : 0 if success, else -1
+** ===================================================================*/
+cdh_status_t read_config(const char *p_filename, cdh_config_t *p_config)
+{
+    FILE *l_file = NULL;
+    char l_line[256];
+    char l_key[64];
+    unsigned long long l_value = 0;
+
+    if ((l_file = fopen(p_filename, "r")) == NULL) {
+        if (errno != ENOENT)
+            syslog(LOG_WARNING, "Cannot open configuration file <%s>. %s", p_filename, strerror(errno));
+
+        return CDH_NOK;
+    }
+
+    while (fgets(l_line, sizeof(l_line), l_file) != NULL) {
+        if ((l_line[0] == '#') || (sscanf(l_line, " %63[^= \t] = %llu", l_key, &l_value) != 2))
+            continue;
+
+        if (strcmp(l_key, "CoreDumpMode") == 0)
+            p_config->mode = (l_value == CDH_MODE_SPARSE) ? CDH_MODE_SPARSE : CDH_MODE_FULL;
+        else if (strcmp(l_key, "SparseStackSize") == 0)
+            p_config->stack_size = l_value;
+        else if (strcmp(l_key, "SparseWritableSize") == 0)
+            p_config->writable_size = l_value;
+        else if (strcmp(l_key, "SparseReadOnlySize") == 0)
+            p_config->readonly_size = l_value;
+        else
+            syslog(LOG_WARNING, "Unknown option <%s> in configuration file <%s>", l_key, p_filename);
+    }
+
+    fclose(l_file);
+
+    return CDH_OK;
+}
+
 /* ===================================================================
 ** Method      : remove_unusual_chars(...)
 **
@@ -197,13 +251,17 @@ void clean_core_tmp_dir()
             struct stat unused_stat;
 
             /* check if lock file exists */
-            snprintf(lockfilepath, sizeof(lockfilepath), "%s/%s", CORE_LOCK_DIRECTORY, dir->d_name);
+            if (snprintf(lockfilepath, sizeof(lockfilepath), "%s/%s", CORE_LOCK_DIRECTORY,
+                         dir->d_name) >= (int)sizeof(lockfilepath))
+                continue;
 
             if (stat(lockfilepath, &unused_stat) != 0) {
                 /* No lock file found for this coredump => from previous LC => delete */
                 char filepath[CORE_MAX_FILENAME_LENGTH] = { 0 };
 
-                snprintf(filepath, sizeof(filepath), "%s/%s", CORE_TMP_DIRECTORY, dir->d_name);
+                if (snprintf(filepath, sizeof(filepath), "%s/%s", CORE_TMP_DIRECTORY,
+                             dir->d_name) >= (int)sizeof(filepath))
+                    continue;
 
                 syslog(LOG_INFO, "Cleaning %s: delete file %s", CORE_TMP_DIRECTORY, filepath);
 
@@ -348,7 +406,9 @@ int main(int argc, char *argv[])
     if (read_args(argc, argv, &l_proc_info) < 0)
         exit(-1);
 
-    if (get_exec_name(l_proc_info.pid, l_proc_info.name, sizeof(l_proc_info.name)) != 0)
+    read_config((argc > 5) ? argv[5] : CDH_CONFIG_FILE, &l_proc_info.config);
+
+    if (get_exec_name((unsigned int)l_proc_info.pid, l_proc_info.name, sizeof(l_proc_info.name)) != 0)
         syslog(LOG_ERR, "Failed to get executable name");
 
     syslog(LOG_NOTICE, "Handling coredump procname:%s pid:%d timest:%d signal:%d",
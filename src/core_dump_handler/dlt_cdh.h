@@ -45,14 +45,33 @@
 #define CORE_FILE_PATTERN           "%s/core.%d.%s.%d.gz"
 #define CONTEXT_FILE_PATTERN        "%s/context.%d.%s.%d.txt"
 
+#define CDH_CONFIG_FILE             CONFIGURATION_FILES_DIR "/dlt-cdh.conf"
+
+/* Modes of writing the coredump */
+#define CDH_MODE_FULL               0
+#define CDH_MODE_SPARSE             1
+
+/* Note of a sparse coredump which lists the memory ranges that were not written */
+#define CDH_NOTE_NAME               "DLTCDH"
+#define NT_CDH_SKIPPED              0x44430001
+
+/* Segment types in the NT_CDH_SKIPPED note */
+#define CDH_SEGMENT_STACK           1
+#define CDH_SEGMENT_WRITABLE        2
+#define CDH_SEGMENT_READONLY        3
+
 #if ((__SIZEOF_POINTER__) == 4)
 #define ELF_Ehdr    Elf32_Ehdr
 #define ELF_Phdr    Elf32_Phdr
+#define ELF_Off     Elf32_Off
+#define ELF_Addr    Elf32_Addr
 #define ELF_Shdr    Elf32_Shdr
 #define ELF_Nhdr    Elf32_Nhdr
 #else
 #define ELF_Ehdr    Elf64_Ehdr
 #define ELF_Phdr    Elf64_Phdr
+#define ELF_Off     Elf64_Off
+#define ELF_Addr    Elf64_Addr
 #define ELF_Shdr    Elf64_Shdr
 #define ELF_Nhdr    Elf64_Nhdr
 #endif
@@ -67,6 +86,25 @@ typedef struct
 
 } cdh_registers_t;
 
+typedef struct
+{
+    int mode;                   /* CDH_MODE_FULL or CDH_MODE_SPARSE */
+    uint64_t stack_size;        /* sparse: bytes kept of each thread stack, upwards from the stack pointer */
+    uint64_t writable_size;     /* sparse: writable segments up to this size are kept */
+    uint64_t readonly_size;     /* sparse: read-only segments up to this size are kept */
+
+} cdh_config_t;
+
+/* Entry of the NT_CDH_SKIPPED note */
+typedef struct
+{
+    uint64_t start;             /* virtual address */
+    uint64_t size;
+    uint32_t segment_type;      /* CDH_SEGMENT_* */
+    uint32_t reserved;
+
+} cdh_skipped_range_t;
+
 typedef struct
 {
     char name[MAX_PROC_NAME_LENGTH];
@@ -76,6 +114,7 @@ typedef struct
     int signal;
 
     int can_create_coredump;
+    cdh_config_t config;
     file_streamer_t streamer;
 
     /* coredump content, for crash id generation */
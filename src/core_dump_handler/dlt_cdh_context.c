@@ -61,8 +61,8 @@ cdh_status_t get_exec_name(unsigned int p_pid, char *p_exec_name, int p_exec_nam
     if ((l_name_ptr = strrchr(g_buffer, '/')) == NULL)
         return CDH_NOK;
 
-    memset(p_exec_name, 0, p_exec_name_maxsize);
-    strncpy(p_exec_name, l_name_ptr + 1, p_exec_name_maxsize - 1);
+    memset(p_exec_name, 0, (size_t)p_exec_name_maxsize);
+    strncpy(p_exec_name, l_name_ptr + 1, (size_t)p_exec_name_maxsize - 1);
 
     return CDH_OK;
 }
@@ -97,7 +97,7 @@ cdh_status_t dump_file_to(const char *p_src_filename, FILE *p_fout)
         return CDH_NOK;
     }
 
-    while ((bytes_read = fread(g_buffer, 1, sizeof(g_buffer), l_fin)) != 0) {
+    while ((bytes_read = (int)fread(g_buffer, 1, sizeof(g_buffer), l_fin)) != 0) {
         int i = 0;
 
         /* changes all "\0" in the file to a "\n" */
@@ -106,7 +106,7 @@ cdh_status_t dump_file_to(const char *p_src_filename, FILE *p_fout)
             if (g_buffer[i] == '\000')
                 g_buffer[i] = '\n';
 
-        fwrite(g_buffer, 1, bytes_read, p_fout);
+        fwrite(g_buffer, 1, (size_t)bytes_read, p_fout);
 
         if (ferror(p_fout)) {
             syslog(LOG_ERR, "Writing in context file failed [%s]", strerror(errno));
@@ -257,7 +257,9 @@ cdh_status_t list_dircontent_to(const char *p_dirname, FILE *p_fout)
         if (!strcmp(l_entity->d_name, ".") || !strcmp(l_entity->d_name, ".."))
             continue;
 
-        snprintf(l_fullpath, sizeof(l_fullpath), "%s/%s", p_dirname, l_entity->d_name);
+        if (snprintf(l_fullpath, sizeof(l_fullpath), "%s/%s", p_dirname,
+                     l_entity->d_name) >= (int)sizeof(l_fullpath))
+            continue;
 
         if (lstat(l_fullpath, &l_stat) < 0) {
             syslog(LOG_ERR, "ERR lstat on '%s' failed. [%s]", l_fullpath, strerror(errno));
@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include <fcntl.h>
+#include <limits.h>
 #include <syslog.h>
 #include <errno.h>
 
@@ -36,16 +37,39 @@
 #include <sys/stat.h>
 
 #include "dlt_cdh.h"
+#include "dlt_cdh_cpuinfo.h"
+
+#define CDH_PAGE_SIZE       4096
+/* the red zone below the stack pointer of the x86_64 ABI is kept too */
+#define CDH_STACK_RED_ZONE  128
+
+#define CDH_ALIGN(x, a)     (((x) + (a) - 1) & ~((uint64_t)(a) - 1))
+
+/* Range of the coredump read which is written to the sparse coredump */
+typedef struct
+{
+    uint64_t src_offset;
+    uint64_t size;
+    unsigned int phnum;     /* its program header in the sparse coredump */
+
+} cdh_kept_range_t;
 
 cdh_status_t read_elf_headers(proc_info_t *p_proc)
 {
     int phnum = 0;
 
     /* Read ELF header */
-    stream_read(&p_proc->streamer, &p_proc->m_Ehdr, sizeof(p_proc->m_Ehdr));
+    if (stream_read(&p_proc->streamer, &p_proc->m_Ehdr, sizeof(p_proc->m_Ehdr)) != CDH_OK)
+        return CDH_NOK;
+
+    if (memcmp(p_proc->m_Ehdr.e_ident, ELFMAG, SELFMAG) != 0) {
+        syslog(LOG_ERR, "Coredump is no ELF file");
+        return CDH_NOK;
+    }
 
     /* Read until PROG position */
-    stream_move_to_offest(&p_proc->streamer, p_proc->m_Ehdr.e_phoff);
+    if (stream_move_to_offest(&p_proc->streamer, p_proc->m_Ehdr.e_phoff) != CDH_OK)
+        return CDH_NOK;
 
     /* Read and store all program headers */
     p_proc->m_pPhdr = (ELF_Phdr *)malloc(sizeof(ELF_Phdr) * p_proc->m_Ehdr.e_phnum);
@@ -57,7 +81,8 @@ cdh_status_t read_elf_headers(proc_info_t *p_proc)
 
     for (phnum = 0; phnum < p_proc->m_Ehdr.e_phnum; phnum++)
         /* Read Programm header */
-        stream_read(&p_proc->streamer, &p_proc->m_pPhdr[phnum], sizeof(ELF_Phdr));
+        if (stream_read(&p_proc->streamer, &p_proc->m_pPhdr[phnum], sizeof(ELF_Phdr)) != CDH_OK)
+            return CDH_NOK;
 
     return CDH_OK;
 }
@@ -68,12 +93,12 @@ int getNotePageIndex(proc_info_t *p_proc)
 
     /* Search PT_NOTE section */
     for (i = 0; i < p_proc->m_Ehdr.e_phnum; i++) {
-        syslog(LOG_INFO, "==Note section prog_note:%d type:0x%X offset:0x%X size:0x%X (%dbytes)",
+        syslog(LOG_INFO, "==Note section prog_note:%d type:0x%X offset:0x%llX size:0x%llX (%llubytes)",
                i,
                p_proc->m_pPhdr[i].p_type,
-               p_proc->m_pPhdr[i].p_offset,
-               p_proc->m_pPhdr[i].p_filesz,
-               p_proc->m_pPhdr[i].p_filesz);
+               (unsigned long long)p_proc->m_pPhdr[i].p_offset,
+               (unsigned long long)p_proc->m_pPhdr[i].p_filesz,
+               (unsigned long long)p_proc->m_pPhdr[i].p_filesz);
 
         if (p_proc->m_pPhdr[i].p_type == PT_NOTE)
             break;
@@ -100,21 +125,331 @@ cdh_status_t read_notes(proc_info_t *p_proc)
         return CDH_NOK;
     }
 
-    if ((p_proc->m_Nhdr = (char *)malloc(p_proc->m_pPhdr[prog_note].p_filesz)) == NULL) {
-        syslog(LOG_ERR, "Cannot allocate Nhdr memory (note size %d bytes)", p_proc->m_pPhdr[prog_note].p_filesz);
+    if ((p_proc->m_pPhdr[prog_note].p_filesz > UINT_MAX) ||
+        ((p_proc->m_Nhdr = (char *)malloc(p_proc->m_pPhdr[prog_note].p_filesz)) == NULL)) {
+        syslog(LOG_ERR, "Cannot allocate Nhdr memory (note size %llu bytes)",
+               (unsigned long long)p_proc->m_pPhdr[prog_note].p_filesz);
         return CDH_NOK;
     }
 
-    if (stream_read(&p_proc->streamer, p_proc->m_Nhdr, p_proc->m_pPhdr[prog_note].p_filesz) != CDH_OK) {
+    if (stream_read(&p_proc->streamer, p_proc->m_Nhdr, (unsigned int)p_proc->m_pPhdr[prog_note].p_filesz) != CDH_OK) {
         syslog(LOG_ERR, "Cannot read note header");
         return CDH_NOK;
     }
 
-    p_proc->m_note_page_size = p_proc->m_pPhdr[prog_note].p_filesz;
+    p_proc->m_note_page_size = (unsigned int)p_proc->m_pPhdr[prog_note].p_filesz;
+
+    return CDH_OK;
+}
+
+/* Collect the stack pointers of all threads from their NT_PRSTATUS notes */
+static unsigned int get_stack_pointers(proc_info_t *p_proc, uint64_t **p_sps)
+{
+    unsigned int offset = 0;
+    unsigned int count = 0;
+    unsigned int max = 0;
+    uint64_t *sps = NULL;
+
+    while (offset + sizeof(ELF_Nhdr) <= p_proc->m_note_page_size) {
+        ELF_Nhdr *ptr_note = (ELF_Nhdr *)(p_proc->m_Nhdr + offset);
+        uint64_t desc = offset + sizeof(ELF_Nhdr) + CDH_ALIGN(ptr_note->n_namesz, 4);
+        uint64_t next = desc + CDH_ALIGN(ptr_note->n_descsz, 4);
+
+        if (next > p_proc->m_note_page_size)
+            break;
+
+        if ((ptr_note->n_type == NT_PRSTATUS) && (ptr_note->n_descsz >= sizeof(prstatus_t))) {
+            cdh_registers_t registers;
+
+            if (count == max) {
+                uint64_t *l_sps = realloc(sps, sizeof(uint64_t) * (max + 16));
+
+                if (l_sps == NULL)
+                    break;
+
+                sps = l_sps;
+                max += 16;
+            }
+
+            memset(&registers, 0, sizeof(registers));
+            get_registers((prstatus_t *)(p_proc->m_Nhdr + desc), &registers);
+
+            if (registers.sp != 0)
+                sps[count++] = registers.sp;
+        }
+
+        offset = (unsigned int)next;
+    }
+
+    *p_sps = sps;
+    return count;
+}
+
+/* Write p_size bytes of p_buf at p_offset of the output, the gap before is filled with zeros */
+static cdh_status_t write_at(file_streamer_t *p_fs, uint64_t *p_out, uint64_t p_offset, const void *p_buf,
+                             uint64_t p_size)
+{
+    static const unsigned char zeros[CDH_PAGE_SIZE];
+
+    if (p_offset < *p_out)
+        return CDH_NOK;
+
+    while (*p_out < p_offset) {
+        uint64_t len = p_offset - *p_out;
+
+        if (len > sizeof(zeros))
+            len = sizeof(zeros);
+
+        if (stream_write(p_fs, zeros, len) != CDH_OK)
+            return CDH_NOK;
+
+        *p_out += len;
+    }
+
+    if ((p_size > 0) && (stream_write(p_fs, p_buf, p_size) != CDH_OK))
+        return CDH_NOK;
 
+    *p_out += p_size;
     return CDH_OK;
 }
 
+/* Write the coredump unchanged in filtered mode. The headers are written from what was parsed,
+ * the gaps between them hold zeros like in the coredumps written by the kernel */
+static cdh_status_t write_full_coredump(proc_info_t *p_proc)
+{
+    const ELF_Phdr *note = &p_proc->m_pPhdr[getNotePageIndex(p_proc)];
+    uint64_t out = 0;
+
+    if ((write_at(&p_proc->streamer, &out, 0, &p_proc->m_Ehdr, sizeof(p_proc->m_Ehdr)) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, p_proc->m_Ehdr.e_phoff, p_proc->m_pPhdr,
+                  sizeof(ELF_Phdr) * p_proc->m_Ehdr.e_phnum) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, note->p_offset, p_proc->m_Nhdr, p_proc->m_note_page_size) != CDH_OK) ||
+        (out != stream_get_offset(&p_proc->streamer)))
+        return CDH_NOK;
+
+    return stream_copy_to_end(&p_proc->streamer);
+}
+
+/* Write a sparse coredump: the notes with the registers of all threads, the part of each thread
+ * stack above its stack pointer and the segments below the configured sizes. The ranges left out
+ * are listed in a NT_CDH_SKIPPED note, their program headers have no file content.
+ * p_started is set once writing has begun, the full coredump cannot be written after an error then */
+static cdh_status_t write_sparse_coredump(proc_info_t *p_proc, int *p_started)
+{
+    const cdh_config_t *config = &p_proc->config;
+    ELF_Ehdr ehdr = p_proc->m_Ehdr;
+    ELF_Phdr *phdrs = NULL;
+    ELF_Nhdr nhdr;
+    char note_name[CDH_ALIGN(sizeof(CDH_NOTE_NAME), 4)];
+    cdh_kept_range_t *kept = NULL;
+    cdh_skipped_range_t *skipped = NULL;
+    uint64_t *sps = NULL;
+    unsigned int nsps = 0;
+    unsigned int nphdrs = 0;
+    unsigned int nkept = 0;
+    unsigned int nskipped = 0;
+    unsigned int note_phnum = 0;
+    uint64_t src_offset = stream_get_offset(&p_proc->streamer);
+    uint64_t kept_bytes = 0;
+    uint64_t skipped_bytes = 0;
+    uint64_t out = 0;
+    unsigned int i = 0;
+    unsigned int k = 0;
+    cdh_status_t ret = CDH_NOK;
+
+    if (ehdr.e_phnum == PN_XNUM) {
+        syslog(LOG_WARNING, "Sparse coredump: too many program headers");
+        return CDH_NOK;
+    }
+
+    phdrs = (ELF_Phdr *)malloc(sizeof(ELF_Phdr) * 3 * ehdr.e_phnum);
+    kept = (cdh_kept_range_t *)malloc(sizeof(cdh_kept_range_t) * ehdr.e_phnum);
+    skipped = (cdh_skipped_range_t *)malloc(sizeof(cdh_skipped_range_t) * 2 * ehdr.e_phnum);
+
+    if ((phdrs == NULL) || (kept == NULL) || (skipped == NULL)) {
+        syslog(LOG_ERR, "Cannot allocate memory for %d program headers", ehdr.e_phnum);
+        goto end;
+    }
+
+    nsps = get_stack_pointers(p_proc, &sps);
+
+    /* get_registers() of the architecture does not provide the stack pointer */
+    if (nsps == 0) {
+        syslog(LOG_WARNING, "Sparse coredump: no stack pointer found in the notes");
+        goto end;
+    }
+
+    for (i = 0; i < ehdr.e_phnum; i++) {
+        const ELF_Phdr *src = &p_proc->m_pPhdr[i];
+        uint64_t start = 0;
+        uint64_t end = 0;
+        uint32_t segment_type = CDH_SEGMENT_READONLY;
+        uint64_t sp = UINT64_MAX;
+
+        if ((src->p_type != PT_LOAD) || (src->p_filesz == 0)) {
+            if (src->p_type == PT_NOTE)
+                note_phnum = nphdrs;
+
+            phdrs[nphdrs++] = *src;
+            continue;
+        }
+
+        /* the segments are read in one pass, in the order of their offsets */
+        if (src->p_offset < src_offset) {
+            syslog(LOG_WARNING, "Sparse coredump: segment %u is not in offset order", i);
+            goto end;
+        }
+
+        src_offset = src->p_offset + src->p_filesz;
+
+        /* several threads may share a segment, the lowest stack pointer is taken */
+        for (k = 0; k < nsps; k++)
+            if ((sps[k] >= src->p_vaddr) && (sps[k] - src->p_vaddr < src->p_memsz) && (sps[k] < sp))
+                sp = sps[k];
+
+        if (sp != UINT64_MAX) {
+            segment_type = CDH_SEGMENT_STACK;
+            start = sp - src->p_vaddr;
+            start = (start > CDH_STACK_RED_ZONE) ? start - CDH_STACK_RED_ZONE : 0;
+            start &= ~(uint64_t)(CDH_PAGE_SIZE - 1);
+            end = (config->stack_size < src->p_filesz - start) ? start + config->stack_size : src->p_filesz;
+        }
+        else if (src->p_flags & PF_W) {
+            segment_type = CDH_SEGMENT_WRITABLE;
+            end = (src->p_filesz <= config->writable_size) ? src->p_filesz : 0;
+        }
+        else {
+            end = (src->p_filesz <= config->readonly_size) ? src->p_filesz : 0;
+        }
+
+        if (start > src->p_filesz)
+            start = src->p_filesz;
+
+        if (end < start)
+            end = start;
+
+        /* the program headers of the skipped parts keep the mapping but have no file content */
+        if (start > 0) {
+            phdrs[nphdrs] = *src;
+            phdrs[nphdrs].p_offset = 0;
+            phdrs[nphdrs].p_filesz = 0;
+            phdrs[nphdrs].p_memsz = (ELF_Addr)start;
+            nphdrs++;
+
+            skipped[nskipped].start = src->p_vaddr;
+            skipped[nskipped].size = start;
+            skipped[nskipped].segment_type = segment_type;
+            skipped[nskipped].reserved = 0;
+            nskipped++;
+        }
+
+        if (end > start) {
+            phdrs[nphdrs] = *src;
+            phdrs[nphdrs].p_vaddr = (ELF_Addr)(src->p_vaddr + start);
+            phdrs[nphdrs].p_paddr = 0;
+            phdrs[nphdrs].p_filesz = (ELF_Addr)(end - start);
+            phdrs[nphdrs].p_memsz = (ELF_Addr)(end - start);
+
+            kept[nkept].src_offset = src->p_offset + start;
+            kept[nkept].size = end - start;
+            kept[nkept].phnum = nphdrs;
+            kept_bytes += end - start;
+            nkept++;
+            nphdrs++;
+        }
+
+        if (src->p_memsz > end) {
+            phdrs[nphdrs] = *src;
+            phdrs[nphdrs].p_vaddr = (ELF_Addr)(src->p_vaddr + end);
+            phdrs[nphdrs].p_paddr = 0;
+            phdrs[nphdrs].p_offset = 0;
+            phdrs[nphdrs].p_filesz = 0;
+            phdrs[nphdrs].p_memsz = (ELF_Addr)(src->p_memsz - end);
+            nphdrs++;
+        }
+
+        if (src->p_filesz > end) {
+            skipped[nskipped].start = src->p_vaddr + end;
+            skipped[nskipped].size = src->p_filesz - end;
+            skipped[nskipped].segment_type = segment_type;
+            skipped[nskipped].reserved = 0;
+            skipped_bytes += src->p_filesz - end;
+            nskipped++;
+        }
+
+        skipped_bytes += start;
+    }
+
+    if (nphdrs >= PN_XNUM) {
+        syslog(LOG_WARNING, "Sparse coredump: too many program headers");
+        goto end;
+    }
+
+    memset(&nhdr, 0, sizeof(nhdr));
+    nhdr.n_namesz = sizeof(CDH_NOTE_NAME);
+    nhdr.n_descsz = (uint32_t)(sizeof(cdh_skipped_range_t) * nskipped);
+    nhdr.n_type = NT_CDH_SKIPPED;
+    memset(note_name, 0, sizeof(note_name));
+    memcpy(note_name, CDH_NOTE_NAME, sizeof(CDH_NOTE_NAME));
+
+    /* layout: ELF header, program headers, notes, then the kept ranges at page boundaries */
+    ehdr.e_phoff = sizeof(ELF_Ehdr);
+    ehdr.e_phnum = (uint16_t)nphdrs;
+    ehdr.e_shoff = 0;
+    ehdr.e_shnum = 0;
+    ehdr.e_shstrndx = SHN_UNDEF;
+
+    out = sizeof(ELF_Ehdr) + sizeof(ELF_Phdr) * nphdrs;
+    phdrs[note_phnum].p_offset = (ELF_Off)out;
+    phdrs[note_phnum].p_filesz = (ELF_Addr)(p_proc->m_note_page_size + sizeof(nhdr) + sizeof(note_name) +
+                                            nhdr.n_descsz);
+    out += phdrs[note_phnum].p_filesz;
+
+    for (k = 0; k < nkept; k++) {
+        out = CDH_ALIGN(out, CDH_PAGE_SIZE);
+        phdrs[kept[k].phnum].p_offset = (ELF_Off)out;
+        out += kept[k].size;
+    }
+
+    /* from here on the full coredump cannot be written anymore */
+    *p_started = 1;
+    out = 0;
+
+    if ((write_at(&p_proc->streamer, &out, 0, &ehdr, sizeof(ehdr)) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, out, phdrs, sizeof(ELF_Phdr) * nphdrs) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, out, p_proc->m_Nhdr, p_proc->m_note_page_size) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, out, &nhdr, sizeof(nhdr)) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, out, note_name, sizeof(note_name)) != CDH_OK) ||
+        (write_at(&p_proc->streamer, &out, out, skipped, nhdr.n_descsz) != CDH_OK)) {
+        syslog(LOG_ERR, "Sparse coredump: cannot write headers");
+        goto end;
+    }
+
+    for (k = 0; k < nkept; k++) {
+        if ((write_at(&p_proc->streamer, &out, phdrs[kept[k].phnum].p_offset, NULL, 0) != CDH_OK) ||
+            (stream_move_to_offest(&p_proc->streamer, kept[k].src_offset) != CDH_OK) ||
+            (stream_copy(&p_proc->streamer, kept[k].size) != CDH_OK)) {
+            syslog(LOG_ERR, "Sparse coredump: cannot copy segment data at offset 0x%llX",
+                   (unsigned long long)kept[k].src_offset);
+            goto end;
+        }
+
+        out += kept[k].size;
+    }
+
+    syslog(LOG_INFO, "Sparse coredump: %llu bytes in %u ranges written, %llu bytes in %u ranges skipped",
+           (unsigned long long)kept_bytes, nkept, (unsigned long long)skipped_bytes, nskipped);
+    ret = CDH_OK;
+
+end:
+    free(phdrs);
+    free(kept);
+    free(skipped);
+    free(sps);
+
+    return ret;
+}
+
 cdh_status_t init_coredump(proc_info_t *p_proc)
 {
     if (p_proc == NULL)
@@ -135,19 +470,22 @@ cdh_status_t init_coredump(proc_info_t *p_proc)
         stream_init(&p_proc->streamer, 0, NULL);
     }
 
+    /* in sparse mode only what write_sparse_coredump() selects is written */
+    if ((p_proc->config.mode == CDH_MODE_SPARSE) && (stream_set_filtered(&p_proc->streamer) != CDH_OK))
+        syslog(LOG_WARNING, "cannot write a sparse coredump, writing the full coredump");
+
     return CDH_OK;
 }
 
 cdh_status_t close_coredump(proc_info_t *p_proc)
 {
-    stream_close(&p_proc->streamer);
-
-    return CDH_OK;
+    return stream_close(&p_proc->streamer);
 }
 
 cdh_status_t treat_coredump(proc_info_t *p_proc)
 {
     cdh_status_t ret = CDH_OK;
+    int started = 0;
 
     /* open src and dest files, allocate read buffer */
     if (init_coredump(p_proc) != CDH_OK) {
@@ -156,20 +494,34 @@ cdh_status_t treat_coredump(proc_info_t *p_proc)
         goto finished;
     }
 
-    if (read_elf_headers(p_proc) == CDH_OK) {
-        /* TODO: No NOTES here leads to crash elsewhere!!! dlt_cdh_crashid.c: around line 76 */
-        if (read_notes(p_proc) != CDH_OK) {
-            syslog(LOG_ERR, "cannot read NOTES");
-            ret = CDH_NOK;
-            goto finished;
-        }
-    }
-    else if (read_elf_headers(p_proc) != CDH_OK) {
+    if (read_elf_headers(p_proc) != CDH_OK) {
         syslog(LOG_ERR, "cannot read ELF header");
         ret = CDH_NOK;
         goto finished;
     }
 
+    /* TODO: No NOTES here leads to crash elsewhere!!! dlt_cdh_crashid.c: around line 76 */
+    if (read_notes(p_proc) != CDH_OK) {
+        syslog(LOG_ERR, "cannot read NOTES");
+        ret = CDH_NOK;
+        goto finished;
+    }
+
+    if (p_proc->streamer.filtered && (write_sparse_coredump(p_proc, &started) != CDH_OK)) {
+        if (started) {
+            syslog(LOG_ERR, "cannot write sparse coredump");
+            ret = CDH_NOK;
+        }
+        else {
+            syslog(LOG_WARNING, "cannot write sparse coredump, writing the full coredump");
+
+            if (write_full_coredump(p_proc) != CDH_OK) {
+                syslog(LOG_ERR, "cannot write full coredump");
+                ret = CDH_NOK;
+            }
+        }
+    }
+
 finished:
 
     /* In all cases, we try to finish to read/compress the coredump until the end */
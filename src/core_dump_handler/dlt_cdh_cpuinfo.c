@@ -30,4 +30,7 @@ void get_registers(prstatus_t *prstatus, cdh_registers_t *registers)
 
     registers->pc = ptr_reg->pc;*/ /* [REG_PROC_COUNTER]; */
 
+    /* registers->sp is needed for the sparse coredump, without it the full
+     * coredump is written */
+
 }
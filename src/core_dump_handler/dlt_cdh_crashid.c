@@ -51,7 +51,7 @@
 static cdh_status_t crashid_cityhash(proc_info_t *p_proc);
 #endif
 
-cdh_status_t get_phdr_num(proc_info_t *p_proc, unsigned int p_address, int *phdr_num)
+cdh_status_t get_phdr_num(proc_info_t *p_proc, uint64_t p_address, int *phdr_num)
 {
     int i = 0;
 
@@ -72,7 +72,7 @@ cdh_status_t get_phdr_num(proc_info_t *p_proc, unsigned int p_address, int *phdr
 
 /* Thanks to libunwind for the following definitions, which helps to */
 #define ALIGN(x, a) (((x) + (a) - 1UL) & ~((a) - 1UL))
-#define NOTE_SIZE(_hdr) (sizeof (_hdr) + ALIGN((_hdr).n_namesz, 4) + (_hdr).n_descsz)
+#define NOTE_SIZE(_hdr) ((unsigned int)(sizeof (_hdr) + ALIGN((_hdr).n_namesz, 4) + (_hdr).n_descsz))
 
 cdh_status_t get_crashed_registers(proc_info_t *p_proc)
 {
@@ -134,14 +134,16 @@ cdh_status_t create_crashid(proc_info_t *p_proc)
 #define READ_STACK_VALUE(__offset, __type)  (*(__type *)(stack_page + __offset - sizeof(__type)))
 
     get_phdr_num(p_proc, p_proc->m_registers.pc, &pc_phnum);
-    final_pc = ADDRESS_REBASE(p_proc->m_registers.pc, pc_phnum);
+
+    if (pc_phnum >= 0)
+        final_pc = (uint32_t)ADDRESS_REBASE(p_proc->m_registers.pc, pc_phnum);
 
     get_phdr_num(p_proc, p_proc->m_registers.lr, &lr_phnum);
 
     if (lr_phnum >= 0)
-        final_lr = ADDRESS_REBASE(p_proc->m_registers.lr, lr_phnum);
+        final_lr = (uint32_t)ADDRESS_REBASE(p_proc->m_registers.lr, lr_phnum);
 
-    p_proc->m_crashid_phase1 = p_proc->signal << 24;
+    p_proc->m_crashid_phase1 = (uint64_t)p_proc->signal << 24;
     p_proc->m_crashid_phase1 |= (uint64_t)final_lr;
     p_proc->m_crashid_phase1 <<= 32;
     p_proc->m_crashid_phase1 |= (uint64_t)final_pc;
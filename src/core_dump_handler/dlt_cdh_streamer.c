@@ -27,11 +27,312 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <syslog.h>
+#include <unistd.h>
+#include <zlib.h>
 #include "dlt_cdh_streamer.h"
 
-#define Z_CHUNK_SZ      1024 * 128
-#define Z_MODE_STR      "wb1"
+/*
+ * The coredump is read in blocks straight into the buffers of the compressor,
+ * without intermediate copies. Worker threads compress the blocks
+ * independently, each one into a gzip member of its own, and write the members
+ * in block order. Concatenated gzip members are a valid gzip file, so the
+ * coredump is unpacked as before.
+ * In filtered mode the input is read into a buffer of its own, and only the
+ * data given to stream_write() and stream_copy() is copied into the blocks of
+ * the compressor.
+ */
+
+#define CDH_BLOCK_ALIGN 4096
+
+struct cdh_compressor
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t threads[CDH_COMPRESS_THREADS_MAX];
+    int nthreads;
+
+    unsigned char **blocks;
+    unsigned int *block_lens;
+    unsigned int nblocks;
+
+    uint64_t next_submit;       /* block being read */
+    uint64_t next_compress;     /* next block taken by a worker */
+    uint64_t next_write;        /* next block written to the file */
+
+    int dst_fd;
+    int error;
+    int stop;
+};
+
+static cdh_status_t write_all(int fd, const unsigned char *p_buf, size_t p_size)
+{
+    while (p_size > 0) {
+        ssize_t written = write(fd, p_buf, p_size);
+
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+
+            return CDH_NOK;
+        }
+
+        p_buf += written;
+        p_size -= (size_t)written;
+    }
+
+    return CDH_OK;
+}
+
+static void *compress_thread(void *p_arg)
+{
+    cdh_compressor_t *comp = (cdh_compressor_t *)p_arg;
+    z_stream zs;
+    unsigned char *out = NULL;
+    unsigned long out_size = 0;
+    int zinit;
+
+    memset(&zs, 0, sizeof(zs));
+
+    /* windowBits + 16 writes a gzip header and trailer */
+    zinit = deflateInit2(&zs, CDH_COMPRESS_LEVEL, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+
+    if (zinit == Z_OK) {
+        out_size = deflateBound(&zs, CDH_BLOCK_SIZE);
+        out = (unsigned char *)malloc(out_size);
+    }
+
+    if ((zinit != Z_OK) || (out == NULL))
+        syslog(LOG_ERR, "Cannot initialize coredump compression");
+
+    pthread_mutex_lock(&comp->lock);
+
+    for (;;) {
+        uint64_t seq;
+        unsigned int index;
+        size_t out_len = 0;
+        int ok;
+
+        while (!comp->stop && (comp->next_compress == comp->next_submit))
+            pthread_cond_wait(&comp->cond, &comp->lock);
+
+        if (comp->next_compress == comp->next_submit)
+            break;
+
+        seq = comp->next_compress++;
+        index = (unsigned int)(seq % comp->nblocks);
+        pthread_mutex_unlock(&comp->lock);
+
+        ok = (out != NULL) && (deflateReset(&zs) == Z_OK);
+
+        if (ok) {
+            zs.next_in = comp->blocks[index];
+            zs.avail_in = comp->block_lens[index];
+            zs.next_out = out;
+            zs.avail_out = (uInt)out_size;
+            ok = (deflate(&zs, Z_FINISH) == Z_STREAM_END);
+            out_len = out_size - zs.avail_out;
+        }
+
+        /* members are written in the order of the blocks */
+        pthread_mutex_lock(&comp->lock);
+
+        while (comp->next_write != seq)
+            pthread_cond_wait(&comp->cond, &comp->lock);
+
+        pthread_mutex_unlock(&comp->lock);
+
+        if (!ok) {
+            if (!comp->error)
+                syslog(LOG_ERR, "Cannot compress coredump block %llu", (unsigned long long)seq);
+
+            comp->error = 1;
+        }
+        else if (!comp->error && (write_all(comp->dst_fd, out, out_len) != CDH_OK)) {
+            syslog(LOG_ERR, "Cannot write coredump. %s", strerror(errno));
+            comp->error = 1;
+        }
+
+        pthread_mutex_lock(&comp->lock);
+        comp->next_write++;
+        pthread_cond_broadcast(&comp->cond);
+    }
+
+    pthread_mutex_unlock(&comp->lock);
+
+    if (zinit == Z_OK)
+        deflateEnd(&zs);
+
+    free(out);
+
+    return NULL;
+}
+
+static void compressor_free(cdh_compressor_t *comp)
+{
+    unsigned int i;
+
+    if (comp->blocks != NULL)
+        for (i = 0; i < comp->nblocks; i++)
+            free(comp->blocks[i]);
+
+    free(comp->blocks);
+    free(comp->block_lens);
+
+    if (comp->dst_fd >= 0)
+        close(comp->dst_fd);
+
+    pthread_cond_destroy(&comp->cond);
+    pthread_mutex_destroy(&comp->lock);
+    free(comp);
+}
+
+static cdh_compressor_t *compressor_create(const char *p_dst_fname)
+{
+    cdh_compressor_t *comp;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int i;
+
+    if ((comp = (cdh_compressor_t *)calloc(1, sizeof(cdh_compressor_t))) == NULL)
+        return NULL;
+
+    pthread_mutex_init(&comp->lock, NULL);
+    pthread_cond_init(&comp->cond, NULL);
+
+    if ((comp->dst_fd = open(p_dst_fname, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666)) < 0) {
+        syslog(LOG_ERR, "Cannot open output filename <%s>. %s", p_dst_fname, strerror(errno));
+        compressor_free(comp);
+        return NULL;
+    }
+
+    comp->nthreads = (cpus < 1) ? 1 : ((cpus > CDH_COMPRESS_THREADS_MAX) ? CDH_COMPRESS_THREADS_MAX : (int)cpus);
+
+    /* every worker has one block, the reader one and as many are read ahead */
+    comp->nblocks = (unsigned int)(2 * comp->nthreads + 1);
+    comp->blocks = (unsigned char **)calloc(comp->nblocks, sizeof(unsigned char *));
+    comp->block_lens = (unsigned int *)calloc(comp->nblocks, sizeof(unsigned int));
+
+    if ((comp->blocks == NULL) || (comp->block_lens == NULL)) {
+        compressor_free(comp);
+        return NULL;
+    }
+
+    for (i = 0; i < comp->nblocks; i++)
+        if (posix_memalign((void **)&comp->blocks[i], CDH_BLOCK_ALIGN, CDH_BLOCK_SIZE) != 0) {
+            comp->blocks[i] = NULL;
+            compressor_free(comp);
+            return NULL;
+        }
+
+    for (i = 0; i < (unsigned int)comp->nthreads; i++)
+        if (pthread_create(&comp->threads[i], NULL, compress_thread, comp) != 0)
+            break;
+
+    if (i == 0) {
+        compressor_free(comp);
+        return NULL;
+    }
+
+    comp->nthreads = (int)i;
+
+    return comp;
+}
+
+/* Hand a block of p_len bytes over to the workers, return the next block once it is free */
+static unsigned char *compressor_submit(cdh_compressor_t *comp, unsigned int p_len)
+{
+    unsigned char *block;
+
+    pthread_mutex_lock(&comp->lock);
+
+    comp->block_lens[comp->next_submit % comp->nblocks] = p_len;
+    comp->next_submit++;
+    pthread_cond_broadcast(&comp->cond);
+
+    while (comp->next_write + comp->nblocks <= comp->next_submit)
+        pthread_cond_wait(&comp->cond, &comp->lock);
+
+    block = comp->blocks[comp->next_submit % comp->nblocks];
+
+    pthread_mutex_unlock(&comp->lock);
+
+    return block;
+}
+
+/* Write all blocks and stop the workers */
+static cdh_status_t compressor_finish(file_streamer_t *p_fs)
+{
+    cdh_compressor_t *comp = p_fs->compressor;
+    cdh_status_t ret;
+    int i;
+
+    if (p_fs->filtered) {
+        if (p_fs->out_len > 0)
+            compressor_submit(comp, p_fs->out_len);
+    }
+    else if (p_fs->block_len > 0) {
+        compressor_submit(comp, p_fs->block_len);
+    }
+
+    pthread_mutex_lock(&comp->lock);
+    comp->stop = 1;
+    pthread_cond_broadcast(&comp->cond);
+    pthread_mutex_unlock(&comp->lock);
+
+    for (i = 0; i < comp->nthreads; i++)
+        pthread_join(comp->threads[i], NULL);
+
+    ret = comp->error ? CDH_NOK : CDH_OK;
+
+    compressor_free(comp);
+    p_fs->compressor = NULL;
+    p_fs->out_block = NULL;
+
+    /* in filtered mode the input buffer is not one of the compressor */
+    if (!p_fs->filtered)
+        p_fs->block = NULL;
+
+    return ret;
+}
+
+/* Make sure that the current block has unconsumed bytes, return CDH_NOK at the end of the input */
+static cdh_status_t stream_fill(file_streamer_t *p_fs)
+{
+    ssize_t bytes;
+
+    while (p_fs->block_pos == p_fs->block_len) {
+        if (p_fs->eof)
+            return CDH_NOK;
+
+        if (p_fs->block_len == CDH_BLOCK_SIZE) {
+            if ((p_fs->compressor != NULL) && !p_fs->filtered)
+                p_fs->block = compressor_submit(p_fs->compressor, p_fs->block_len);
+
+            p_fs->block_len = 0;
+            p_fs->block_pos = 0;
+        }
+
+        bytes = read(p_fs->fd, p_fs->block + p_fs->block_len, CDH_BLOCK_SIZE - p_fs->block_len);
+
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+
+            syslog(LOG_WARNING, "Error reading from the src stream: %s", strerror(errno));
+            p_fs->eof = 1;
+            return CDH_NOK;
+        }
+
+        if (bytes == 0)
+            p_fs->eof = 1;
+
+        p_fs->block_len += (unsigned int)bytes;
+    }
+
+    return CDH_OK;
+}
 
 cdh_status_t stream_init(file_streamer_t *p_fs, const char *p_src_fname, const char *p_dst_fname)
 {
@@ -41,38 +342,33 @@ cdh_status_t stream_init(file_streamer_t *p_fs, const char *p_src_fname, const c
     }
 
     memset(p_fs, 0, sizeof(file_streamer_t));
+    p_fs->fd = -1;
 
     /* Allow to not save the coredump */
-    if (p_dst_fname == NULL) {
-        p_fs->gz_dst_file = 0;
-    }
-    else {
-        /* Create output file */
-        p_fs->gz_dst_file = gzopen(p_dst_fname, Z_MODE_STR);
-
-        if (p_fs->gz_dst_file == Z_NULL) {
-            /*return CDH_NOK; */
-            syslog(LOG_ERR, "Cannot open output filename <%s>. %s", p_dst_fname, strerror(errno));
-            p_fs->gz_dst_file = 0;
-
-        }
-    }
+    if (p_dst_fname != NULL)
+        p_fs->compressor = compressor_create(p_dst_fname);
 
-    if (p_fs->gz_dst_file == Z_NULL)
+    if (p_fs->compressor == NULL)
         syslog(LOG_WARNING, "The coredump will be processed, but not written");
 
     /* Open input file */
     if (p_src_fname == NULL) {
-        p_fs->stream = stdin;
+        p_fs->fd = STDIN_FILENO;
+
+        /* a larger pipe lets the kernel write ahead of the reader, fails if stdin is no pipe */
+        (void)fcntl(p_fs->fd, F_SETPIPE_SZ, CDH_BLOCK_SIZE);
     }
-    else if ((p_fs->stream = fopen(p_src_fname, "rb")) == NULL) {
+    else if ((p_fs->fd = open(p_src_fname, O_RDONLY | O_CLOEXEC)) < 0) {
         syslog(LOG_ERR, "Cannot open filename <%s>. %s", p_src_fname, strerror(errno));
         return CDH_NOK;
     }
 
-    /* Allocate read buffer */
-    if ((p_fs->read_buf = (unsigned char *)malloc(Z_CHUNK_SZ)) == NULL) {
-        syslog(LOG_ERR, "Cannot allocate %d bytes for read buffer. %s", Z_CHUNK_SZ, strerror(errno));
+    if (p_fs->compressor != NULL) {
+        p_fs->block = p_fs->compressor->blocks[0];
+    }
+    else if (posix_memalign((void **)&p_fs->block, CDH_BLOCK_ALIGN, CDH_BLOCK_SIZE) != 0) {
+        p_fs->block = NULL;
+        syslog(LOG_ERR, "Cannot allocate %d bytes for read buffer", CDH_BLOCK_SIZE);
         return CDH_NOK;
     }
 
@@ -81,33 +377,31 @@ cdh_status_t stream_init(file_streamer_t *p_fs, const char *p_src_fname, const c
 
 cdh_status_t stream_close(file_streamer_t *p_fs)
 {
+    cdh_status_t ret = CDH_OK;
+
     if (p_fs == NULL) {
         syslog(LOG_ERR, "Internal pointer error in 'stream_close'");
         return CDH_NOK;
     }
 
-    if (p_fs->gz_dst_file != NULL) {
-        gzflush(p_fs->gz_dst_file, Z_FINISH);
-        gzclose(p_fs->gz_dst_file);
-        p_fs->gz_dst_file = NULL;
-    }
+    if (p_fs->compressor != NULL)
+        ret = compressor_finish(p_fs);
 
-    if (p_fs->stream != NULL) {
-        fclose(p_fs->stream);
-        p_fs->stream = NULL;
+    if (p_fs->fd >= 0) {
+        close(p_fs->fd);
+        p_fs->fd = -1;
     }
 
-    if (p_fs->read_buf != NULL) {
-        free(p_fs->read_buf);
-        p_fs->read_buf = NULL;
-    }
+    free(p_fs->block);
+    p_fs->block = NULL;
 
-    return CDH_OK;
+    return ret;
 }
 
 cdh_status_t stream_read(file_streamer_t *p_fs, void *p_buf, unsigned int p_size)
 {
-    unsigned int byte_read = 0;
+    unsigned char *l_buf = (unsigned char *)p_buf;
+    unsigned int l_size = p_size;
 
     if (p_fs == NULL) {
         syslog(LOG_ERR, "Internal pointer error in 'stream_read'");
@@ -119,92 +413,220 @@ cdh_status_t stream_read(file_streamer_t *p_fs, void *p_buf, unsigned int p_size
         return CDH_NOK;
     }
 
-    if ((byte_read = fread(p_buf, 1, p_size, p_fs->stream)) != p_size) {
-        syslog(LOG_WARNING, "Cannot read %d bytes from src. %s", p_size, strerror(errno));
-        return CDH_NOK;
-    }
+    while (l_size > 0) {
+        unsigned int chunk_size;
+
+        if ((p_fs->block == NULL) || (stream_fill(p_fs) != CDH_OK)) {
+            syslog(LOG_WARNING, "Cannot read %u bytes from src", p_size);
+            return CDH_NOK;
+        }
+
+        chunk_size = p_fs->block_len - p_fs->block_pos;
 
-    p_fs->offset += byte_read;
+        if (chunk_size > l_size)
+            chunk_size = l_size;
 
-    if (p_fs->gz_dst_file != NULL)
-        gzwrite(p_fs->gz_dst_file, p_buf, byte_read);
+        memcpy(l_buf, p_fs->block + p_fs->block_pos, chunk_size);
+        p_fs->block_pos += chunk_size;
+        p_fs->offset += chunk_size;
+        l_buf += chunk_size;
+        l_size -= chunk_size;
+    }
 
     return CDH_OK;
 }
 
-int stream_finish(file_streamer_t *p_fs)
+cdh_status_t stream_finish(file_streamer_t *p_fs)
 {
-    if ((p_fs == NULL) || (p_fs->stream == NULL)) {
-        syslog(LOG_ERR, "Internal pointer error in 'stream_move_ahead'");
+    if ((p_fs == NULL) || (p_fs->block == NULL)) {
+        syslog(LOG_ERR, "Internal pointer error in 'stream_finish'");
         return CDH_NOK;
     }
 
-    while (!feof(p_fs->stream)) {
-        size_t read_bytes = fread(p_fs->read_buf, 1, Z_CHUNK_SZ, p_fs->stream);
-
-        if (p_fs->gz_dst_file != NULL)
-            gzwrite(p_fs->gz_dst_file, p_fs->read_buf, read_bytes);
-
-        p_fs->offset += read_bytes;
-
-        if (ferror(p_fs->stream)) {
-            syslog(LOG_WARNING, "Error reading from the src stream: %s", strerror(errno));
-            return CDH_NOK;
-        }
+    while (stream_fill(p_fs) == CDH_OK) {
+        p_fs->offset += p_fs->block_len - p_fs->block_pos;
+        p_fs->block_pos = p_fs->block_len;
     }
 
     return CDH_OK;
 }
 
-int stream_move_to_offest(file_streamer_t *p_fs, unsigned int p_offset)
+cdh_status_t stream_move_to_offest(file_streamer_t *p_fs, uint64_t p_offset)
 {
-    int bytes_to_read = 0;
-
     if (p_fs == NULL) {
         syslog(LOG_ERR, "Internal pointer error in 'stream_move_to_offest'");
         return CDH_NOK;
     }
 
-    bytes_to_read = p_offset - p_fs->offset;
+    /* the stream cannot go back */
+    if (p_offset < p_fs->offset) {
+        syslog(LOG_WARNING, "Cannot move back to offset %llu from %llu",
+               (unsigned long long)p_offset, (unsigned long long)p_fs->offset);
+        return CDH_NOK;
+    }
 
-    return stream_move_ahead(p_fs, bytes_to_read);
+    return stream_move_ahead(p_fs, p_offset - p_fs->offset);
 }
 
-int stream_move_ahead(file_streamer_t *p_fs, unsigned int p_nbbytes)
+cdh_status_t stream_move_ahead(file_streamer_t *p_fs, uint64_t p_nbbytes)
 {
-    int bytes_to_read = p_nbbytes;
+    uint64_t bytes_to_read = p_nbbytes;
 
-    if (p_fs == NULL) {
+    if ((p_fs == NULL) || (p_fs->block == NULL)) {
         syslog(LOG_ERR, "Internal pointer error in 'stream_move_ahead'");
         return CDH_NOK;
     }
 
     while (bytes_to_read > 0) {
-        size_t chunk_size = bytes_to_read > Z_CHUNK_SZ ? Z_CHUNK_SZ : bytes_to_read;
-        size_t read_bytes = fread(p_fs->read_buf, 1, chunk_size, p_fs->stream);
+        unsigned int chunk_size;
 
-        if (read_bytes != chunk_size) {
-            syslog(LOG_WARNING, "Cannot move ahead by %d bytes from src. Read %lu bytes", p_nbbytes, read_bytes);
+        if (stream_fill(p_fs) != CDH_OK) {
+            syslog(LOG_WARNING, "Cannot move ahead by %llu bytes from src. Read %llu bytes",
+                   (unsigned long long)p_nbbytes, (unsigned long long)(p_nbbytes - bytes_to_read));
             return CDH_NOK;
         }
 
-        if (p_fs->gz_dst_file != 0)
-            gzwrite(p_fs->gz_dst_file, p_fs->read_buf, chunk_size);
+        chunk_size = p_fs->block_len - p_fs->block_pos;
+
+        if (chunk_size > bytes_to_read)
+            chunk_size = (unsigned int)bytes_to_read;
 
+        p_fs->block_pos += chunk_size;
+        p_fs->offset += chunk_size;
         bytes_to_read -= chunk_size;
     }
 
-    p_fs->offset += p_nbbytes;
-
     return CDH_OK;
 }
 
-unsigned int stream_get_offset(file_streamer_t *p_fs)
+uint64_t stream_get_offset(file_streamer_t *p_fs)
 {
     if (p_fs == NULL) {
         syslog(LOG_ERR, "Internal pointer error in 'stream_get_offset'");
-        return CDH_NOK;
+        return 0;
     }
 
     return p_fs->offset;
 }
+
+cdh_status_t stream_set_filtered(file_streamer_t *p_fs)
+{
+    unsigned char *l_block;
+
+    if ((p_fs == NULL) || (p_fs->block == NULL)) {
+        syslog(LOG_ERR, "Internal pointer error in 'stream_set_filtered'");
+        return CDH_NOK;
+    }
+
+    if (p_fs->filtered)
+        return CDH_OK;
+
+    if (p_fs->compressor == NULL) {
+        p_fs->filtered = 1;
+        return CDH_OK;
+    }
+
+    /* what was read so far must not have been written yet */
+    if (p_fs->compressor->next_submit > 0)
+        return CDH_NOK;
+
+    if (posix_memalign((void **)&l_block, CDH_BLOCK_ALIGN, CDH_BLOCK_SIZE) != 0) {
+        syslog(LOG_ERR, "Cannot allocate %d bytes for read buffer", CDH_BLOCK_SIZE);
+        return CDH_NOK;
+    }
+
+    memcpy(l_block, p_fs->block, p_fs->block_len);
+    p_fs->out_block = p_fs->block;
+    p_fs->out_len = 0;
+    p_fs->block = l_block;
+    p_fs->filtered = 1;
+
+    return CDH_OK;
+}
+
+cdh_status_t stream_write(file_streamer_t *p_fs, const void *p_buf, uint64_t p_size)
+{
+    const unsigned char *l_buf = (const unsigned char *)p_buf;
+
+    if ((p_fs == NULL) || (p_buf == NULL) || !p_fs->filtered) {
+        syslog(LOG_ERR, "Internal pointer error in 'stream_write'");
+        return CDH_NOK;
+    }
+
+    /* the coredump is not written */
+    if (p_fs->compressor == NULL)
+        return CDH_OK;
+
+    while (p_size > 0) {
+        unsigned int chunk_size = CDH_BLOCK_SIZE - p_fs->out_len;
+
+        if (chunk_size > p_size)
+            chunk_size = (unsigned int)p_size;
+
+        memcpy(p_fs->out_block + p_fs->out_len, l_buf, chunk_size);
+        p_fs->out_len += chunk_size;
+        l_buf += chunk_size;
+        p_size -= chunk_size;
+
+        if (p_fs->out_len == CDH_BLOCK_SIZE) {
+            p_fs->out_block = compressor_submit(p_fs->compressor, p_fs->out_len);
+            p_fs->out_len = 0;
+        }
+    }
+
+    return CDH_OK;
+}
+
+cdh_status_t stream_copy(file_streamer_t *p_fs, uint64_t p_nbbytes)
+{
+    uint64_t bytes_to_copy = p_nbbytes;
+
+    if ((p_fs == NULL) || (p_fs->block == NULL) || !p_fs->filtered) {
+        syslog(LOG_ERR, "Internal pointer error in 'stream_copy'");
+        return CDH_NOK;
+    }
+
+    while (bytes_to_copy > 0) {
+        unsigned int chunk_size;
+
+        if (stream_fill(p_fs) != CDH_OK) {
+            syslog(LOG_WARNING, "Cannot copy %llu bytes from src. Copied %llu bytes",
+                   (unsigned long long)p_nbbytes, (unsigned long long)(p_nbbytes - bytes_to_copy));
+            return CDH_NOK;
+        }
+
+        chunk_size = p_fs->block_len - p_fs->block_pos;
+
+        if (chunk_size > bytes_to_copy)
+            chunk_size = (unsigned int)bytes_to_copy;
+
+        if (stream_write(p_fs, p_fs->block + p_fs->block_pos, chunk_size) != CDH_OK)
+            return CDH_NOK;
+
+        p_fs->block_pos += chunk_size;
+        p_fs->offset += chunk_size;
+        bytes_to_copy -= chunk_size;
+    }
+
+    return CDH_OK;
+}
+
+cdh_status_t stream_copy_to_end(file_streamer_t *p_fs)
+{
+    if ((p_fs == NULL) || (p_fs->block == NULL) || !p_fs->filtered) {
+        syslog(LOG_ERR, "Internal pointer error in 'stream_copy_to_end'");
+        return CDH_NOK;
+    }
+
+    while (stream_fill(p_fs) == CDH_OK) {
+        unsigned int chunk_size = p_fs->block_len - p_fs->block_pos;
+
+        if (stream_write(p_fs, p_fs->block + p_fs->block_pos, chunk_size) != CDH_OK)
+            return CDH_NOK;
+
+        p_fs->block_pos += chunk_size;
+        p_fs->offset += chunk_size;
+    }
+
+    return CDH_OK;
+}
@@ -26,17 +26,31 @@
 #ifndef DLT_CDH_STREAMER_H
 #define DLT_CDH_STREAMER_H
 
-#include <stdio.h>
-#include <zlib.h>
+#include <stdint.h>
 
 #include "dlt_cdh_definitions.h"
 
+/* Blocks in which the coredump is read and compressed, each one is written as one gzip member */
+#define CDH_BLOCK_SIZE              (512 * 1024)
+#define CDH_COMPRESS_THREADS_MAX    8
+#define CDH_COMPRESS_LEVEL          1
+
+typedef struct cdh_compressor cdh_compressor_t;
+
 typedef struct
 {
-    FILE *stream;
-    unsigned int offset;
-    gzFile gz_dst_file;
-    unsigned char *read_buf;
+    int fd;
+    uint64_t offset;
+    unsigned char *block;       /* block being read, owned by the compressor if there is one */
+    unsigned int block_len;     /* bytes read into block */
+    unsigned int block_pos;     /* bytes of block consumed by the reader */
+    int eof;
+    cdh_compressor_t *compressor;
+
+    /* filtered mode: only what is passed to stream_write() and stream_copy() is written */
+    int filtered;
+    unsigned char *out_block;   /* block being written, owned by the compressor */
+    unsigned int out_len;
 
 } file_streamer_t;
 
@@ -44,8 +58,12 @@ cdh_status_t stream_init(file_streamer_t *p_fs, const char *p_src_fname, const c
 cdh_status_t stream_close(file_streamer_t *p_fs);
 cdh_status_t stream_read(file_streamer_t *p_fs, void *p_buf, unsigned int p_size);
 cdh_status_t stream_finish(file_streamer_t *p_fs);
-cdh_status_t stream_move_to_offest(file_streamer_t *p_fs, unsigned int p_offset);
-cdh_status_t stream_move_ahead(file_streamer_t *p_fs, unsigned int p_nbbytes);
-unsigned int stream_get_offset(file_streamer_t *p_fs);
+cdh_status_t stream_move_to_offest(file_streamer_t *p_fs, uint64_t p_offset);
+cdh_status_t stream_move_ahead(file_streamer_t *p_fs, uint64_t p_nbbytes);
+uint64_t stream_get_offset(file_streamer_t *p_fs);
+cdh_status_t stream_set_filtered(file_streamer_t *p_fs);
+cdh_status_t stream_write(file_streamer_t *p_fs, const void *p_buf, uint64_t p_size);
+cdh_status_t stream_copy(file_streamer_t *p_fs, uint64_t p_nbbytes);
+cdh_status_t stream_copy_to_end(file_streamer_t *p_fs);
 
 #endif /* #ifndef DLT_CDH_STREAMER_H */
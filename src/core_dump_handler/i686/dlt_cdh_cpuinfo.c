@@ -32,4 +32,5 @@ void get_registers(prstatus_t *prstatus, cdh_registers_t *registers)
     registers->pc = ptr_reg->ecx; /* [REG_PROC_COUNTER]; */
     registers->ip = ptr_reg->eip; /* [REG_INSTR_POINTER]; */
     registers->lr = ptr_reg->ebp; /* [REG_LINK_REGISTER]; */
+    registers->sp = ptr_reg->esp; /* [REG_STACK_POINTER]; */
 }
@@ -38,6 +38,7 @@
 #include <signal.h>
 #include <syslog.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <pthread.h>
 #include <grp.h>
 
@@ -117,6 +118,9 @@ static int dlt_daemon_check_numeric_setting(char *token,
                                             char *value,
                                             unsigned long *data);
 
+static bool load_shedding_keep_message(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
+static bool load_shedding_keep_message_v2(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
+
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
 
 struct DltTraceLoadLogParams {
@@ -129,7 +133,6 @@ struct DltTraceLoadLogParams {
 static DltReturnValue dlt_daemon_output_internal_msg(DltLogLevelType loglevel, const char *text, void *params);
 static void dlt_trace_load_free(DltDaemon* daemon);
 
-pthread_rwlock_t trace_load_rw_lock;
 #endif
 
 /* used in main event loop and signal handler */
@@ -468,6 +471,7 @@ int option_file_parser(DltDaemonLocal *daemon_local)
     daemon_local->RingbufferMaxSize = DLT_DAEMON_RINGBUFFER_MAX_SIZE;
     daemon_local->RingbufferStepSize = DLT_DAEMON_RINGBUFFER_STEP_SIZE;
     daemon_local->daemonFifoSize = 0;
+    daemon_local->serialWriterBufferSize = DLT_DAEMON_SERIAL_WRITER_BUFSIZE;
     daemon_local->flags.sendECUSoftwareVersion = 0;
     memset(daemon_local->flags.pathToECUSoftwareVersion, 0, sizeof(daemon_local->flags.pathToECUSoftwareVersion));
     memset(daemon_local->flags.ecuSoftwareVersionFileField, 0, sizeof(daemon_local->flags.ecuSoftwareVersionFileField));
@@ -503,10 +507,17 @@ int option_file_parser(DltDaemonLocal *daemon_local)
     daemon_local->flags.contextLogLevel = DLT_LOG_INFO;
     daemon_local->flags.contextTraceStatus = DLT_TRACE_STATUS_OFF;
     daemon_local->flags.enforceContextLLAndTS = 0; /* default is off */
+    daemon_local->flags.loadShedding = 0; /* default is off */
+    daemon_local->flags.loadSheddingHighWatermark = 75;
+    daemon_local->flags.loadSheddingLowWatermark = 25;
+    daemon_local->flags.loadSheddingKeepLevel = DLT_LOG_ERROR;
 #ifdef UDP_CONNECTION_SUPPORT
     daemon_local->UDPConnectionSetup = MULTICAST_CONNECTION_ENABLED;
     strncpy(daemon_local->UDPMulticastIPAddress, MULTICASTIPADDRESS, MULTICASTIP_MAX_SIZE - 1);
     daemon_local->UDPMulticastIPPort = MULTICASTIPPORT;
+    daemon_local->UDPMulticastDatagramSize = MULTICAST_DATAGRAM_SIZE;
+    daemon_local->UDPMulticastFlushTimeout = MULTICAST_FLUSH_TIMEOUT;
+    daemon_local->UDPMulticastSequence = 0;
 #endif
     daemon_local->flags.ipNodes = NULL;
     daemon_local->flags.injectionMode = 1;
@@ -679,6 +690,15 @@ int option_file_parser(DltDaemonLocal *daemon_local)
                             return -1;
                         }
                     }
+                    else if (strcmp(token, "SerialWriterBufferSize") == 0)
+                    {
+                        if ((dlt_daemon_check_numeric_setting(token,
+                                value, &(daemon_local->serialWriterBufferSize)) < 0) ||
+                            (daemon_local->serialWriterBufferSize > UINT32_MAX)) {
+                            fclose (pFile);
+                            return -1;
+                        }
+                    }
                     else if (strcmp(token, "SharedMemorySize") == 0)
                     {
                         daemon_local->flags.sharedMemorySize = atoi(value);
@@ -841,6 +861,55 @@ int option_file_parser(DltDaemonLocal *daemon_local)
                                     intval);
                         }
                     }
+                    else if (strcmp(token, "LoadShedding") == 0)
+                    {
+                        daemon_local->flags.loadShedding = atoi(value);
+                        printf("Option: %s=%s\n", token, value);
+                    }
+                    else if (strcmp(token, "LoadSheddingHighWatermark") == 0)
+                    {
+                        int const intval = atoi(value);
+
+                        if ((intval >= 1) && (intval <= 100)) {
+                            daemon_local->flags.loadSheddingHighWatermark = intval;
+                            printf("Option: %s=%s\n", token, value);
+                        }
+                        else {
+                            fprintf(stderr,
+                                    "Invalid value for LoadSheddingHighWatermark: %i. Must be in range [1..100]\n",
+                                    intval);
+                        }
+                    }
+                    else if (strcmp(token, "LoadSheddingLowWatermark") == 0)
+                    {
+                        int const intval = atoi(value);
+
+                        if ((intval >= 1) && (intval <= 100)) {
+                            daemon_local->flags.loadSheddingLowWatermark = intval;
+                            printf("Option: %s=%s\n", token, value);
+                        }
+                        else {
+                            fprintf(stderr,
+                                    "Invalid value for LoadSheddingLowWatermark: %i. Must be in range [1..100]\n",
+                                    intval);
+                        }
+                    }
+                    else if (strcmp(token, "LoadSheddingKeepLevel") == 0)
+                    {
+                        int const intval = atoi(value);
+
+                        if ((intval >= DLT_LOG_FATAL) && (intval <= DLT_LOG_VERBOSE)) {
+                            daemon_local->flags.loadSheddingKeepLevel = intval;
+                            printf("Option: %s=%s\n", token, value);
+                        }
+                        else {
+                            fprintf(stderr,
+                                    "Invalid value for LoadSheddingKeepLevel: %i. Must be in range [%i..%i]\n",
+                                    intval,
+                                    DLT_LOG_FATAL,
+                                    DLT_LOG_VERBOSE);
+                        }
+                    }
 
 #ifdef DLT_DAEMON_USE_FIFO_IPC
                     else if (strcmp(token, "DaemonFIFOSize") == 0)
@@ -886,6 +955,40 @@ int option_file_parser(DltDaemonLocal *daemon_local)
                     {
                         daemon_local->UDPMulticastIPPort = (int)strtol(value, NULL, 10);
                     }
+                    else if (strcmp(token, "UDPMulticastDatagramSize") == 0)
+                    {
+                        const long longval = strtol(value, NULL, 10);
+
+                        if ((longval >= (long)(sizeof(DltUdpDatagramHeader) + sizeof(DltStandardHeader)))
+                            && (longval <= MULTICAST_DATAGRAM_SIZE_MAX)) {
+                            daemon_local->UDPMulticastDatagramSize = (int)longval;
+                            printf("Option: %s=%s\n", token, value);
+                        }
+                        else {
+                            fprintf(stderr,
+                                    "Invalid value for UDPMulticastDatagramSize set to default %d\n",
+                                    MULTICAST_DATAGRAM_SIZE);
+                        }
+                    }
+                    else if (strcmp(token, "UDPMulticastFlushTimeout") == 0)
+                    {
+                        const long longval = strtol(value, NULL, 10);
+
+                        if ((longval >= 0) && (longval <= 1000)) {
+                            daemon_local->UDPMulticastFlushTimeout = (int)longval;
+                            printf("Option: %s=%s\n", token, value);
+                        }
+                        else {
+                            fprintf(stderr,
+                                    "Invalid value for UDPMulticastFlushTimeout set to default %d\n",
+                                    MULTICAST_FLUSH_TIMEOUT);
+                        }
+                    }
+                    else if (strcmp(token, "UDPMulticastSequence") == 0)
+                    {
+                        daemon_local->UDPMulticastSequence = (strtol(value, NULL, 10) != 0);
+                        printf("Option: %s=%s\n", token, value);
+                    }
 #endif
                     else if (strcmp(token, "BindAddress") == 0)
                     {
@@ -952,6 +1055,15 @@ int option_file_parser(DltDaemonLocal *daemon_local)
         fprintf(stderr, "Cannot open configuration file: %s\n", filename);
     }
 
+    if (daemon_local->flags.loadSheddingLowWatermark >= daemon_local->flags.loadSheddingHighWatermark) {
+        fprintf(stderr,
+                "LoadSheddingLowWatermark %d must be below LoadSheddingHighWatermark %d, using 25 and 75\n",
+                daemon_local->flags.loadSheddingLowWatermark,
+                daemon_local->flags.loadSheddingHighWatermark);
+        daemon_local->flags.loadSheddingHighWatermark = 75;
+        daemon_local->flags.loadSheddingLowWatermark = 25;
+    }
+
     return 0;
 }
 
@@ -1264,7 +1376,7 @@ int trace_load_config_file_parser(DltDaemon *daemon, DltDaemonLocal *daemon_loca
         errno = 0;
         char *endptr;
         endptr = NULL;
-        soft_limit = strtoul(soft_limit_value, &endptr, 10);
+        soft_limit = (uint32_t)strtoul(soft_limit_value, &endptr, 10);
         if ((errno != 0)
             || ((soft_limit == 0) && (soft_limit_value[0] != '0'))
             || (soft_limit_value[0] == '-')
@@ -1277,7 +1389,7 @@ int trace_load_config_file_parser(DltDaemon *daemon, DltDaemonLocal *daemon_loca
 
         errno = 0;
         endptr = NULL;
-        hard_limit = strtoul(hard_limit_value, &endptr, 10);
+        hard_limit = (uint32_t)strtoul(hard_limit_value, &endptr, 10);
         if ((errno != 0)
             || ((hard_limit == 0) && (hard_limit_value[0] != '0'))
             || (hard_limit_value[0] == '-')
@@ -1313,7 +1425,7 @@ int trace_load_config_file_parser(DltDaemon *daemon, DltDaemonLocal *daemon_loca
         /* allocate one more element in the trace load settings */
         DltTraceLoadSettings *tmp =
             realloc(daemon->preconfigured_trace_load_settings,
-                    (++daemon->preconfigured_trace_load_settings_count) *
+                    (size_t)(++daemon->preconfigured_trace_load_settings_count) *
                         sizeof(DltTraceLoadSettings));
 
         if (tmp == NULL) {
@@ -1347,7 +1459,7 @@ int trace_load_config_file_parser(DltDaemon *daemon, DltDaemonLocal *daemon_loca
     fclose(pFile);
 
     // sort limits to improve search performance
-    qsort(daemon->preconfigured_trace_load_settings, daemon->preconfigured_trace_load_settings_count,
+    qsort(daemon->preconfigured_trace_load_settings, (size_t)daemon->preconfigured_trace_load_settings_count,
           sizeof(DltTraceLoadSettings),
           dlt_daemon_compare_trace_load_settings);
     return 0;
@@ -1582,7 +1694,6 @@ int main(int argc, char *argv[])
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
     /* Load control trace load configuration file without setting `back` to prevent exit if file is missing */
-    pthread_rwlock_init(&trace_load_rw_lock, NULL);
     if (trace_load_config_file_parser(&daemon, &daemon_local) < 0) {
         dlt_vlog(LOG_WARNING, "trace_load_config_file_parser() failed, using defaults for all app ids!\n");
     }
@@ -1721,7 +1832,6 @@ void dlt_trace_load_free(DltDaemon* daemon)
         free(daemon->preconfigured_trace_load_settings);
         daemon->preconfigured_trace_load_settings = NULL;
     }
-    pthread_rwlock_destroy(&trace_load_rw_lock);
 }
 #endif
 
@@ -3002,6 +3112,7 @@ int dlt_daemon_process_client_connect(DltDaemon *daemon,
                 dlt_log(LOG_DEBUG, "Send ring-buffer to client\n");
 
             dlt_daemon_change_state(daemon, DLT_DAEMON_STATE_SEND_BUFFER);
+            /* the client can not have set a filter yet, the buffer is sent unfiltered */
             if (dlt_daemon_send_ringbuffer_to_client_v2(daemon, daemon_local, verbose) == -1) {
                 dlt_log(LOG_WARNING, "Can't send contents of ringbuffer to clients\n");
                 close(in_sock);
@@ -3085,6 +3196,7 @@ int dlt_daemon_process_client_connect(DltDaemon *daemon,
 
             dlt_daemon_change_state(daemon, DLT_DAEMON_STATE_SEND_BUFFER);
 
+            /* the client can not have set a filter yet, the buffer is sent unfiltered */
             if (dlt_daemon_send_ringbuffer_to_client(daemon, daemon_local, verbose) == -1) {
                 dlt_log(LOG_WARNING, "Can't send contents of ringbuffer to clients\n");
                 close(in_sock);
@@ -3682,6 +3794,40 @@ static dlt_daemon_process_user_message_func process_user_func[DLT_USER_MESSAGE_N
     dlt_daemon_process_user_message_not_sup
 };
 
+/**
+ * Find the next complete user header in the data received from the applications.
+ * @param buffer received data
+ * @param length number of received bytes
+ * @return offset of the user header, -1 if no complete user header was found
+ */
+static int dlt_daemon_find_userheader(char *buffer, int32_t length)
+{
+    const uint8_t pattern[] = { 'D', 'U', 'H' };
+    const uint8_t *data = (const uint8_t *)buffer;
+    const uint8_t *found;
+    int32_t offset = 0;
+
+    while (offset + (int32_t)sizeof(DltUserHeader) <= length) {
+        found = dlt_find_pattern(data + offset, (size_t)(length - offset), pattern, sizeof(pattern));
+
+        if (found == NULL)
+            return -1;
+
+        offset = (int32_t)(found - data);
+
+        if (offset + (int32_t)sizeof(DltUserHeader) > length)
+            return -1;
+
+        /* the pattern is followed by the supported versions */
+        if (dlt_user_check_userheader((DltUserHeader *)(buffer + offset)))
+            return offset;
+
+        offset++;
+    }
+
+    return -1;
+}
+
 int dlt_daemon_process_user_messages(DltDaemon *daemon,
                                      DltDaemonLocal *daemon_local,
                                      DltReceiver *receiver,
@@ -3741,20 +3887,15 @@ int dlt_daemon_process_user_messages(DltDaemon *daemon,
     #endif
             dlt_daemon_process_user_message_func func = NULL;
 
-            offset = 0;
-            userheader = (DltUserHeader *)(receiver->buf + offset);
-
-            while (!dlt_user_check_userheader(userheader) &&
-                (offset + min_size <= receiver->bytesRcvd)) {
-                /* resync if necessary */
-                offset++;
-                userheader = (DltUserHeader *)(receiver->buf + offset);
-            }
+            /* resync if necessary */
+            offset = dlt_daemon_find_userheader(receiver->buf, receiver->bytesRcvd);
 
             /* Check for user header pattern */
-            if (!dlt_user_check_userheader(userheader))
+            if (offset < 0)
                 break;
 
+            userheader = (DltUserHeader *)(receiver->buf + offset);
+
             /* Set new start offset */
             if (offset > 0) {
                 if (dlt_receiver_remove(receiver, offset) == -1) {
@@ -3805,20 +3946,15 @@ int dlt_daemon_process_user_messages(DltDaemon *daemon,
 #endif
             dlt_daemon_process_user_message_func func = NULL;
 
-            offset = 0;
-            userheader = (DltUserHeader *)(receiver->buf + offset);
-
-            while (!dlt_user_check_userheader(userheader) &&
-                (offset + min_size <= receiver->bytesRcvd)) {
-                /* resync if necessary */
-                offset++;
-                userheader = (DltUserHeader *)(receiver->buf + offset);
-            }
+            /* resync if necessary */
+            offset = dlt_daemon_find_userheader(receiver->buf, receiver->bytesRcvd);
 
             /* Check for user header pattern */
-            if (!dlt_user_check_userheader(userheader))
+            if (offset < 0)
                 break;
 
+            userheader = (DltUserHeader *)(receiver->buf + offset);
+
             /* Set new start offset */
             if (offset > 0) {
                 if (dlt_receiver_remove(receiver, offset) == -1) {
@@ -3933,6 +4069,88 @@ int dlt_daemon_send_message_overflow_v2(DltDaemon *daemon, DltDaemonLocal *daemo
     return DLT_DAEMON_ERROR_OK;
 }
 
+void dlt_daemon_process_load_shedding(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose)
+{
+    DltDaemonLoadShedding *ls = NULL;
+    DltDaemonApplication *app = NULL;
+    char local_str[DLT_DAEMON_TEXTBUFSIZE];
+    uint32_t unregistered = 0;
+    int fill = 0;
+    int used = 0;
+    int i = 0;
+    int j = 0;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((daemon == NULL) || (daemon_local == NULL) || !daemon_local->flags.loadShedding)
+        return;
+
+    ls = &daemon_local->loadShedding;
+
+    /* report what was shed per application instead of a single overflow count */
+    if (ls->shed_messages > 0) {
+        unregistered = ls->shed_messages;
+
+        for (i = 0; i < daemon->num_user_lists; i++) {
+            for (j = 0; j < daemon->user_list[i].num_applications; j++) {
+                app = &daemon->user_list[i].applications[j];
+
+                if (app->load_shed_messages == 0)
+                    continue;
+
+                if (daemon->daemon_version == DLTProtocolV2)
+                    snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE, "%u messages shed for app %.*s",
+                             app->load_shed_messages, (int)app->apid2len, app->apid2);
+                else
+                    snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE, "%u messages shed for app %.4s",
+                             app->load_shed_messages, app->apid);
+
+                dlt_daemon_log_internal(daemon, daemon_local, local_str, DLT_LOG_WARN,
+                                        DLT_DAEMON_APP_ID, DLT_DAEMON_CTX_ID, verbose);
+                unregistered -= (app->load_shed_messages < unregistered) ? app->load_shed_messages : unregistered;
+            }
+        }
+
+        if (unregistered > 0) {
+            snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE, "%u messages shed for unregistered apps", unregistered);
+            dlt_daemon_log_internal(daemon, daemon_local, local_str, DLT_LOG_WARN,
+                                    DLT_DAEMON_APP_ID, DLT_DAEMON_CTX_ID, verbose);
+        }
+    }
+
+    used = dlt_buffer_get_used_size(&daemon->client_ringbuffer);
+
+    if ((used > 0) && (daemon->client_ringbuffer.max_size > 0))
+        fill = (int)((uint64_t)used * 100U / daemon->client_ringbuffer.max_size);
+
+    snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE,
+             "Load shedding: %" PRIu64 " bytes received, %" PRIu64 " bytes per second of sending, buffer %d%% full",
+             ls->ingest_bytes, ls->capacity, fill);
+
+    dlt_daemon_load_shedding_update(ls, daemon, fill, daemon_local->client_connections,
+                                    dlt_daemon_load_shedding_now(),
+                                    daemon_local->flags.loadSheddingHighWatermark,
+                                    daemon_local->flags.loadSheddingLowWatermark,
+                                    daemon_local->flags.loadSheddingKeepLevel);
+
+    if (ls->shed_levels != ls->reported_levels) {
+        ls->reported_levels = ls->shed_levels;
+        dlt_daemon_log_internal(daemon, daemon_local, local_str, DLT_LOG_INFO,
+                                DLT_DAEMON_APP_ID, DLT_DAEMON_CTX_ID, verbose);
+
+        if (ls->shed_levels > 0)
+            snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE,
+                     "Load shedding: log levels above %d are discarded",
+                     DLT_LOG_VERBOSE - ls->shed_levels);
+        else
+            snprintf(local_str, DLT_DAEMON_TEXTBUFSIZE, "Load shedding: all log levels are kept again");
+
+        dlt_daemon_log_internal(daemon, daemon_local, local_str, DLT_LOG_INFO,
+                                DLT_DAEMON_APP_ID, DLT_DAEMON_CTX_ID, verbose);
+        dlt_vlog(LOG_INFO, "%s\n", local_str);
+    }
+}
+
 int dlt_daemon_process_user_message_register_application(DltDaemon *daemon,
                                                          DltDaemonLocal *daemon_local,
                                                          DltReceiver *rec,
@@ -5142,8 +5360,12 @@ int dlt_daemon_process_user_message_log(DltDaemon *daemon,
         keep_message &= trace_load_keep_message(app, size, daemon, daemon_local, verbose);
 #endif
 
-        if (keep_message)
-          dlt_daemon_client_send_message_to_all_client(daemon, daemon_local, verbose);
+        if (keep_message) {
+            /* shed messages still go to the offline trace and logstorage */
+            daemon_local->loadShedding.shed_message = !load_shedding_keep_message(daemon, daemon_local, verbose);
+            dlt_daemon_client_send_message_to_all_client(daemon, daemon_local, verbose);
+            daemon_local->loadShedding.shed_message = false;
+        }
 
         if (DLT_DAEMON_ERROR_OK != ret)
             dlt_log(LOG_ERR, "failed to send message to client.\n");
@@ -5171,10 +5393,10 @@ int dlt_daemon_process_user_message_log(DltDaemon *daemon,
         }
 
 #if defined(DLT_LOG_LEVEL_APP_CONFIG) || defined(DLT_TRACE_LOAD_CTRL_ENABLE)
-        DltDaemonApplication *app = (DltDaemonApplication *)malloc(sizeof(DltDaemonApplication));
+        DltDaemonApplication *app = NULL;
         dlt_daemon_application_find_v2(
-            daemon, daemon_local->msgv2.extendedheaderv2->apidlen,
-            daemon_local->msgv2.extendedheaderv2->apid, daemon->ecuid2len, daemon->ecuid2, verbose, &app);
+            daemon, daemon_local->msgv2.extendedheaderv2.apidlen,
+            daemon_local->msgv2.extendedheaderv2.apid, daemon->ecuid2len, daemon->ecuid2, verbose, &app);
 #endif
 
         /* discard non-allowed levels if enforcement is on */
@@ -5190,8 +5412,12 @@ int dlt_daemon_process_user_message_log(DltDaemon *daemon,
         keep_message &=
             trace_load_keep_message_v2(app, size, daemon, daemon_local, verbose);
 #endif
+
         if (keep_message){
+            /* shed messages still go to the offline trace and logstorage */
+            daemon_local->loadShedding.shed_message = !load_shedding_keep_message_v2(daemon, daemon_local, verbose);
             dlt_daemon_client_send_message_to_all_client_v2(daemon, daemon_local, verbose);
+            daemon_local->loadShedding.shed_message = false;
         }
         /* keep not read data in buffer */
         size = (int) (daemon_local->msgv2.headersizev2 +
@@ -5245,8 +5471,12 @@ int dlt_daemon_process_user_message_log(DltDaemon *daemon,
         keep_message &=
             trace_load_keep_message(app, size, daemon, daemon_local, verbose);
 #endif
+
         if (keep_message){
+            /* shed messages still go to the offline trace and logstorage */
+            daemon_local->loadShedding.shed_message = !load_shedding_keep_message(daemon, daemon_local, verbose);
             dlt_daemon_client_send_message_to_all_client(daemon, daemon_local, verbose);
+            daemon_local->loadShedding.shed_message = false;
         }
 
         /* keep not read data in buffer */
@@ -5332,6 +5562,63 @@ bool enforce_context_ll_and_ts_keep_message_v2(DltDaemonLocal *daemon_local
     return mtin <= daemon_local->flags.contextLogLevel;
 }
 
+/* the ring buffer above the high watermark is left for the levels which are never shed */
+static void load_shedding_check_ringbuffer(DltDaemon *daemon, DltDaemonLocal *daemon_local)
+{
+    int used = 0;
+
+    if (daemon->state == DLT_DAEMON_STATE_SEND_DIRECT)
+        return;
+
+    used = dlt_buffer_get_used_size(&daemon->client_ringbuffer);
+
+    if ((used > 0) &&
+        ((uint64_t)used * 100U >= (uint64_t)daemon->client_ringbuffer.max_size *
+         (uint64_t)daemon_local->flags.loadSheddingHighWatermark))
+        dlt_daemon_load_shedding_overload(&daemon_local->loadShedding, daemon_local->flags.loadSheddingKeepLevel);
+}
+
+/* messages discarded by the checks before are not part of the load */
+static bool load_shedding_keep_message(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose)
+{
+    DltMessage *msg = &daemon_local->msg;
+
+    if (!daemon_local->flags.loadShedding || (msg->extendedheader == NULL))
+        return true;
+
+    load_shedding_check_ringbuffer(daemon, daemon_local);
+
+    return dlt_daemon_load_shedding_keep_message(
+        &daemon_local->loadShedding,
+        dlt_daemon_application_find(daemon, msg->extendedheader->apid, daemon->ecuid, verbose),
+        DLT_GET_MSIN_MSTP(msg->extendedheader->msin),
+        DLT_GET_MSIN_MTIN(msg->extendedheader->msin),
+        (uint32_t)msg->headersize - (uint32_t)sizeof(DltStorageHeader) + (uint32_t)msg->datasize,
+        daemon_local->flags.loadSheddingKeepLevel);
+}
+
+static bool load_shedding_keep_message_v2(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose)
+{
+    DltMessageV2 *msg = &daemon_local->msgv2;
+    DltDaemonApplication *app = NULL;
+
+    if (!daemon_local->flags.loadShedding)
+        return true;
+
+    load_shedding_check_ringbuffer(daemon, daemon_local);
+
+    if (msg->extendedheaderv2.apid != NULL)
+        dlt_daemon_application_find_v2(daemon, msg->extendedheaderv2.apidlen, msg->extendedheaderv2.apid,
+                                       daemon->ecuid2len, daemon->ecuid2, verbose, &app);
+
+    return dlt_daemon_load_shedding_keep_message(
+        &daemon_local->loadShedding,
+        app,
+        DLT_GET_MSIN_MSTP(msg->headerextrav2.msin),
+        DLT_GET_MSIN_MTIN(msg->headerextrav2.msin),
+        (uint32_t)msg->headersizev2 - msg->storageheadersizev2 + (uint32_t)msg->datasize,
+        daemon_local->flags.loadSheddingKeepLevel);
+}
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
 bool trace_load_keep_message(DltDaemonApplication *app,
@@ -5382,11 +5669,85 @@ bool trace_load_keep_message(DltDaemonApplication *app,
         }
     }
 
-    pthread_rwlock_wrlock(&trace_load_rw_lock);
+    /* the accounting is lock free, see dlt_check_trace_load() */
     keep_message = dlt_check_trace_load(
         context->trace_load_settings, mtin, msg->headerextra.tmsp, size,
         dlt_daemon_output_internal_msg, (void *)(&params));
-    pthread_rwlock_unlock(&trace_load_rw_lock);
+
+    return keep_message;
+}
+
+bool trace_load_keep_message_v2(DltDaemonApplication *app,
+                                const int size, DltDaemon *const daemon,
+                                DltDaemonLocal *const daemon_local,
+                                int verbose)
+{
+    bool keep_message = true;
+    DltMessageV2 *msg = &daemon_local->msgv2;
+
+    if ((app == NULL) || (msg->extendedheaderv2.apid == NULL) || (msg->extendedheaderv2.ctid == NULL)) {
+        return keep_message;
+    }
+
+    const int mtin = DLT_GET_MSIN_MTIN(msg->headerextrav2.msin);
+
+    /* the internal messages use the 4 character ids */
+    char tl_apid[DLT_ID_SIZE + 1] = { 0 };
+    memcpy(tl_apid, app->apid2, app->apid2len < DLT_ID_SIZE ? app->apid2len : DLT_ID_SIZE);
+
+    struct DltTraceLoadLogParams params = {
+        daemon,
+        daemon_local,
+        verbose,
+        tl_apid,
+    };
+
+    DltDaemonContext *context = dlt_daemon_context_find_v2(
+        daemon,
+        msg->extendedheaderv2.apidlen,
+        msg->extendedheaderv2.apid,
+        msg->extendedheaderv2.ctidlen,
+        msg->extendedheaderv2.ctid,
+        daemon->ecuid2len,
+        daemon->ecuid2,
+        verbose);
+
+    if (context == NULL) {
+        context = dlt_daemon_context_add_v2(
+            daemon,
+            msg->extendedheaderv2.apidlen,
+            msg->extendedheaderv2.apid,
+            msg->extendedheaderv2.ctidlen,
+            msg->extendedheaderv2.ctid,
+            daemon->default_log_level,
+            daemon->default_trace_status,
+            0,
+            app->user_handle,
+            "",
+            daemon->ecuid2len,
+            daemon->ecuid2,
+            verbose);
+        if (context == NULL) {
+            dlt_vlog(LOG_WARNING,
+                     "Can't add ContextID '%.*s' for ApID '%.*s' in %s\n",
+                     msg->extendedheaderv2.ctidlen, msg->extendedheaderv2.ctid,
+                     msg->extendedheaderv2.apidlen, msg->extendedheaderv2.apid, __func__);
+            return false;
+        }
+    }
+
+    /* the version 2 header carries the time since epoch, the window only needs
+     * a monotonic counter in units of 0.1 msec, so its wrap around is fine */
+    uint64_t seconds = 0;
+    for (int i = 0; i < 5; i++)
+        seconds = (seconds << 8) | msg->headerextrav2.seconds[i];
+
+    const uint32_t timestamp = (uint32_t)(seconds * 10000U + msg->headerextrav2.nanoseconds / 100000U);
+
+    /* the accounting is lock free, see dlt_check_trace_load() */
+    keep_message = dlt_check_trace_load(
+        context->trace_load_settings, mtin, timestamp, size,
+        dlt_daemon_output_internal_msg, (void *)(&params));
 
     return keep_message;
 }
@@ -5824,7 +6185,7 @@ static DltReturnValue dlt_daemon_output_internal_msg(
     const DltLogLevelType loglevel, const char *const text, void* const params) {
     struct DltTraceLoadLogParams* log_params = (struct DltTraceLoadLogParams*)params;
     return dlt_daemon_log_internal(
-        log_params->daemon, log_params->daemon_local, (char *)text, loglevel,
+        log_params->daemon, log_params->daemon_local, (char *)(uintptr_t)text, loglevel,
         log_params->app_id, DLT_TRACE_LOAD_CONTEXT_ID, log_params->verbose);
 }
 #endif
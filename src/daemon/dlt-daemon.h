@@ -77,6 +77,7 @@
 #include "dlt_daemon_event_handler_types.h"
 #include "dlt_gateway_types.h"
 #include "dlt_offline_trace.h"
+#include "dlt_daemon_load_shedding.h"
 
 #define DLT_DAEMON_FLAG_MAX 256
 
@@ -154,6 +155,10 @@ typedef struct
     DltBindAddress_t* ipNodes;                              /**< (String: BindAddress) The daemon accepts connections only on this list of IP addresses        */
     int  injectionMode;                                     /**< (Boolean) Injection mode                                                                      */
     int  protocolVersion;                                   /**< (int) Protocol version selected by user (1 or 2, 0=default)                                  */
+    int  loadShedding;                                      /**< (Boolean) Shed the lowest log levels first when the clients cannot keep up (Default: 0)      */
+    int  loadSheddingHighWatermark;                         /**< (int) Load in percent above which one more log level is shed (Default: 75)                   */
+    int  loadSheddingLowWatermark;                          /**< (int) Load in percent below which shed log levels are given back (Default: 25)              */
+    int  loadSheddingKeepLevel;                             /**< (int) Highest log level which is never shed (Default: 2 = DLT_LOG_ERROR)                     */
 } DltDaemonFlags;
 /**
  * The global parameters of a dlt daemon.
@@ -175,15 +180,20 @@ typedef struct
 #endif
     MultipleFilesRingBuffer offlineTrace;  /**< Offline trace handling */
     MultipleFilesRingBuffer dltLogging;    /**< Dlt logging handling   */
+    DltDaemonLoadShedding loadShedding;    /**< Load shedding state    */
     int timeoutOnSend;
     unsigned long RingbufferMinSize;
     unsigned long RingbufferMaxSize;
     unsigned long RingbufferStepSize;
     unsigned long daemonFifoSize;
+    unsigned long serialWriterBufferSize;              /* ring buffer of the serial writer thread */
 #ifdef UDP_CONNECTION_SUPPORT
     int UDPConnectionSetup;                            /* enable/disable the UDP connection */
     char UDPMulticastIPAddress[MULTICASTIP_MAX_SIZE];  /* multicast ip addres               */
     int UDPMulticastIPPort;                            /* multicast port                    */
+    int UDPMulticastDatagramSize;                      /* maximum size of a datagram        */
+    int UDPMulticastFlushTimeout;                      /* maximum delay of a message in ms  */
+    int UDPMulticastSequence;                          /* add datagram header with sequence */
 #endif
 } DltDaemonLocal;
 
@@ -250,6 +260,7 @@ int dlt_daemon_process_user_message_overflow(DltDaemon *daemon,
                                              int verbose);
 int dlt_daemon_send_message_overflow(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
 int dlt_daemon_send_message_overflow_v2(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
+void dlt_daemon_process_load_shedding(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
 int dlt_daemon_process_user_message_register_application(DltDaemon *daemon,
                                                          DltDaemonLocal *daemon_local,
                                                          DltReceiver *rec,
@@ -307,6 +318,8 @@ int dlt_daemon_close_socket(int sock, DltDaemon *daemon, DltDaemonLocal *daemon_
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
 bool trace_load_keep_message(
     DltDaemonApplication *app, int size, DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
+bool trace_load_keep_message_v2(
+    DltDaemonApplication *app, int size, DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
 // Functions that are only exposed for testing and should not be public
 // for normal builds
 #ifdef DLT_UNIT_TESTS
@@ -106,6 +106,15 @@
 /* Default baudrate for serial interface */
 #define DLT_DAEMON_SERIAL_DEFAULT_BAUDRATE 115200
 
+/* Default size of the ring buffer of the serial writer thread, 0 to write directly */
+#define DLT_DAEMON_SERIAL_WRITER_BUFSIZE (64 * 1024)
+
+/* Limits and default of the number of message bytes compressed into one frame
+ * of a compressed client stream. The minimum holds the biggest message. */
+#define DLT_DAEMON_COMPRESSION_BATCH_MIN     (68 * 1024)
+#define DLT_DAEMON_COMPRESSION_BATCH_DEFAULT (128 * 1024)
+#define DLT_DAEMON_COMPRESSION_BATCH_MAX     (192 * 1024)
+
 /************************/
 /* Don't change please! */
 /************************/
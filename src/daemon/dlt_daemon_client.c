@@ -63,6 +63,7 @@
 #include "dlt_daemon_client.h"
 #include "dlt_daemon_connection.h"
 #include "dlt_daemon_event_handler.h"
+#include "dlt_filter_engine.h"
 
 #include "dlt_daemon_offline_logstorage.h"
 #include "dlt_gateway.h"
@@ -84,9 +85,63 @@ static inline int8_t getStatus(uint8_t request_log, int context_log)
     return (int8_t)((request_log <= context_log) ? request_log : context_log);
 }
 
+/** @brief Prepare a message for the client filters.
+ *
+ * Fills the header pointers of a message without copying the data. The
+ * standard header is expected at the start of the first buffer, the payload
+ * follows the headers or is the second buffer.
+ *
+ * @param msg Message to be filled.
+ * @param data1 The first part of the message.
+ * @param size1 The size of the first part.
+ * @param data2 The second part of the message, may be NULL.
+ * @param size2 The size of the second part.
+ *
+ * @return 1 if the message can be filtered, 0 if it has to be sent to all clients.
+ */
+static int dlt_daemon_client_message_view(DltMessage *msg, void *data1, int size1, void *data2, int size2)
+{
+    int32_t headersize;
+
+    if ((data1 == NULL) || (size1 < (int)sizeof(DltStandardHeader)))
+        return 0;
+
+    memset(msg, 0, sizeof(DltMessage));
+    msg->standardheader = (DltStandardHeader *)data1;
+
+    /* version 2 messages, messages without extended header and control
+     * messages are sent to every client */
+    if (((msg->standardheader->htyp & DLT_HTYP_VERS) != DLT_HTYP_PROTOCOL_VERSION1) ||
+        !DLT_IS_HTYP_UEH(msg->standardheader->htyp))
+        return 0;
+
+    headersize = (int32_t)(sizeof(DltStandardHeader) + sizeof(DltExtendedHeader) +
+                           DLT_STANDARD_HEADER_EXTRA_SIZE(msg->standardheader->htyp));
+
+    if (size1 < headersize)
+        return 0;
+
+    msg->extendedheader = (DltExtendedHeader *)((uint8_t *)data1 + headersize - sizeof(DltExtendedHeader));
+
+    if (DLT_GET_MSIN_MSTP(msg->extendedheader->msin) == DLT_TYPE_CONTROL)
+        return 0;
+
+    if (data2 != NULL) {
+        msg->databuffer = (uint8_t *)data2;
+        msg->datasize = size2;
+    }
+    else {
+        msg->databuffer = (uint8_t *)data1 + headersize;
+        msg->datasize = size1 - headersize;
+    }
+
+    return 1;
+}
+
 /** @brief Sends up to 2 messages to all the clients.
  *
- * Runs through the client list and sends the messages to them. If the message
+ * Runs through the client list and sends the messages to them. Clients which
+ * set a filter only get the messages matching it. If the message
  * transfer fails and the connection is a socket connection, the socket is closed.
  * Takes and release dlt_daemon_mutex.
  *
@@ -112,6 +167,9 @@ static int dlt_daemon_client_send_all_multiple(DltDaemon *daemon,
     nfds_t i = 0;
     int ret = 0;
     DltConnection *temp = NULL;
+    DltMessage msg;
+    int parsed = -1;
+    uint64_t start = 0;
     int type_mask =
         (DLT_CON_MASK_CLIENT_MSG_TCP | DLT_CON_MASK_CLIENT_MSG_SERIAL);
 
@@ -122,6 +180,10 @@ static int dlt_daemon_client_send_all_multiple(DltDaemon *daemon,
         return 0;
     }
 
+    /* the time blocked in sending is what the load shedding measures */
+    if (daemon_local->flags.loadShedding)
+        start = dlt_daemon_load_shedding_now();
+
     for (i = 0; i < daemon_local->pEvent.nfds; i++)
     {
 #ifdef DLT_SYSTEMD_WATCHDOG_ENABLE
@@ -140,6 +202,18 @@ static int dlt_daemon_client_send_all_multiple(DltDaemon *daemon,
             continue;
         }
 
+        if (temp->filter != NULL) {
+            /* headers are only parsed once for all clients with a filter */
+            if (parsed < 0)
+                parsed = dlt_daemon_client_message_view(&msg, data1, size1, data2, size2);
+
+            if (parsed && (dlt_filter_engine_match(temp->filter, &msg) != DLT_RETURN_TRUE)) {
+                /* not wanted by this client, which is the same as sent */
+                sent = 1;
+                continue;
+            }
+        }
+
         ret = dlt_connection_send_multiple(temp,
                                            data1,
                                            size1,
@@ -167,14 +241,106 @@ static int dlt_daemon_client_send_all_multiple(DltDaemon *daemon,
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
     if (sent)
     {
-        const uint32_t serial_header = daemon->sendserialheader ? sizeof(dltSerialHeader) : 0;
+        const int serial_header = daemon->sendserialheader ? (int)sizeof(dltSerialHeader) : 0;
         daemon->bytes_sent += size1 + size2 + serial_header;
     }
 #endif
 
+    if (daemon_local->flags.loadShedding)
+        dlt_daemon_load_shedding_sent(&daemon_local->loadShedding,
+                                      sent ? (uint32_t)(size1 + size2) : 0U,
+                                      start);
+
     return sent;
 }
 
+#ifdef DLT_STREAM_COMPRESSION
+/**
+ * Send a message to the client of a compressed connection.
+ *
+ * @param sock connection handle of the client
+ * @param daemon pointer to dlt daemon structure
+ * @param daemon_local pointer to dlt daemon local structure
+ * @param data1 first part of the message
+ * @param size1 size of the first part
+ * @param data2 second part of the message
+ * @param size2 size of the second part
+ * @return DLT_DAEMON_ERROR_OK if sent, 1 if the connection is not compressed,
+ *         negative value if there was an error
+ */
+static int dlt_daemon_client_send_compressed(int sock,
+                                             DltDaemon *daemon,
+                                             DltDaemonLocal *daemon_local,
+                                             void *data1,
+                                             int size1,
+                                             void *data2,
+                                             int size2)
+{
+    DltConnection *con = dlt_event_handler_find_connection(&(daemon_local->pEvent), sock);
+
+    if ((con == NULL) || (con->compression == NULL))
+        return 1;
+
+    return dlt_connection_send_multiple(con, data1, size1, data2, size2, daemon->sendserialheader);
+}
+
+void dlt_daemon_client_flush_compressed(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose)
+{
+    DltConnection *con = NULL;
+    DltConnection *next = NULL;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((daemon == NULL) || (daemon_local == NULL))
+        return;
+
+    for (con = daemon_local->pEvent.connections; con != NULL; con = next) {
+        /* the connection is destroyed if sending fails */
+        next = con->next;
+
+        if ((con->compression == NULL) || (con->compression->used == 0))
+            continue;
+
+        if (dlt_connection_flush(con) != DLT_DAEMON_ERROR_OK) {
+            dlt_vlog(LOG_WARNING, "%s: send compressed frame failed\n", __func__);
+
+            if (con->type == DLT_CONNECTION_CLIENT_MSG_TCP)
+                dlt_daemon_close_socket(con->receiver->fd, daemon, daemon_local, verbose);
+        }
+    }
+}
+#endif
+
+/**
+ * Send a message to the client of a serial connection, through the writer
+ * thread of the connection if it has one.
+ *
+ * @param sock file descriptor of the serial device
+ * @param daemon pointer to dlt daemon structure
+ * @param daemon_local pointer to dlt daemon local structure
+ * @param data1 first part of the message
+ * @param size1 size of the first part
+ * @param data2 second part of the message
+ * @param size2 size of the second part
+ * @return DLT_DAEMON_ERROR_OK on success, negative value if there was an error
+ */
+static int dlt_daemon_client_send_serial(int sock,
+                                         DltDaemon *daemon,
+                                         DltDaemonLocal *daemon_local,
+                                         void *data1,
+                                         int size1,
+                                         void *data2,
+                                         int size2)
+{
+    DltConnection *con = dlt_event_handler_find_connection(&(daemon_local->pEvent), sock);
+
+    if ((con != NULL) && (con->serial_sink != NULL))
+        return dlt_daemon_serial_sink_send(con->serial_sink, data1, size1, data2, size2,
+                                           (char)daemon->sendserialheader);
+
+    return dlt_daemon_serial_send(sock, data1, size1, data2, size2, (char)daemon->sendserialheader);
+}
+
 /* TODO: Extract the storage header v2 from buffer */
 int dlt_daemon_client_send(int sock,
                            DltDaemon *daemon,
@@ -197,11 +363,18 @@ int dlt_daemon_client_send(int sock,
     }
 
     if ((sock != DLT_DAEMON_SEND_TO_ALL) && (sock != DLT_DAEMON_SEND_FORCE)) {
+#ifdef DLT_STREAM_COMPRESSION
+        /* a compressed connection must only get frames */
+        if ((ret = dlt_daemon_client_send_compressed(sock, daemon, daemon_local, data1, size1, data2,
+                                                     size2)) <= DLT_DAEMON_ERROR_OK)
+            return ret;
+#endif
+
         /* Send message to specific socket */
         if (isatty(sock)) {
             if ((ret =
-                     dlt_daemon_serial_send(sock, data1, size1, data2, size2,
-                                            (char)daemon->sendserialheader))) {
+                     dlt_daemon_client_send_serial(sock, daemon, daemon_local, data1, size1,
+                                                   data2, size2))) {
                 dlt_vlog(LOG_WARNING, "%s: serial send dlt message failed\n", __func__);
                 return ret;
             }
@@ -269,7 +442,7 @@ int dlt_daemon_client_send(int sock,
 
         if ((sock == DLT_DAEMON_SEND_FORCE) || (daemon->state == DLT_DAEMON_STATE_SEND_DIRECT)) {
             /* Forward message to network client if network routing is not disabled */
-            if (ret_logstorage != 1) {
+            if ((ret_logstorage != 1) && !daemon_local->loadShedding.shed_message) {
                 sent = dlt_daemon_client_send_all_multiple(daemon,
                                                            daemon_local,
                                                            data1,
@@ -289,6 +462,10 @@ int dlt_daemon_client_send(int sock,
     if ((sock != DLT_DAEMON_SEND_FORCE) &&
         ((daemon->state == DLT_DAEMON_STATE_BUFFER) || (daemon->state == DLT_DAEMON_STATE_SEND_BUFFER) ||
          (daemon->state == DLT_DAEMON_STATE_BUFFER_FULL))) {
+        /* shed messages are not kept for the clients */
+        if (daemon_local->loadShedding.shed_message)
+            return DLT_DAEMON_ERROR_OK;
+
         if (daemon->state != DLT_DAEMON_STATE_BUFFER_FULL) {
             /* Store message in history buffer */
             ret = dlt_buffer_push3(&(daemon->client_ringbuffer), data1, (unsigned int)size1, data2, (unsigned int)size2, 0U, 0U);
@@ -349,11 +526,18 @@ int dlt_daemon_client_send_v2(int sock,
     }
 
     if ((sock != DLT_DAEMON_SEND_TO_ALL) && (sock != DLT_DAEMON_SEND_FORCE)) {
+#ifdef DLT_STREAM_COMPRESSION
+        /* a compressed connection must only get frames */
+        if ((ret = dlt_daemon_client_send_compressed(sock, daemon, daemon_local, data1, size1, data2,
+                                                     size2)) <= DLT_DAEMON_ERROR_OK)
+            return ret;
+#endif
+
         /* Send message to specific socket */
         if (isatty(sock)) {
             if ((ret =
-                     dlt_daemon_serial_send(sock, data1, size1, data2, size2,
-                                            (char)daemon->sendserialheader))) {
+                     dlt_daemon_client_send_serial(sock, daemon, daemon_local, data1, size1,
+                                                   data2, size2))) {
                 dlt_vlog(LOG_WARNING, "%s: serial send dlt message failed\n", __func__);
                 return ret;
             }
@@ -423,7 +607,7 @@ int dlt_daemon_client_send_v2(int sock,
 
         if ((sock == DLT_DAEMON_SEND_FORCE) || (daemon->state == DLT_DAEMON_STATE_SEND_DIRECT)) {
             /* Forward message to network client if network routing is not disabled */
-            if (ret_logstorage != 1) {
+            if ((ret_logstorage != 1) && !daemon_local->loadShedding.shed_message) {
                 sent = dlt_daemon_client_send_all_multiple(daemon,
                                                            daemon_local,
                                                            data1,
@@ -443,6 +627,10 @@ int dlt_daemon_client_send_v2(int sock,
     if ((sock != DLT_DAEMON_SEND_FORCE) &&
         ((daemon->state == DLT_DAEMON_STATE_BUFFER) || (daemon->state == DLT_DAEMON_STATE_SEND_BUFFER) ||
          (daemon->state == DLT_DAEMON_STATE_BUFFER_FULL))) {
+        /* shed messages are not kept for the clients */
+        if (daemon_local->loadShedding.shed_message)
+            return DLT_DAEMON_ERROR_OK;
+
         if (daemon->state != DLT_DAEMON_STATE_BUFFER_FULL) {
             /* Store message in history buffer */
             ret = dlt_buffer_push3(&(daemon->client_ringbuffer), data1, (unsigned int)size1, data2, (unsigned int)size2, 0, 0);
@@ -1212,6 +1400,16 @@ int dlt_daemon_client_process_control(int sock,
             dlt_daemon_control_set_all_trace_status(sock, daemon, daemon_local, msg, verbose);
             break;
         }
+        case DLT_SERVICE_ID_SET_CLIENT_FILTER:
+        {
+            dlt_daemon_control_set_client_filter(sock, daemon, daemon_local, msg, verbose);
+            break;
+        }
+        case DLT_SERVICE_ID_SET_STREAM_COMPRESSION:
+        {
+            dlt_daemon_control_set_stream_compression(sock, daemon, daemon_local, msg, verbose);
+            break;
+        }
         default:
         {
             dlt_daemon_control_service_response(sock,
@@ -4429,6 +4627,173 @@ void dlt_daemon_control_set_all_trace_status_v2(int sock,
     }
 }
 
+void dlt_daemon_control_set_client_filter(int sock,
+                                          DltDaemon *daemon,
+                                          DltDaemonLocal *daemon_local,
+                                          DltMessage *msg,
+                                          int verbose)
+{
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    DltServiceSetClientFilter *req = NULL;
+    DltServiceClientFilterRule *req_rule = NULL;
+    DltConnection *con = NULL;
+    DltFilterEngine *filter = NULL;
+    DltFilterRule rule;
+    uint32_t id = DLT_SERVICE_ID_SET_CLIENT_FILTER;
+    uint16_t count = 0;
+    uint16_t i = 0;
+
+    if ((daemon == NULL) || (daemon_local == NULL) || (msg == NULL) || (msg->databuffer == NULL)) {
+        dlt_vlog(LOG_ERR, "%s: Invalid parameters\n", __func__);
+        return;
+    }
+
+    if (dlt_check_rcv_data_size(msg->datasize, sizeof(DltServiceSetClientFilter)) < 0)
+        return;
+
+    req = (DltServiceSetClientFilter *)(msg->databuffer);
+    count = DLT_ENDIAN_GET_16(msg->standardheader->htyp, req->count);
+
+    /* the filter belongs to the connection the request was received on */
+    con = dlt_event_handler_find_connection(&(daemon_local->pEvent), sock);
+
+    if ((con == NULL) ||
+        !((1 << con->type) & (DLT_CON_MASK_CLIENT_MSG_TCP | DLT_CON_MASK_CLIENT_MSG_SERIAL)) ||
+        ((size_t)msg->datasize <
+         sizeof(DltServiceSetClientFilter) + (size_t)count * sizeof(DltServiceClientFilterRule))) {
+        dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR, verbose);
+        return;
+    }
+
+    if (count > 0) {
+        filter = (DltFilterEngine *)malloc(sizeof(DltFilterEngine));
+
+        if (filter == NULL) {
+            dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR,
+                                                verbose);
+            return;
+        }
+
+        dlt_filter_engine_init(filter);
+        req_rule = (DltServiceClientFilterRule *)(msg->databuffer + sizeof(DltServiceSetClientFilter));
+
+        for (i = 0; i < count; i++) {
+            memset(&rule, 0, sizeof(rule));
+            rule.apid = dlt_filter_engine_pack_id(req_rule[i].apid);
+            rule.ctid = dlt_filter_engine_pack_id(req_rule[i].ctid);
+            rule.log_level = req_rule[i].log_level;
+            rule.message_types = req_rule[i].message_types;
+
+            /* rules sent twice are ignored */
+            if ((dlt_filter_engine_add(filter, &rule) < DLT_RETURN_OK) &&
+                (dlt_filter_engine_find(filter, &rule) < 0)) {
+                dlt_filter_engine_free(filter);
+                free(filter);
+                dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR,
+                                                    verbose);
+                return;
+            }
+        }
+
+        /* compile once here instead of on the first message */
+        if (dlt_filter_engine_compile(filter) < DLT_RETURN_OK) {
+            dlt_filter_engine_free(filter);
+            free(filter);
+            dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR,
+                                                verbose);
+            return;
+        }
+    }
+
+    if (con->filter != NULL) {
+        dlt_filter_engine_free(con->filter);
+        free(con->filter);
+    }
+
+    con->filter = filter;
+
+    dlt_vlog(LOG_INFO, "Client filter with %u rule(s) set on connection %d\n", count, sock);
+
+    dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_OK, verbose);
+}
+
+void dlt_daemon_control_set_stream_compression(int sock,
+                                               DltDaemon *daemon,
+                                               DltDaemonLocal *daemon_local,
+                                               DltMessage *msg,
+                                               int verbose)
+{
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    DltServiceSetStreamCompression *req = NULL;
+    DltConnection *con = NULL;
+    uint32_t id = DLT_SERVICE_ID_SET_STREAM_COMPRESSION;
+
+    if ((daemon == NULL) || (daemon_local == NULL) || (msg == NULL) || (msg->databuffer == NULL)) {
+        dlt_vlog(LOG_ERR, "%s: Invalid parameters\n", __func__);
+        return;
+    }
+
+    if (dlt_check_rcv_data_size(msg->datasize, sizeof(DltServiceSetStreamCompression)) < 0)
+        return;
+
+    req = (DltServiceSetStreamCompression *)(msg->databuffer);
+
+#ifdef DLT_STREAM_COMPRESSION
+    DltDaemonCompression *compression = NULL;
+    uint32_t batch_size = DLT_ENDIAN_GET_32(msg->standardheader->htyp, req->batch_size);
+
+    /* the compression belongs to the connection the request was received on */
+    con = dlt_event_handler_find_connection(&(daemon_local->pEvent), sock);
+
+    if ((con == NULL) || (con->type != DLT_CONNECTION_CLIENT_MSG_TCP) ||
+        (req->method > DLT_STREAM_COMPRESSION_ZLIB) ||
+        ((req->method == DLT_STREAM_COMPRESSION_ZLIB) && ((req->level < 1) || (req->level > 9)))) {
+        dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR, verbose);
+        return;
+    }
+
+    if (batch_size == 0)
+        batch_size = DLT_DAEMON_COMPRESSION_BATCH_DEFAULT;
+    else if (batch_size < DLT_DAEMON_COMPRESSION_BATCH_MIN)
+        batch_size = DLT_DAEMON_COMPRESSION_BATCH_MIN;
+    else if (batch_size > DLT_DAEMON_COMPRESSION_BATCH_MAX)
+        batch_size = DLT_DAEMON_COMPRESSION_BATCH_MAX;
+
+    if (req->method == DLT_STREAM_COMPRESSION_ZLIB) {
+        compression = (DltDaemonCompression *)malloc(sizeof(DltDaemonCompression));
+
+        if ((compression == NULL) ||
+            (dlt_daemon_compression_init(compression, req->level, batch_size) != DLT_RETURN_OK)) {
+            free(compression);
+            dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_ERROR,
+                                                verbose);
+            return;
+        }
+    }
+
+    /* the response is the last data in the old format */
+    dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_OK, verbose);
+
+    if (con->compression != NULL) {
+        dlt_connection_flush(con);
+        dlt_daemon_compression_free(con->compression);
+        free(con->compression);
+    }
+
+    con->compression = compression;
+
+    dlt_vlog(LOG_INFO, "Stream compression %s on connection %d\n",
+             (compression != NULL) ? "enabled" : "disabled", sock);
+#else
+    (void)req;
+    (void)con;
+    dlt_daemon_control_service_response(sock, daemon, daemon_local, id, DLT_SERVICE_RESPONSE_NOT_SUPPORTED,
+                                        verbose);
+#endif
+}
+
 void dlt_daemon_control_set_timing_packets(int sock,
                                            DltDaemon *daemon,
                                            DltDaemonLocal *daemon_local,
@@ -4594,6 +4959,8 @@ int dlt_daemon_process_one_s_timer(DltDaemon *daemon,
                     "Can't send contents of ring buffer to clients\n");
     }
 
+    dlt_daemon_process_load_shedding(daemon, daemon_local, daemon_local->flags.vflag);
+
     if ((daemon->timingpackets) &&
         (daemon->state == DLT_DAEMON_STATE_SEND_DIRECT))
         dlt_daemon_control_message_time(DLT_DAEMON_SEND_TO_ALL,
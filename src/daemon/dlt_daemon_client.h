@@ -625,6 +625,52 @@ void dlt_daemon_control_set_all_trace_status(int sock,
                                              DltMessage *msg,
                                              int verbose);
 
+/**
+ * Process and generate response to received set client filter control message.
+ * The filter applies to the messages sent to the connection of sock. The ring
+ * buffer is sent to the first client when it connects, before it can set a
+ * filter, so these messages are not filtered.
+ * @param sock connection handle used for sending response
+ * @param daemon pointer to dlt daemon structure
+ * @param daemon_local pointer to dlt daemon local structure
+ * @param msg pointer to received control message
+ * @param verbose if set to true verbose information is printed out.
+ */
+void dlt_daemon_control_set_client_filter(int sock,
+                                          DltDaemon *daemon,
+                                          DltDaemonLocal *daemon_local,
+                                          DltMessage *msg,
+                                          int verbose);
+
+/**
+ * Process and generate response to received set stream compression control
+ * message. The compression applies to the messages sent to the connection of
+ * sock after the response. Without DLT_STREAM_COMPRESSION the request is not
+ * supported.
+ * @param sock connection handle used for sending response
+ * @param daemon pointer to dlt daemon structure
+ * @param daemon_local pointer to dlt daemon local structure
+ * @param msg pointer to received control message
+ * @param verbose if set to true verbose information is printed out.
+ */
+void dlt_daemon_control_set_stream_compression(int sock,
+                                               DltDaemon *daemon,
+                                               DltDaemonLocal *daemon_local,
+                                               DltMessage *msg,
+                                               int verbose);
+
+#ifdef DLT_STREAM_COMPRESSION
+/**
+ * Send the messages collected for all compressed client connections.
+ * Called after every round of the event loop, so messages wait at most
+ * until all events of the round are handled.
+ * @param daemon pointer to dlt daemon structure
+ * @param daemon_local pointer to dlt daemon local structure
+ * @param verbose if set to true verbose information is printed out.
+ */
+void dlt_daemon_client_flush_compressed(DltDaemon *daemon, DltDaemonLocal *daemon_local, int verbose);
+#endif
+
 /**
  * Process and generate response to received set all trace status control message
  * for DLT V2
@@ -390,7 +390,7 @@ DltReturnValue dlt_daemon_find_preconfigured_trace_load_settings(
         }
 
         // Reallocate memory for the settings array with an additional slot for the new setting
-        DltTraceLoadSettings *temp = realloc(*settings, (*num_settings + 1) * sizeof(DltTraceLoadSettings));
+        DltTraceLoadSettings *temp = realloc(*settings, (size_t)(*num_settings + 1) * sizeof(DltTraceLoadSettings));
         if (temp == NULL) {
             dlt_vlog(LOG_ERR, "Failed to allocate memory for trace load settings\n");
             free(*settings); // Free any previously allocated memory
@@ -887,6 +887,9 @@ DltDaemonApplication *dlt_daemon_application_add(DltDaemon *daemon,
         application->trace_load_settings = NULL;
         application->trace_load_settings_count = 0;
 #endif
+        application->load_demand_bytes = 0;
+        application->load_kept_bytes = 0;
+        application->load_shed_messages = 0;
 
         new_application = 1;
 
@@ -998,7 +1001,7 @@ DltDaemonApplication *dlt_daemon_application_add(DltDaemon *daemon,
             (pre_configured_trace_load_settings != NULL) &&
             (num_settings != 0)) {
             application->trace_load_settings = pre_configured_trace_load_settings;
-            application->trace_load_settings_count = num_settings;
+            application->trace_load_settings_count = (uint32_t)num_settings;
             app_level = dlt_find_runtime_trace_load_settings(
                 application->trace_load_settings,
                 application->trace_load_settings_count, application->apid,
@@ -1121,6 +1124,9 @@ DltDaemonApplication *dlt_daemon_application_add_v2(DltDaemon *daemon,
         application->trace_load_settings = NULL;
         application->trace_load_settings_count = 0;
 #endif
+        application->load_demand_bytes = 0;
+        application->load_kept_bytes = 0;
+        application->load_shed_messages = 0;
 
         new_application = 1;
     }
@@ -1217,11 +1223,15 @@ DltDaemonApplication *dlt_daemon_application_add_v2(DltDaemon *daemon,
 #endif
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
     if (application->trace_load_settings == NULL) {
+        /* the trace load settings use the 4 character ids */
+        char tl_apid[DLT_ID_SIZE + 1] = { 0 };
+        memcpy(tl_apid, apid, apidlen < DLT_ID_SIZE ? apidlen : DLT_ID_SIZE);
+
         DltTraceLoadSettings* pre_configured_trace_load_settings = NULL;
         int num_settings = 0;
         DltReturnValue find_trace_settings_return_value = dlt_daemon_find_preconfigured_trace_load_settings(
             daemon,
-            application->apid,
+            tl_apid,
             NULL /*load settings for all contexts*/,
             &pre_configured_trace_load_settings,
             &num_settings,
@@ -1232,10 +1242,10 @@ DltDaemonApplication *dlt_daemon_application_add_v2(DltDaemon *daemon,
             (pre_configured_trace_load_settings != NULL) &&
             (num_settings != 0)) {
             application->trace_load_settings = pre_configured_trace_load_settings;
-            application->trace_load_settings_count = num_settings;
+            application->trace_load_settings_count = (uint32_t)num_settings;
             app_level = dlt_find_runtime_trace_load_settings(
                 application->trace_load_settings,
-                application->trace_load_settings_count, application->apid,
+                application->trace_load_settings_count, tl_apid,
                 NULL);
         }
 
@@ -1253,7 +1263,7 @@ DltDaemonApplication *dlt_daemon_application_add_v2(DltDaemon *daemon,
                 memset(app_level, 0, sizeof(DltTraceLoadSettings));
                 app_level[0].hard_limit = DLT_TRACE_LOAD_DAEMON_HARD_LIMIT_DEFAULT;
                 app_level[0].soft_limit = DLT_TRACE_LOAD_DAEMON_SOFT_LIMIT_DEFAULT;
-                memcpy(&app_level[0].apid, apid, DLT_ID_SIZE);
+                memcpy(&app_level[0].apid, tl_apid, DLT_ID_SIZE);
                 memset(&app_level[0].tl_stat, 0, sizeof(DltTraceLoadStat));
             } else {
                 dlt_vlog(DLT_LOG_FATAL, "Failed to allocate memory for trace load settings\n");
@@ -1725,7 +1735,10 @@ DltDaemonContext *dlt_daemon_context_add(DltDaemon *daemon,
         dlt_set_id(context->ctid, ctid);
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
-        context->trace_load_settings = NULL;
+        /* resolved once, the settings of an application never move */
+        context->trace_load_settings = dlt_find_runtime_trace_load_settings(
+            application->trace_load_settings, application->trace_load_settings_count,
+            application->apid, context->ctid);
 #endif
 
         application->num_contexts++;
@@ -1925,6 +1938,17 @@ DltDaemonContext *dlt_daemon_context_add_v2(DltDaemon *daemon,
         dlt_set_id_v2(context->ctid2, ctid, ctidlen);
         context->ctid2len = ctidlen;
 
+#ifdef DLT_TRACE_LOAD_CTRL_ENABLE
+        /* the trace load settings use the 4 character ids */
+        char tl_apid[DLT_ID_SIZE + 1] = { 0 };
+        char tl_ctid[DLT_ID_SIZE + 1] = { 0 };
+        memcpy(tl_apid, apid, apidlen < DLT_ID_SIZE ? apidlen : DLT_ID_SIZE);
+        memcpy(tl_ctid, ctid, ctidlen < DLT_ID_SIZE ? ctidlen : DLT_ID_SIZE);
+        context->trace_load_settings = dlt_find_runtime_trace_load_settings(
+            application->trace_load_settings, application->trace_load_settings_count,
+            tl_apid, tl_ctid);
+#endif
+
         application->num_contexts++;
         new_context = 1;
     }
@@ -3360,7 +3384,7 @@ int dlt_daemon_user_send_trace_load_config(DltDaemon *const daemon, DltDaemonApp
         trace_load_settings_count = 1;
         trace_load_settings_user_msg = malloc(sizeof(DltUserControlMsgTraceSettingMsg));
 
-        memset(trace_load_settings_user_msg, 0, sizeof(DltTraceLoadSettings));
+        memset(trace_load_settings_user_msg, 0, sizeof(DltUserControlMsgTraceSettingMsg));
         trace_load_settings_user_msg[0].soft_limit = DLT_TRACE_LOAD_DAEMON_SOFT_LIMIT_DEFAULT;
         trace_load_settings_user_msg[0].hard_limit = DLT_TRACE_LOAD_DAEMON_HARD_LIMIT_DEFAULT;
     }
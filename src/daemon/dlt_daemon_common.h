@@ -102,6 +102,9 @@ extern "C" {
     #      define MULTICASTIP_MAX_SIZE 256
     #      define MULTICAST_CONNECTION_DISABLED 0
     #      define MULTICAST_CONNECTION_ENABLED 1
+    #      define MULTICAST_DATAGRAM_SIZE 1472 /* Ethernet MTU minus IPv4 and UDP header */
+    #      define MULTICAST_DATAGRAM_SIZE_MAX 65507
+    #      define MULTICAST_FLUSH_TIMEOUT 10    /* ms */
 #   endif
 
 /**
@@ -161,6 +164,9 @@ typedef struct
     DltTraceLoadSettings* trace_load_settings;
     uint32_t trace_load_settings_count;
 #endif
+    uint64_t load_demand_bytes;     /**< load shedding: bytes of log messages at allowed levels in this interval */
+    uint64_t load_kept_bytes;       /**< load shedding: bytes of these messages kept in this interval */
+    uint32_t load_shed_messages;    /**< load shedding: messages shed in this interval */
 } DltDaemonApplication;
 
 /**
@@ -0,0 +1,242 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_daemon_compression.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <syslog.h>
+#include <arpa/inet.h>
+
+#include "dlt_daemon_compression.h"
+#include "dlt_log.h"
+
+DltReturnValue dlt_daemon_compression_init(DltDaemonCompression *comp, int level, uint32_t size)
+{
+    if ((comp == NULL) || (level < Z_BEST_SPEED) || (level > Z_BEST_COMPRESSION) || (size == 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(comp, 0, sizeof(DltDaemonCompression));
+
+    if (deflateInit(&comp->stream, level) != Z_OK) {
+        dlt_vlog(LOG_ERR, "%s: deflateInit failed\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    comp->size = size;
+    comp->frame_size = (uint32_t)(sizeof(DltCompressionFrameHeader) + deflateBound(&comp->stream, size));
+    comp->data = malloc(comp->size);
+    comp->frame = malloc(comp->frame_size);
+
+    if ((comp->data == NULL) || (comp->frame == NULL)) {
+        dlt_vlog(LOG_ERR, "%s: Could not allocate %u bytes\n", __func__, comp->size + comp->frame_size);
+        dlt_daemon_compression_free(comp);
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+void dlt_daemon_compression_free(DltDaemonCompression *comp)
+{
+    if (comp == NULL)
+        return;
+
+    deflateEnd(&comp->stream);
+    free(comp->data);
+    free(comp->frame);
+    comp->data = NULL;
+    comp->frame = NULL;
+    comp->used = 0;
+}
+
+DltReturnValue dlt_daemon_compression_add(DltDaemonCompression *comp,
+                                          const void *data1,
+                                          int size1,
+                                          const void *data2,
+                                          int size2,
+                                          int serial)
+{
+    uint32_t length;
+
+    if ((comp == NULL) || (comp->data == NULL) || (size1 < 0) || (size2 < 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (data1 == NULL)
+        size1 = 0;
+
+    if (data2 == NULL)
+        size2 = 0;
+
+    length = (uint32_t)size1 + (uint32_t)size2 + (serial ? (uint32_t)sizeof(dltSerialHeader) : 0);
+
+    if (length > comp->size)
+        return DLT_RETURN_ERROR;
+
+    if (length > comp->size - comp->used)
+        return DLT_RETURN_TRUE;
+
+    if (serial) {
+        memcpy(comp->data + comp->used, dltSerialHeader, sizeof(dltSerialHeader));
+        comp->used += (uint32_t)sizeof(dltSerialHeader);
+    }
+
+    if (size1 > 0) {
+        memcpy(comp->data + comp->used, data1, (size_t)size1);
+        comp->used += (uint32_t)size1;
+    }
+
+    if (size2 > 0) {
+        memcpy(comp->data + comp->used, data2, (size_t)size2);
+        comp->used += (uint32_t)size2;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_daemon_compression_pack(DltDaemonCompression *comp,
+                                           const uint8_t **frame,
+                                           uint32_t *length)
+{
+    DltCompressionFrameHeader header;
+    uint32_t compressed;
+
+    if ((comp == NULL) || (comp->data == NULL) || (frame == NULL) || (length == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    *frame = comp->frame;
+    *length = 0;
+
+    if (comp->used == 0)
+        return DLT_RETURN_OK;
+
+    comp->stream.next_in = comp->data;
+    comp->stream.avail_in = comp->used;
+    comp->stream.next_out = comp->frame + sizeof(DltCompressionFrameHeader);
+    comp->stream.avail_out = (uInt)(comp->frame_size - sizeof(DltCompressionFrameHeader));
+
+    /* the frame buffer is big enough for the compressed batch, so one call
+     * compresses everything */
+    if (deflate(&comp->stream, Z_FINISH) != Z_STREAM_END) {
+        dlt_vlog(LOG_ERR, "%s: deflate failed\n", __func__);
+        deflateReset(&comp->stream);
+        comp->used = 0;
+        return DLT_RETURN_ERROR;
+    }
+
+    compressed = (uint32_t)comp->stream.total_out;
+    deflateReset(&comp->stream);
+
+    header.id = htonl(DLT_COMPRESSION_FRAME_ID);
+    header.length = htonl(compressed);
+    header.size = htonl(comp->used);
+    memcpy(comp->frame, &header, sizeof(header));
+
+    *length = (uint32_t)sizeof(DltCompressionFrameHeader) + compressed;
+    comp->bytes_in += comp->used;
+    comp->bytes_out += *length;
+    comp->used = 0;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_daemon_decompression_init(DltDaemonDecompression *decomp, uint32_t size)
+{
+    if ((decomp == NULL) || (size == 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(decomp, 0, sizeof(DltDaemonDecompression));
+
+    if (inflateInit(&decomp->stream) != Z_OK) {
+        dlt_vlog(LOG_ERR, "%s: inflateInit failed\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    decomp->size = size;
+    decomp->data = malloc(size);
+
+    if (decomp->data == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Could not allocate %u bytes\n", __func__, size);
+        inflateEnd(&decomp->stream);
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+void dlt_daemon_decompression_free(DltDaemonDecompression *decomp)
+{
+    if ((decomp == NULL) || (decomp->data == NULL))
+        return;
+
+    inflateEnd(&decomp->stream);
+    free(decomp->data);
+    decomp->data = NULL;
+}
+
+DltReturnValue dlt_daemon_decompression_unpack(DltDaemonDecompression *decomp,
+                                               const uint8_t *buffer,
+                                               uint32_t length,
+                                               uint32_t *frame_length,
+                                               uint32_t *size)
+{
+    DltCompressionFrameHeader header;
+    uint32_t compressed;
+    uint32_t uncompressed;
+
+    if ((decomp == NULL) || (decomp->data == NULL) || (buffer == NULL) || (frame_length == NULL) ||
+        (size == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (length < sizeof(DltCompressionFrameHeader))
+        return DLT_RETURN_OK;
+
+    memcpy(&header, buffer, sizeof(header));
+    compressed = ntohl(header.length);
+    uncompressed = ntohl(header.size);
+
+    if ((ntohl(header.id) != DLT_COMPRESSION_FRAME_ID) || (uncompressed > decomp->size) ||
+        (compressed > compressBound(uncompressed))) {
+        dlt_vlog(LOG_WARNING, "%s: Invalid frame header\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    if (length - sizeof(DltCompressionFrameHeader) < compressed)
+        return DLT_RETURN_OK;
+
+    decomp->stream.next_in = (Bytef *)(uintptr_t)(buffer + sizeof(DltCompressionFrameHeader));
+    decomp->stream.avail_in = compressed;
+    decomp->stream.next_out = decomp->data;
+    decomp->stream.avail_out = uncompressed;
+
+    if ((inflate(&decomp->stream, Z_FINISH) != Z_STREAM_END) ||
+        (decomp->stream.total_out != uncompressed)) {
+        dlt_vlog(LOG_WARNING, "%s: Corrupted frame\n", __func__);
+        inflateReset(&decomp->stream);
+        return DLT_RETURN_ERROR;
+    }
+
+    inflateReset(&decomp->stream);
+
+    *frame_length = (uint32_t)sizeof(DltCompressionFrameHeader) + compressed;
+    *size = uncompressed;
+
+    return DLT_RETURN_TRUE;
+}
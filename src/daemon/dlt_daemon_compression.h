@@ -0,0 +1,151 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_daemon_compression.h
+ */
+
+#ifndef DLT_DAEMON_COMPRESSION_H
+#define DLT_DAEMON_COMPRESSION_H
+
+#include <stdint.h>
+#include <zlib.h>
+
+#include "dlt_common.h"
+
+/*
+ * A compressed stream, as negotiated with DLT_SERVICE_ID_SET_STREAM_COMPRESSION,
+ * is a sequence of frames. Every frame is a DltCompressionFrameHeader followed
+ * by a batch of complete DLT messages compressed with zlib, exactly as they
+ * would have been sent without compression. Frames do not depend on each
+ * other.
+ */
+
+/* "DLZ" and the version of the frame format */
+#define DLT_COMPRESSION_FRAME_ID 0x444C5A01
+
+/**
+ * Header of a frame of a compressed stream. All values are big endian.
+ */
+typedef struct
+{
+    uint32_t id;        /**< DLT_COMPRESSION_FRAME_ID */
+    uint32_t length;    /**< length of the compressed data following the header */
+    uint32_t size;      /**< length of the messages after decompression */
+} DLT_PACKED DltCompressionFrameHeader;
+
+/**
+ * Messages collected for the next frame of a compressed stream.
+ */
+typedef struct
+{
+    z_stream stream;        /**< deflate state, reused for all frames */
+    uint8_t *data;          /**< collected messages */
+    uint32_t used;          /**< number of collected bytes */
+    uint32_t size;          /**< maximum number of bytes of one frame */
+    uint8_t *frame;         /**< frame header and compressed data */
+    uint32_t frame_size;    /**< size of the frame buffer */
+    uint64_t bytes_in;      /**< number of bytes compressed */
+    uint64_t bytes_out;     /**< number of frame bytes created */
+} DltDaemonCompression;
+
+/**
+ * Receive side of a compressed stream.
+ */
+typedef struct
+{
+    z_stream stream;        /**< inflate state, reused for all frames */
+    uint8_t *data;          /**< messages of the last frame */
+    uint32_t size;          /**< maximum number of bytes of one frame */
+} DltDaemonDecompression;
+
+/**
+ * Initialise the sending side of a compressed stream.
+ * @param comp pointer to compression structure
+ * @param level zlib compression level, 1 (fastest) to 9 (best)
+ * @param size maximum number of message bytes per frame
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_daemon_compression_init(DltDaemonCompression *comp, int level, uint32_t size);
+
+/**
+ * Release the sending side of a compressed stream. Collected messages are lost.
+ * @param comp pointer to compression structure
+ */
+void dlt_daemon_compression_free(DltDaemonCompression *comp);
+
+/**
+ * Add a message to the next frame.
+ * @param comp pointer to compression structure
+ * @param data1 first part of the message
+ * @param size1 size of the first part
+ * @param data2 second part of the message
+ * @param size2 size of the second part
+ * @param serial if set, the serial header is added in front of the message
+ * @return DLT_RETURN_OK if added, DLT_RETURN_TRUE if the frame is full and has to
+ * be packed first, negative value if the message does not fit into an empty frame
+ */
+DltReturnValue dlt_daemon_compression_add(DltDaemonCompression *comp,
+                                          const void *data1,
+                                          int size1,
+                                          const void *data2,
+                                          int size2,
+                                          int serial);
+
+/**
+ * Compress the collected messages into a frame and start the next one.
+ * @param comp pointer to compression structure
+ * @param frame set to the frame, valid until the next call
+ * @param length set to the length of the frame, 0 if no messages were collected
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_daemon_compression_pack(DltDaemonCompression *comp,
+                                           const uint8_t **frame,
+                                           uint32_t *length);
+
+/**
+ * Initialise the receiving side of a compressed stream.
+ * @param decomp pointer to decompression structure
+ * @param size maximum number of message bytes per frame
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_daemon_decompression_init(DltDaemonDecompression *decomp, uint32_t size);
+
+/**
+ * Release the receiving side of a compressed stream.
+ * @param decomp pointer to decompression structure
+ */
+void dlt_daemon_decompression_free(DltDaemonDecompression *decomp);
+
+/**
+ * Decompress the frame at the begin of a buffer into decomp->data.
+ * @param decomp pointer to decompression structure
+ * @param buffer received data
+ * @param length length of the received data
+ * @param frame_length set to the length of the frame in the buffer
+ * @param size set to the number of message bytes in decomp->data
+ * @return DLT_RETURN_TRUE if a frame was decompressed, DLT_RETURN_OK if the frame
+ * is not complete yet, negative value if the data is not a valid frame
+ */
+DltReturnValue dlt_daemon_decompression_unpack(DltDaemonDecompression *decomp,
+                                               const uint8_t *buffer,
+                                               uint32_t length,
+                                               uint32_t *frame_length,
+                                               uint32_t *size);
+
+#endif /* DLT_DAEMON_COMPRESSION_H */
@@ -78,6 +78,9 @@ DLT_STATIC int dlt_connection_send(DltConnection *conn,
 
     switch (type) {
     case DLT_CONNECTION_CLIENT_MSG_SERIAL:
+        if (msg_size > 0 && msg_size <= INT_MAX && conn->serial_sink != NULL)
+            return dlt_daemon_serial_sink_send(conn->serial_sink, msg, (int)msg_size, NULL, 0, 0);
+
         if (msg_size > 0 && msg_size <= SSIZE_MAX) {
             if (write(conn->receiver->fd, msg, msg_size) > 0)
                 return DLT_DAEMON_ERROR_OK;
@@ -123,6 +126,28 @@ int dlt_connection_send_multiple(DltConnection *con,
     if (con == NULL)
         return DLT_DAEMON_ERROR_UNKNOWN;
 
+#ifdef DLT_STREAM_COMPRESSION
+    if (con->compression != NULL) {
+        /* collected until the end of the event loop or a full frame */
+        ret = dlt_daemon_compression_add(con->compression, data1, size1, data2, size2, sendserialheader);
+
+        if (ret == DLT_RETURN_TRUE) {
+            ret = dlt_connection_flush(con);
+
+            if (ret == DLT_DAEMON_ERROR_OK)
+                ret = dlt_daemon_compression_add(con->compression, data1, size1, data2, size2,
+                                                  sendserialheader);
+        }
+
+        return (ret == DLT_RETURN_OK) ? DLT_DAEMON_ERROR_OK : DLT_DAEMON_ERROR_UNKNOWN;
+    }
+#endif
+
+    /* the whole message at once, the writer thread coalesces it with others */
+    if (con->serial_sink != NULL)
+        return dlt_daemon_serial_sink_send(con->serial_sink, data1, size1, data2, size2,
+                                           (char)sendserialheader);
+
     if (sendserialheader)
         ret = dlt_connection_send(con,
                                 (const void *)dltSerialHeader,
@@ -139,6 +164,34 @@ int dlt_connection_send_multiple(DltConnection *con,
     return ret;
 }
 
+#ifdef DLT_STREAM_COMPRESSION
+/** @brief Send the messages collected for a compressed connection.
+ *
+ * The collected messages are compressed into one frame, which is sent.
+ *
+ * @param con The connection to send the frame through.
+ *
+ * @return DLT_DAEMON_ERROR_OK on success, or if there is nothing to send,
+ *         negative value otherwise.
+ */
+int dlt_connection_flush(DltConnection *con)
+{
+    const uint8_t *frame = NULL;
+    uint32_t length = 0;
+
+    if ((con == NULL) || (con->compression == NULL))
+        return DLT_DAEMON_ERROR_UNKNOWN;
+
+    if (dlt_daemon_compression_pack(con->compression, &frame, &length) != DLT_RETURN_OK)
+        return DLT_DAEMON_ERROR_UNKNOWN;
+
+    if (length == 0)
+        return DLT_DAEMON_ERROR_OK;
+
+    return dlt_connection_send(con, frame, length);
+}
+#endif
+
 /** @brief Get the next connection filtered with a type mask.
  *
  * In some cases we need the next connection available of a specific type or
@@ -350,8 +403,28 @@ void *dlt_connection_get_callback(DltConnection *con)
 void dlt_connection_destroy(DltConnection *to_destroy)
 {
     to_destroy->id = 0;
+
+    /* written out before the device is closed */
+    if (to_destroy->serial_sink != NULL) {
+        dlt_daemon_serial_sink_free(to_destroy->serial_sink);
+        free(to_destroy->serial_sink);
+    }
+
     close(to_destroy->receiver->fd);
     dlt_connection_destroy_receiver(to_destroy);
+
+    if (to_destroy->filter != NULL) {
+        dlt_filter_engine_free(to_destroy->filter);
+        free(to_destroy->filter);
+    }
+
+#ifdef DLT_STREAM_COMPRESSION
+    if (to_destroy->compression != NULL) {
+        dlt_daemon_compression_free(to_destroy->compression);
+        free(to_destroy->compression);
+    }
+#endif
+
     free(to_destroy);
 }
 
@@ -439,6 +512,19 @@ int dlt_connection_create(DltDaemonLocal *daemon_local,
     temp->type = type;
     temp->status = ACTIVE;
 
+    if ((type == DLT_CONNECTION_CLIENT_MSG_SERIAL) && (daemon_local != NULL) &&
+        (daemon_local->serialWriterBufferSize > 0)) {
+        temp->serial_sink = malloc(sizeof(DltDaemonSerialSink));
+
+        if ((temp->serial_sink == NULL) ||
+            (dlt_daemon_serial_sink_init(temp->serial_sink, fd,
+                                         (uint32_t)daemon_local->serialWriterBufferSize) != DLT_RETURN_OK)) {
+            dlt_log(LOG_WARNING, "Serial writer thread not available, writing directly\n");
+            free(temp->serial_sink);
+            temp->serial_sink = NULL;
+        }
+    }
+
     /* Now give the ownership of the newly created connection
      * to the event handler, by registering for events.
      */
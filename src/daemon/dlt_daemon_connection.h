@@ -33,6 +33,9 @@
 #include "dlt-daemon.h"
 
 int dlt_connection_send_multiple(DltConnection *, void *, int, void *, int, int);
+#ifdef DLT_STREAM_COMPRESSION
+int dlt_connection_flush(DltConnection *);
+#endif
 
 DltConnection *dlt_connection_get_next(DltConnection *, int);
 int dlt_connection_create_remaining(DltDaemonLocal *);
@@ -28,6 +28,11 @@
 #ifndef DLT_DAEMON_CONNECTION_TYPES_H
 #define DLT_DAEMON_CONNECTION_TYPES_H
 #include "dlt_common.h"
+#include "dlt_filter_engine.h"
+#include "dlt_daemon_serial.h"
+#ifdef DLT_STREAM_COMPRESSION
+#   include "dlt_daemon_compression.h"
+#endif
 
 typedef enum {
     UNDEFINED, /* Undefined status */
@@ -80,6 +85,11 @@ typedef struct DltConnection {
     DltConnectionStatus status; /**< Status of connection */
     struct DltConnection *next;   /**< For multiple client connection using linked list */
     int ev_mask; /**< Mask to set when registering the connection for events */
+    DltFilterEngine *filter; /**< Filter set by the client, NULL to send all messages */
+#ifdef DLT_STREAM_COMPRESSION
+    DltDaemonCompression *compression; /**< Compression set by the client, NULL to send uncompressed */
+#endif
+    DltDaemonSerialSink *serial_sink; /**< Writer thread of a serial connection, NULL to write directly */
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
     int remaining_size; /**< Remaining data size for sending data. This value will be set to non-zero when data could not be sent fully */
 #endif
@@ -44,6 +44,11 @@
 #include "dlt_daemon_event_handler.h"
 #include "dlt_daemon_event_handler_types.h"
 #include "dlt_daemon_common.h"
+#include "dlt_daemon_client.h"
+
+#ifdef UDP_CONNECTION_SUPPORT
+#   include "dlt_daemon_udp_socket.h"
+#endif
 
 /**
  * \def DLT_EV_TIMEOUT_MSEC
@@ -276,6 +281,15 @@ int dlt_daemon_handle_event(DltEventHandler *pEvent,
 #endif
     }
 
+#ifdef DLT_STREAM_COMPRESSION
+    dlt_daemon_client_flush_compressed(daemon, daemon_local, daemon_local->flags.vflag);
+#endif
+
+#ifdef UDP_CONNECTION_SUPPORT
+    if (daemon_local->UDPConnectionSetup == MULTICAST_CONNECTION_ENABLED)
+        dlt_daemon_udp_flush(daemon_local->flags.vflag);
+#endif
+
     return 0;
 }
 
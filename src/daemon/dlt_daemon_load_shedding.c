@@ -0,0 +1,293 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_daemon_load_shedding.c
+ */
+
+#include <stdlib.h>
+#include <syslog.h>
+#include <time.h>
+
+#include "dlt_daemon_load_shedding.h"
+#include "dlt_log.h"
+
+#define DLT_DAEMON_LOAD_SHEDDING_US_PER_S 1000000ULL
+
+uint64_t dlt_daemon_load_shedding_now(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return (uint64_t)ts.tv_sec * DLT_DAEMON_LOAD_SHEDDING_US_PER_S + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+bool dlt_daemon_load_shedding_keep_message(DltDaemonLoadShedding *ls,
+                                           DltDaemonApplication *app,
+                                           int mstp,
+                                           int mtin,
+                                           uint32_t size,
+                                           int keep_level)
+{
+    if (ls == NULL)
+        return true;
+
+    ls->ingest_bytes += size;
+
+    if ((mstp != DLT_TYPE_LOG) || (mtin <= keep_level)) {
+        ls->kept_bytes += size;
+        ls->protected_bytes += size;
+        return true;
+    }
+
+    /* the lowest levels go first */
+    if (mtin > DLT_LOG_VERBOSE - ls->shed_levels) {
+        ls->shed_messages++;
+
+        if (app != NULL)
+            app->load_shed_messages++;
+
+        return false;
+    }
+
+    if (app != NULL) {
+        app->load_demand_bytes += size;
+
+        if ((ls->app_quota > 0) && (app->load_kept_bytes + size > ls->app_quota)) {
+            ls->shed_messages++;
+            app->load_shed_messages++;
+            return false;
+        }
+
+        app->load_kept_bytes += size;
+    }
+
+    ls->kept_bytes += size;
+
+    return true;
+}
+
+void dlt_daemon_load_shedding_overload(DltDaemonLoadShedding *ls, int keep_level)
+{
+    if ((ls == NULL) || (keep_level >= DLT_LOG_VERBOSE))
+        return;
+
+    ls->shed_levels = DLT_LOG_VERBOSE - keep_level;
+    ls->calm_intervals = 0;
+}
+
+void dlt_daemon_load_shedding_sent(DltDaemonLoadShedding *ls, uint32_t size, uint64_t start)
+{
+    uint64_t now = 0;
+
+    if (ls == NULL)
+        return;
+
+    now = dlt_daemon_load_shedding_now();
+    ls->sink_bytes += size;
+
+    if (now > start)
+        ls->busy_us += now - start;
+}
+
+uint64_t dlt_daemon_load_shedding_fair_share(const uint64_t *demands, int count, uint64_t budget)
+{
+    uint64_t quota = 0;
+    uint64_t largest = 0;
+    uint64_t met = 0;
+    uint64_t next = 0;
+    uint64_t limited = 0;
+    int i = 0;
+
+    if ((demands == NULL) || (count <= 0))
+        return 0;
+
+    for (i = 0; i < count; i++)
+        if (demands[i] > largest)
+            largest = demands[i];
+
+    /* every round meets at least one more demand in full, the rest of the
+     * budget is shared equally between the demands which are still larger */
+    quota = budget / (uint64_t)count;
+
+    for (;;) {
+        met = 0;
+        limited = 0;
+
+        for (i = 0; i < count; i++) {
+            if (demands[i] <= quota)
+                met += demands[i];
+            else
+                limited++;
+        }
+
+        if (limited == 0)
+            return largest;
+
+        if (met >= budget)
+            return quota;
+
+        next = (budget - met) / limited;
+
+        if (next <= quota)
+            return quota;
+
+        quota = next;
+    }
+}
+
+/**
+ * Quota of an application for the next interval, 0 if the budget is
+ * sufficient for the demand of all applications.
+ */
+static uint64_t dlt_daemon_load_shedding_quota(DltDaemonLoadShedding *ls,
+                                               DltDaemon *daemon,
+                                               uint64_t interval,
+                                               int target)
+{
+    uint64_t *demands = NULL;
+    uint64_t budget = ls->capacity * (uint64_t)target / 100U;
+    uint64_t protected_rate = ls->protected_bytes * DLT_DAEMON_LOAD_SHEDDING_US_PER_S / interval;
+    uint64_t total = 0;
+    uint64_t quota = 0;
+    int count = 0;
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < daemon->num_user_lists; i++)
+        count += daemon->user_list[i].num_applications;
+
+    if (count == 0)
+        return 0;
+
+    demands = malloc(sizeof(uint64_t) * (size_t)count);
+
+    if (demands == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Could not allocate demands of %d applications\n", __func__, count);
+        return 0;
+    }
+
+    count = 0;
+
+    for (i = 0; i < daemon->num_user_lists; i++) {
+        for (j = 0; j < daemon->user_list[i].num_applications; j++) {
+            demands[count] = daemon->user_list[i].applications[j].load_demand_bytes *
+                DLT_DAEMON_LOAD_SHEDDING_US_PER_S / interval;
+            total += demands[count];
+            count++;
+        }
+    }
+
+    /* messages which are never shed use up their part of the budget first */
+    budget = (budget > protected_rate) ? budget - protected_rate : 0;
+
+    if (total > budget) {
+        quota = dlt_daemon_load_shedding_fair_share(demands, count, budget);
+
+        /* 0 is no quota */
+        if (quota == 0)
+            quota = 1;
+    }
+
+    free(demands);
+
+    return quota;
+}
+
+void dlt_daemon_load_shedding_update(DltDaemonLoadShedding *ls,
+                                     DltDaemon *daemon,
+                                     int fill_percent,
+                                     int clients,
+                                     uint64_t now,
+                                     int high,
+                                     int low,
+                                     int keep_level)
+{
+    uint64_t interval = DLT_DAEMON_LOAD_SHEDDING_US_PER_S;
+    uint64_t measured = 0;
+    int load = fill_percent;
+    int busy_percent = 0;
+    int max_levels = DLT_LOG_VERBOSE - keep_level;
+    int i = 0;
+    int j = 0;
+
+    if ((ls == NULL) || (daemon == NULL))
+        return;
+
+    if ((ls->last_update_us > 0) && (now > ls->last_update_us))
+        interval = now - ls->last_update_us;
+
+    ls->last_update_us = now;
+
+    if (clients > 0) {
+        busy_percent = (ls->busy_us >= interval) ? 100 : (int)(ls->busy_us * 100U / interval);
+
+        if ((ls->busy_us > 0) && (ls->sink_bytes > 0)) {
+            measured = ls->sink_bytes * DLT_DAEMON_LOAD_SHEDDING_US_PER_S / ls->busy_us;
+            ls->capacity = (ls->capacity > 0) ? (3 * ls->capacity + measured) / 4 : measured;
+        }
+    }
+
+    if (busy_percent > load)
+        load = busy_percent;
+
+    if (max_levels < 0)
+        max_levels = 0;
+
+    if (load >= high) {
+        if (ls->shed_levels < max_levels)
+            ls->shed_levels++;
+
+        ls->calm_intervals = 0;
+    }
+    else if (load <= low) {
+        if ((ls->shed_levels > 0) && (++ls->calm_intervals >= DLT_DAEMON_LOAD_SHEDDING_CALM_INTERVALS)) {
+            ls->shed_levels--;
+            ls->calm_intervals = 0;
+        }
+    }
+    else {
+        ls->calm_intervals = 0;
+    }
+
+    if (ls->shed_levels > max_levels)
+        ls->shed_levels = max_levels;
+
+    /* without a client there is no sending to take the budget from */
+    ls->app_quota = 0;
+
+    if ((ls->shed_levels > 0) && (clients > 0) && (ls->capacity > 0))
+        ls->app_quota = dlt_daemon_load_shedding_quota(ls, daemon, interval, (high + low) / 2);
+
+    for (i = 0; i < daemon->num_user_lists; i++) {
+        for (j = 0; j < daemon->user_list[i].num_applications; j++) {
+            daemon->user_list[i].applications[j].load_demand_bytes = 0;
+            daemon->user_list[i].applications[j].load_kept_bytes = 0;
+            daemon->user_list[i].applications[j].load_shed_messages = 0;
+        }
+    }
+
+    ls->ingest_bytes = 0;
+    ls->kept_bytes = 0;
+    ls->protected_bytes = 0;
+    ls->sink_bytes = 0;
+    ls->busy_us = 0;
+    ls->shed_messages = 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_daemon_load_shedding.h
+ */
+
+#ifndef DLT_DAEMON_LOAD_SHEDDING_H
+#define DLT_DAEMON_LOAD_SHEDDING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dlt_common.h"
+#include "dlt_daemon_common.h"
+
+/*
+ * The load shedder decides once per second, from what it measured in the last
+ * interval, how many log levels are discarded in the next one. The load is the
+ * higher of the fill level of the client ring buffer and the share of the
+ * time the daemon was blocked sending to its clients. Above the high watermark
+ * one more level is shed, starting with verbose. After some intervals below the
+ * low watermark one level is given back. Messages up to the keep level and
+ * messages which are not log messages are never shed. When the ring buffer
+ * reaches the high watermark between two updates, all levels above the keep
+ * level are shed at once, so the rest of the buffer is left for them.
+ * Shedding only applies to the clients and their ring buffer, the offline
+ * trace and logstorage still get every message.
+ *
+ * While levels are shed, the bytes the clients took per second of sending are
+ * the budget. It is shared between the applications, applications which need
+ * less than an equal share keep all their messages, the others get the same
+ * quota for their remaining log messages.
+ */
+
+/* intervals below the low watermark until a shed level is given back */
+#define DLT_DAEMON_LOAD_SHEDDING_CALM_INTERVALS 3
+
+/**
+ * State of the load shedder.
+ */
+typedef struct
+{
+    int shed_levels;            /**< number of log levels shed, counted from verbose */
+    int reported_levels;        /**< shed levels last reported */
+    int calm_intervals;         /**< intervals below the low watermark */
+    uint64_t ingest_bytes;      /**< bytes received in this interval */
+    uint64_t kept_bytes;        /**< bytes kept in this interval */
+    uint64_t protected_bytes;   /**< kept bytes which are never shed */
+    uint64_t sink_bytes;        /**< bytes sent to the clients in this interval */
+    uint64_t busy_us;           /**< time spent sending to the clients in this interval */
+    uint64_t capacity;          /**< bytes per second of sending the clients take */
+    uint64_t app_quota;         /**< bytes one application may keep per interval, 0 for no quota */
+    uint64_t last_update_us;    /**< time of the last update */
+    uint32_t shed_messages;     /**< messages shed in this interval */
+    bool shed_message;          /**< the message being sent is not sent to the clients */
+} DltDaemonLoadShedding;
+
+/**
+ * Current time for the measurement of the send time.
+ * @return monotonic time in microseconds
+ */
+uint64_t dlt_daemon_load_shedding_now(void);
+
+/**
+ * Account a message received from an application and decide whether it is kept.
+ * @param ls pointer to load shedding structure
+ * @param app application of the message, NULL if not registered
+ * @param mstp message type
+ * @param mtin message type info, the log level of log messages
+ * @param size size of the message
+ * @param keep_level highest log level which is never shed
+ * @return true if the message is kept, false if it is shed
+ */
+bool dlt_daemon_load_shedding_keep_message(DltDaemonLoadShedding *ls,
+                                           DltDaemonApplication *app,
+                                           int mstp,
+                                           int mtin,
+                                           uint32_t size,
+                                           int keep_level);
+
+/**
+ * Shed all log levels above the keep level until the next update.
+ * @param ls pointer to load shedding structure
+ * @param keep_level highest log level which is never shed
+ */
+void dlt_daemon_load_shedding_overload(DltDaemonLoadShedding *ls, int keep_level);
+
+/**
+ * Account a message sent to the clients.
+ * @param ls pointer to load shedding structure
+ * @param size size of the message, 0 if no client took it
+ * @param start time before sending, from dlt_daemon_load_shedding_now()
+ */
+void dlt_daemon_load_shedding_sent(DltDaemonLoadShedding *ls, uint32_t size, uint64_t start);
+
+/**
+ * Max-min fair share of a budget: demands below the returned quota are met in
+ * full, all larger demands get the quota.
+ * @param demands demand of every application
+ * @param count number of demands
+ * @param budget budget to share
+ * @return the quota, the largest demand if the budget is sufficient for all
+ */
+uint64_t dlt_daemon_load_shedding_fair_share(const uint64_t *demands, int count, uint64_t budget);
+
+/**
+ * Evaluate the last interval, adapt the shed levels and the application quota
+ * and start the next interval. The shed messages of the applications are reset,
+ * so they have to be reported before.
+ * @param ls pointer to load shedding structure
+ * @param daemon pointer to dlt daemon structure
+ * @param fill_percent fill level of the client ring buffer in percent
+ * @param clients number of connected clients
+ * @param now current time, from dlt_daemon_load_shedding_now()
+ * @param high high watermark in percent
+ * @param low low watermark in percent
+ * @param keep_level highest log level which is never shed
+ */
+void dlt_daemon_load_shedding_update(DltDaemonLoadShedding *ls,
+                                     DltDaemon *daemon,
+                                     int fill_percent,
+                                     int clients,
+                                     uint64_t now,
+                                     int high,
+                                     int low,
+                                     int keep_level);
+
+#endif /* DLT_DAEMON_LOAD_SHEDDING_H */
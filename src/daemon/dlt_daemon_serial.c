@@ -56,6 +56,7 @@
 #include <string.h>
 #include <syslog.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <unistd.h>
 
 #include <sys/socket.h> /* send() */
@@ -96,3 +97,207 @@ int dlt_daemon_serial_send(int sock,
 
     return DLT_DAEMON_ERROR_OK;
 }
+
+/**
+ * Copy data into the ring buffer of a serial sink at its head.
+ * The caller holds the mutex and has checked the free space.
+ */
+static void dlt_daemon_serial_sink_copy(DltDaemonSerialSink *sink, const void *data, uint32_t size)
+{
+    uint32_t part = sink->size - sink->head;
+
+    if (size <= part) {
+        memcpy(sink->buffer + sink->head, data, size);
+    }
+    else {
+        memcpy(sink->buffer + sink->head, data, part);
+        memcpy(sink->buffer, (const uint8_t *)data + part, size - part);
+    }
+
+    sink->head = (sink->head + size) % sink->size;
+}
+
+/**
+ * Main function of the writer thread. It writes the contiguous data from the
+ * tail of the ring buffer, as much as possible at once, until it is stopped
+ * and the buffer is empty.
+ */
+static void *dlt_daemon_serial_sink_thread(void *arg)
+{
+    DltDaemonSerialSink *sink = (DltDaemonSerialSink *)arg;
+    uint32_t length;
+    ssize_t ret;
+
+    pthread_mutex_lock(&sink->mutex);
+
+    while (1) {
+        while ((sink->used == 0) && sink->running)
+            pthread_cond_wait(&sink->cond, &sink->mutex);
+
+        if (sink->used == 0)
+            break;
+
+        /* the daemon only adds behind the data, so the range stays valid
+         * without holding the mutex */
+        length = sink->size - sink->tail;
+
+        if (length > sink->used)
+            length = sink->used;
+
+        pthread_mutex_unlock(&sink->mutex);
+
+        ret = write(sink->fd, sink->buffer + sink->tail, length);
+
+        if ((ret < 0) && ((errno == EINTR) || (errno == EAGAIN))) {
+            pthread_mutex_lock(&sink->mutex);
+            continue;
+        }
+
+        if (ret < 0) {
+            if (sink->write_error != errno)
+                dlt_vlog(LOG_WARNING, "%s: write to serial device failed: %s\n", __func__,
+                         strerror(errno));
+
+            /* the data is lost, keep the link usable for the next messages */
+            pthread_mutex_lock(&sink->mutex);
+            sink->write_error = errno;
+            sink->dropped_bytes += length;
+        }
+        else {
+            length = (uint32_t)ret;
+            pthread_mutex_lock(&sink->mutex);
+            sink->write_error = 0;
+            sink->bytes += length;
+        }
+
+        sink->tail = (sink->tail + length) % sink->size;
+        sink->used -= length;
+    }
+
+    pthread_mutex_unlock(&sink->mutex);
+
+    return NULL;
+}
+
+DltReturnValue dlt_daemon_serial_sink_init(DltDaemonSerialSink *sink, int fd, uint32_t size)
+{
+    if ((sink == NULL) || (fd < 0) || (size == 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(sink, 0, sizeof(DltDaemonSerialSink));
+
+    sink->fd = fd;
+    sink->size = size;
+    sink->running = 1;
+    sink->buffer = malloc(size);
+
+    if (sink->buffer == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Could not allocate %u bytes\n", __func__, size);
+        return DLT_RETURN_ERROR;
+    }
+
+    pthread_mutex_init(&sink->mutex, NULL);
+    pthread_cond_init(&sink->cond, NULL);
+
+    if (pthread_create(&sink->thread, NULL, dlt_daemon_serial_sink_thread, sink) != 0) {
+        dlt_vlog(LOG_ERR, "%s: Could not start writer thread\n", __func__);
+        pthread_cond_destroy(&sink->cond);
+        pthread_mutex_destroy(&sink->mutex);
+        free(sink->buffer);
+        sink->buffer = NULL;
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+void dlt_daemon_serial_sink_free(DltDaemonSerialSink *sink)
+{
+    if ((sink == NULL) || (sink->buffer == NULL))
+        return;
+
+    pthread_mutex_lock(&sink->mutex);
+    sink->running = 0;
+    pthread_cond_signal(&sink->cond);
+    pthread_mutex_unlock(&sink->mutex);
+
+    pthread_join(sink->thread, NULL);
+
+    dlt_vlog(LOG_INFO,
+             "Serial writer: %" PRIu64 " messages, %" PRIu64 " bytes written, %" PRIu64
+             " messages (%" PRIu64 " bytes) dropped, buffer used up to %u of %u bytes\n",
+             sink->messages, sink->bytes, sink->dropped, sink->dropped_bytes, sink->max_used,
+             sink->size);
+
+    pthread_cond_destroy(&sink->cond);
+    pthread_mutex_destroy(&sink->mutex);
+    free(sink->buffer);
+    sink->buffer = NULL;
+}
+
+int dlt_daemon_serial_sink_send(DltDaemonSerialSink *sink,
+                                const void *data1,
+                                int size1,
+                                const void *data2,
+                                int size2,
+                                char serialheader)
+{
+    uint32_t length;
+    uint32_t recovered = 0;
+    int dropping = 0;
+
+    if ((sink == NULL) || (sink->buffer == NULL) || (size1 < 0) || (size2 < 0))
+        return DLT_DAEMON_ERROR_UNKNOWN;
+
+    if (data1 == NULL)
+        size1 = 0;
+
+    if (data2 == NULL)
+        size2 = 0;
+
+    length = (uint32_t)size1 + (uint32_t)size2 + (serialheader ? (uint32_t)sizeof(dltSerialHeader) : 0);
+
+    pthread_mutex_lock(&sink->mutex);
+
+    if (length > sink->size - sink->used) {
+        /* drop the new message, the receiver still gets complete messages */
+        sink->dropped++;
+        sink->dropped_bytes += length;
+        dropping = (sink->dropping++ == 0);
+        pthread_mutex_unlock(&sink->mutex);
+
+        if (dropping)
+            dlt_log(LOG_WARNING, "Serial link too slow, dropping messages\n");
+
+        return DLT_DAEMON_ERROR_OK;
+    }
+
+    if (serialheader)
+        dlt_daemon_serial_sink_copy(sink, dltSerialHeader, sizeof(dltSerialHeader));
+
+    if (size1 > 0)
+        dlt_daemon_serial_sink_copy(sink, data1, (uint32_t)size1);
+
+    if (size2 > 0)
+        dlt_daemon_serial_sink_copy(sink, data2, (uint32_t)size2);
+
+    /* the thread only waits if the buffer was empty */
+    if (sink->used == 0)
+        pthread_cond_signal(&sink->cond);
+
+    sink->used += length;
+    sink->messages++;
+
+    if (sink->used > sink->max_used)
+        sink->max_used = sink->used;
+
+    recovered = sink->dropping;
+    sink->dropping = 0;
+
+    pthread_mutex_unlock(&sink->mutex);
+
+    if (recovered > 0)
+        dlt_vlog(LOG_WARNING, "Serial link recovered, %u messages dropped\n", recovered);
+
+    return DLT_DAEMON_ERROR_OK;
+}
@@ -56,10 +56,38 @@
 #define DLT_DAEMON_SERIAL_H
 
 #include <limits.h>
+#include <pthread.h>
 #include <semaphore.h>
 #include "dlt_common.h"
 #include "dlt_user.h"
 
+/**
+ * Writer thread of a serial connection. The daemon copies the messages into a
+ * ring buffer, the thread writes as much of the buffer as possible with each
+ * write(), so a slow serial link does not block the daemon. If the buffer is
+ * full, new messages are dropped as a whole.
+ */
+typedef struct
+{
+    int fd;                     /**< serial device */
+    uint8_t *buffer;            /**< ring buffer */
+    uint32_t size;              /**< size of the ring buffer */
+    uint32_t head;              /**< offset where the next message is added */
+    uint32_t tail;              /**< offset of the next byte to be written */
+    uint32_t used;              /**< number of bytes not written yet */
+    int running;                /**< cleared to stop the thread */
+    pthread_t thread;
+    pthread_mutex_t mutex;      /**< protects the ring buffer and the statistics */
+    pthread_cond_t cond;        /**< signalled if data was added or the thread has to stop */
+    uint64_t messages;          /**< number of messages added */
+    uint64_t bytes;             /**< number of bytes written to the device */
+    uint64_t dropped;           /**< number of messages dropped, because the buffer was full */
+    uint64_t dropped_bytes;     /**< number of bytes dropped */
+    uint32_t dropping;          /**< messages dropped since the buffer was full */
+    uint32_t max_used;          /**< highest fill level of the buffer */
+    int write_error;            /**< errno of the last failed write, 0 after a successful one */
+} DltDaemonSerialSink;
+
 int dlt_daemon_serial_send(int sock,
                            void *data1,
                            int size1,
@@ -67,4 +95,39 @@ int dlt_daemon_serial_send(int sock,
                            int size2,
                            char serialheader);
 
+/**
+ * Start the writer thread of a serial connection.
+ * @param sink pointer to serial sink structure
+ * @param fd serial device
+ * @param size size of the ring buffer
+ * @return negative value if there was an error
+ */
+DltReturnValue dlt_daemon_serial_sink_init(DltDaemonSerialSink *sink, int fd, uint32_t size);
+
+/**
+ * Stop the writer thread after everything in the ring buffer is written
+ * and log its statistics.
+ * @param sink pointer to serial sink structure
+ */
+void dlt_daemon_serial_sink_free(DltDaemonSerialSink *sink);
+
+/**
+ * Add a message to the ring buffer of a serial connection. A message which
+ * does not fit is dropped and counted.
+ * @param sink pointer to serial sink structure
+ * @param data1 first part of the message
+ * @param size1 size of the first part
+ * @param data2 second part of the message
+ * @param size2 size of the second part
+ * @param serialheader if set, the serial header is added in front of the message
+ * @return DLT_DAEMON_ERROR_OK if added or dropped, DLT_DAEMON_ERROR_UNKNOWN
+ *         on invalid parameters
+ */
+int dlt_daemon_serial_sink_send(DltDaemonSerialSink *sink,
+                                const void *data1,
+                                int size1,
+                                const void *data2,
+                                int size2,
+                                char serialheader);
+
 #endif /* DLT_DAEMON_SERIAL_H */
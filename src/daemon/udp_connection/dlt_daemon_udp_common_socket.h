@@ -33,6 +33,8 @@
 #include <string.h>     /* for memset() */
 #include <syslog.h>
 #include <sys/socket.h> /* for socket(), connect(), (), and recv() */
+#include <sys/uio.h>    /* for struct iovec */
+#include <time.h>       /* for clock_gettime() */
 #include <unistd.h>     /* for close() */
 
 #include "dlt_common.h"
@@ -47,6 +49,7 @@
 #define SYSTEM_CALL_ERROR -1
 #define ZERO_BYTE_RECIEVED 0
 #define ONE_BYTE_RECIEVED 0
+#define UDP_BATCH_DATAGRAMS 32 /* datagrams sent with one sendmmsg() */
 
 typedef struct sockaddr_storage CLIENT_ADDR_STRUCT;
 typedef socklen_t CLIENT_ADDR_STRUCT_SIZE;
@@ -59,10 +62,28 @@ typedef struct
     int isvalidflag;
 } DltDaemonClientSockInfo;
 
+/* datagrams collected for the next sendmmsg() */
+typedef struct
+{
+    uint8_t *buffer;                            /* UDP_BATCH_DATAGRAMS datagrams of datagram_size */
+    uint32_t length[UDP_BATCH_DATAGRAMS];       /* used bytes of each datagram */
+    struct iovec iov[UDP_BATCH_DATAGRAMS];
+    struct mmsghdr msgs[UDP_BATCH_DATAGRAMS];
+    uint32_t datagram_size;                     /* maximum size of a datagram */
+    uint32_t header_size;                       /* size of the datagram header, 0 if disabled */
+    unsigned int count;                         /* number of datagrams in use */
+    uint32_t sequence;                          /* sequence number of the next datagram */
+    long flush_timeout;                         /* maximum delay of a message in ns */
+    struct timespec oldest;                     /* arrival of the oldest collected message */
+} DltDaemonUdpBatch;
+
 /* Function prototype declaration */
 void dlt_daemon_udp_init_clientstruct(DltDaemonClientSockInfo *clientinfo_struct);
 DltReturnValue dlt_daemon_udp_socket_open(int *sock, unsigned int servPort);
 void dlt_daemon_udp_setmulticast_addr(DltDaemonLocal *daemon_local);
+DltReturnValue dlt_daemon_udp_batch_init(DltDaemonUdpBatch *batch, int datagram_size,
+                                         int flush_timeout, int sequence);
+void dlt_daemon_udp_batch_free(DltDaemonUdpBatch *batch);
 
 #endif /* DLT_DAEMON_UDP_COMMON_SOCKET_H */
 
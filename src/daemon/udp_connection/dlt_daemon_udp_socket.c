@@ -25,8 +25,10 @@
 
 static void dlt_daemon_udp_clientmsg_send(DltDaemonClientSockInfo *clientinfo,
                                           void *data1, int size1, void *data2, int size2, int verbose);
+static void dlt_daemon_udp_batch_send(DltDaemonClientSockInfo *clientinfo, DltDaemonUdpBatch *batch);
 static int g_udp_sock_fd = -1;
 static DltDaemonClientSockInfo g_udpmulticast_addr;
+static DltDaemonUdpBatch g_udp_batch;
 
 /* ************************************************************************** */
 /* Function   : dlt_daemon_udp_init_clientstruct */
@@ -94,7 +96,20 @@ DltReturnValue dlt_daemon_udp_connection_setup(DltDaemonLocal *daemon_local)
         g_udp_sock_fd = fd;
         /* set global multicast addr */
         dlt_daemon_udp_setmulticast_addr(daemon_local);
-        dlt_log(LOG_DEBUG, "initialize udp socket success\n");
+
+        ret_val = dlt_daemon_udp_batch_init(&g_udp_batch,
+                                            daemon_local->UDPMulticastDatagramSize,
+                                            daemon_local->UDPMulticastFlushTimeout,
+                                            daemon_local->UDPMulticastSequence);
+
+        if (ret_val != DLT_RETURN_OK) {
+            dlt_log(LOG_ERR, "Could not initialize udp datagram batch.\n");
+            close(fd);
+            g_udp_sock_fd = -1;
+        }
+        else {
+            dlt_log(LOG_DEBUG, "initialize udp socket success\n");
+        }
     }
 
     return ret_val;
@@ -185,6 +200,50 @@ DltReturnValue dlt_daemon_udp_socket_open(int *sock, unsigned int servPort)
     return DLT_RETURN_OK; /* OK */
 }
 
+/* ************************************************************************** */
+/* Function   : dlt_daemon_udp_batch_init */
+/* In Param   : maximum datagram size, flush timeout in ms, sequence flag */
+/* Out Param  : status of the batch allocation */
+/* Description: prepare the datagrams which collect messages for sendmmsg() */
+/* ************************************************************************** */
+DltReturnValue dlt_daemon_udp_batch_init(DltDaemonUdpBatch *batch, int datagram_size,
+                                         int flush_timeout, int sequence)
+{
+    if ((batch == NULL) || (datagram_size <= (int)sizeof(DltUdpDatagramHeader)) ||
+        (flush_timeout < 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(batch, 0, sizeof(DltDaemonUdpBatch));
+
+    batch->datagram_size = (uint32_t)datagram_size;
+    batch->header_size = sequence ? (uint32_t)sizeof(DltUdpDatagramHeader) : 0;
+    batch->flush_timeout = flush_timeout * 1000000L;
+    batch->buffer = malloc((size_t)UDP_BATCH_DATAGRAMS * batch->datagram_size);
+
+    if (batch->buffer == NULL) {
+        dlt_vlog(LOG_ERR, "%s: malloc failure\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+/* ************************************************************************** */
+/* Function   : dlt_daemon_udp_batch_free */
+/* In Param   : batch to be released */
+/* Out Param  : NIL */
+/* Description: release the datagrams, collected messages are dropped */
+/* ************************************************************************** */
+void dlt_daemon_udp_batch_free(DltDaemonUdpBatch *batch)
+{
+    if (batch == NULL)
+        return;
+
+    free(batch->buffer);
+    batch->buffer = NULL;
+    batch->count = 0;
+}
+
 /* ************************************************************************** */
 /* Function   : dlt_daemon_udp_dltmsg_multicast */
 /* In Param   : data bytes in dlt format */
@@ -197,61 +256,180 @@ void dlt_daemon_udp_dltmsg_multicast(void *data1, int size1,
 {
     PRINT_FUNCTION_VERBOSE(verbose);
 
-    /*
-     * When UDP Buffer is implemented then data2 would be expected to be NULL
-     * as the data comes from buffer directly. In that case data2 should
-     * not be checked for NULL
-     */
-    if ((data1 == NULL) || (data2 == NULL)) {
+    if (data1 == NULL) {
         dlt_vlog(LOG_ERR, "%s: NULL arg\n", __func__);
         return;
     }
 
+    if (data2 == NULL)
+        size2 = 0;
+
     dlt_daemon_udp_clientmsg_send(&g_udpmulticast_addr, data1, size1,
                                   data2, size2, verbose);
 }
 
+/* ************************************************************************** */
+/* Function   : dlt_daemon_udp_flush */
+/* In Param   : NIL */
+/* Out Param  : NIL */
+/* Description: send the collected multicast datagrams, called when the */
+/*              daemon has processed all pending events */
+/* ************************************************************************** */
+void dlt_daemon_udp_flush(int verbose)
+{
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if (g_udp_batch.count > 0)
+        dlt_daemon_udp_batch_send(&g_udpmulticast_addr, &g_udp_batch);
+}
+
+/* ************************************************************************** */
+/* Function   : dlt_daemon_udp_batch_send */
+/* In Param   : destination and collected datagrams */
+/* Out Param  : NIL */
+/* Description: send all collected datagrams with as few sendmmsg() as */
+/*              possible */
+/* ************************************************************************** */
+static void dlt_daemon_udp_batch_send(DltDaemonClientSockInfo *clientinfo, DltDaemonUdpBatch *batch)
+{
+    DltUdpDatagramHeader header;
+    unsigned int i;
+    unsigned int sent = 0;
+    int ret;
+
+    memcpy(header.pattern, dltUdpDatagramHeader, DLT_ID_SIZE);
+
+    for (i = 0; i < batch->count; i++) {
+        uint8_t *datagram = batch->buffer + (size_t)i * batch->datagram_size;
+
+        if (batch->header_size > 0) {
+            header.sequence = htonl(batch->sequence++);
+            memcpy(datagram, &header, sizeof(header));
+        }
+
+        batch->iov[i].iov_base = datagram;
+        batch->iov[i].iov_len = batch->length[i];
+        memset(&batch->msgs[i], 0, sizeof(batch->msgs[i]));
+        batch->msgs[i].msg_hdr.msg_name = &clientinfo->clientaddr;
+        batch->msgs[i].msg_hdr.msg_namelen = clientinfo->clientaddr_size;
+        batch->msgs[i].msg_hdr.msg_iov = &batch->iov[i];
+        batch->msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (sent < batch->count) {
+        ret = sendmmsg(g_udp_sock_fd, &batch->msgs[sent], batch->count - sent, 0);
+
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+
+            /* the remaining datagrams are lost, the receiver sees the gap
+             * in the sequence numbers */
+            dlt_vlog(LOG_ERR, "%s: Send UDP Packet Data failed: %s\n", __func__, strerror(errno));
+            break;
+        }
+
+        sent += (unsigned int)ret;
+    }
+
+    batch->count = 0;
+}
+
 /* ************************************************************************** */
 /* Function   : dlt_daemon_udp_clientmsg_send */
 /* In Param   : data bytes & respective size in dlt format */
 /* Out Param  : NIL */
-/* Description: common interface to send data via UDP protocol */
+/* Description: common interface to send data via UDP protocol. The message */
+/*              is appended to the current datagram, full datagrams are */
+/*              sent in batches. A message which does not fit into an */
+/*              empty datagram is sent on its own. */
 /* ************************************************************************** */
 void dlt_daemon_udp_clientmsg_send(DltDaemonClientSockInfo *clientinfo,
                                    void *data1, int size1, void *data2, int size2, int verbose)
 {
+    DltDaemonUdpBatch *batch = &g_udp_batch;
+    struct timespec now;
+    uint32_t size;
+    uint8_t *datagram;
+
     PRINT_FUNCTION_VERBOSE(verbose);
 
-    if ((clientinfo->isvalidflag == ADDRESS_VALID) &&
-        (size1 > 0) && (size2 > 0)) {
-        void *data = (void *)calloc((size_t)(size1 + size2), sizeof(char));
+    if ((clientinfo->isvalidflag != ADDRESS_VALID) || (batch->buffer == NULL) ||
+        (size1 <= 0) || (size2 < 0)) {
+        if (clientinfo->isvalidflag != ADDRESS_VALID)
+            dlt_vlog(LOG_ERR, "%s: clientinfo->isvalidflag != ADDRESS_VALID %d\n", __func__, clientinfo->isvalidflag);
+
+        if (size1 <= 0)
+            dlt_vlog(LOG_ERR, "%s: size1 <= 0\n", __func__);
+
+        if (size2 < 0)
+            dlt_vlog(LOG_ERR, "%s: size2 < 0\n", __func__);
 
-        if (data == NULL) {
-            dlt_vlog(LOG_ERR, "%s: calloc failure\n", __func__);
-            return;
+        return;
+    }
+
+    size = (uint32_t)size1 + (uint32_t)size2;
+
+    if (size > batch->datagram_size - batch->header_size) {
+        DltUdpDatagramHeader header;
+        struct iovec iov[3];
+        struct msghdr msg;
+        int n = 0;
+
+        /* keep the order of the messages */
+        if (batch->count > 0)
+            dlt_daemon_udp_batch_send(clientinfo, batch);
+
+        if (batch->header_size > 0) {
+            memcpy(header.pattern, dltUdpDatagramHeader, DLT_ID_SIZE);
+            header.sequence = htonl(batch->sequence++);
+            iov[n].iov_base = &header;
+            iov[n++].iov_len = sizeof(header);
         }
 
-        memcpy(data, data1, (size_t)size1);
-        memcpy((int*)data + size1, data2, (size_t)size2);
+        iov[n].iov_base = data1;
+        iov[n++].iov_len = (size_t)size1;
+        iov[n].iov_base = data2;
+        iov[n++].iov_len = (size_t)size2;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &clientinfo->clientaddr;
+        msg.msg_namelen = clientinfo->clientaddr_size;
+        msg.msg_iov = iov;
+        msg.msg_iovlen = (size_t)n;
 
-        if (sendto(g_udp_sock_fd, data, (size_t)(size1 + size2), 0, (struct sockaddr *)&clientinfo->clientaddr,
-                   clientinfo->clientaddr_size) < 0)
+        if (sendmsg(g_udp_sock_fd, &msg, 0) < 0)
             dlt_vlog(LOG_ERR, "%s: Send UDP Packet Data failed\n", __func__);
 
-        free(data);
-        data = NULL;
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
+    if ((batch->count == 0) || (batch->length[batch->count - 1] + size > batch->datagram_size)) {
+        if (batch->count == UDP_BATCH_DATAGRAMS)
+            dlt_daemon_udp_batch_send(clientinfo, batch);
+
+        if (batch->count == 0)
+            batch->oldest = now;
+
+        batch->length[batch->count++] = batch->header_size;
     }
-    else {
-        if (clientinfo->isvalidflag != ADDRESS_VALID)
-            dlt_vlog(LOG_ERR, "%s: clientinfo->isvalidflag != ADDRESS_VALID %d\n", __func__, clientinfo->isvalidflag);
 
-        if (size1 <= 0)
-            dlt_vlog(LOG_ERR, "%s: size1 <= 0\n", __func__);
+    datagram = batch->buffer + (size_t)(batch->count - 1) * batch->datagram_size;
+    memcpy(datagram + batch->length[batch->count - 1], data1, (size_t)size1);
+    batch->length[batch->count - 1] += (uint32_t)size1;
 
-        if (size2 <= 0)
-            dlt_vlog(LOG_ERR, "%s: size2 <= 0\n", __func__);
+    if (size2 > 0) {
+        memcpy(datagram + batch->length[batch->count - 1], data2, (size_t)size2);
+        batch->length[batch->count - 1] += (uint32_t)size2;
     }
+
+    /* don't delay messages longer than configured, even if the daemon
+     * is too busy to get idle */
+    if ((now.tv_sec - batch->oldest.tv_sec) * 1000000000L + (now.tv_nsec - batch->oldest.tv_nsec) >=
+        batch->flush_timeout)
+        dlt_daemon_udp_batch_send(clientinfo, batch);
 }
 
 /* ************************************************************************** */
@@ -262,6 +440,9 @@ void dlt_daemon_udp_clientmsg_send(DltDaemonClientSockInfo *clientinfo,
 /* ************************************************************************** */
 void dlt_daemon_udp_close_connection(void)
 {
+    dlt_daemon_udp_flush(0);
+    dlt_daemon_udp_batch_free(&g_udp_batch);
+
     if (close(g_udp_sock_fd) == SYSTEM_CALL_ERROR)
         dlt_vlog(LOG_WARNING, "[%s:%d] close error %s\n", __func__, __LINE__,
                  strerror(errno));
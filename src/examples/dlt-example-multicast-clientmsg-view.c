@@ -56,6 +56,40 @@ struct clientinfostruct
     DltReceiver receiver;
 };
 
+/* sequence numbers of the datagram headers, if the daemon sends them */
+static int sequence_valid = 0;
+static uint32_t sequence_next = 0;
+static uint64_t datagrams_lost = 0;
+
+/* Remove the datagram header at the begin of the new data and report
+ * datagrams missing in the sequence */
+void dlt_receiver_check_sequence_udp(DltReceiver *receiver, int32_t received)
+{
+    DltUdpDatagramHeader header;
+    char *datagram = receiver->buf + receiver->lastBytesRcvd;
+    uint32_t sequence;
+
+    if ((received < (int32_t)sizeof(header)) ||
+        (memcmp(datagram, dltUdpDatagramHeader, DLT_ID_SIZE) != 0))
+        return;
+
+    memcpy(&header, datagram, sizeof(header));
+    sequence = ntohl(header.sequence);
+
+    if (sequence_valid && (sequence != sequence_next)) {
+        datagrams_lost += (uint32_t)(sequence - sequence_next);
+        printf("Lost %u datagram(s), %" PRIu64 " in total\n",
+               (uint32_t)(sequence - sequence_next), datagrams_lost);
+    }
+
+    sequence_valid = 1;
+    sequence_next = sequence + 1;
+
+    memmove(datagram, datagram + sizeof(header), (size_t)received - sizeof(header));
+    receiver->bytesRcvd -= (int32_t)sizeof(header);
+    receiver->totalBytesRcvd -= (int32_t)sizeof(header);
+}
+
 int dlt_receiver_receive_socket_udp(struct clientinfostruct *clientinfo, DltReceiver *receiver)
 {
     if ((receiver == NULL) || (clientinfo == NULL)) {
@@ -87,6 +121,7 @@ int dlt_receiver_receive_socket_udp(struct clientinfostruct *clientinfo, DltRece
     } /* if */
 
     receiver->totalBytesRcvd += receiver->bytesRcvd;
+    dlt_receiver_check_sequence_udp(receiver, receiver->bytesRcvd);
     receiver->bytesRcvd += receiver->lastBytesRcvd;
 
     return receiver->bytesRcvd;
@@ -36,6 +36,7 @@
 #include <netdb.h>
 #include <limits.h>
 #include <errno.h>
+#include <unistd.h>
 #include "dlt_gateway.h"
 #include "dlt_gateway_internal.h"
 #include "dlt_config_file_parser.h"
@@ -248,6 +249,36 @@ DLT_STATIC DltReturnValue dlt_gateway_check_send_serial(DltGatewayConnection *co
     return DLT_RETURN_OK;
 }
 
+/**
+ * Check compression level of the data sent by the passive node
+ *
+ * @param con     DltGatewayConnection to be updated
+ * @param value   string to be tested
+ * @return Value from DltReturnValue enum
+ */
+DLT_STATIC DltReturnValue dlt_gateway_check_compression(DltGatewayConnection *con,
+                                                        char *value)
+{
+    if ((con == NULL) || (value == NULL)) {
+        dlt_vlog(LOG_ERR, "%s: wrong parameter\n", __func__);
+        return DLT_RETURN_WRONG_PARAMETER;
+    }
+
+    con->compression = (int)strtol(value, NULL, 10);
+
+    if ((con->compression < 0) || (con->compression > 9))
+        return DLT_RETURN_ERROR;
+
+#ifndef DLT_STREAM_COMPRESSION
+    if (con->compression > 0) {
+        dlt_log(LOG_WARNING, "Compression is not supported, data is received uncompressed\n");
+        con->compression = 0;
+    }
+#endif
+
+    return DLT_RETURN_OK;
+}
+
 /**
  * Allocate passive control messages
  *
@@ -518,6 +549,11 @@ DLT_STATIC DltGatewayConf configuration_entries[GW_CONF_COUNT] = {
         .key = "SendSerialHeader",
         .func = dlt_gateway_check_send_serial,
         .is_opt = 1
+    },
+    [GW_CONF_COMPRESSION] = {
+        .key = "Compression",
+        .func = dlt_gateway_check_compression,
+        .is_opt = 1
     }
 };
 
@@ -622,6 +658,7 @@ int dlt_gateway_store_connection(DltGateway *gateway,
     gateway->connections[i].p_control_msgs = tmp->p_control_msgs;
     gateway->connections[i].head = tmp->head;
     gateway->connections[i].send_serial = tmp->send_serial;
+    gateway->connections[i].compression = tmp->compression;
 
     if (dlt_client_init_port(&gateway->connections[i].client,
                              gateway->connections[i].port,
@@ -877,7 +914,11 @@ void dlt_gateway_deinit(DltGateway *gateway, int verbose)
 
     for (i = 0; i < gateway->num_connections; i++) {
         DltGatewayConnection *c = &gateway->connections[i];
+        dlt_client_connect_free(&c->connect_state);
         dlt_client_cleanup(&c->client, verbose);
+#ifdef DLT_STREAM_COMPRESSION
+        dlt_daemon_decompression_free(&c->decompression);
+#endif
         free(c->ip_address);
         c->ip_address = NULL;
         free(c->ecuid);
@@ -914,11 +955,22 @@ DLT_STATIC int dlt_gateway_add_to_event_loop(DltDaemonLocal *daemon_local,
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
+    /* all messages received at once are forwarded together, so use a
+     * bigger receive buffer than the one of the client */
+    if (dlt_receiver_init(&con->client.receiver,
+                          con->client.sock,
+                          con->client.receiver.type,
+                          DLT_GATEWAY_RECEIVE_BUFSIZE) != DLT_RETURN_OK) {
+        dlt_log(LOG_ERR, "Gateway receive buffer allocation failed\n");
+        return DLT_RETURN_ERROR;
+    }
+
     /* connection to passive node established, add to event loop */
     con->status = DLT_GATEWAY_CONNECTED;
     con->reconnect_cnt = 0;
     con->timeout_cnt = 0;
     con->sendtime_cnt = 0;
+    con->compressed = 0;
 
     /* setup dlt connection and add to poll event loop here */
     if (dlt_connection_create(daemon_local,
@@ -930,6 +982,14 @@ DLT_STATIC int dlt_gateway_add_to_event_loop(DltDaemonLocal *daemon_local,
         return DLT_RETURN_ERROR;
     }
 
+    /* the passive node compresses everything after its response */
+    if ((con->compression > 0) &&
+        (dlt_client_send_stream_compression(&con->client,
+                                            DLT_STREAM_COMPRESSION_ZLIB,
+                                            (uint8_t)con->compression,
+                                            0) != DLT_RETURN_OK))
+        dlt_log(LOG_WARNING, "Requesting compression from passive node failed\n");
+
     /* immediately send configured control messages */
     control_msg = con->p_control_msgs;
 
@@ -980,9 +1040,29 @@ int dlt_gateway_establish_connections(DltGateway *gateway,
         if ((con->status != DLT_GATEWAY_CONNECTED) &&
             (con->trigger != DLT_GATEWAY_ON_DEMAND) &&
             (con->trigger != DLT_GATEWAY_DISABLED)) {
-            ret = dlt_client_connect(&con->client, verbose);
+            /* the connection is established without blocking the daemon,
+             * a pending connect is checked again with the next timer tick */
+            if (con->status == DLT_GATEWAY_CONNECTING)
+                ret = dlt_client_connect_finish(&con->client, &con->connect_state, verbose);
+            else
+                ret = dlt_client_connect_start(&con->client, &con->connect_state, verbose);
+
+            if (ret == DLT_RETURN_TRUE) {
+                con->status = DLT_GATEWAY_CONNECTING;
+                con->timeout_cnt++;
 
-            if (ret == 0) {
+                if ((con->timeout > 0) && (con->timeout_cnt > con->timeout)) {
+                    close(con->client.sock);
+                    con->client.sock = -1;
+                    dlt_client_connect_free(&con->connect_state);
+                    con->status = DLT_GATEWAY_DISCONNECTED;
+                    con->trigger = DLT_GATEWAY_DISABLED;
+                    dlt_log(LOG_WARNING,
+                            "Passive Node connection retry timed out. "
+                            "Give up.\n");
+                }
+            }
+            else if (ret == DLT_RETURN_OK) {
                 /* setup dlt connection and add to poll event loop here */
                 if (dlt_gateway_add_to_event_loop(daemon_local, con, verbose) != DLT_RETURN_OK) {
                     dlt_log(LOG_ERR, "Gateway connection creation failed\n");
@@ -993,6 +1073,9 @@ int dlt_gateway_establish_connections(DltGateway *gateway,
                 dlt_log(LOG_DEBUG,
                         "Passive Node is not up. Connection failed.\n");
 
+                if (con->status == DLT_GATEWAY_CONNECTING)
+                    con->status = DLT_GATEWAY_DISCONNECTED;
+
                 con->timeout_cnt++;
 
                 if (con->timeout > 0) {
@@ -1280,6 +1363,233 @@ DLT_STATIC int dlt_gateway_control_service_logstorage(DltDaemon *daemon,
     return DLT_RETURN_OK;
 }
 
+/**
+ * Parse the control message responses of a passive node which are needed by
+ * the gateway itself.
+ *
+ * @param daemon        DltDaemon structure
+ * @param daemon_local  DltDaemonLocal structure
+ * @param con           DltGatewayConnection the message was received from
+ * @param ecu           ECU id of the message
+ * @param msg           received control message
+ * @param verbose       verbose flag
+ */
+DLT_STATIC void dlt_gateway_parse_control_message(DltDaemon *daemon,
+                                                  DltDaemonLocal *daemon_local,
+                                                  DltGatewayConnection *con,
+                                                  char *ecu,
+                                                  DltMessage *msg,
+                                                  int verbose)
+{
+    uint32_t id;
+    uint32_t id_tmp;
+    DltPassiveControlMessage *control_msg = con->p_control_msgs;
+
+    memcpy(&id_tmp, msg->databuffer, sizeof(uint32_t));
+    id = DLT_ENDIAN_GET_32(msg->standardheader->htyp, id_tmp);
+
+    /* if ID is GET_LOG_INFO, parse msg */
+    if (id == DLT_SERVICE_ID_GET_LOG_INFO) {
+        while (control_msg) {
+            if (control_msg->id == id) {
+                if (dlt_gateway_parse_get_log_info(daemon,
+                                                   ecu,
+                                                   msg,
+                                                   control_msg->req,
+                                                   verbose) == DLT_RETURN_ERROR)
+                    dlt_log(LOG_WARNING, "Parsing GET_LOG_INFO message failed!\n");
+
+                /* Check for logstorage */
+                dlt_gateway_control_service_logstorage(daemon,
+                                                       daemon_local,
+                                                       verbose);
+
+                /* initialize the flag */
+                control_msg->req = CONTROL_MESSAGE_NOT_REQUESTED;
+                break;
+            }
+
+            control_msg = control_msg->next;
+        }
+    }
+    else if (id == DLT_SERVICE_ID_GET_DEFAULT_LOG_LEVEL)
+    {
+        if (dlt_gateway_parse_get_default_log_level(daemon,
+                                                    daemon_local,
+                                                    ecu,
+                                                    msg,
+                                                    verbose) == DLT_RETURN_ERROR)
+            dlt_log(LOG_WARNING,
+                    "Parsing GET_DEFAULT_LOG_LEVEL message failed!\n");
+    }
+}
+
+/**
+ * Switch a passive node connection to compressed frames.
+ *
+ * @param con     DltGatewayConnection
+ * @return Value from DltReturnValue enum
+ */
+DLT_STATIC DltReturnValue dlt_gateway_start_decompression(DltGatewayConnection *con)
+{
+#ifdef DLT_STREAM_COMPRESSION
+    if ((con->decompression.data == NULL) &&
+        (dlt_daemon_decompression_init(&con->decompression,
+                                       DLT_DAEMON_COMPRESSION_BATCH_MAX) != DLT_RETURN_OK))
+        return DLT_RETURN_ERROR;
+
+    con->compressed = 1;
+    dlt_vlog(LOG_INFO, "Passive node %s sends compressed data\n", con->ecuid);
+
+    return DLT_RETURN_OK;
+#else
+    dlt_vlog(LOG_ERR, "%s: Compression is not supported\n", __func__);
+    (void)con;
+
+    return DLT_RETURN_ERROR;
+#endif
+}
+
+/**
+ * Forward the complete messages at the begin of a buffer of a passive node.
+ * The messages are sent as they are, only a storage header is added. Stops at
+ * the response which switches the passive node to compressed frames.
+ *
+ * @param daemon          DltDaemon structure
+ * @param daemon_local    DltDaemonLocal structure
+ * @param con             DltGatewayConnection the messages were received from
+ * @param buffer          received messages
+ * @param length          length of the received messages
+ * @param storageheader   storage header to be sent with the messages
+ * @param msg             message used for parsing control messages
+ * @param msg_initialized whether msg is initialized, set when it is initialized
+ * @param verbose         verbose flag
+ * @return number of bytes forwarded, -1 if a message of another ECU was received,
+ *         -2 on error
+ */
+DLT_STATIC int dlt_gateway_forward_messages(DltDaemon *daemon,
+                                            DltDaemonLocal *daemon_local,
+                                            DltGatewayConnection *con,
+                                            uint8_t *buffer,
+                                            int length,
+                                            DltStorageHeader *storageheader,
+                                            DltMessage *msg,
+                                            bool *msg_initialized,
+                                            int verbose)
+{
+    int offset = 0;
+
+    while (length - offset >= (int)sizeof(DltStandardHeader)) {
+        uint8_t *ptr = buffer + offset;
+        int available = length - offset;
+        int serial = 0;
+
+        if (memcmp(ptr, dltSerialHeader, sizeof(dltSerialHeader)) == 0) {
+            serial = (int)sizeof(dltSerialHeader);
+
+            if (available < serial + (int)sizeof(DltStandardHeader))
+                break;
+        }
+
+        DltStandardHeader *standardheader = (DltStandardHeader *)(ptr + serial);
+        int size = DLT_BETOH_16(standardheader->len);
+        int headersize = (int)(sizeof(DltStandardHeader) +
+                               DLT_STANDARD_HEADER_EXTRA_SIZE(standardheader->htyp) +
+                               (DLT_IS_HTYP_UEH(standardheader->htyp) ? sizeof(DltExtendedHeader) : 0));
+
+        if (size < headersize) {
+            /* like dlt_message_read(), wait until the data is removed
+             * together with the connection */
+            dlt_vlog(LOG_WARNING, "%s: Invalid message header\n", __func__);
+            break;
+        }
+
+        if (available < serial + size)
+            break;
+
+        uint8_t *header = ptr + serial;
+        uint8_t *payload = header + headersize;
+        int datasize = size - headersize;
+        uint32_t id = 0;
+
+        /* messages without ECU id are assigned to the configured one */
+        if (DLT_IS_HTYP_WEID(standardheader->htyp))
+            memcpy(storageheader->ecu, header + sizeof(DltStandardHeader), DLT_ID_SIZE);
+        else
+            dlt_set_id(storageheader->ecu, con->ecuid);
+
+        /* only forward messages if the received ECUid is the expected one */
+        if (strncmp(storageheader->ecu, con->ecuid, DLT_ID_SIZE) != 0) {
+            dlt_vlog(LOG_WARNING,
+                     "Received ECUid (%.*s) differs to configured ECUid(%s). "
+                     "Discard this message.\n",
+                     DLT_ID_SIZE,
+                     storageheader->ecu,
+                     con->ecuid);
+            return -1;
+        }
+
+        /* only the responses the gateway needs itself are parsed */
+        if (DLT_IS_HTYP_UEH(standardheader->htyp) &&
+            (DLT_GET_MSIN_MSTP(((DltExtendedHeader *)(payload - sizeof(DltExtendedHeader)))->msin) ==
+             DLT_TYPE_CONTROL) &&
+            (datasize >= (int)sizeof(uint32_t))) {
+            if (!*msg_initialized) {
+                if (dlt_message_init(msg, verbose) == -1) {
+                    dlt_log(LOG_ERR,
+                            "Cannot initialize DLT message for passive node forwarding\n");
+                    return -2;
+                }
+
+                *msg_initialized = true;
+            }
+
+            if (dlt_message_read(msg, ptr, (unsigned int)(serial + size), 0, verbose) ==
+                DLT_MESSAGE_ERROR_OK) {
+                uint32_t id_tmp;
+
+                memcpy(&id_tmp, msg->databuffer, sizeof(uint32_t));
+                id = DLT_ENDIAN_GET_32(msg->standardheader->htyp, id_tmp);
+                dlt_gateway_parse_control_message(daemon,
+                                                  daemon_local,
+                                                  con,
+                                                  storageheader->ecu,
+                                                  msg,
+                                                  verbose);
+            }
+        }
+
+        dlt_daemon_client_send(DLT_DAEMON_SEND_TO_ALL,
+                               daemon,
+                               daemon_local,
+                               storageheader,
+                               (int)sizeof(DltStorageHeader),
+                               header,
+                               headersize,
+                               payload,
+                               datasize,
+                               verbose);
+
+        offset += serial + size;
+
+        /* everything after a positive response is compressed */
+        if ((id == DLT_SERVICE_ID_SET_STREAM_COMPRESSION) && (con->compression > 0)) {
+            if ((msg->datasize < (int32_t)sizeof(DltServiceResponse)) ||
+                (((DltServiceResponse *)msg->databuffer)->status != DLT_SERVICE_RESPONSE_OK)) {
+                dlt_vlog(LOG_WARNING, "Passive node %s does not support compression\n", con->ecuid);
+                continue;
+            }
+
+            if (dlt_gateway_start_decompression(con) != DLT_RETURN_OK)
+                return -2;
+
+            break;
+        }
+    }
+
+    return offset;
+}
+
 DltReturnValue dlt_gateway_process_passive_node_messages(DltDaemon *daemon,
                                                          DltDaemonLocal *daemon_local,
                                                          DltReceiver *receiver,
@@ -1289,7 +1599,12 @@ DltReturnValue dlt_gateway_process_passive_node_messages(DltDaemon *daemon,
     DltGateway *gateway = NULL;
     DltGatewayConnection *con = NULL;
     DltMessage msg = { 0 };
+    bool msg_initialized = false;
+    DltStorageHeader storageheader;
     bool b_reset_receiver = false;
+    int offset = 0;
+    int forwarded = 0;
+    DltReturnValue ret = DLT_RETURN_OK;
 
     if ((daemon == NULL) || (daemon_local == NULL) || (receiver == NULL)) {
         dlt_vlog(LOG_ERR, "%s: wrong parameter\n", __func__);
@@ -1316,21 +1631,9 @@ DltReturnValue dlt_gateway_process_passive_node_messages(DltDaemon *daemon,
         return DLT_RETURN_ERROR;
     }
 
-    /* now the corresponding passive node connection is available */
-    if (dlt_message_init(&msg, verbose) == -1) {
-        dlt_log(LOG_ERR,
-                "Cannot initialize DLT message for passive node forwarding\n");
-        return DLT_RETURN_ERROR;
-    }
-
     /* nearly copy and paste of dlt_client_main_loop function */
     if (dlt_receiver_receive(receiver) <= 0) {
         /* No more data to be received */
-        if (dlt_message_free(&msg, verbose) < 0) {
-            dlt_log(LOG_ERR, "Cannot free DLT message\n");
-            return DLT_RETURN_ERROR;
-        }
-
         dlt_log(LOG_WARNING, "Connection to passive node lost\n");
 
         if (con->reconnect_cnt < DLT_GATEWAY_RECONNECT_MAX) {
@@ -1350,95 +1653,65 @@ DltReturnValue dlt_gateway_process_passive_node_messages(DltDaemon *daemon,
         return DLT_RETURN_OK;
     }
 
-    while (dlt_message_read(&msg,
-                            (unsigned char *)receiver->buf,
-                            (unsigned int)receiver->bytesRcvd,
-                            0,
-                            verbose) == DLT_MESSAGE_ERROR_OK) {
-        DltStandardHeaderExtra *header = (DltStandardHeaderExtra *)
-            (msg.headerbuffer +
-             sizeof(DltStorageHeader) +
-             sizeof(DltStandardHeader));
-
-        /* only forward messages if the received ECUid is the expected one */
-        if (strncmp(header->ecu, con->ecuid, DLT_ID_SIZE) == 0) {
-            uint32_t id;
-            uint32_t id_tmp;
-            DltPassiveControlMessage *control_msg = con->p_control_msgs;
-
-            dlt_vlog(LOG_DEBUG,
-                     "Received ECUid (%.*s) similar to configured ECUid(%s). "
-                     "Forwarding message (%s).\n",
-                     DLT_ID_SIZE,
-                     header->ecu,
-                     con->ecuid,
-                     msg.databuffer);
-
-            id_tmp = *((uint32_t *)(msg.databuffer));
-            id = DLT_ENDIAN_GET_32(msg.standardheader->htyp, id_tmp);
-
-            /* if ID is GET_LOG_INFO, parse msg */
-            if (id == DLT_SERVICE_ID_GET_LOG_INFO) {
-                while (control_msg) {
-                    if (control_msg->id == id) {
-                        if (dlt_gateway_parse_get_log_info(daemon,
-                                                           header->ecu,
-                                                           &msg,
-                                                           control_msg->req,
-                                                           verbose) == DLT_RETURN_ERROR)
-                            dlt_log(LOG_WARNING, "Parsing GET_LOG_INFO message failed!\n");
-
-                        /* Check for logstorage */
-                        dlt_gateway_control_service_logstorage(daemon,
-                                                               daemon_local,
-                                                               verbose);
-
-                        /* initialize the flag */
-                        control_msg->req = CONTROL_MESSAGE_NOT_REQUESTED;
-                        break;
-                    }
+    /* All messages received with one call are forwarded directly out of the
+     * receive buffer. Only the storage header is created, its time is taken
+     * once for all of them. */
+    if (dlt_set_storageheader(&storageheader, con->ecuid) == DLT_RETURN_ERROR) {
+        dlt_vlog(LOG_ERR, "%s: Can't set storage header\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
 
-                    control_msg = control_msg->next;
-                }
-            }
-            else if (id == DLT_SERVICE_ID_GET_DEFAULT_LOG_LEVEL)
-            {
-                if (dlt_gateway_parse_get_default_log_level(
-                        daemon,
-                        daemon_local,
-                        header->ecu,
-                        &msg,
-                        verbose) == DLT_RETURN_ERROR)
-                    dlt_log(LOG_WARNING,
-                            "Parsing GET_DEFAULT_LOG_LEVEL message failed!\n");
+    while (offset < receiver->bytesRcvd) {
+#ifdef DLT_STREAM_COMPRESSION
+        if (con->compressed) {
+            uint32_t frame_length = 0;
+            uint32_t size = 0;
+            DltReturnValue unpacked = dlt_daemon_decompression_unpack(&con->decompression,
+                                                                      (uint8_t *)receiver->buf + offset,
+                                                                      (uint32_t)(receiver->bytesRcvd - offset),
+                                                                      &frame_length,
+                                                                      &size);
+
+            if (unpacked == DLT_RETURN_OK)
+                break;
+
+            if (unpacked < DLT_RETURN_OK) {
+                /* the following frames cannot be found anymore, connect again */
+                dlt_log(LOG_WARNING, "Disconnect from passive node due to corrupted data\n");
+                con->status = DLT_GATEWAY_DISCONNECTED;
+
+                if (dlt_event_handler_unregister_connection(&daemon_local->pEvent,
+                                                            daemon_local,
+                                                            receiver->fd) != 0)
+                    dlt_log(LOG_ERR, "Remove passive node Connection failed\n");
+
+                b_reset_receiver = true;
+                break;
             }
 
-            /* prepare storage header */
-            if (dlt_set_storageheader(msg.storageheader,
-                                      msg.headerextra.ecu) == DLT_RETURN_ERROR) {
-                dlt_vlog(LOG_ERR, "%s: Can't set storage header\n", __func__);
-                return DLT_RETURN_ERROR;
-            }
+            forwarded = dlt_gateway_forward_messages(daemon, daemon_local, con, con->decompression.data,
+                                                     (int)size, &storageheader, &msg, &msg_initialized,
+                                                     verbose);
 
-            dlt_daemon_client_send(DLT_DAEMON_SEND_TO_ALL,
-                                       daemon,
-                                       daemon_local,
-                                       msg.headerbuffer,
-                                       (int)sizeof(DltStorageHeader),
-                                       msg.headerbuffer + sizeof(DltStorageHeader),
-                                       (int)((size_t)msg.headersize - sizeof(DltStorageHeader)),
-                                       msg.databuffer,
-                                       (int)((size_t)msg.datasize),
-                                       verbose);
-        } else { /* otherwise remove this connection and do not connect again */
-            dlt_vlog(LOG_WARNING,
-                     "Received ECUid (%.*s) differs to configured ECUid(%s). "
-                     "Discard this message.\n",
-                     DLT_ID_SIZE,
-                     header->ecu,
-                     con->ecuid);
+            if ((forwarded >= 0) && (forwarded != (int)size))
+                dlt_vlog(LOG_WARNING, "%s: Incomplete message in compressed frame\n", __func__);
 
-            /* disconnect from passive node */
+            offset += (int)frame_length;
+        }
+        else
+#endif
+        {
+            forwarded = dlt_gateway_forward_messages(daemon, daemon_local, con,
+                                                     (uint8_t *)receiver->buf + offset,
+                                                     receiver->bytesRcvd - offset,
+                                                     &storageheader, &msg, &msg_initialized, verbose);
+
+            if (forwarded > 0)
+                offset += forwarded;
+        }
+
+        if (forwarded == -1) {
+            /* otherwise remove this connection and do not connect again */
             con->status = DLT_GATEWAY_DISCONNECTED;
             con->trigger = DLT_GATEWAY_DISABLED;
 
@@ -1455,42 +1728,31 @@ DltReturnValue dlt_gateway_process_passive_node_messages(DltDaemon *daemon,
             /* however, the rest will never be received since the socket will be closed by above method */
             /* as such, we need to reset the receiver to prevent permanent corruption */
             b_reset_receiver = true;
+            break;
         }
 
-        if (msg.found_serialheader) {
-            if (dlt_receiver_remove(receiver,
-                                    (int)((size_t)msg.headersize +
-                                    (size_t)msg.datasize -
-                                    sizeof(DltStorageHeader) +
-                                    sizeof(dltSerialHeader))) == -1) {
-                /* Return value ignored */
-                dlt_message_free(&msg, verbose);
-                return DLT_RETURN_ERROR;
-            }
-        }
-        else if (dlt_receiver_remove(receiver,
-                                     (int)((size_t)msg.headersize +
-                                     (size_t)msg.datasize -
-                                     sizeof(DltStorageHeader))) == -1) {
-            /* Return value ignored */
-            dlt_message_free(&msg, verbose);
-            return DLT_RETURN_ERROR;
+        if (forwarded < 0) {
+            ret = DLT_RETURN_ERROR;
+            break;
         }
+
+        /* stop at incomplete data unless the stream switched to compressed frames */
+        if (!con->compressed)
+            break;
     }
 
     if (b_reset_receiver)
-        dlt_receiver_remove(receiver, receiver->bytesRcvd);
+        offset = receiver->bytesRcvd;
 
-    if (dlt_receiver_move_to_begin(receiver) == -1) {
-        /* Return value ignored */
-        dlt_message_free(&msg, verbose);
-        return DLT_RETURN_ERROR;
-    }
+    if ((offset > 0) && (dlt_receiver_remove(receiver, offset) == -1))
+        ret = DLT_RETURN_ERROR;
+    else if (dlt_receiver_move_to_begin(receiver) == -1)
+        ret = DLT_RETURN_ERROR;
 
-    if (dlt_message_free(&msg, verbose) == -1)
-        return DLT_RETURN_ERROR;
+    if (msg_initialized && (dlt_message_free(&msg, verbose) == -1))
+        ret = DLT_RETURN_ERROR;
 
-    return DLT_RETURN_OK;
+    return ret;
 }
 
 int dlt_gateway_process_gateway_timer(DltDaemon *daemon,
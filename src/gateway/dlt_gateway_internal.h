@@ -74,6 +74,9 @@ DLT_STATIC DltReturnValue dlt_gateway_check_timeout(DltGatewayConnection *con,
 DLT_STATIC DltReturnValue dlt_gateway_check_send_serial(DltGatewayConnection *con,
                                                         char *value);
 
+DLT_STATIC DltReturnValue dlt_gateway_check_compression(DltGatewayConnection *con,
+                                                        char *value);
+
 DLT_STATIC DltReturnValue dlt_gateway_allocate_control_messages(DltGatewayConnection *con);
 
 DLT_STATIC DltReturnValue dlt_gateway_check_control_messages(DltGatewayConnection *con,
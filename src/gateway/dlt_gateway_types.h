@@ -58,6 +58,9 @@
 
 #include "dlt_protocol.h"
 #include "dlt_client.h"
+#ifdef DLT_STREAM_COMPRESSION
+#   include "dlt_daemon_compression.h"
+#endif
 
 #define DLT_GATEWAY_CONFIG_PATH CONFIGURATION_FILES_DIR "/dlt_gateway.conf"
 #define DLT_GATEWAY_TIMER_DEFAULT_INTERVAL 1
@@ -65,6 +68,10 @@
 
 #define DLT_GATEWAY_RECONNECT_MAX 1 /* reconnect once after connection loss */
 
+/* size of the receive buffer of a passive node connection, all messages
+ * received at once are forwarded together */
+#define DLT_GATEWAY_RECEIVE_BUFSIZE (256 * 1024)
+
 /* maximum number of control messages that can be send after connection is
  * established */
 #define DLT_GATEWAY_MAX_STARTUP_CTRL_MSG 10
@@ -74,7 +81,8 @@ typedef enum
     DLT_GATEWAY_UNINITIALIZED,
     DLT_GATEWAY_INITIALIZED,
     DLT_GATEWAY_CONNECTED,
-    DLT_GATEWAY_DISCONNECTED
+    DLT_GATEWAY_DISCONNECTED,
+    DLT_GATEWAY_CONNECTING      /* non-blocking connect in progress */
 } connection_status;
 
 typedef enum
@@ -132,7 +140,13 @@ typedef struct {
     DltPassiveControlMessage *p_control_msgs; /* passive control msgs */
     DltPassiveControlMessage *head; /* to go back to the head pointer of p_control_msgs */
     int send_serial;            /* Send serial header with control messages */
+    int compression;            /* compression level requested from passive node, 0 for none */
+    int compressed;             /* passive node sends compressed frames */
+#ifdef DLT_STREAM_COMPRESSION
+    DltDaemonDecompression decompression; /* receive side of compressed frames */
+#endif
     DltClient client;           /* DltClient structure */
+    DltClientConnectState connect_state; /* addresses while status is DLT_GATEWAY_CONNECTING */
     int default_log_level;      /* Default Log Level on passive node */
 } DltGatewayConnection;
 
@@ -166,6 +180,7 @@ typedef enum {
     GW_CONF_SEND_CONTROL,
     GW_CONF_SEND_PERIODIC_CONTROL,
     GW_CONF_SEND_SERIAL_HEADER,
+    GW_CONF_COMPRESSION,
     GW_CONF_COUNT
 } DltGatewayConfType;
 
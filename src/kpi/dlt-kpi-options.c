@@ -104,6 +104,7 @@ void dlt_kpi_init_configuration(DltKpiConfig *config)
 {
     config->process_log_interval = 1000;
     config->irq_log_interval = 1000;
+    config->process_events = 1;
     config->log_level = DLT_LOG_DEFAULT;
 }
 
@@ -195,6 +196,15 @@ DltReturnValue dlt_kpi_read_configuration_file(DltKpiConfig *config, char *file_
                 else
                     fprintf(stderr, "Error reading configuration file: %s is not a valid value for %s\n", value, token);
             }
+            else if (strcmp(token, "process_events") == '\0')
+            {
+                tmp = strtol(value, &strchk, 10);
+
+                if ((strchk[0] == '\0') && (tmp >= 0) && (tmp <= 1))
+                    config->process_events = tmp;
+                else
+                    fprintf(stderr, "Error reading configuration file: %s is not a valid value for %s\n", value, token);
+            }
             else if (strcmp(token, "log_level") == '\0')
             {
                 tmp = strtol(value, &strchk, 10);
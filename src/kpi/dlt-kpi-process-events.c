@@ -0,0 +1,163 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt-kpi-process-events.c
+ */
+
+#include "dlt-kpi-process-events.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/connector.h>
+#include <linux/cn_proc.h>
+
+static DltReturnValue dlt_kpi_send_process_events_op(int fd, enum proc_cn_mcast_op op)
+{
+    char buffer[NLMSG_SPACE(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op))]
+    __attribute__((aligned(NLMSG_ALIGNTO)));
+    struct nlmsghdr *header = (struct nlmsghdr *)buffer;
+    struct cn_msg *message = (struct cn_msg *)NLMSG_DATA(header);
+
+    memset(buffer, 0, sizeof(buffer));
+    header->nlmsg_len = NLMSG_LENGTH(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op));
+    header->nlmsg_type = NLMSG_DONE;
+    header->nlmsg_pid = (__u32)getpid();
+    message->id.idx = CN_IDX_PROC;
+    message->id.val = CN_VAL_PROC;
+    message->len = sizeof(enum proc_cn_mcast_op);
+    memcpy(message->data, &op, sizeof(op));
+
+    if (send(fd, header, header->nlmsg_len, 0) < 0)
+        return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
+int dlt_kpi_open_process_events()
+{
+    struct sockaddr_nl address;
+    int fd = socket(PF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+
+    if (fd < 0) {
+        fprintf(stderr, "%s: Proc connector not available: %s\n", __func__, strerror(errno));
+        return -1;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = CN_IDX_PROC;
+    address.nl_pid = (__u32)getpid();
+
+    if ((bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0) ||
+        (dlt_kpi_send_process_events_op(fd, PROC_CN_MCAST_LISTEN) < DLT_RETURN_OK)) {
+        fprintf(stderr, "%s: Could not subscribe to process events: %s\n", __func__, strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+DltReturnValue dlt_kpi_read_process_event(int fd, DltKpiProcessEvent *event)
+{
+    char buffer[BUFFER_SIZE] __attribute__((aligned(NLMSG_ALIGNTO)));
+    struct nlmsghdr *header;
+    struct cn_msg *message;
+    struct proc_event *proc_event;
+    ssize_t length;
+
+    if ((fd < 0) || (event == NULL)) {
+        fprintf(stderr, "%s: Invalid Parameter\n", __func__);
+        return DLT_RETURN_WRONG_PARAMETER;
+    }
+
+    while (1) {
+        length = recv(fd, buffer, sizeof(buffer), 0);
+
+        if (length < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                return DLT_RETURN_OK;
+
+            if (errno == EINTR)
+                continue;
+
+            if (errno == ENOBUFS) {
+                /* the socket buffer overflowed, events are missing */
+                event->type = DLT_KPI_PROCESS_EVENT_LOST;
+                event->pid = event->ppid = 0;
+                return DLT_RETURN_TRUE;
+            }
+
+            fprintf(stderr, "%s: Could not read process event: %s\n", __func__, strerror(errno));
+            return DLT_RETURN_ERROR;
+        }
+
+        header = (struct nlmsghdr *)buffer;
+
+        if (!NLMSG_OK(header, (unsigned int)length) || (header->nlmsg_type != NLMSG_DONE) ||
+            (header->nlmsg_len < NLMSG_LENGTH(sizeof(struct cn_msg) + sizeof(struct proc_event))))
+            continue;
+
+        message = (struct cn_msg *)NLMSG_DATA(header);
+
+        if ((message->id.idx != CN_IDX_PROC) || (message->id.val != CN_VAL_PROC))
+            continue;
+
+        proc_event = (struct proc_event *)message->data;
+
+        switch (proc_event->what) {
+        case PROC_EVENT_FORK:
+
+            if (proc_event->event_data.fork.child_pid != proc_event->event_data.fork.child_tgid)
+                continue; /* new thread */
+
+            event->type = DLT_KPI_PROCESS_EVENT_FORK;
+            event->pid = proc_event->event_data.fork.child_tgid;
+            event->ppid = proc_event->event_data.fork.parent_tgid;
+            return DLT_RETURN_TRUE;
+        case PROC_EVENT_EXEC:
+            event->type = DLT_KPI_PROCESS_EVENT_EXEC;
+            event->pid = proc_event->event_data.exec.process_tgid;
+            event->ppid = 0;
+            return DLT_RETURN_TRUE;
+        case PROC_EVENT_EXIT:
+
+            if (proc_event->event_data.exit.process_pid != proc_event->event_data.exit.process_tgid)
+                continue; /* ended thread */
+
+            event->type = DLT_KPI_PROCESS_EVENT_EXIT;
+            event->pid = proc_event->event_data.exit.process_tgid;
+            event->ppid = 0;
+            return DLT_RETURN_TRUE;
+        default:
+            continue;
+        }
+    }
+}
+
+void dlt_kpi_close_process_events(int fd)
+{
+    if (fd < 0)
+        return;
+
+    dlt_kpi_send_process_events_op(fd, PROC_CN_MCAST_IGNORE);
+    close(fd);
+}
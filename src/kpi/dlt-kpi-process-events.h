@@ -0,0 +1,67 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt-kpi-process-events.h
+ */
+
+#ifndef SRC_KPI_DLT_KPI_PROCESS_EVENTS_H_
+#define SRC_KPI_DLT_KPI_PROCESS_EVENTS_H_
+
+#include "dlt.h"
+#include <sys/types.h>
+#include "dlt-kpi-common.h"
+
+typedef enum
+{
+    DLT_KPI_PROCESS_EVENT_NONE = 0,
+    DLT_KPI_PROCESS_EVENT_FORK,     /* a new process was created */
+    DLT_KPI_PROCESS_EVENT_EXEC,     /* a process started a new program */
+    DLT_KPI_PROCESS_EVENT_EXIT,     /* a process has ended */
+    DLT_KPI_PROCESS_EVENT_LOST      /* events were dropped by the kernel */
+} DltKpiProcessEventType;
+
+typedef struct
+{
+    DltKpiProcessEventType type;
+    pid_t pid, ppid;
+} DltKpiProcessEvent;
+
+/**
+ * Subscribe to the process events of the Linux proc connector.
+ * Needs the CAP_NET_ADMIN capability.
+ * @return non-blocking socket to read the events from, -1 if not available
+ */
+int dlt_kpi_open_process_events();
+
+/**
+ * Read the next process event. Events of threads are skipped.
+ * @param fd socket returned by dlt_kpi_open_process_events()
+ * @param event set to the event
+ * @return DLT_RETURN_TRUE if an event was read, DLT_RETURN_OK if there is no
+ * pending event, negative value if there was an error
+ */
+DltReturnValue dlt_kpi_read_process_event(int fd, DltKpiProcessEvent *event);
+
+/**
+ * Unsubscribe from the process events and close the socket.
+ * @param fd socket returned by dlt_kpi_open_process_events()
+ */
+void dlt_kpi_close_process_events(int fd);
+
+#endif /* SRC_KPI_DLT_KPI_PROCESS_EVENTS_H_ */
@@ -24,6 +24,35 @@
 
 #include "dlt-kpi-process-list.h"
 
+static unsigned int dlt_kpi_hash_pid(pid_t pid)
+{
+    return (unsigned int)pid & (DLT_KPI_PROCESS_HASH_SIZE - 1);
+}
+
+static void dlt_kpi_hash_process(DltKpiProcessList *list, DltKpiProcess *process)
+{
+    unsigned int bucket = dlt_kpi_hash_pid(process->pid);
+
+    process->hash_next = list->hash[bucket];
+    list->hash[bucket] = process;
+}
+
+static void dlt_kpi_unhash_process(DltKpiProcessList *list, DltKpiProcess *process)
+{
+    DltKpiProcess **entry = &list->hash[dlt_kpi_hash_pid(process->pid)];
+
+    while (*entry != NULL) {
+        if (*entry == process) {
+            *entry = process->hash_next;
+            break;
+        }
+
+        entry = &(*entry)->hash_next;
+    }
+
+    process->hash_next = NULL;
+}
+
 DltKpiProcessList *dlt_kpi_create_process_list()
 {
     DltKpiProcessList *new_list = malloc(sizeof(DltKpiProcessList));
@@ -81,6 +110,21 @@ DltKpiProcess *dlt_kpi_get_process_at_cursor(DltKpiProcessList *list)
     return list->cursor;
 }
 
+DltKpiProcess *dlt_kpi_find_process(DltKpiProcessList *list, pid_t pid)
+{
+    if (list == NULL) {
+        fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
+        return NULL;
+    }
+
+    DltKpiProcess *process = list->hash[dlt_kpi_hash_pid(pid)];
+
+    while ((process != NULL) && (process->pid != pid))
+        process = process->hash_next;
+
+    return process;
+}
+
 DltReturnValue dlt_kpi_reset_cursor(DltKpiProcessList *list)
 {
     if (list == NULL) {
@@ -151,7 +195,9 @@ DltReturnValue dlt_kpi_add_process_at_start(DltKpiProcessList *list, DltKpiProce
         list->start->prev = process;
 
     process->next = list->start;
+    process->prev = NULL;
     list->start = process;
+    dlt_kpi_hash_process(list, process);
 
     return DLT_RETURN_OK;
 }
@@ -184,6 +230,7 @@ DltReturnValue dlt_kpi_add_process_before_cursor(DltKpiProcessList *list, DltKpi
     process->next = list->cursor;
     process->prev = list->cursor->prev;
     list->cursor->prev = process;
+    dlt_kpi_hash_process(list, process);
 
     return DLT_RETURN_OK;
 }
@@ -204,6 +251,7 @@ DltReturnValue dlt_kpi_add_process_after_cursor(DltKpiProcessList *list, DltKpiP
     process->next = list->cursor->next;
     process->prev = list->cursor;
     list->cursor->next = process;
+    dlt_kpi_hash_process(list, process);
 
     return DLT_RETURN_OK;
 }
@@ -242,6 +290,8 @@ DltReturnValue dlt_kpi_remove_process_at_cursor_soft(DltKpiProcessList *list)
     }
 
     list->cursor = tmp->next; /* becomes NULL if list is at end */
+    tmp->next = tmp->prev = NULL;
+    dlt_kpi_unhash_process(list, tmp);
 
     return DLT_RETURN_OK;
 }
@@ -28,15 +28,20 @@
 #include "dlt-kpi-process.h"
 #include "dlt-kpi-common.h"
 
+/* number of hash buckets of a process list, must be a power of two */
+#define DLT_KPI_PROCESS_HASH_SIZE 1024
+
 typedef struct
 {
     struct DltKpiProcess *start, *cursor;
+    struct DltKpiProcess *hash[DLT_KPI_PROCESS_HASH_SIZE]; /* processes by PID, chained by hash_next */
 } DltKpiProcessList;
 
 DltKpiProcessList *dlt_kpi_create_process_list();
 DltReturnValue dlt_kpi_free_process_list_soft(DltKpiProcessList *list);
 DltReturnValue dlt_kpi_free_process_list(DltKpiProcessList *list);
 DltKpiProcess *dlt_kpi_get_process_at_cursor(DltKpiProcessList *list);
+DltKpiProcess *dlt_kpi_find_process(DltKpiProcessList *list, pid_t pid);
 DltReturnValue dlt_kpi_increment_cursor(DltKpiProcessList *list);
 DltReturnValue dlt_kpi_decrement_cursor(DltKpiProcessList *list);
 DltReturnValue dlt_kpi_reset_cursor(DltKpiProcessList *list);
@@ -24,22 +24,220 @@
 
 #include "dlt-kpi-process.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <pthread.h>
 #include <unistd.h>
+#include <sys/resource.h>
+
+/* file descriptors left for everything else when files in /proc are kept open */
+#define DLT_KPI_RESERVED_FILES 64
+
+/* marks a file of a process which can not be read, e.g. /proc/<pid>/io of a foreign process */
+#define DLT_KPI_FILE_UNREADABLE -2
+
+/* values of /proc/<pid>/stat used by dlt-kpi */
+typedef struct
+{
+    pid_t ppid;                         /* field 4 */
+    unsigned long int utime, stime;     /* fields 14 and 15 */
+    long int rss;                       /* field 24 */
+    unsigned long int blkio_ticks;      /* field 42 */
+} DltKpiProcessStat;
+
+static int dlt_kpi_open_files = 0;
+static int dlt_kpi_max_open_files = -1;
 
 DltReturnValue dlt_kpi_read_process_file_to_str(pid_t pid, char **target_str, char *subdir);
-unsigned long int dlt_kpi_read_process_stat_to_ulong(pid_t pid, unsigned int index);
 DltReturnValue dlt_kpi_read_process_stat_cmdline(pid_t pid, char **buffer);
 
-DltReturnValue dlt_kpi_process_update_io_wait(DltKpiProcess *process, unsigned long int time_dif_ms)
+static int dlt_kpi_get_max_open_files()
+{
+    struct rlimit limit;
+
+    if (dlt_kpi_max_open_files >= 0)
+        return dlt_kpi_max_open_files;
+
+    dlt_kpi_max_open_files = 0;
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) < 0)
+        return dlt_kpi_max_open_files;
+
+    /* three files are kept open per process, so use as many descriptors as allowed */
+    if (limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+
+        if (setrlimit(RLIMIT_NOFILE, &limit) < 0)
+            getrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    if (limit.rlim_cur > INT_MAX)
+        limit.rlim_cur = INT_MAX;
+
+    if (limit.rlim_cur > DLT_KPI_RESERVED_FILES)
+        dlt_kpi_max_open_files = (int)limit.rlim_cur - DLT_KPI_RESERVED_FILES;
+
+    return dlt_kpi_max_open_files;
+}
+
+/*
+ * Read a file in /proc/<pid>/ into buffer. The file is kept open in *fd and
+ * read again with pread() in the next cycle, unless too many files are open
+ * already. Fails if the process has ended.
+ */
+static DltReturnValue dlt_kpi_read_process_file(DltKpiProcess *process,
+                                                int *fd,
+                                                char *name,
+                                                char *buffer,
+                                                size_t size)
+{
+    char filename[64];
+    int file = *fd;
+    ssize_t length;
+
+    if (file == DLT_KPI_FILE_UNREADABLE)
+        return DLT_RETURN_ERROR;
+
+    if (file < 0) {
+        snprintf(filename, sizeof(filename), "/proc/%d/%s", process->pid, name);
+        file = open(filename, O_RDONLY | O_CLOEXEC);
+
+        if (file < 0)
+            return DLT_RETURN_ERROR;
+
+        if (dlt_kpi_open_files < dlt_kpi_get_max_open_files()) {
+            *fd = file;
+            dlt_kpi_open_files++;
+        }
+    }
+
+    length = pread(file, buffer, size - 1, 0);
+
+    if ((length < 0) && ((errno == EACCES) || (errno == EPERM)) && (file == *fd)) {
+        /* access is checked on read, it will not be granted later on */
+        close(file);
+        dlt_kpi_open_files--;
+        *fd = DLT_KPI_FILE_UNREADABLE;
+        return DLT_RETURN_ERROR;
+    }
+
+    if (file != *fd)
+        close(file);
+
+    if (length <= 0)
+        return DLT_RETURN_ERROR;
+
+    buffer[length] = '\0';
+
+    return DLT_RETURN_OK;
+}
+
+static void dlt_kpi_close_process_file(int *fd)
+{
+    if (*fd >= 0) {
+        close(*fd);
+        dlt_kpi_open_files--;
+    }
+
+    *fd = -1;
+}
+
+static DltReturnValue dlt_kpi_parse_process_stat(char *buffer, DltKpiProcessStat *stat)
+{
+    char *tok, *end;
+    unsigned int index;
+    unsigned long int value;
+
+    memset(stat, 0, sizeof(DltKpiProcessStat));
+
+    /* the command name in field 2 may contain blanks and parentheses, count the fields from its end */
+    tok = strrchr(buffer, ')');
+
+    if (tok == NULL)
+        return DLT_RETURN_ERROR;
+
+    tok = strchr(tok + 2, ' '); /* skip the state in field 3 */
+
+    if (tok == NULL)
+        return DLT_RETURN_ERROR;
+
+    for (index = 4; index <= 42; index++) {
+        value = strtoul(tok, &end, 10);
+
+        if (end == tok)
+            break; /* older kernels have less fields */
+
+        switch (index) {
+        case 4:
+            stat->ppid = (pid_t)value;
+            break;
+        case 14:
+            stat->utime = value;
+            break;
+        case 15:
+            stat->stime = value;
+            break;
+        case 24:
+            stat->rss = (long int)value;
+            break;
+        case 42:
+            stat->blkio_ticks = value;
+            break;
+        default:
+            break;
+        }
+
+        tok = end;
+    }
+
+    return (index > 24) ? DLT_RETURN_OK : DLT_RETURN_ERROR;
+}
+
+/* sum up the values of all lines starting with one of the keys */
+static DltReturnValue dlt_kpi_parse_process_values(char *buffer, char *key1, char *key2, unsigned long int *sum)
+{
+    char *line = buffer;
+    char *value;
+    size_t length1 = strlen(key1);
+    size_t length2 = strlen(key2);
+
+    *sum = 0;
+
+    while (line != NULL) {
+        value = NULL;
+
+        if (strncmp(line, key1, length1) == 0)
+            value = line + length1;
+        else if (strncmp(line, key2, length2) == 0)
+            value = line + length2;
+
+        if (value != NULL) {
+            char *chk;
+            *sum += strtoul(value, &chk, 10);
+
+            if ((chk == value) || ((*chk != '\n') && (*chk != '\0')))
+                return DLT_RETURN_ERROR;
+        }
+
+        line = strchr(line, '\n');
+
+        if (line != NULL)
+            line++;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_kpi_process_update_io_wait(DltKpiProcess *process,
+                                              unsigned long int total_io_wait,
+                                              unsigned long int time_dif_ms)
 {
     if (process == NULL) {
         fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    unsigned long int total_io_wait = dlt_kpi_read_process_stat_to_ulong(process->pid, 42);
-
     int cpu_count = dlt_kpi_get_cpu_count();
 
     process->io_wait = (total_io_wait - process->last_io_wait) * 1000 / sysconf(_SC_CLK_TCK); /* busy milliseconds since last update */
@@ -52,18 +250,15 @@ DltReturnValue dlt_kpi_process_update_io_wait(DltKpiProcess *process, unsigned l
     return DLT_RETURN_OK;
 }
 
-DltReturnValue dlt_kpi_process_update_cpu_time(DltKpiProcess *process, unsigned long int time_dif_ms)
+DltReturnValue dlt_kpi_process_update_cpu_time(DltKpiProcess *process,
+                                               unsigned long int total_cpu_time,
+                                               unsigned long int time_dif_ms)
 {
     if (process == NULL) {
         fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    unsigned long int utime = dlt_kpi_read_process_stat_to_ulong(process->pid, 14);
-    unsigned long int stime = dlt_kpi_read_process_stat_to_ulong(process->pid, 15);
-
-    unsigned long total_cpu_time = utime + stime;
-
     if ((process->last_cpu_time > 0) && (process->last_cpu_time <= total_cpu_time)) {
         int cpu_count = dlt_kpi_get_cpu_count();
 
@@ -82,18 +277,6 @@ DltReturnValue dlt_kpi_process_update_cpu_time(DltKpiProcess *process, unsigned
     return DLT_RETURN_OK;
 }
 
-DltReturnValue dlt_kpi_process_update_rss(DltKpiProcess *process)
-{
-    if (process == NULL) {
-        fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
-        return DLT_RETURN_WRONG_PARAMETER;
-    }
-
-    process->rss = dlt_kpi_read_process_stat_to_ulong(process->pid, 24);
-
-    return DLT_RETURN_OK;
-}
-
 DltReturnValue dlt_kpi_process_update_ctx_switches(DltKpiProcess *process)
 {
     if (process == NULL) {
@@ -101,38 +284,20 @@ DltReturnValue dlt_kpi_process_update_ctx_switches(DltKpiProcess *process)
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    char *buffer, *tok, *last_tok;
-    char *delim = " :\t\n";
-    last_tok = NULL;
-
+    char buffer[BUFFER_SIZE];
+    unsigned long int ctx_switches;
     DltReturnValue ret;
 
-    if ((ret = dlt_kpi_read_process_file_to_str(process->pid, &buffer, "status")) < DLT_RETURN_OK) return ret;
-
-    process->ctx_switches = 0;
-
-    tok = strtok(buffer, delim);
-
-    while (tok != NULL) {
-        if (last_tok != NULL) {
-            if ((strcmp(last_tok,
-                        "voluntary_ctxt_switches") == 0) || (strcmp(last_tok, "nonvoluntary_ctxt_switches") == 0)) {
-                char *chk;
-                process->ctx_switches += strtol(tok, &chk, 10);
-
-                if (*chk != '\0') {
-                    fprintf(stderr, "Could not parse ctx_switches info from /proc/%d/status", process->pid);
-                    free(buffer);
-                    return DLT_RETURN_ERROR;
-                }
-            }
-        }
+    if ((ret = dlt_kpi_read_process_file(process, &process->status_fd, "status", buffer, sizeof(buffer))) < DLT_RETURN_OK)
+        return ret;
 
-        last_tok = tok;
-        tok = strtok(NULL, delim);
+    if (dlt_kpi_parse_process_values(buffer, "voluntary_ctxt_switches:", "nonvoluntary_ctxt_switches:",
+                                     &ctx_switches) < DLT_RETURN_OK) {
+        fprintf(stderr, "Could not parse ctx_switches info from /proc/%d/status", process->pid);
+        return DLT_RETURN_ERROR;
     }
 
-    free(buffer);
+    process->ctx_switches = (long int)ctx_switches;
 
     return DLT_RETURN_OK;
 }
@@ -144,42 +309,25 @@ DltReturnValue dlt_kpi_process_update_io_bytes(DltKpiProcess *process)
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    char *buffer, *tok, *last_tok;
-    char *delim = " :\t\n";
-    last_tok = NULL;
-
+    char buffer[BUFFER_SIZE];
     DltReturnValue ret;
 
-    if ((ret = dlt_kpi_read_process_file_to_str(process->pid, &buffer, "io")) < DLT_RETURN_OK)
+    if ((ret = dlt_kpi_read_process_file(process, &process->io_fd, "io", buffer, sizeof(buffer))) < DLT_RETURN_OK)
         return ret;
 
-    process->io_bytes = 0;
-
-    tok = strtok(buffer, delim);
-
-    while (tok != NULL) {
-        if (last_tok != NULL) {
-            if ((strcmp(last_tok, "rchar") == 0) || (strcmp(last_tok, "wchar") == 0)) {
-                char *chk;
-                process->io_bytes += strtoul(tok, &chk, 10);
-
-                if (*chk != '\0') {
-                    fprintf(stderr, "Could not parse io_bytes info from /proc/%d/io", process->pid);
-                    free(buffer);
-                    return DLT_RETURN_ERROR;
-                }
-            }
-        }
-
-        last_tok = tok;
-        tok = strtok(NULL, delim);
+    if (dlt_kpi_parse_process_values(buffer, "rchar:", "wchar:", &process->io_bytes) < DLT_RETURN_OK) {
+        fprintf(stderr, "Could not parse io_bytes info from /proc/%d/io", process->pid);
+        return DLT_RETURN_ERROR;
     }
 
-    free(buffer);
-
     return DLT_RETURN_OK;
 }
 
+/*
+ * Read the current values of a process. /proc/<pid>/stat is read and parsed
+ * only once for all values taken from it. Returns an error if the process
+ * has ended, which also applies if its PID was reused meanwhile.
+ */
 DltReturnValue dlt_kpi_update_process(DltKpiProcess *process, unsigned long int time_dif_ms)
 {
 
@@ -188,15 +336,50 @@ DltReturnValue dlt_kpi_update_process(DltKpiProcess *process, unsigned long int
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    dlt_kpi_process_update_io_wait(process, time_dif_ms);
-    dlt_kpi_process_update_cpu_time(process, time_dif_ms);
-    dlt_kpi_process_update_rss(process);
+    char buffer[BUFFER_SIZE];
+    DltKpiProcessStat stat;
+
+    if ((dlt_kpi_read_process_file(process, &process->stat_fd, "stat", buffer, sizeof(buffer)) < DLT_RETURN_OK) ||
+        (dlt_kpi_parse_process_stat(buffer, &stat) < DLT_RETURN_OK))
+        return DLT_RETURN_ERROR;
+
+    process->ppid = stat.ppid;
+    process->rss = stat.rss;
+    dlt_kpi_process_update_io_wait(process, stat.blkio_ticks, time_dif_ms);
+    dlt_kpi_process_update_cpu_time(process, stat.utime + stat.stime, time_dif_ms);
     dlt_kpi_process_update_ctx_switches(process);
     dlt_kpi_process_update_io_bytes(process);
 
     return DLT_RETURN_OK;
 }
 
+DltReturnValue dlt_kpi_update_process_command_line(DltKpiProcess *process)
+{
+    if (process == NULL) {
+        fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
+        return DLT_RETURN_WRONG_PARAMETER;
+    }
+
+    char *command_line = NULL;
+
+    dlt_kpi_read_process_file_to_str(process->pid, &command_line, "cmdline");
+
+    if (command_line != NULL)
+        if (strlen(command_line) == 0) {
+            free(command_line);
+            command_line = NULL;
+            dlt_kpi_read_process_stat_cmdline(process->pid, &command_line);
+        }
+
+    if (command_line == NULL)
+        return DLT_RETURN_ERROR; /* keep the old one */
+
+    free(process->command_line);
+    process->command_line = command_line;
+
+    return DLT_RETURN_OK;
+}
+
 DltKpiProcess *dlt_kpi_create_process(int pid)
 {
     DltKpiProcess *new_process = malloc(sizeof(DltKpiProcess));
@@ -209,16 +392,9 @@ DltKpiProcess *dlt_kpi_create_process(int pid)
     memset(new_process, 0, sizeof(DltKpiProcess));
 
     new_process->pid = pid;
-    new_process->ppid = (pid_t)dlt_kpi_read_process_stat_to_ulong(pid, 4);
-
-    dlt_kpi_read_process_file_to_str(pid, &(new_process->command_line), "cmdline");
-
-    if (new_process->command_line != NULL)
-        if (strlen(new_process->command_line) == 0) {
-            free(new_process->command_line);
-            dlt_kpi_read_process_stat_cmdline(pid, &(new_process->command_line));
-        }
+    new_process->stat_fd = new_process->status_fd = new_process->io_fd = -1;
 
+    dlt_kpi_update_process_command_line(new_process);
     dlt_kpi_update_process(new_process, 0);
 
     return new_process;
@@ -256,7 +432,9 @@ DltKpiProcess *dlt_kpi_clone_process(DltKpiProcess *original)
         new_process->command_line = NULL;
     }
 
-    new_process->next = new_process->prev = NULL;
+    /* the files stay with the original */
+    new_process->stat_fd = new_process->status_fd = new_process->io_fd = -1;
+    new_process->next = new_process->prev = new_process->hash_next = NULL;
 
     return new_process;
 }
@@ -271,6 +449,10 @@ DltReturnValue dlt_kpi_free_process(DltKpiProcess *process)
     if (process->command_line != NULL)
         free(process->command_line);
 
+    dlt_kpi_close_process_file(&process->stat_fd);
+    dlt_kpi_close_process_file(&process->status_fd);
+    dlt_kpi_close_process_file(&process->io_fd);
+
     free(process);
 
     return DLT_RETURN_OK;
@@ -320,57 +502,6 @@ DltReturnValue dlt_kpi_read_process_file_to_str(pid_t pid, char **target_str, ch
     return dlt_kpi_read_file_compact(filename, target_str);
 }
 
-unsigned long int dlt_kpi_read_process_stat_to_ulong(pid_t pid, unsigned int index)
-{
-    if (pid <= 0) {
-        fprintf(stderr, "%s: Invalid Parameter (NULL)\n", __func__);
-        return 0;
-    }
-
-    char *buffer = NULL;
-
-    if (dlt_kpi_read_process_file_to_str(pid, &buffer, "stat") < DLT_RETURN_OK) {
-        /* fprintf(stderr, "dlt_kpi_read_process_stat_to_ulong(): Error while reading process stat file. Pid: %d. Requested index: %u\n", pid, index); // can happen if process closed shortly before */
-
-        if (buffer != NULL)
-            free(buffer);
-
-        return 0;
-    }
-
-    char *tok = strtok(buffer, " \t\n");
-    unsigned int i = 1, found = 0;
-
-    while (tok != NULL) {
-        if (i == index) {
-            found = 1;
-            break;
-        }
-
-        i++;
-        tok = strtok(NULL, " \t\n");
-    }
-
-    unsigned long int ret = 0;
-
-    if (found) {
-        char *check = NULL;
-        ret = strtoul(tok, &check, 10);
-
-        if (*check != '\0') {
-            fprintf(stderr, "dlt_kpi_read_process_stat_to_ulong(): Could not extract token\n");
-            ret = 0;
-        }
-    }
-    else {
-        fprintf(stderr, "dlt_kpi_read_process_stat_to_ulong(): Index not found\n");
-    }
-
-    free(buffer);
-
-    return ret;
-}
-
 DltReturnValue dlt_kpi_read_process_stat_cmdline(pid_t pid, char **buffer)
 {
     if (pid <= 0) {
@@ -38,7 +38,10 @@ typedef struct DltKpiProcess
     unsigned long int cpu_time, last_cpu_time, io_wait, last_io_wait, io_bytes;
     long int rss, ctx_switches;
 
-    struct DltKpiProcess *next, *prev;
+    int stat_fd, status_fd, io_fd; /* open files in /proc/<pid>/, read again with pread() every cycle */
+    unsigned int generation; /* update cycle in which the process was seen last */
+
+    struct DltKpiProcess *next, *prev, *hash_next;
 } DltKpiProcess;
 
 DltKpiProcess *dlt_kpi_create_process();
@@ -46,6 +49,7 @@ DltKpiProcess *dlt_kpi_clone_process(DltKpiProcess *original);
 DltReturnValue dlt_kpi_free_process(DltKpiProcess *process);
 DltReturnValue dlt_kpi_print_process(DltKpiProcess *process);
 DltReturnValue dlt_kpi_update_process(DltKpiProcess *process, unsigned long int time_dif_ms);
+DltReturnValue dlt_kpi_update_process_command_line(DltKpiProcess *process);
 DltReturnValue dlt_kpi_get_msg_process_new(DltKpiProcess *process, char *buffer, int maxlen);
 DltReturnValue dlt_kpi_get_msg_process_stop(DltKpiProcess *process, char *buffer, int maxlen);
 DltReturnValue dlt_kpi_get_msg_process_update(DltKpiProcess *process, char *buffer, int maxlen);
@@ -26,9 +26,11 @@
 
 #include <signal.h>
 #include <dirent.h>
+#include <limits.h>
 #include <time.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <poll.h>
 
 DLT_DECLARE_CONTEXT(kpi_ctx)
 
@@ -39,6 +41,11 @@ static DltKpiProcessList *list, *new_process_list, *stopped_process_list, *updat
 static struct timespec _tmp_time;
 static pthread_mutex_t process_list_mutex;
 
+/* processes reported by the proc connector, logged by the event thread */
+static DltKpiProcessList *event_new_process_list, *event_stopped_process_list;
+static int process_events_fd = -1;
+static int process_events_lost = 0;
+
 void dlt_kpi_stop_loops(int sig);
 void dlt_kpi_init_sigterm_handler();
 DltReturnValue dlt_kpi_init_process_lists();
@@ -51,6 +58,8 @@ DltReturnValue dlt_kpi_irq_loop();
 void *dlt_kpi_start_check_thread();
 DltReturnValue dlt_kpi_check_loop();
 DltReturnValue dlt_kpi_log_check_commandlines();
+void *dlt_kpi_start_event_thread();
+DltReturnValue dlt_kpi_event_loop();
 
 unsigned long int timespec_to_millis(struct timespec *time)
 {
@@ -90,6 +99,17 @@ int main(int argc, char **argv)
     pthread_t process_thread;
     pthread_t irq_thread;
     pthread_t check_thread;
+    pthread_t event_thread;
+
+    /* without the proc connector, new and stopped processes are found by scanning /proc */
+    if (config.process_events)
+        process_events_fd = dlt_kpi_open_process_events();
+
+    if ((process_events_fd >= 0) &&
+        (pthread_create(&event_thread, NULL, &dlt_kpi_start_event_thread, NULL) != 0)) {
+        fprintf(stderr, "Could not create thread\n");
+        return -1;
+    }
 
     if (pthread_create(&process_thread, NULL, &dlt_kpi_start_process_thread, NULL) != 0) {
         fprintf(stderr, "Could not create thread\n");
@@ -110,6 +130,11 @@ int main(int argc, char **argv)
     pthread_join(irq_thread, NULL);
     pthread_join(check_thread, NULL);
 
+    if (process_events_fd >= 0) {
+        pthread_join(event_thread, NULL);
+        dlt_kpi_close_process_events(process_events_fd);
+    }
+
     DLT_UNREGISTER_CONTEXT(kpi_ctx);
     DLT_UNREGISTER_APP();
 
@@ -151,6 +176,10 @@ DltReturnValue dlt_kpi_init_process_lists()
 
     if ((update_process_list = dlt_kpi_create_process_list()) == NULL) return DLT_RETURN_ERROR;
 
+    if ((event_new_process_list = dlt_kpi_create_process_list()) == NULL) return DLT_RETURN_ERROR;
+
+    if ((event_stopped_process_list = dlt_kpi_create_process_list()) == NULL) return DLT_RETURN_ERROR;
+
     return DLT_RETURN_OK;
 }
 
@@ -170,6 +199,12 @@ DltReturnValue dlt_kpi_free_process_lists()
     if (dlt_kpi_free_process_list(update_process_list) < DLT_RETURN_OK)
         ret = DLT_RETURN_ERROR;
 
+    if (dlt_kpi_free_process_list(event_new_process_list) < DLT_RETURN_OK)
+        ret = DLT_RETURN_ERROR;
+
+    if (dlt_kpi_free_process_list(event_stopped_process_list) < DLT_RETURN_OK)
+        ret = DLT_RETURN_ERROR;
+
     return ret;
 }
 
@@ -286,109 +321,115 @@ DltReturnValue dlt_kpi_log_list(DltKpiProcessList *list,
     return DLT_RETURN_OK;
 }
 
+/* Update a known process and remember it for the ACT message. Fails if the process has ended. */
+DltReturnValue dlt_kpi_update_staying_process(DltKpiProcess *process, unsigned long int time_dif_ms)
+{
+    DltReturnValue ret;
+
+    if ((ret = dlt_kpi_update_process(process, time_dif_ms)) < DLT_RETURN_OK)
+        return ret;
+
+    if (process->cpu_time > 0) /* only log active processes */
+        if (dlt_kpi_add_process_after_cursor(update_process_list, dlt_kpi_clone_process(process)) < DLT_RETURN_OK)
+            fprintf(stderr, "dlt_kpi_update_process_list: Can't add process to list updateProcessList\n");
+
+    return DLT_RETURN_OK;
+}
+
 DltReturnValue dlt_kpi_update_process_list(DltKpiProcessList *list, unsigned long int time_dif_ms)
 {
     static char *strchk;
     static DltReturnValue tmp_ret;
     static struct dirent *current_dir;
     static pid_t current_dir_pid;
+    static long current_dir_value;
+    static unsigned int generation;
+    DIR *proc_dir = NULL;
 
     if (list == NULL) {
         fprintf(stderr, "dlt_kpi_update_process_list(): Nullpointer parameter");
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
-    DIR *proc_dir = opendir("/proc");
+    generation++;
 
-    if (proc_dir == NULL) {
-        dlt_log(LOG_ERR, "Could not open /proc/ !\n");
+    if (pthread_mutex_lock(&process_list_mutex) < 0) {
+        fprintf(stderr, "Can't lock mutex\n");
         return DLT_RETURN_ERROR;
     }
 
-    current_dir = readdir(proc_dir);
-    dlt_kpi_reset_cursor(list);
+    if ((process_events_fd >= 0) && !process_events_lost) {
+        /* new processes are added by the event thread, only the known ones are updated */
+        DltKpiProcess *process;
 
-    int debug_process_count = 0;
+        for (process = list->start; process != NULL; process = process->next)
+            if (dlt_kpi_update_staying_process(process, time_dif_ms) == DLT_RETURN_OK)
+                process->generation = generation;
+    }
+    else {
+        proc_dir = opendir("/proc");
 
-    if (pthread_mutex_lock(&process_list_mutex) < 0) {
-        fprintf(stderr, "Can't lock mutex\n");
-        return DLT_RETURN_ERROR;
+        if (proc_dir == NULL) {
+            pthread_mutex_unlock(&process_list_mutex);
+            dlt_log(LOG_ERR, "Could not open /proc/ !\n");
+            return DLT_RETURN_ERROR;
+        }
+
+        process_events_lost = 0;
     }
 
-    while (1) {
-        if (current_dir == NULL) {
-            /* no more active processes.. delete all remaining processes in the list */
-            if (list->cursor != NULL)
-                while (list->cursor != NULL) {
-                    if ((tmp_ret =
-                             dlt_kpi_add_process_after_cursor(stopped_process_list,
-                                                              dlt_kpi_clone_process(list->cursor))) < DLT_RETURN_OK)
-                        return tmp_ret;
+    while ((proc_dir != NULL) && ((current_dir = readdir(proc_dir)) != NULL)) {
+        current_dir_value = strtol(current_dir->d_name, &strchk, 10);
 
-                    dlt_kpi_remove_process_at_cursor(list);
-                }
+        if ((*strchk != '\0') || (current_dir_value <= 0) || (current_dir_value > INT_MAX))
+            continue; /* no valid PID */
 
-            break;
-        }
+        current_dir_pid = (pid_t)current_dir_value;
 
-        current_dir_pid = strtol(current_dir->d_name, &strchk, 10);
+        /* compare the /proc/-filesystem with our process-list */
+        DltKpiProcess *process = dlt_kpi_find_process(list, current_dir_pid);
 
-        if ((*strchk != '\0') || (current_dir_pid <= 0)) {
-            /* no valid PID */
-            current_dir = readdir(proc_dir); /* next process in proc-fs */
+        if ((process != NULL) && (dlt_kpi_update_staying_process(process, time_dif_ms) == DLT_RETURN_OK)) {
+            process->generation = generation;
             continue;
         }
 
-        /* compare the /proc/-filesystem with our process-list */
-        if ((list->cursor == NULL) || (current_dir_pid < list->cursor->pid)) { /* New Process */
-            DltKpiProcess *new_process = dlt_kpi_create_process(current_dir_pid);
+        /* New Process, or the PID was reused since the last cycle. The ended
+         * process is not marked as seen and is moved to the stopped ones below. */
+        DltKpiProcess *new_process = dlt_kpi_create_process(current_dir_pid);
 
-            if (new_process == NULL) {
-                fprintf(stderr, "Error: Could not create process (out of memory?)\n");
-                return DLT_RETURN_ERROR;
-            }
+        if (new_process == NULL) {
+            fprintf(stderr, "Error: Could not create process (out of memory?)\n");
+            return DLT_RETURN_ERROR;
+        }
 
-            if ((tmp_ret = dlt_kpi_add_process_before_cursor(list, new_process)) < DLT_RETURN_OK)
-                return tmp_ret;
+        new_process->generation = generation;
 
-            if ((tmp_ret =
-                     dlt_kpi_add_process_before_cursor(new_process_list,
-                                                       dlt_kpi_clone_process(new_process))) < DLT_RETURN_OK)
-                return tmp_ret;
+        if ((tmp_ret = dlt_kpi_add_process_at_start(list, new_process)) < DLT_RETURN_OK)
+            return tmp_ret;
 
-            current_dir = readdir(proc_dir); /* next process in proc-fs */
-            debug_process_count++;
-        }
-        else if (current_dir_pid > list->cursor->pid) /* Process ended */
-        {
-            if ((tmp_ret =
-                     dlt_kpi_add_process_after_cursor(stopped_process_list,
-                                                      dlt_kpi_clone_process(list->cursor))) < DLT_RETURN_OK)
-                return tmp_ret;
+        if ((tmp_ret =
+                 dlt_kpi_add_process_at_start(new_process_list,
+                                              dlt_kpi_clone_process(new_process))) < DLT_RETURN_OK)
+            return tmp_ret;
+    }
 
-            if ((tmp_ret = dlt_kpi_remove_process_at_cursor(list)) < DLT_RETURN_OK)
-                return tmp_ret;
-        }
-        else if (current_dir_pid == list->cursor->pid) /* Staying process */
-        {
-            /* update data */
-            if ((tmp_ret = dlt_kpi_update_process(list->cursor, time_dif_ms)) < DLT_RETURN_OK)
-                return tmp_ret;
-
-            if (list->cursor->cpu_time > 0) /* only log active processes */
-                if ((tmp_ret =
-                         dlt_kpi_add_process_after_cursor(update_process_list,
-                                                          dlt_kpi_clone_process(list->cursor))) < DLT_RETURN_OK) {
-                    fprintf(stderr, "dlt_kpi_update_process_list: Can't add process to list updateProcessList\n");
-                    return tmp_ret;
-                }
-
-            if ((tmp_ret = dlt_kpi_increment_cursor(list)) < DLT_RETURN_OK) /* next process in list */
-                return tmp_ret;
-
-            current_dir = readdir(proc_dir); /* next process in proc-fs */
-            debug_process_count++;
+    /* Processes not seen in this cycle have ended */
+    dlt_kpi_reset_cursor(list);
+
+    while (list->cursor != NULL) {
+        DltKpiProcess *process = list->cursor;
+
+        if (process->generation == generation) {
+            dlt_kpi_increment_cursor(list);
+            continue;
         }
+
+        if ((tmp_ret = dlt_kpi_remove_process_at_cursor_soft(list)) < DLT_RETURN_OK)
+            return tmp_ret;
+
+        if ((tmp_ret = dlt_kpi_add_process_at_start(stopped_process_list, process)) < DLT_RETURN_OK)
+            return tmp_ret;
     }
 
     if (pthread_mutex_unlock(&process_list_mutex) < 0) {
@@ -408,12 +449,119 @@ DltReturnValue dlt_kpi_update_process_list(DltKpiProcessList *list, unsigned lon
     if ((tmp_ret = dlt_kpi_log_list(update_process_list, &dlt_kpi_get_msg_process_update, "ACT", 1)) < DLT_RETURN_OK)
         return tmp_ret;
 
-    if (closedir(proc_dir) < 0)
+    if ((proc_dir != NULL) && (closedir(proc_dir) < 0))
         fprintf(stderr, "Could not close /proc/ directory\n");
 
     return DLT_RETURN_OK;
 }
 
+void *dlt_kpi_start_event_thread()
+{
+    if (dlt_kpi_event_loop() < DLT_RETURN_OK)
+        dlt_kpi_stop_loops(-1);
+
+    return NULL;
+}
+
+/* Apply a process event to the process list, called with process_list_mutex locked */
+DltReturnValue dlt_kpi_handle_process_event(DltKpiProcessEvent *event)
+{
+    DltKpiProcess *process = NULL;
+    DltKpiProcess *new_process;
+    DltReturnValue ret;
+
+    if (event->type == DLT_KPI_PROCESS_EVENT_LOST) {
+        /* find out what was missed with the next scan of /proc */
+        process_events_lost = 1;
+        return DLT_RETURN_OK;
+    }
+
+    process = dlt_kpi_find_process(list, event->pid);
+
+    if (event->type == DLT_KPI_PROCESS_EVENT_EXIT) {
+        if (process == NULL)
+            return DLT_RETURN_OK;
+
+        list->cursor = process;
+
+        if ((ret = dlt_kpi_remove_process_at_cursor_soft(list)) < DLT_RETURN_OK)
+            return ret;
+
+        return dlt_kpi_add_process_at_start(event_stopped_process_list, process);
+    }
+
+    if ((process != NULL) && (event->type == DLT_KPI_PROCESS_EVENT_FORK))
+        return DLT_RETURN_OK; /* already found by a scan of /proc */
+
+    if (process == NULL) {
+        if ((process = dlt_kpi_create_process(event->pid)) == NULL)
+            return DLT_RETURN_ERROR;
+
+        if (event->ppid > 0)
+            process->ppid = event->ppid;
+
+        if ((ret = dlt_kpi_add_process_at_start(list, process)) < DLT_RETURN_OK)
+            return ret;
+    }
+    else if (dlt_kpi_update_process_command_line(process) < DLT_RETURN_OK) {
+        return DLT_RETURN_OK;
+    }
+
+    /* a process which started a new program is reported again with its new
+     * command line, only once if it was created just before */
+    new_process = dlt_kpi_find_process(event_new_process_list, event->pid);
+
+    if (new_process != NULL) {
+        event_new_process_list->cursor = new_process;
+        dlt_kpi_remove_process_at_cursor(event_new_process_list);
+    }
+
+    return dlt_kpi_add_process_at_start(event_new_process_list, dlt_kpi_clone_process(process));
+}
+
+DltReturnValue dlt_kpi_event_loop()
+{
+    struct pollfd pfd;
+    DltKpiProcessEvent event;
+    DltReturnValue ret;
+
+    pfd.fd = process_events_fd;
+    pfd.events = POLLIN;
+
+    while (!stop_loop) {
+        /* wake up regularly to check whether to stop */
+        if (poll(&pfd, 1, 500) <= 0)
+            continue;
+
+        if (pthread_mutex_lock(&process_list_mutex) < 0) {
+            fprintf(stderr, "Can't lock mutex\n");
+            return DLT_RETURN_ERROR;
+        }
+
+        while ((ret = dlt_kpi_read_process_event(process_events_fd, &event)) == DLT_RETURN_TRUE)
+            if (dlt_kpi_handle_process_event(&event) < DLT_RETURN_OK)
+                break;
+
+        if (pthread_mutex_unlock(&process_list_mutex) < 0) {
+            fprintf(stderr, "Can't unlock mutex\n");
+            return DLT_RETURN_ERROR;
+        }
+
+        if (ret < DLT_RETURN_OK)
+            return ret;
+
+        /* Log new processes */
+        if ((ret = dlt_kpi_log_list(event_new_process_list, &dlt_kpi_get_msg_process_new, "NEW", 1)) < DLT_RETURN_OK)
+            return ret;
+
+        /* Log stopped processes */
+        if ((ret = dlt_kpi_log_list(event_stopped_process_list, &dlt_kpi_get_msg_process_stop, "STP", 1)) < DLT_RETURN_OK)
+            return ret;
+    }
+
+    return DLT_RETURN_OK;
+}
+
 void *dlt_kpi_start_irq_thread()
 {
     if (dlt_kpi_irq_loop() < DLT_RETURN_OK)
@@ -32,6 +32,7 @@
 #include "dlt-kpi-interrupt.h"
 #include "dlt-kpi-process.h"
 #include "dlt-kpi-process-list.h"
+#include "dlt-kpi-process-events.h"
 
 /* CONSTANT DEFINITIONS */
 #define DEFAULT_CONF_FILE (CONFIGURATION_FILES_DIR "/dlt-kpi.conf")
@@ -51,6 +52,7 @@ typedef struct
 typedef struct
 {
     int process_log_interval, irq_log_interval, check_log_interval;
+    int process_events;
     DltLogLevelType log_level;
 } DltKpiConfig;
 
@@ -95,6 +95,7 @@
 #include <stdlib.h> /* for malloc(), free() */
 #include <string.h> /* for strlen(), memcmp(), memmove() */
 #include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <poll.h>
 
@@ -102,6 +103,7 @@
 #include "dlt_log.h"
 #include "dlt_client.h"
 #include "dlt_client_cfg.h"
+#include "dlt_filter_engine.h"
 
 // DLTv2 - DLT Version flag for multiplexing v1 and v2 messages
 uint8_t dlt_client_dlt_version = DLTProtocolV1;
@@ -490,6 +492,164 @@ DltReturnValue dlt_client_connect(DltClient *client, int verbose)
     return DLT_RETURN_OK;
 }
 
+void dlt_client_connect_free(DltClientConnectState *state)
+{
+    if (state == NULL)
+        return;
+
+    if (state->addrinfo != NULL)
+        freeaddrinfo(state->addrinfo);
+
+    state->addrinfo = NULL;
+    state->addrinfo_next = NULL;
+}
+
+/* Complete a connection after the connect succeeded */
+static DltReturnValue dlt_client_connect_established(DltClient *client, DltClientConnectState *state, int verbose)
+{
+    dlt_client_connect_free(state);
+
+    if (fcntl(client->sock, F_SETFL, fcntl(client->sock, F_GETFL, 0) & ~O_NONBLOCK) < 0) {
+        dlt_vlog(LOG_WARNING,
+                 "%s: Socket cannot be changed to BLOCK with err [%s]\n",
+                 __func__, strerror(errno));
+        close(client->sock);
+        client->sock = -1;
+        return DLT_RETURN_ERROR;
+    }
+
+    if (verbose)
+        dlt_vlog(LOG_INFO,
+                 "%s: Connected to DLT daemon (%s)\n",
+                 __func__,
+                 client->servIP);
+
+    if (dlt_receiver_init(&(client->receiver), client->sock, DLT_RECEIVE_SOCKET, DLT_RECEIVE_BUFSIZE) != DLT_RETURN_OK) {
+        dlt_vlog(LOG_ERR, "%s: ERROR initializing receiver\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+/* Start to connect to the remaining addresses, one after the other, until a
+ * connect succeeds or is in progress */
+static DltReturnValue dlt_client_connect_next(DltClient *client, DltClientConnectState *state, int verbose)
+{
+    struct addrinfo *p;
+    int connect_errno = 0;
+
+    for (p = state->addrinfo_next; p != NULL; p = p->ai_next) {
+        if ((client->sock = socket(p->ai_family, p->ai_socktype, p->ai_protocol)) < 0) {
+            connect_errno = errno;
+            continue;
+        }
+
+        if (fcntl(client->sock, F_SETFL, fcntl(client->sock, F_GETFL, 0) | O_NONBLOCK) < 0) {
+            connect_errno = errno;
+            close(client->sock);
+            continue;
+        }
+
+        if (connect(client->sock, p->ai_addr, p->ai_addrlen) == 0)
+            return dlt_client_connect_established(client, state, verbose);
+
+        if (errno == EINPROGRESS) {
+            /* completed by dlt_client_connect_finish() */
+            state->addrinfo_next = p->ai_next;
+            return DLT_RETURN_TRUE;
+        }
+
+        connect_errno = errno;
+        close(client->sock);
+    }
+
+    dlt_client_connect_free(state);
+    client->sock = -1;
+
+    if (connect_errno != 0)
+        dlt_vlog(LOG_ERR,
+                 "%s: ERROR: failed to connect! %s\n",
+                 __func__,
+                 strerror(connect_errno));
+
+    return DLT_RETURN_ERROR;
+}
+
+DltReturnValue dlt_client_connect_start(DltClient *client, DltClientConnectState *state, int verbose)
+{
+    char portnumbuffer[33] = {0};
+    struct addrinfo hints, *servinfo;
+    int rv;
+
+    if ((client == NULL) || (state == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (client->mode != DLT_CLIENT_MODE_TCP)
+        return dlt_client_connect(client, verbose);
+
+    /* left over from a connection which was given up */
+    dlt_client_connect_free(state);
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_socktype = SOCK_STREAM;
+    snprintf(portnumbuffer, 32, "%d", client->port);
+
+    if ((rv = getaddrinfo(client->servIP, portnumbuffer, &hints, &servinfo)) != 0) {
+        dlt_vlog(LOG_ERR,
+                 "%s: getaddrinfo: %s\n",
+                 __func__,
+                 gai_strerror(rv));
+        return DLT_RETURN_ERROR;
+    }
+
+    /* kept until the connection is established or all addresses failed */
+    state->addrinfo = servinfo;
+    state->addrinfo_next = servinfo;
+
+    return dlt_client_connect_next(client, state, verbose);
+}
+
+DltReturnValue dlt_client_connect_finish(DltClient *client, DltClientConnectState *state, int verbose)
+{
+    struct pollfd pfd;
+    int error = 0;
+    socklen_t length = sizeof(error);
+    int ret;
+
+    if ((client == NULL) || (state == NULL) || (client->sock < 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    pfd.fd = client->sock;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+
+    ret = poll(&pfd, 1, 0);
+
+    if ((ret < 0) && (errno == EINTR))
+        return DLT_RETURN_TRUE;
+
+    if (ret == 0)
+        /* connection still in progress */
+        return DLT_RETURN_TRUE;
+
+    if ((ret < 0) ||
+        (getsockopt(client->sock, SOL_SOCKET, SO_ERROR, (void *)&error, &length) != 0) ||
+        (error != 0)) {
+        dlt_vlog((state->addrinfo_next != NULL) ? LOG_WARNING : LOG_ERR,
+                 "%s: ERROR: failed to connect! %s\n",
+                 __func__,
+                 strerror(error != 0 ? error : errno));
+        close(client->sock);
+        client->sock = -1;
+
+        /* try the next address of the host */
+        return dlt_client_connect_next(client, state, verbose);
+    }
+
+    return dlt_client_connect_established(client, state, verbose);
+}
+
 DltReturnValue dlt_client_cleanup(DltClient *client, int verbose)
 {
     int ret = DLT_RETURN_OK;
@@ -670,6 +830,249 @@ DltReturnValue dlt_client_main_loop_v2(DltClient *client, void *data, int verbos
     return DLT_RETURN_OK;
 }
 
+DltReturnValue dlt_client_stream_init(DltClientStream *stream,
+                                      DltClient *client,
+                                      uint32_t buffer_size,
+                                      uint32_t batch_max,
+                                      DltClientStreamCallback callback,
+                                      void *data)
+{
+    if ((stream == NULL) || (client == NULL) || (callback == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (buffer_size == 0)
+        buffer_size = DLT_CLIENT_STREAM_BUFFER_SIZE;
+
+    if (batch_max == 0)
+        batch_max = DLT_CLIENT_STREAM_BATCH_MAX;
+
+    if (buffer_size < DLT_CLIENT_STREAM_BUFFER_MIN) {
+        dlt_vlog(LOG_ERR, "%s: Buffer size %u too small, at least %zu bytes are needed\n",
+                 __func__, buffer_size, (size_t)DLT_CLIENT_STREAM_BUFFER_MIN);
+        return DLT_RETURN_WRONG_PARAMETER;
+    }
+
+    memset(stream, 0, sizeof(DltClientStream));
+
+    stream->buffer = (uint8_t *)malloc(buffer_size);
+    stream->views = (DltMessageView *)calloc(batch_max, sizeof(DltMessageView));
+
+    if ((stream->buffer == NULL) || (stream->views == NULL)) {
+        dlt_vlog(LOG_ERR, "%s: Cannot allocate memory for stream buffers\n", __func__);
+        dlt_client_stream_free(stream);
+        return DLT_RETURN_ERROR;
+    }
+
+    stream->client = client;
+    stream->callback = callback;
+    stream->data = data;
+    stream->size = buffer_size;
+    stream->batch_max = batch_max;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_client_stream_free(DltClientStream *stream)
+{
+    if (stream == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    free(stream->buffer);
+    stream->buffer = NULL;
+    free(stream->views);
+    stream->views = NULL;
+    stream->size = 0;
+    stream->start = 0;
+    stream->end = 0;
+
+    return DLT_RETURN_OK;
+}
+
+/* Fill the view of a message starting with the standard header */
+static void dlt_client_stream_view(DltClientStream *stream,
+                                   uint32_t position,
+                                   uint32_t headersize,
+                                   uint32_t length,
+                                   DltMessageView *view)
+{
+    const uint8_t *header = stream->buffer + position;
+    const uint8_t *extra = header + sizeof(DltStandardHeader);
+
+    view->offset = stream->bytes - (stream->end - position);
+    view->header = header;
+    view->headersize = (int32_t)headersize;
+    view->payload = header + headersize;
+    view->datasize = (int32_t)(length - headersize);
+    view->storageheader = NULL;
+    view->standardheader = (const DltStandardHeader *)header;
+
+    memset(&view->headerextra, 0, sizeof(view->headerextra));
+
+    if (DLT_IS_HTYP_WEID(view->standardheader->htyp)) {
+        memcpy(view->headerextra.ecu, extra, DLT_ID_SIZE);
+        extra += DLT_SIZE_WEID;
+    }
+
+    if (DLT_IS_HTYP_WSID(view->standardheader->htyp)) {
+        memcpy(&view->headerextra.seid, extra, DLT_SIZE_WSID);
+        view->headerextra.seid = DLT_BETOH_32(view->headerextra.seid);
+        extra += DLT_SIZE_WSID;
+    }
+
+    if (DLT_IS_HTYP_WTMS(view->standardheader->htyp)) {
+        memcpy(&view->headerextra.tmsp, extra, DLT_SIZE_WTMS);
+        view->headerextra.tmsp = DLT_BETOH_32(view->headerextra.tmsp);
+        extra += DLT_SIZE_WTMS;
+    }
+
+    if (DLT_IS_HTYP_UEH(view->standardheader->htyp))
+        view->extendedheader = (const DltExtendedHeader *)extra;
+    else
+        view->extendedheader = NULL;
+}
+
+/* Deliver the collected views to the callback, returns non-zero to stop */
+static int dlt_client_stream_deliver(DltClientStream *stream, uint32_t *count)
+{
+    int ret = 0;
+
+    if (*count > 0) {
+        ret = stream->callback(stream->client, stream->views, *count, stream->data);
+        stream->messages += *count;
+        *count = 0;
+    }
+
+    return ret;
+}
+
+/* Parse all complete messages in the buffer, returns non-zero to stop */
+static int dlt_client_stream_parse(DltClientStream *stream, int verbose)
+{
+    uint32_t count = 0;
+    int resync = stream->client->resync_serial_header;
+
+    while (stream->start < stream->end) {
+        uint32_t position = stream->start;
+        uint32_t available = stream->end - position;
+        uint32_t serial = 0;
+
+        if (available < sizeof(dltSerialHeader))
+            break;
+
+        if (memcmp(stream->buffer + position, dltSerialHeader, sizeof(dltSerialHeader)) == 0) {
+            serial = sizeof(dltSerialHeader);
+        }
+        else if (resync) {
+            const uint8_t *found = dlt_find_pattern(stream->buffer + position,
+                                                    available,
+                                                    (const uint8_t *)dltSerialHeader,
+                                                    sizeof(dltSerialHeader));
+            /* skip all data except a possibly incomplete serial header at the end */
+            uint32_t skip = (found != NULL) ? (uint32_t)(found - (stream->buffer + position)) :
+                (uint32_t)(available - sizeof(dltSerialHeader) + 1);
+
+            stream->start += skip;
+            stream->skipped += skip;
+            continue;
+        }
+
+        if (available < serial + sizeof(DltStandardHeader))
+            break;
+
+        const DltStandardHeader *standardheader =
+            (const DltStandardHeader *)(stream->buffer + position + serial);
+        uint32_t length = DLT_BETOH_16(standardheader->len);
+        uint32_t headersize = (uint32_t)(sizeof(DltStandardHeader) +
+                                         DLT_STANDARD_HEADER_EXTRA_SIZE(standardheader->htyp) +
+                                         (DLT_IS_HTYP_UEH(standardheader->htyp) ? sizeof(DltExtendedHeader) : 0));
+
+        if ((length < headersize) ||
+            (((standardheader->htyp & DLT_VERSION_MASK) >> DLT_VERSION_SHIFT) != DLTProtocolV1)) {
+            /* corrupted message, skip the first byte and search again */
+            if (verbose)
+                dlt_vlog(LOG_WARNING, "%s: Invalid message header at offset %" PRIu64 "\n",
+                         __func__, stream->bytes - available);
+
+            stream->start += 1;
+            stream->skipped += 1;
+            continue;
+        }
+
+        if (available < serial + length)
+            break;
+
+        dlt_client_stream_view(stream, position + serial, headersize, length, &stream->views[count]);
+        count++;
+        stream->start += serial + length;
+
+        if ((count == stream->batch_max) && dlt_client_stream_deliver(stream, &count))
+            return 1;
+    }
+
+    return dlt_client_stream_deliver(stream, &count);
+}
+
+DltReturnValue dlt_client_stream_process(DltClientStream *stream, int verbose)
+{
+    ssize_t bytes;
+
+    if ((stream == NULL) || (stream->client == NULL) || (stream->buffer == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    /* the views of the last batch are not used anymore, so the remaining
+     * incomplete message can be moved to the begin of the buffer */
+    if (stream->start == stream->end) {
+        stream->start = 0;
+        stream->end = 0;
+    }
+    else if (stream->size - stream->end < DLT_CLIENT_STREAM_READ_MIN) {
+        memmove(stream->buffer, stream->buffer + stream->start, stream->end - stream->start);
+        stream->end -= stream->start;
+        stream->start = 0;
+    }
+
+    DltReceiver *receiver = &(stream->client->receiver);
+
+    if (receiver->type == DLT_RECEIVE_FD)
+        bytes = read(receiver->fd, stream->buffer + stream->end, stream->size - stream->end);
+    else
+        bytes = recv(receiver->fd, stream->buffer + stream->end, stream->size - stream->end, 0);
+
+    if (bytes < 0) {
+        if ((errno == EINTR) || (errno == EAGAIN) || (errno == EWOULDBLOCK))
+            return DLT_RETURN_TRUE;
+
+        dlt_vlog(LOG_ERR, "%s: Receive failed: %s\n", __func__, strerror(errno));
+        return DLT_RETURN_ERROR;
+    }
+
+    if (bytes == 0)
+        /* connection closed */
+        return DLT_RETURN_OK;
+
+    stream->end += (uint32_t)bytes;
+    stream->bytes += (uint64_t)bytes;
+
+    if (verbose)
+        dlt_vlog(LOG_DEBUG, "%s: Received %zd bytes\n", __func__, bytes);
+
+    if (dlt_client_stream_parse(stream, verbose))
+        return DLT_RETURN_OK;
+
+    return DLT_RETURN_TRUE;
+}
+
+DltReturnValue dlt_client_stream_loop(DltClientStream *stream, int verbose)
+{
+    DltReturnValue ret;
+
+    do
+        ret = dlt_client_stream_process(stream, verbose);
+    while (ret == DLT_RETURN_TRUE);
+
+    return ret;
+}
+
 DltReturnValue dlt_client_send_message_to_socket(DltClient *client, DltMessage *msg)
 {
     int ret = 0;
@@ -1796,6 +2199,82 @@ DltReturnValue dlt_client_send_all_trace_status_v2(DltClient *client, uint8_t tr
     return DLT_RETURN_OK;
 }
 
+DltReturnValue dlt_client_send_client_filter(DltClient *client, const DltFilterEngine *engine)
+{
+    DltServiceSetClientFilter *req;
+    DltServiceClientFilterRule *req_rule;
+    const DltFilterRule *rule;
+    uint32_t count;
+    uint32_t size;
+    uint32_t i;
+
+    if (client == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Invalid parameters\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    count = (engine != NULL) ? engine->count : 0;
+
+    if (count > DLT_CLIENT_FILTER_RULES_MAX) {
+        dlt_vlog(LOG_ERR, "%s: Too many filter rules %u, maximum is %u\n", __func__, count,
+                 (uint32_t)DLT_CLIENT_FILTER_RULES_MAX);
+        return DLT_RETURN_ERROR;
+    }
+
+    size = (uint32_t)(sizeof(DltServiceSetClientFilter) + count * sizeof(DltServiceClientFilterRule));
+    req = calloc(1, size);
+
+    if (req == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Could not allocate memory %u\n", __func__, size);
+        return DLT_RETURN_ERROR;
+    }
+
+    req->service_id = DLT_SERVICE_ID_SET_CLIENT_FILTER;
+    req->count = (uint16_t)count;
+    req_rule = (DltServiceClientFilterRule *)((uint8_t *)req + sizeof(DltServiceSetClientFilter));
+
+    /* Payload and timestamp conditions stay with the client, the daemon
+     * only gets the part of each rule it can check on the headers */
+    for (i = 0; i < count; i++) {
+        rule = &engine->rules[i];
+        memcpy(req_rule[i].apid, &rule->apid, DLT_ID_SIZE);
+        memcpy(req_rule[i].ctid, &rule->ctid, DLT_ID_SIZE);
+        req_rule[i].log_level = (uint8_t)rule->log_level;
+        req_rule[i].message_types = (uint8_t)rule->message_types;
+    }
+
+    if (dlt_client_send_ctrl_msg(client, "APP", "CON", (uint8_t *)req, size) == DLT_RETURN_ERROR) {
+        free(req);
+        return DLT_RETURN_ERROR;
+    }
+
+    free(req);
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_client_send_stream_compression(DltClient *client, uint8_t method, uint8_t level,
+                                                  uint32_t batch_size)
+{
+    DltServiceSetStreamCompression req;
+
+    if (client == NULL) {
+        dlt_vlog(LOG_ERR, "%s: Invalid parameters\n", __func__);
+        return DLT_RETURN_ERROR;
+    }
+
+    memset(&req, 0, sizeof(req));
+    req.service_id = DLT_SERVICE_ID_SET_STREAM_COMPRESSION;
+    req.method = method;
+    req.level = level;
+    req.batch_size = batch_size;
+
+    if (dlt_client_send_ctrl_msg(client, "APP", "CON", (uint8_t *)&req, sizeof(req)) == DLT_RETURN_ERROR)
+        return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
 DltReturnValue dlt_client_send_timing_pakets(DltClient *client, uint8_t timingPakets)
 {
     DltServiceSetVerboseMode *req;
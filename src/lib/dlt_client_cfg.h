@@ -90,8 +90,26 @@
 /* Name of environment variable for specifying the daemon port */
 #define DLT_CLIENT_ENV_DAEMON_TCP_PORT "DLT_DAEMON_TCP_PORT"
 
+/* Default size of the receive buffer of a client stream */
+#define DLT_CLIENT_STREAM_BUFFER_SIZE (1024 * 1024)
+
+/* Default maximum number of messages delivered to a stream callback at once */
+#define DLT_CLIENT_STREAM_BATCH_MAX 256
+
+/* Parsed data is moved to the begin of the stream buffer when less free
+ * space than this is left at its end */
+#define DLT_CLIENT_STREAM_READ_MIN (64 * 1024)
+
 /************************/
 /* Don't change please! */
 /************************/
 
+/* Minimum size of the receive buffer of a client stream, one message of maximum size with serial header */
+#define DLT_CLIENT_STREAM_BUFFER_MIN (UINT16_MAX + sizeof(dltSerialHeader))
+
+/* Maximum number of rules of a client filter, limited by the length of one message */
+#define DLT_CLIENT_FILTER_RULES_MAX ((UINT16_MAX - sizeof(DltStandardHeader) - sizeof(DltStandardHeaderExtra) - \
+                                      sizeof(DltExtendedHeader) - sizeof(DltServiceSetClientFilter)) / \
+                                     sizeof(DltServiceClientFilterRule))
+
 #endif /* DLT_CLIENT_CFG_H */
@@ -52,8 +52,11 @@
 *******************************************************************************/
 
 #include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include "dlt_filetransfer.h"
 #include "dlt_common.h"
 #include "dlt_user_macros.h"
@@ -67,6 +70,19 @@
 
 #define DLT_FILETRANSFER_TRANSFER_ALL_PACKAGES INT_MAX
 
+/*!Size of the arguments of a data package around the data in verbose mode: two strings "FLDA", two 32 bit integers and the raw data length */
+#define PACKAGE_OVERHEAD (2 * (4 + 2 + 5) + 2 * (4 + 4) + (4 + 2))
+
+/*!Largest data package: the daemon receives the user header, standard header with all optional fields,
+ * extended header and payload of a message in a buffer of DLT_RECEIVE_BUFSIZE */
+#define PACKAGE_SIZE_MAX (DLT_RECEIVE_BUFSIZE - 8 - (4 + 12 + 10) - PACKAGE_OVERHEAD)
+
+/*!Fill level of the user buffer in percent, up to which dlt_user_log_file_transfer sends without waiting */
+#define BUFFER_HIGH_WATERMARK 50
+
+/*!Time in ms dlt_user_log_file_transfer waits for the user buffer to drain before it gives up */
+#define BUFFER_DRAIN_TIMEOUT 10000
+
 #define NANOSEC_PER_MILLISEC 1000000
 #define NANOSEC_PER_SEC 1000000000
 
@@ -74,6 +90,8 @@
 /*!Buffer for dlt file transfer. The size is defined by BUFFER_SIZE */
 unsigned char buffer[BUFFER_SIZE];
 
+uint32_t getFileSerialNumber2(const char *file, const struct stat *st);
+
 
 /*!Get some information about the file size of a file */
 /**See stat(2) for more informations.
@@ -129,20 +147,32 @@ void stringHash(const char *str, uint32_t *hash)
 uint32_t getFileSerialNumber(const char *file, int *ok)
 {
     struct stat st;
-    uint32_t ret;
 
     if (-1 == stat(file, &st)) {
         *ok = 0;
-        ret = 0;
-    } else {
-        *ok = 1;
-        ret = (uint32_t)st.st_ino;
-        ret = ret << (sizeof(ret) * 8) / 2;
-        ret |= (uint32_t)st.st_size;
-        ret ^= (uint32_t)st.st_ctime;
-        stringHash(file, &ret);
+        return 0;
     }
 
+    *ok = 1;
+    return getFileSerialNumber2(file, &st);
+}
+
+/*!Get the file serial number from the result of stat */
+/** See getFileSerialNumber.
+ * @param file Absolute file path
+ * @param st Result of stat or fstat for the file
+ * @return Returns a unique number associated with each filename
+ */
+uint32_t getFileSerialNumber2(const char *file, const struct stat *st)
+{
+    uint32_t ret;
+
+    ret = (uint32_t)st->st_ino;
+    ret = ret << (sizeof(ret) * 8) / 2;
+    ret |= (uint32_t)st->st_size;
+    ret ^= (uint32_t)st->st_ctime;
+    stringHash(file, &ret);
+
     return ret;
 }
 
@@ -778,3 +808,251 @@ int dlt_user_log_file_end(DltContext *fileContext, const char *filename, int del
         return DLT_FILETRANSFER_ERROR_FILE_END;
     }
 }
+
+/*!Waits until there is space in the user buffer for the next package */
+/**Returns at once as long as the user buffer is filled less than BUFFER_HIGH_WATERMARK.
+ * Otherwise it sends the buffer to the daemon, with a delay doubling from 1 ms up to timeout, until it is drained.
+ * @param needed Size of the next package
+ * @param timeout Maximum delay between two checks of the user buffer in ms
+ * @param fileCancelTransferFlag Transfer is cancelled if set
+ * @return Returns 0 if the package can be sent. If there was a failure a value < 0 will be returned.
+ */
+static int waitForUserBuffer(int needed, int timeout, bool *const fileCancelTransferFlag)
+{
+    int total_size, used_size;
+    int last_used_size = INT_MAX;
+    int delay = 1;
+    int waited = 0;
+
+    while (1) {
+        if (dlt_user_check_buffer(&total_size, &used_size) < DLT_RETURN_OK)
+            return DLT_FILETRANSFER_ERROR_FILE_DATA_USER_BUFFER_FAILED;
+
+        if ((long)used_size + needed <= (long)total_size * BUFFER_HIGH_WATERMARK / 100)
+            return 0;
+
+        if (*fileCancelTransferFlag)
+            return DLT_FILETRANSFER_ERROR_FILE_END_USER_CANCELLED;
+
+        /* give up only if the daemon does not read anymore */
+        if (used_size < last_used_size)
+            waited = 0;
+        else if (waited >= BUFFER_DRAIN_TIMEOUT)
+            return DLT_FILETRANSFER_ERROR_FILE_DATA_USER_BUFFER_FAILED;
+
+        last_used_size = used_size;
+        doTimeout(delay);
+        /* the user buffer is otherwise only sent with the next log message */
+        dlt_user_log_resend_buffer();
+        waited += delay;
+        delay = (delay * 2 > timeout) ? timeout : delay * 2;
+    }
+}
+
+/*!Logs a data package */
+/**
+ * @return Returns the result of dlt_user_log_write_finish, DLT_RETURN_OK if the log level is disabled.
+ */
+static DltReturnValue sendDataPackage(DltContext *fileContext,
+                                      uint32_t fserial,
+                                      int pkgNumber,
+                                      const unsigned char *data,
+                                      uint16_t length)
+{
+    DltContextData log;
+    DltReturnValue ret;
+
+    memset(&log, 0, sizeof(log));
+    ret = dlt_user_log_write_start(fileContext, &log, DLT_LOG_INFO);
+
+    if (ret != DLT_RETURN_TRUE)
+        return ret;
+
+    if ((dlt_user_log_write_string(&log, "FLDA") < DLT_RETURN_OK) ||
+        (dlt_user_log_write_uint(&log, fserial) < DLT_RETURN_OK) ||
+        (dlt_user_log_write_uint(&log, (unsigned int)pkgNumber) < DLT_RETURN_OK) ||
+        (dlt_user_log_write_raw(&log, (void *)(uintptr_t)data, length) < DLT_RETURN_OK) ||
+        (dlt_user_log_write_string(&log, "FLDA") < DLT_RETURN_OK)) {
+        free(log.buffer);
+        return DLT_RETURN_ERROR;
+    }
+
+    return dlt_user_log_write_finish(&log);
+}
+
+/*!Logs the header and the data packages of an open file */
+/**See dlt_user_log_file_transfer.
+ * @return Returns 0 if everything was okey. If there was a failure a value < 0 will be returned.
+ */
+static int sendFilePackages(DltContext *fileContext,
+                            const char *filename,
+                            const char *alias,
+                            int fd,
+                            const struct stat *st,
+                            int packageSize,
+                            int firstPackage,
+                            int timeout,
+                            bool *const fileCancelTransferFlag)
+{
+    char fcreationdate[50] = {0};
+    struct tm ts;
+    unsigned char *data;
+    uint32_t fserial = getFileSerialNumber2(filename, st);
+    int packages = (st->st_size == 0) ? 1 : (int)((st->st_size + packageSize - 1) / packageSize);
+    int pkgNumber;
+    int ret = 0;
+
+    if ((firstPackage < 1) || (firstPackage > packages)) {
+        DLT_LOG(*fileContext, DLT_LOG_ERROR,
+                DLT_STRING("Error at dlt_user_log_file_transfer: firstPackage out of scope"),
+                DLT_STRING("firstPackage:"),
+                DLT_INT(firstPackage),
+                DLT_STRING("numberOfMaximalPackages:"),
+                DLT_INT(packages),
+                DLT_STRING("for File:"),
+                DLT_STRING(filename));
+        return DLT_FILETRANSFER_ERROR_FILE_DATA;
+    }
+
+    if (firstPackage == 1) {
+        tzset();
+        localtime_r(&st->st_ctime, &ts);
+        asctime_r(&ts, fcreationdate);
+
+        if ((ret = waitForUserBuffer(packageSize, timeout, fileCancelTransferFlag)) < 0)
+            return ret;
+
+        DLT_LOG(*fileContext, DLT_LOG_INFO,
+                DLT_STRING("FLST"),
+                DLT_UINT(fserial),
+                DLT_STRING(alias != NULL ? alias : filename),
+                DLT_UINT((uint32_t)st->st_size),
+                DLT_STRING(fcreationdate);
+                DLT_UINT((unsigned int)packages),
+                DLT_UINT((unsigned int)packageSize),
+                DLT_STRING("FLST")
+                );
+    }
+
+    if (st->st_size == 0)
+        return 0;
+
+    data = malloc((size_t)packageSize);
+
+    if (data == NULL)
+        return DLT_FILETRANSFER_ERROR_FILE_DATA;
+
+    for (pkgNumber = firstPackage; (pkgNumber <= packages) && (ret == 0); pkgNumber++) {
+        ssize_t readBytes = pread(fd, data, (size_t)packageSize, (off_t)(pkgNumber - 1) * packageSize);
+
+        if (readBytes <= 0) {
+            /* the file was truncated meanwhile */
+            dlt_user_log_file_errorMessage(fileContext, filename, DLT_FILETRANSFER_ERROR_FILE_DATA);
+            ret = DLT_FILETRANSFER_ERROR_FILE_DATA;
+            break;
+        }
+
+        while ((ret = waitForUserBuffer((int)readBytes, timeout, fileCancelTransferFlag)) == 0) {
+            DltReturnValue sent = sendDataPackage(fileContext, fserial, pkgNumber, data, (uint16_t)readBytes);
+
+            if (sent != DLT_RETURN_BUFFER_FULL) {
+                if (sent < DLT_RETURN_OK)
+                    ret = DLT_FILETRANSFER_ERROR_FILE_DATA;
+
+                break;
+            }
+
+            /* the package was lost, wait and send it again */
+            doTimeout(timeout);
+        }
+    }
+
+    free(data);
+
+    return ret;
+}
+
+/*!Transfer the complete file with packages as big as a log message allows. */
+/**Like dlt_user_log_file_complete, this method logs the header, all data packages and the end of the file.
+ * The file is checked and opened only once and read with one pread per package. The package size is the
+ * maximum log message size (see DLT_LOG_MSG_BUF_LEN) and announced in the header, so that the dlt viewer
+ * can reconstruct the file. Packages are sent without delay as long as the user buffer is filled less
+ * than 50%. Above, the transfer waits until the daemon has read enough. A package which does not fit
+ * into the user buffer anymore is sent again.
+ * As no global buffer is used, several files can be transferred in parallel from different threads.
+ * @param fileContext Specific context to log the file to dlt
+ * @param filename Absolute file path
+ * @param alias Alternative name to show in the receiving end, the file path is used if NULL
+ * @param firstPackage Package to start with. A value > 1 resumes an interrupted transfer without sending the header again.
+ * @param deleteFlag Flag if the file will be deleted after transfer. 1->delete, 0->notDelete
+ * @param timeout Maximum time in ms to wait between two checks of the user buffer
+ * @param fileCancelTransferFlag is a bool pointer to cancel the filetransfer on demand
+ * @return Returns 0 if everything was okey. If there was a failure a value < 0 will be returned.
+ */
+int dlt_user_log_file_transfer(DltContext *fileContext,
+                               const char *filename,
+                               const char *alias,
+                               int firstPackage,
+                               int deleteFlag,
+                               int timeout,
+                               bool *const fileCancelTransferFlag)
+{
+    struct stat st;
+    int packageSize;
+    int fd;
+    int ret;
+
+    if ((fileContext == NULL) || (filename == NULL) || (fileCancelTransferFlag == NULL))
+        return DLT_FILETRANSFER_ERROR_FILE_DATA;
+
+    fd = open(filename, O_RDONLY | O_CLOEXEC);
+
+    if ((fd < 0) || (fstat(fd, &st) < 0)) {
+        dlt_user_log_file_errorMessage(fileContext, filename, DLT_FILETRANSFER_ERROR_FILE_HEAD);
+
+        if (fd >= 0)
+            close(fd);
+
+        return DLT_FILETRANSFER_ERROR_FILE_HEAD;
+    }
+
+    if ((dlt_user_get_log_buffer_size(&packageSize) < DLT_RETURN_OK) ||
+        (packageSize - PACKAGE_OVERHEAD < BUFFER_SIZE))
+        packageSize = BUFFER_SIZE;
+    else if (packageSize - PACKAGE_OVERHEAD > PACKAGE_SIZE_MAX)
+        packageSize = PACKAGE_SIZE_MAX;
+    else
+        packageSize -= PACKAGE_OVERHEAD;
+
+    if (timeout < 1)
+        timeout = MIN_TIMEOUT;
+
+    ret = sendFilePackages(fileContext, filename, alias, fd, &st, packageSize, firstPackage, timeout,
+                           fileCancelTransferFlag);
+    close(fd);
+
+    if ((ret == 0) && *fileCancelTransferFlag)
+        ret = DLT_FILETRANSFER_ERROR_FILE_END_USER_CANCELLED;
+
+    if (ret == DLT_FILETRANSFER_ERROR_FILE_END_USER_CANCELLED)
+        DLT_LOG(*fileContext, DLT_LOG_ERROR,
+                DLT_STRING("FLER"),
+                DLT_INT(DLT_FILETRANSFER_ERROR_FILE_END_USER_CANCELLED)
+                );
+
+    if (ret < 0)
+        return ret;
+
+    DLT_LOG(*fileContext, DLT_LOG_INFO,
+            DLT_STRING("FLFI"),
+            DLT_UINT(getFileSerialNumber2(filename, &st)),
+            DLT_STRING("FLFI")
+            );
+
+    if (deleteFlag && (doRemoveFile(filename) != 0)) {
+        dlt_user_log_file_errorMessage(fileContext, filename, DLT_FILETRANSFER_ERROR_FILE_END);
+        return DLT_FILETRANSFER_ERROR_FILE_END;
+    }
+
+    return 0;
+}
@@ -259,6 +259,15 @@ DltContext trace_load_context = {0};
 DltTraceLoadSettings* trace_load_settings = NULL;
 uint32_t trace_load_settings_count = 0;
 pthread_rwlock_t trace_load_rw_lock = PTHREAD_RWLOCK_INITIALIZER;
+/* The settings are used without a lock while a message is checked. A reader
+ * counts itself in the slot of the current epoch, settings replaced by the
+ * daemon are freed once the slot of the previous epoch is empty. */
+static atomic_uint trace_load_epoch = 0;
+static atomic_uint trace_load_readers[2] = { 0, 0 };
+static unsigned int dlt_user_trace_load_enter(void);
+static void dlt_user_trace_load_leave(unsigned int epoch);
+static void dlt_user_trace_load_retire(DltTraceLoadSettings *settings);
+static void dlt_user_trace_load_apid(char *apid);
 #endif
 
 #include <stdint.h>
@@ -584,9 +593,7 @@ DltReturnValue dlt_init(void)
     memset(trace_load_settings, 0, sizeof(DltTraceLoadSettings));
     trace_load_settings[0].soft_limit = DLT_TRACE_LOAD_CLIENT_SOFT_LIMIT_DEFAULT;
     trace_load_settings[0].hard_limit = DLT_TRACE_LOAD_CLIENT_HARD_LIMIT_DEFAULT;
-    strncpy(trace_load_settings[0].apid, dlt_user.appID, DLT_ID_SIZE);
-    trace_load_settings[0].apid2len = dlt_user.appID2len;
-    strncpy(trace_load_settings[0].apid2, dlt_user.appID2, (dlt_user.appID2len) + 1);
+    dlt_user_trace_load_apid(trace_load_settings[0].apid);
     trace_load_settings_count = 1;
 
     pthread_rwlock_unlock(&trace_load_rw_lock);
@@ -1518,8 +1525,9 @@ DltReturnValue dlt_register_app_v2(const char *apid, const char *description)
     dlt_mutex_unlock();
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
-    strncpy(trace_load_settings[0].apid2, dlt_user.appID2, dlt_user.appID2len);
-    trace_load_settings[0].apid2len = dlt_user.appID2len;
+    pthread_rwlock_wrlock(&trace_load_rw_lock);
+    dlt_user_trace_load_apid(trace_load_settings[0].apid);
+    pthread_rwlock_unlock(&trace_load_rw_lock);
 #endif
 
     ret = dlt_user_log_send_register_application_v2();
@@ -1789,23 +1797,20 @@ DltReturnValue dlt_register_context_ll_ts_llccb(DltContext *handle,
     dlt_mutex_unlock();
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
-    /* Compute runtime trace-load settings under the rwlock,
-     * then publish the pointer while holding the DLT mutex
-     * to avoid races with other threads that may reallocate
-     * the context array. This avoids holding both locks at
-     * the same time.
+    /* Resolve the runtime trace-load settings and publish the pointer
+     * while holding the DLT mutex, so settings which the daemon replaces
+     * in between are resolved again before they are freed. The DLT mutex
+     * is always taken before the rwlock.
      */
+    dlt_mutex_lock();
     pthread_rwlock_rdlock(&trace_load_rw_lock);
-    DltTraceLoadSettings *settings = dlt_find_runtime_trace_load_settings(
+    /* ctx_entry points into dlt_user.dlt_ll_ts which is protected by dlt_mutex */
+    ctx_entry->trace_load_settings = dlt_find_runtime_trace_load_settings(
                                                       trace_load_settings,
                                                       trace_load_settings_count,
                                                       dlt_user.appID,
                                                       ctx_entry->contextID);
     pthread_rwlock_unlock(&trace_load_rw_lock);
-
-    dlt_mutex_lock();
-    /* ctx_entry points into dlt_user.dlt_ll_ts which is protected by dlt_mutex */
-    ctx_entry->trace_load_settings = settings;
     dlt_mutex_unlock();
 #endif
 
@@ -2075,6 +2080,19 @@ DltReturnValue dlt_register_context_ll_ts_llccb_v2(DltContext *handle,
 
     dlt_mutex_unlock();
 
+#ifdef DLT_TRACE_LOAD_CTRL_ENABLE
+    /* Resolve the trace load settings once, see dlt_register_context_ll_ts_llccb() */
+    dlt_mutex_lock();
+    pthread_rwlock_rdlock(&trace_load_rw_lock);
+    ctx_entry->trace_load_settings = dlt_find_runtime_trace_load_settings(
+                                                      trace_load_settings,
+                                                      trace_load_settings_count,
+                                                      dlt_user.appID2,
+                                                      ctx_entry->contextID2);
+    pthread_rwlock_unlock(&trace_load_rw_lock);
+    dlt_mutex_unlock();
+#endif
+
     return dlt_user_log_send_register_context_v2(&log);
 }
 
@@ -5178,32 +5196,30 @@ DltReturnValue dlt_user_log_send_log(DltContextData *log, const int mtype, int *
             if (!sent_size)
             {
                 int pos = log->handle->log_level_pos;
-                char ctxid[DLT_ID_SIZE];
-                memcpy(ctxid, log->handle->contextID, DLT_ID_SIZE);
 
-                if ((uint32_t)pos > dlt_user.dlt_ll_ts_num_entries) {
+                if ((pos < 0) || ((uint32_t)pos >= dlt_user.dlt_ll_ts_num_entries)) {
                     char msg_buffer[255];
-                    sprintf(msg_buffer, "log handle has invalid log level pos %d, current entries: %u, dropping message\n",
-                        log->handle->log_level_pos, dlt_user.dlt_ll_ts_num_entries);
+                    snprintf(msg_buffer, sizeof(msg_buffer),
+                             "log handle has invalid log level pos %d, current entries: %u, dropping message\n",
+                             log->handle->log_level_pos, dlt_user.dlt_ll_ts_num_entries);
                     dlt_mutex_unlock();
                     dlt_user_output_internal_msg(LOG_ERR, msg_buffer, NULL);
                     return DLT_RETURN_ERROR;
                 }
-                dlt_mutex_unlock();
 
-                pthread_rwlock_rdlock(&trace_load_rw_lock);
-                DltTraceLoadSettings *computed_settings = dlt_find_runtime_trace_load_settings(
-                    trace_load_settings, trace_load_settings_count, dlt_user.appID, ctxid);
-                pthread_rwlock_unlock(&trace_load_rw_lock);
+                /* The settings were resolved when the context was registered,
+                 * the check itself needs no lock */
+                const unsigned int trace_load_epoch_entered = dlt_user_trace_load_enter();
+                DltTraceLoadSettings *settings = dlt_user.dlt_ll_ts[pos].trace_load_settings;
+                dlt_mutex_unlock();
 
-                dlt_mutex_lock();
-                if ((uint32_t)pos < dlt_user.dlt_ll_ts_num_entries) {
-                    dlt_ll_ts_type* ll_ts = &dlt_user.dlt_ll_ts[pos];
-                    if (ll_ts->trace_load_settings == NULL) {
-                        ll_ts->trace_load_settings = computed_settings;
-                    }
+                if (settings == NULL) {
+                    pthread_rwlock_rdlock(&trace_load_rw_lock);
+                    settings = dlt_find_runtime_trace_load_settings(
+                        trace_load_settings, trace_load_settings_count, dlt_user.appID, log->handle->contextID);
+                    pthread_rwlock_unlock(&trace_load_rw_lock);
                 }
-                dlt_mutex_unlock();
+
                 size_t trace_load_size = (size_t)sizeof(DltUserHeader)
                                         + (size_t)msg.headersize
                                         - (size_t)sizeof(DltStorageHeader)
@@ -5211,12 +5227,13 @@ DltReturnValue dlt_user_log_send_log(DltContextData *log, const int mtype, int *
 
                 int32_t trace_load_size_i32 = safe_size_to_int32(trace_load_size);
                 const bool trace_load_in_limits = dlt_check_trace_load(
-                                                    computed_settings,
+                                                    settings,
                                                     log->log_level,
                                                     time_stamp,
                                                     trace_load_size_i32,
                                                     dlt_user_output_internal_msg,
                                                     NULL);
+                dlt_user_trace_load_leave(trace_load_epoch_entered);
 
                 if (!trace_load_in_limits){
                     return DLT_RETURN_LOAD_EXCEEDED;
@@ -5491,11 +5508,10 @@ DltReturnValue dlt_user_log_send_log_v2(DltContextData *log, const int mtype, Dl
         msg.headerextrav2.msid = log->msid;
     }
 
-/* TODO:
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
-    time_stamp = msg.headerextra.tmsp;
+    /* the version 2 header has no timestamp in units of 0.1 msec */
+    time_stamp = dlt_uptime();
 #endif
-*/
 
     if (dlt_message_set_extraparameters_v2(&msg, 0) != DLT_RETURN_OK)
         return DLT_RETURN_ERROR;
@@ -5689,26 +5705,44 @@ DltReturnValue dlt_user_log_send_log_v2(DltContextData *log, const int mtype, Dl
             /* check trace load before output */
             if (!sent_size)
             {
-                pthread_rwlock_wrlock(&trace_load_rw_lock);
-                DltTraceLoadSettings* settings =
-                    dlt_find_runtime_trace_load_settings(
+                DltTraceLoadSettings *settings = NULL;
+                const int pos = log->handle->log_level_pos;
+
+                /* The settings were resolved when the context was registered,
+                 * the check itself needs no lock */
+                const unsigned int trace_load_epoch_entered = dlt_user_trace_load_enter();
+                dlt_mutex_lock();
+                if ((pos >= 0) && ((uint32_t)pos < dlt_user.dlt_ll_ts_num_entries))
+                    settings = dlt_user.dlt_ll_ts[pos].trace_load_settings;
+                dlt_mutex_unlock();
+
+                if (settings == NULL) {
+                    pthread_rwlock_rdlock(&trace_load_rw_lock);
+                    settings = dlt_find_runtime_trace_load_settings(
                         trace_load_settings, trace_load_settings_count, dlt_user.appID2, log->handle->contextID2);
+                    pthread_rwlock_unlock(&trace_load_rw_lock);
+                }
+
                 const bool trace_load_in_limits = dlt_check_trace_load(
                         settings,
                         log->log_level, time_stamp,
-                        sizeof(DltUserHeader)
-                            + msg.headersizev2 - msg.storageheadersizev2
-                            + log->size,
+                        safe_size_to_int32(sizeof(DltUserHeader)
+                            + ((size_t)msg.headersizev2 - (size_t)msg.storageheadersizev2)
+                            + (size_t)log->size),
                         dlt_user_output_internal_msg,
                         NULL);
-                pthread_rwlock_unlock(&trace_load_rw_lock);
+                dlt_user_trace_load_leave(trace_load_epoch_entered);
+
                 if (!trace_load_in_limits){
+                    free(msg.headerbufferv2);
                     return DLT_RETURN_LOAD_EXCEEDED;
                 }
             }
             else
             {
-                *sent_size = (sizeof(DltUserHeader) + msg.headersizev2 - msg.storageheadersizev2 + log->size);
+                *sent_size = safe_size_to_int32(sizeof(DltUserHeader)
+                                                + ((size_t)msg.headersizev2 - (size_t)msg.storageheadersizev2)
+                                                + (size_t)log->size);
             }
 #endif
 
@@ -6585,6 +6619,8 @@ DltReturnValue dlt_user_log_check_user_message(void)
     uint32_t trace_load_settings_user_messages_count = 0;
     uint32_t trace_load_settings_user_message_bytes_required = 0;
     unsigned long trace_load_settings_alloc_size = 0;
+    DltTraceLoadSettings *new_settings = NULL;
+    DltTraceLoadSettings *old_settings = NULL;
 #endif
 
     /* For delayed calling of injection callback, to avoid deadlock */
@@ -6878,47 +6914,46 @@ DltReturnValue dlt_user_log_check_user_message(void)
                     trace_load_settings_user_messages =
                         (DltUserControlMsgTraceSettingMsg *)(receiver->buf + sizeof(DltUserHeader) + sizeof(uint32_t));
 
-                    pthread_rwlock_wrlock(&trace_load_rw_lock);
-
-                    // Remove the default created at startup
-                    if (trace_load_settings != NULL) {
-                        free(trace_load_settings);
-                        trace_load_settings_count = 0;
-                        trace_load_settings = NULL;
-                    }
-
                     trace_load_settings_alloc_size = sizeof(DltTraceLoadSettings) * trace_load_settings_user_messages_count;
-                    trace_load_settings = malloc(trace_load_settings_alloc_size);
-                                       if (trace_load_settings == NULL) {
-                        pthread_rwlock_unlock(&trace_load_rw_lock);
-                        dlt_vlog(LOG_EMERG, "Unable to allocate memory for trace load settings, no logging will be possible\n");
-                   } else {
-                        memset(trace_load_settings, 0, trace_load_settings_alloc_size);
+                    new_settings = malloc(trace_load_settings_alloc_size);
+                    if (new_settings == NULL) {
+                        dlt_vlog(LOG_EMERG, "Unable to allocate memory for trace load settings, keeping the current settings\n");
+                    } else {
+                        char apid[DLT_ID_SIZE];
+
+                        dlt_user_trace_load_apid(apid);
+                        memset(new_settings, 0, trace_load_settings_alloc_size);
                         for (i = 0; i < trace_load_settings_user_messages_count; i++) {
-                            memcpy(trace_load_settings[i].apid, dlt_user.appID, DLT_ID_SIZE);
-                            memcpy(trace_load_settings[i].ctid, trace_load_settings_user_messages[i].ctid, DLT_ID_SIZE);
-                            trace_load_settings[i].soft_limit = trace_load_settings_user_messages[i].soft_limit;
-                            trace_load_settings[i].hard_limit = trace_load_settings_user_messages[i].hard_limit;
+                            memcpy(new_settings[i].apid, apid, DLT_ID_SIZE);
+                            memcpy(new_settings[i].ctid, trace_load_settings_user_messages[i].ctid, DLT_ID_SIZE);
+                            new_settings[i].soft_limit = trace_load_settings_user_messages[i].soft_limit;
+                            new_settings[i].hard_limit = trace_load_settings_user_messages[i].hard_limit;
                         }
 
-                        /* Publish the newly installed trace_load_settings (protected by rwlock)
-                        * and then update the per-context pointer while holding the DLT mutex to
-                        * avoid races with concurrent context registration/unregistration.
-                        */
+                        /* Replace the settings and resolve the settings of every context
+                         * again while holding the DLT mutex, so no context keeps a pointer
+                         * to the old settings. Registration takes the same locks.
+                         */
+                        dlt_mutex_lock();
+                        pthread_rwlock_wrlock(&trace_load_rw_lock);
+                        old_settings = trace_load_settings;
+                        trace_load_settings = new_settings;
                         trace_load_settings_count = trace_load_settings_user_messages_count;
-                        pthread_rwlock_unlock(&trace_load_rw_lock);
 
-                        dlt_mutex_lock();
                         for (i = 0; i < dlt_user.dlt_ll_ts_num_entries; ++i) {
                             dlt_ll_ts_type* ctx_entry = &dlt_user.dlt_ll_ts[i];
                             ctx_entry->trace_load_settings = dlt_find_runtime_trace_load_settings(
-                                trace_load_settings, trace_load_settings_count, dlt_user.appID, ctx_entry->contextID);
+                                trace_load_settings, trace_load_settings_count, apid,
+                                (ctx_entry->contextID2len > 0) ?
+                                ctx_entry->contextID2 : ctx_entry->contextID);
                         }
+                        pthread_rwlock_unlock(&trace_load_rw_lock);
                         dlt_mutex_unlock();
 
+                        dlt_user_trace_load_retire(old_settings);
+
                         char **messages = malloc(trace_load_settings_count * sizeof(char *));
                         if (messages == NULL) {
-                            pthread_rwlock_unlock(&trace_load_rw_lock);
                             dlt_vlog(LOG_ERR, "unable to allocate memory for trace load message buffer\n");
                         } else {
                             uint32_t msg_count = 0U;
@@ -6943,7 +6978,6 @@ DltReturnValue dlt_user_log_check_user_message(void)
                             }
                             free(messages);
                         }
-                        /* continue outer flow, rwlock already unlocked */
                     }
 
                     /* keep not read data in buffer */
@@ -6997,7 +7031,7 @@ DltReturnValue dlt_user_log_resend_buffer(void)
     count = dlt_buffer_get_message_count(&(dlt_user.startup_buffer));
     dlt_mutex_unlock();
 
-    if(dlt_user.appID[0] == '\0') {
+    if (dlt_user.appID2len == 0) {
         for (num = 0; num < count; num++) {
             dlt_mutex_lock();
             size = dlt_buffer_copy(&(dlt_user.startup_buffer), dlt_user.resend_buffer, dlt_user.log_buf_len);
@@ -7336,6 +7370,23 @@ DltReturnValue dlt_user_check_buffer(int *total_size, int *used_size)
     return DLT_RETURN_OK; /* ok */
 }
 
+DltReturnValue dlt_user_get_log_buffer_size(int *size)
+{
+    if (size == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (!DLT_USER_INITIALIZED) {
+        if (dlt_init() < DLT_RETURN_OK) {
+            dlt_vlog(LOG_ERR, "%s Failed to initialise dlt", __func__);
+            return DLT_RETURN_ERROR;
+        }
+    }
+
+    *size = dlt_user.log_buf_len;
+
+    return DLT_RETURN_OK;
+}
+
 #ifdef DLT_TEST_ENABLE
 void dlt_user_test_corrupt_user_header(int enable)
 {
@@ -7589,6 +7640,60 @@ static DltReturnValue dlt_user_output_internal_msg(
     /* Return number of bytes if message was successfully sent */
     return (ret == DLT_RETURN_OK) ? sent_size : ret;
 }
+
+/* Count a reader of the trace load settings, returns the epoch to pass to
+ * dlt_user_trace_load_leave() */
+static unsigned int dlt_user_trace_load_enter(void)
+{
+    unsigned int epoch;
+
+    for (;;) {
+        epoch = atomic_load(&trace_load_epoch);
+        atomic_fetch_add(&trace_load_readers[epoch & 1U], 1U);
+
+        /* a reader counted in an epoch which already ended may use
+         * settings which are freed, so it counts itself again */
+        if (atomic_load(&trace_load_epoch) == epoch)
+            return epoch;
+
+        atomic_fetch_sub(&trace_load_readers[epoch & 1U], 1U);
+    }
+}
+
+static void dlt_user_trace_load_leave(unsigned int epoch)
+{
+    atomic_fetch_sub(&trace_load_readers[epoch & 1U], 1U);
+}
+
+/* Free settings which no context refers to anymore. The readers which may
+ * still use them are counted in the current epoch, so a new epoch is started
+ * and the settings are freed when the readers of the old one have left.
+ * Only the receiver thread replaces settings. */
+static void dlt_user_trace_load_retire(DltTraceLoadSettings *settings)
+{
+    unsigned int epoch;
+
+    if (settings == NULL)
+        return;
+
+    epoch = atomic_fetch_add(&trace_load_epoch, 1U);
+
+    while (atomic_load(&trace_load_readers[epoch & 1U]) != 0)
+        sched_yield();
+
+    free(settings);
+}
+
+/* Application id of the trace load settings, the settings use the 4 character ids */
+static void dlt_user_trace_load_apid(char *apid)
+{
+    memset(apid, 0, DLT_ID_SIZE);
+
+    if (dlt_user.appID2len > 0)
+        memcpy(apid, dlt_user.appID2, dlt_user.appID2len < DLT_ID_SIZE ? dlt_user.appID2len : DLT_ID_SIZE);
+    else
+        memcpy(apid, dlt_user.appID, DLT_ID_SIZE);
+}
 #endif
 
 DltReturnValue dlt_user_log_out_error_handling(void *ptr1, size_t len1, void *ptr2, size_t len2, void *ptr3,
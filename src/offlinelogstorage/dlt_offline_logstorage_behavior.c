@@ -795,16 +795,16 @@ DLT_STATIC int dlt_logstorage_find_dlt_header(void *ptr,
                                               unsigned int offset,
                                               unsigned int cnt)
 {
-    const char magic[] = { 'D', 'L', 'T', 0x01 };
-    const char *cache = (char*)ptr + offset;
+    const uint8_t magic[] = { 'D', 'L', 'T', 0x01 };
+    const uint8_t *cache = (const uint8_t *)ptr + offset;
+    const uint8_t *found;
 
-    unsigned int i;
-    for (i = 0; i < cnt; i++) {
-        if ((cache[i] == 'D') && (strncmp(&cache[i], magic, 4) == 0))
-           return (int)i;
-    }
+    found = dlt_find_pattern(cache, cnt, magic, sizeof(magic));
 
-    return -1;
+    if (found == NULL)
+        return -1;
+
+    return (int)(found - cache);
 }
 
 /**
@@ -821,16 +821,20 @@ DLT_STATIC int dlt_logstorage_find_last_dlt_header(void *ptr,
                                                    unsigned int offset,
                                                    unsigned int cnt)
 {
-    const char magic[] = {'D', 'L', 'T', 0x01};
-    const char *cache = (char*)ptr + offset;
+    const uint8_t magic[] = {'D', 'L', 'T', 0x01};
+    const uint8_t *cache = (const uint8_t *)ptr + offset;
+    const uint8_t *found;
 
-    int i;
-    for (i = (int)cnt - (DLT_ID_SIZE - 1) ; i > 0; i--) {
-        if ((cache[i] == 'D') && (strncmp(&cache[i], magic, 4) == 0))
-            return i;
-    }
+    /* a header at index 0 is not reported */
+    if (cnt <= 1)
+        return -1;
+
+    found = dlt_find_last_pattern(cache + 1, (size_t)cnt - 1, magic, sizeof(magic));
+
+    if (found == NULL)
+        return -1;
 
-    return -1;
+    return (int)(found - cache);
 }
 
 /**
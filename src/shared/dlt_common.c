@@ -37,11 +37,25 @@
 #include <errno.h>
 #include <sys/stat.h> /* for mkdir() */
 #include <sys/wait.h>
+#include <sys/mman.h> /* for mmap() */
+#include <pthread.h>
+
+#if (defined (__x86_64__) || defined (__i386__)) && defined (__GNUC__)
+#   include <immintrin.h> /* for SSE2 and AVX2 intrinsics */
+#   define DLT_PATTERN_AVX2
+#   ifdef __SSE2__
+#      define DLT_PATTERN_SSE2
+#   endif
+#elif defined (__aarch64__) && defined (__ARM_NEON)
+#   include <arm_neon.h>
+#   define DLT_PATTERN_NEON
+#endif
 
 #include "dlt_user_shared.h"
 #include "dlt_common.h"
 #include "dlt_common_cfg.h"
 #include "dlt_multiple_files.h"
+#include "dlt_filter_engine.h"
 
 #include "dlt_version.h"
 
@@ -77,6 +91,8 @@
 
 const char dltSerialHeader[DLT_ID_SIZE] = { 'D', 'L', 'S', 1 };
 char dltSerialHeaderChar[DLT_ID_SIZE] = { 'D', 'L', 'S', 1 };
+const char dltUdpDatagramHeader[DLT_ID_SIZE] = { 'D', 'L', 'U', 1 };
+static const uint8_t dltStorageHeaderPattern[DLT_ID_SIZE] = { 'D', 'L', 'T', 1 };
 
 #if defined DLT_DAEMON_USE_FIFO_IPC || defined DLT_LIB_USE_FIFO_IPC
 char dltFifoBaseDir[DLT_PATH_MAX] = "/tmp";
@@ -121,24 +137,20 @@ DltReturnValue dlt_message_get_extendedparameters_from_recievedbuffer_v2(DltMess
 static int32_t dlt_output_soft_limit_over_warning(
     DltTraceLoadSettings* tl_settings,
     DltLogInternal log_internal,
-    void *log_params);
+    void *log_params,
+    uint32_t timestamp);
 
 static int32_t dlt_output_hard_limit_warning(
     DltTraceLoadSettings* tl_settings,
     DltLogInternal log_internal,
-    void *log_params);
-
-static bool dlt_user_cleanup_window(DltTraceLoadStat *tl_stat);
-
-static int32_t dlt_switch_slot_if_needed(
-    DltTraceLoadSettings* tl_settings,
-    DltLogInternal log_internal,
-    void *log_internal_params,
+    void *log_params,
     uint32_t timestamp);
 
-static void dlt_record_trace_load(DltTraceLoadStat *const tl_stat, int32_t size);
-static inline bool dlt_is_over_trace_load_soft_limit(DltTraceLoadSettings* tl_settings);
-static inline bool dlt_is_over_trace_load_hard_limit(DltTraceLoadSettings* tl_settings, int size);
+static bool dlt_record_trace_load(
+    DltTraceLoadSettings* tl_settings,
+    uint32_t timestamp,
+    int32_t size,
+    int32_t sent_warn_msg_bytes);
 #endif
 
 void dlt_print_hex(uint8_t *ptr, int size)
@@ -1770,19 +1782,20 @@ int dlt_message_read(DltMessage *msg, uint8_t *buffer, unsigned int length, int
 
         if (resync) {
             /* resync if necessary */
-            msg->resync_offset = 0;
-
-            do {
-                if (memcmp(buffer + msg->resync_offset, dltSerialHeader, sizeof(dltSerialHeader)) == 0) {
-                    /* serial header found */
-                    msg->found_serialheader = 1;
-                    buffer += sizeof(dltSerialHeader);
-                    length -= (unsigned int)sizeof(dltSerialHeader);
-                    break;
-                }
-
-                msg->resync_offset++;
-            } while ((sizeof(dltSerialHeader) + (size_t)msg->resync_offset) <= length);
+            const uint8_t *serialheader = dlt_find_pattern(buffer,
+                                                           length,
+                                                           (const uint8_t *)dltSerialHeader,
+                                                           sizeof(dltSerialHeader));
+
+            if (serialheader != NULL) {
+                /* serial header found */
+                msg->found_serialheader = 1;
+                msg->resync_offset = (int32_t)(serialheader - buffer);
+            }
+            else {
+                /* skip all data except a possibly incomplete serial header at the end */
+                msg->resync_offset = (int32_t)(length - sizeof(dltSerialHeader) + 1);
+            }
 
             /* Set new start offset */
             if (msg->resync_offset > 0) {
@@ -1790,6 +1803,11 @@ int dlt_message_read(DltMessage *msg, uint8_t *buffer, unsigned int length, int
                 buffer += msg->resync_offset;
                 length -= (unsigned int)msg->resync_offset;
             }
+
+            if (msg->found_serialheader) {
+                buffer += sizeof(dltSerialHeader);
+                length -= (unsigned int)sizeof(dltSerialHeader);
+            }
         }
     }
 
@@ -1954,19 +1972,20 @@ int dlt_message_read_v2(DltMessageV2 *msg, uint8_t *buffer, unsigned int length,
 
         if (resync) {
             /* resync if necessary */
-            msg->resync_offset = 0;
-
-            do {
-                if (memcmp(buffer + msg->resync_offset, dltSerialHeader, sizeof(dltSerialHeader)) == 0) {
-                    /* serial header found */
-                    msg->found_serialheader = 1;
-                    buffer += sizeof(dltSerialHeader);
-                    length -= (unsigned int)sizeof(dltSerialHeader);
-                    break;
-                }
-
-                msg->resync_offset++;
-            } while ((sizeof(dltSerialHeader) + (size_t)msg->resync_offset) <= length);
+            const uint8_t *serialheader = dlt_find_pattern(buffer,
+                                                           length,
+                                                           (const uint8_t *)dltSerialHeader,
+                                                           sizeof(dltSerialHeader));
+
+            if (serialheader != NULL) {
+                /* serial header found */
+                msg->found_serialheader = 1;
+                msg->resync_offset = (int32_t)(serialheader - buffer);
+            }
+            else {
+                /* skip all data except a possibly incomplete serial header at the end */
+                msg->resync_offset = (int32_t)(length - sizeof(dltSerialHeader) + 1);
+            }
 
             /* Set new start offset */
             if (msg->resync_offset > 0) {
@@ -1974,6 +1993,11 @@ int dlt_message_read_v2(DltMessageV2 *msg, uint8_t *buffer, unsigned int length,
                 buffer += msg->resync_offset;
                 length -= (unsigned int)msg->resync_offset;
             }
+
+            if (msg->found_serialheader) {
+                buffer += sizeof(dltSerialHeader);
+                length -= (unsigned int)sizeof(dltSerialHeader);
+            }
         }
     }
 
@@ -2674,6 +2698,79 @@ DltReturnValue dlt_message_get_extendedparameters_from_recievedbuffer_v2(DltMess
     return DLT_RETURN_OK;
 }
 
+/* State of a DltFile which is private to libdlt, allocated on demand */
+struct sDltFilePrivate
+{
+    uint8_t *map;             /* mapped content of the file, NULL if the file is read with stdio */
+    DltFilterEngine engine;   /* compiled filter of the file */
+    int filtered;             /* engine holds the filter of the file */
+    const DltFilter *source;  /* filter the engine was compiled from, NULL for a set engine */
+    int source_counter;       /* number of rules of source when it was compiled */
+};
+
+/* Get the private state of a file, allocate it if needed */
+static struct sDltFilePrivate *dlt_file_get_private(DltFile *file)
+{
+    if (file->priv == NULL) {
+        file->priv = calloc(1, sizeof(struct sDltFilePrivate));
+
+        if (file->priv != NULL)
+            dlt_filter_engine_init(&file->priv->engine);
+    }
+
+    return file->priv;
+}
+
+/* Get the mapped content of a file, NULL if the file is read with stdio */
+static uint8_t *dlt_file_get_map(const DltFile *file)
+{
+    return (file->priv != NULL) ? file->priv->map : NULL;
+}
+
+/* Get the compiled filter of a file, NULL if the filter was assigned or changed directly */
+static const DltFilterEngine *dlt_file_engine(const DltFile *file)
+{
+    const struct sDltFilePrivate *priv = file->priv;
+
+    if ((priv == NULL) || !priv->filtered || (priv->source != file->filter) ||
+        ((file->filter != NULL) && (file->filter->counter != priv->source_counter)))
+        return NULL;
+
+    return &priv->engine;
+}
+
+/* Check if a filter is set for a file */
+static int dlt_file_filtered(const DltFile *file)
+{
+    return (file->filter != NULL) || (dlt_file_engine(file) != NULL);
+}
+
+/* Check the filter of a file, a filter which was not compiled is checked rule by rule */
+static DltReturnValue dlt_file_filter_check(const DltFile *file, DltMessage *msg, int verbose)
+{
+    const DltFilterEngine *engine = dlt_file_engine(file);
+
+    if (engine != NULL)
+        return dlt_filter_engine_match(engine, msg);
+
+    if (file->filter != NULL)
+        return dlt_message_filter_check(msg, file->filter, verbose);
+
+    return DLT_RETURN_TRUE;
+}
+
+/* Remove the compiled filter of a file */
+static void dlt_file_engine_free(DltFile *file)
+{
+    if (file->priv == NULL)
+        return;
+
+    dlt_filter_engine_free(&file->priv->engine);
+    file->priv->filtered = 0;
+    file->priv->source = NULL;
+    file->priv->source_counter = 0;
+}
+
 DltReturnValue dlt_file_init(DltFile *file, int verbose)
 {
     PRINT_FUNCTION_VERBOSE(verbose);
@@ -2693,6 +2790,8 @@ DltReturnValue dlt_file_init(DltFile *file, int verbose)
 
     file->position = 0;
 
+    file->priv = NULL;
+
     file->error_messages = 0;
 
     return dlt_message_init(&(file->msg), verbose);
@@ -2717,6 +2816,8 @@ DltReturnValue dlt_file_init_v2(DltFile *file, int verbose)
 
     file->position = 0;
 
+    file->priv = NULL;
+
     file->error_messages = 0;
 
     return dlt_message_init_v2(&(file->msgv2), verbose);
@@ -2733,10 +2834,100 @@ DltReturnValue dlt_file_set_filter(DltFile *file, DltFilter *filter, int verbose
 
     /* set filter */
     file->filter = filter;
+    dlt_file_engine_free(file);
+
+    if ((filter == NULL) || (dlt_file_get_private(file) == NULL))
+        return DLT_RETURN_OK;
+
+    /* compile it now as it may be used by several threads later,
+     * a filter which cannot be compiled is checked rule by rule */
+    if (dlt_filter_compile(filter, &file->priv->engine) == DLT_RETURN_OK) {
+        file->priv->filtered = 1;
+        file->priv->source = filter;
+        file->priv->source_counter = filter->counter;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_set_filter_engine(DltFile *file, const DltFilterEngine *engine, int verbose)
+{
+    uint32_t num;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if (file == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    file->filter = NULL;
+    dlt_file_engine_free(file);
+
+    if (engine == NULL)
+        return DLT_RETURN_OK;
+
+    if (dlt_file_get_private(file) == NULL)
+        return DLT_RETURN_ERROR;
+
+    /* the file keeps a copy, so the engine of the caller can be released */
+    for (num = 0; num < engine->count; num++)
+        if (dlt_filter_engine_add(&file->priv->engine, &engine->rules[num]) < DLT_RETURN_OK) {
+            dlt_file_engine_free(file);
+            return DLT_RETURN_ERROR;
+        }
+
+    if (dlt_filter_engine_compile(&file->priv->engine) < DLT_RETURN_OK) {
+        dlt_file_engine_free(file);
+        return DLT_RETURN_ERROR;
+    }
+
+    file->priv->filtered = 1;
 
     return DLT_RETURN_OK;
 }
 
+const DltFilterEngine *dlt_file_get_filter_engine(const DltFile *file)
+{
+    if (file == NULL)
+        return NULL;
+
+    return dlt_file_engine(file);
+}
+
+/**
+ * Position a DLT file opened with stdio at the next occurrence of a header pattern,
+ * starting at the current file position. The file is read in blocks and each
+ * block is searched with dlt_find_pattern(). If the pattern is not found, the
+ * file is positioned at the last bytes, which may be the beginning of a pattern
+ * written later, so that the next read reports the end of the file.
+ * @param file pointer to structure of organising access to DLT file
+ * @param pattern pointer to the pattern
+ * @param pattern_length length of the pattern
+ * @return negative value if there was an error
+ */
+static DltReturnValue dlt_file_skip_to_pattern(DltFile *file, const uint8_t *pattern, size_t pattern_length)
+{
+    uint8_t buffer[DLT_COMMON_RESYNC_BUFFER_SIZE];
+    const uint8_t *found;
+    size_t count;
+
+    while (1) {
+        count = fread(buffer, 1, sizeof(buffer), file->handle);
+
+        if (count < pattern_length)
+            return (fseek(file->handle, -(long)count, SEEK_CUR) < 0) ? DLT_RETURN_ERROR : DLT_RETURN_OK;
+
+        found = dlt_find_pattern(buffer, count, pattern, pattern_length);
+
+        if (found != NULL)
+            return (fseek(file->handle, (long)(found - buffer) - (long)count, SEEK_CUR) < 0) ?
+                   DLT_RETURN_ERROR : DLT_RETURN_OK;
+
+        /* keep the last bytes, they may be the beginning of the pattern */
+        if (fseek(file->handle, 1 - (long)pattern_length, SEEK_CUR) < 0)
+            return DLT_RETURN_ERROR;
+    }
+}
+
 DltReturnValue dlt_file_read_header(DltFile *file, int verbose)
 {
     PRINT_FUNCTION_VERBOSE(verbose);
@@ -2765,10 +2956,13 @@ DltReturnValue dlt_file_read_header(DltFile *file, int verbose)
 
         /* check id of storage header */
         if (dlt_check_storageheader(file->msg.storageheader) != DLT_RETURN_TRUE) {
-            /* Shift the position back to the place where it stared to read + 1 */
-            if (fseek(file->handle,
-                      (long) (1 - (sizeof(DltStorageHeader) + sizeof(DltStandardHeader))),
-                      SEEK_CUR) < 0) {
+            /* Shift the position back to the place where it stared to read + 1
+             * and skip to the next storage header pattern */
+            if ((fseek(file->handle,
+                       (long) (1 - (sizeof(DltStorageHeader) + sizeof(DltStandardHeader))),
+                       SEEK_CUR) < 0) ||
+                (dlt_file_skip_to_pattern(file, dltStorageHeaderPattern,
+                                          sizeof(dltStorageHeaderPattern)) < DLT_RETURN_OK)) {
                 dlt_log(LOG_WARNING, "DLT storage header pattern not found!\n");
                 return DLT_RETURN_ERROR;
             }
@@ -2837,18 +3031,16 @@ DltReturnValue dlt_file_read_header_raw(DltFile *file, int resync, int verbose)
             /* increase error counter */
             file->error_messages++;
 
-            /* resync to serial header */
-            do {
-                memmove(dltSerialHeaderBuffer, dltSerialHeaderBuffer + 1, sizeof(dltSerialHeader) - 1);
-
-                if (fread(dltSerialHeaderBuffer + 3, 1, 1, file->handle) != 1)
-                    /* cannot read any data, perhaps end of file reached */
-                    return DLT_RETURN_ERROR;
+            /* resync to serial header, starting one byte after the read data */
+            if ((fseek(file->handle, 1 - (long)sizeof(dltSerialHeaderBuffer), SEEK_CUR) < 0) ||
+                (dlt_file_skip_to_pattern(file, (const uint8_t *)dltSerialHeader,
+                                          sizeof(dltSerialHeader)) < DLT_RETURN_OK))
+                return DLT_RETURN_ERROR;
 
-                if (memcmp(dltSerialHeaderBuffer, dltSerialHeader, sizeof(dltSerialHeader)) == 0)
-                    /* serial header synchronised */
-                    break;
-            } while (1);
+            if ((fread(dltSerialHeaderBuffer, sizeof(dltSerialHeaderBuffer), 1, file->handle) != 1) ||
+                (memcmp(dltSerialHeaderBuffer, dltSerialHeader, sizeof(dltSerialHeader)) != 0))
+                /* cannot read any data, perhaps end of file reached */
+                return DLT_RETURN_ERROR;
         }
         else
         /* go back to last file position */
@@ -2989,6 +3181,233 @@ DltReturnValue dlt_file_read_data(DltFile *file, int verbose)
     return DLT_RETURN_OK;
 }
 
+/* Release the mapping of a memory mapped DLT file */
+static void dlt_file_unmap(DltFile *file)
+{
+    if ((file->priv == NULL) || (file->priv->map == NULL))
+        return;
+
+    munmap(file->priv->map, (size_t)file->file_length);
+    file->priv->map = NULL;
+}
+
+/* Renew the mapping if the file has grown, returns 1 if more data is available */
+static int dlt_file_remap(DltFile *file)
+{
+    struct stat st;
+    void *map;
+
+    if ((file->handle == NULL) || (fstat(fileno(file->handle), &st) != 0))
+        return 0;
+
+    if ((uint64_t)st.st_size <= file->file_length)
+        return 0;
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(file->handle), 0);
+
+    if (map == MAP_FAILED) {
+        dlt_vlog(LOG_WARNING, "Cannot remap file: %s\n", strerror(errno));
+        return 0;
+    }
+
+    dlt_file_unmap(file);
+    file->priv->map = (uint8_t *)map;
+    file->file_length = (uint64_t)st.st_size;
+
+    return 1;
+}
+
+/**
+ * Find the next complete message in the mapped content of a DLT file.
+ * Like dlt_file_read_header(), the storage header pattern is searched
+ * starting at position.
+ * @return DLT_RETURN_OK if a message was found, DLT_RETURN_ERROR at the end of the
+ * mapping or if the message is incomplete or broken
+ */
+static DltReturnValue dlt_file_map_next(const uint8_t *map,
+                                        uint64_t length,
+                                        uint64_t position,
+                                        uint64_t *offset,
+                                        int32_t *headersize,
+                                        int32_t *datasize)
+{
+    const DltStandardHeader *standardheader;
+    const uint64_t min_size = sizeof(DltStorageHeader) + sizeof(DltStandardHeader);
+    const uint8_t *pattern;
+    int32_t hsize;
+    int32_t dsize;
+
+    if (position + min_size > length)
+        return DLT_RETURN_ERROR;
+
+    /* Search storage header */
+    pattern = dlt_find_pattern(map + position,
+                               (size_t)(length - position),
+                               dltStorageHeaderPattern,
+                               sizeof(dltStorageHeaderPattern));
+
+    if (pattern == NULL)
+        return DLT_RETURN_ERROR;
+
+    position = (uint64_t)(pattern - map);
+
+    if (position + min_size > length)
+        return DLT_RETURN_ERROR;
+
+    standardheader = (const DltStandardHeader *)(map + position + sizeof(DltStorageHeader));
+
+    hsize = (int32_t)(min_size
+                      + DLT_STANDARD_HEADER_EXTRA_SIZE(standardheader->htyp)
+                      + (DLT_IS_HTYP_UEH(standardheader->htyp) ? (uint32_t)sizeof(DltExtendedHeader) : 0U));
+    dsize = DLT_BETOH_16(standardheader->len) + (int32_t)sizeof(DltStorageHeader) - hsize;
+
+    if (dsize < 0) {
+        dlt_vlog(LOG_WARNING,
+                 "Plausibility check failed. Complete message size too short! (%d)\n",
+                 dsize);
+        return DLT_RETURN_ERROR;
+    }
+
+    /* message is not yet completely written */
+    if (position + (uint64_t)hsize + (uint64_t)dsize > length)
+        return DLT_RETURN_ERROR;
+
+    *offset = position;
+    *headersize = hsize;
+    *datasize = dsize;
+
+    return DLT_RETURN_OK;
+}
+
+/* Check the filter against a message in the mapping, without copying it */
+static DltReturnValue dlt_file_map_filter_check(const DltFile *file,
+                                                uint64_t offset,
+                                                int32_t headersize,
+                                                int32_t datasize)
+{
+    uint8_t *map = dlt_file_get_map(file);
+    DltMessage msg;
+
+    msg.standardheader = (DltStandardHeader *)(map + offset + sizeof(DltStorageHeader));
+    msg.extendedheader = (DltExtendedHeader *)(map + offset + sizeof(DltStorageHeader) +
+                                               sizeof(DltStandardHeader) +
+                                               DLT_STANDARD_HEADER_EXTRA_SIZE(msg.standardheader->htyp));
+    msg.databuffer = map + offset + (uint64_t)headersize;
+    msg.datasize = datasize;
+
+    return dlt_file_filter_check(file, &msg, 0);
+}
+
+/* Fill a view of a message in the mapping */
+static void dlt_file_map_view(const uint8_t *map,
+                              uint64_t offset,
+                              int32_t headersize,
+                              int32_t datasize,
+                              DltMessageView *view)
+{
+    const uint8_t *extra = map + offset + sizeof(DltStorageHeader) + sizeof(DltStandardHeader);
+
+    view->offset = offset;
+    view->header = map + offset;
+    view->headersize = headersize;
+    view->payload = map + offset + (uint64_t)headersize;
+    view->datasize = datasize;
+    view->storageheader = (const DltStorageHeader *)view->header;
+    view->standardheader = (const DltStandardHeader *)(view->header + sizeof(DltStorageHeader));
+
+    memset(&view->headerextra, 0, sizeof(view->headerextra));
+
+    if (DLT_IS_HTYP_WEID(view->standardheader->htyp)) {
+        memcpy(view->headerextra.ecu, extra, DLT_ID_SIZE);
+        extra += DLT_SIZE_WEID;
+    }
+
+    if (DLT_IS_HTYP_WSID(view->standardheader->htyp)) {
+        memcpy(&view->headerextra.seid, extra, DLT_SIZE_WSID);
+        view->headerextra.seid = DLT_BETOH_32(view->headerextra.seid);
+        extra += DLT_SIZE_WSID;
+    }
+
+    if (DLT_IS_HTYP_WTMS(view->standardheader->htyp)) {
+        memcpy(&view->headerextra.tmsp, extra, DLT_SIZE_WTMS);
+        view->headerextra.tmsp = DLT_BETOH_32(view->headerextra.tmsp);
+        extra += DLT_SIZE_WTMS;
+    }
+
+    if (DLT_IS_HTYP_UEH(view->standardheader->htyp))
+        view->extendedheader = (const DltExtendedHeader *)extra;
+    else
+        view->extendedheader = NULL;
+}
+
+/* Copy the headers of a message in the mapping to the current message of the file */
+static void dlt_file_map_load_header(DltFile *file, uint64_t offset, int32_t headersize, int32_t datasize)
+{
+    memcpy(file->msg.headerbuffer, dlt_file_get_map(file) + offset, (size_t)headersize);
+
+    file->msg.storageheader = (DltStorageHeader *)file->msg.headerbuffer;
+    file->msg.standardheader = (DltStandardHeader *)(file->msg.headerbuffer + sizeof(DltStorageHeader));
+    file->msg.headersize = headersize;
+    file->msg.datasize = datasize;
+
+    dlt_message_get_extraparameters(&(file->msg), 0);
+
+    if (DLT_IS_HTYP_UEH(file->msg.standardheader->htyp))
+        file->msg.extendedheader =
+            (DltExtendedHeader *)(file->msg.headerbuffer + sizeof(DltStorageHeader) + sizeof(DltStandardHeader) +
+                                  DLT_STANDARD_HEADER_EXTRA_SIZE(file->msg.standardheader->htyp));
+    else
+        file->msg.extendedheader = NULL;
+}
+
+/* dlt_file_read() for memory mapped files, index memory is already available */
+static DltReturnValue dlt_file_read_mapped(DltFile *file, int verbose)
+{
+    uint64_t offset;
+    int32_t headersize;
+    int32_t datasize;
+    DltReturnValue found = DLT_RETURN_OK;
+
+    while (dlt_file_map_next(dlt_file_get_map(file), file->file_length, file->file_position,
+                             &offset, &headersize, &datasize) < DLT_RETURN_OK)
+        /* wait for a complete message if the file is still written */
+        if (!dlt_file_remap(file))
+            return DLT_RETURN_ERROR;
+
+    if (verbose)
+        dlt_vlog(LOG_DEBUG, "HeaderSize=%u, DataSize=%u\n", headersize, datasize);
+
+    dlt_file_map_load_header(file, offset, headersize, datasize);
+
+    if (!dlt_file_filtered(file) ||
+        (dlt_file_map_filter_check(file, offset, headersize, datasize) == DLT_RETURN_TRUE)) {
+        /* store index pointer to message position in DLT file */
+        file->index[file->counter] = (long)offset;
+        file->counter++;
+        file->position = file->counter - 1;
+
+        found = DLT_RETURN_TRUE;
+    }
+
+    /* increase total message counter */
+    file->counter_total++;
+
+    /* store position to next message */
+    file->file_position = offset + (uint64_t)headersize + (uint64_t)datasize;
+
+    return found;
+}
+
+/* Extend the index of a memory mapped file until it contains the message index */
+static DltReturnValue dlt_file_map_extend_index(DltFile *file, int index, int verbose)
+{
+    while (index >= file->counter)
+        if (dlt_file_read(file, verbose) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
 DltReturnValue dlt_file_open(DltFile *file, const char *filename, int verbose)
 {
     PRINT_FUNCTION_VERBOSE(verbose);
@@ -2996,6 +3415,8 @@ DltReturnValue dlt_file_open(DltFile *file, const char *filename, int verbose)
     if ((file == NULL) || (filename == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
+    dlt_file_unmap(file);
+
     /* reset counters */
     file->counter = 0;
     file->counter_total = 0;
@@ -3038,6 +3459,8 @@ DltReturnValue dlt_file_read(DltFile *file, int verbose)
 {
     long *ptr;
     int found = DLT_RETURN_OK;
+    int payload;
+    const DltFilterEngine *engine;
 
     if (file == NULL)
         return DLT_RETURN_WRONG_PARAMETER;
@@ -3060,6 +3483,9 @@ DltReturnValue dlt_file_read(DltFile *file, int verbose)
         file->index = ptr;
     }
 
+    if (dlt_file_get_map(file) != NULL)
+        return dlt_file_read_mapped(file, verbose);
+
     /* set to end of last succesful read message, because of conflicting calls to dlt_file_read and dlt_file_message */
     if (0 != fseek(file->handle, (long)file->file_position, SEEK_SET)) {
         dlt_vlog(LOG_WARNING, "Seek failed to file_position %" PRIu64 "\n",
@@ -3081,7 +3507,7 @@ DltReturnValue dlt_file_read(DltFile *file, int verbose)
         return DLT_RETURN_ERROR;
     }
 
-    if (file->filter) {
+    if (dlt_file_filtered(file)) {
         /* read the extended header if filter is enabled and extended header exists */
         if (dlt_file_read_header_extended(file, verbose) < DLT_RETURN_OK) {
             /* go back to last position in file */
@@ -3091,8 +3517,20 @@ DltReturnValue dlt_file_read(DltFile *file, int verbose)
             return DLT_RETURN_ERROR;
         }
 
+        /* payload rules of the filter need the payload, otherwise it is skipped */
+        engine = dlt_file_engine(file);
+        payload = (engine != NULL) && (engine->payload_rules > 0);
+
+        if (payload && (dlt_file_read_data(file, verbose) < DLT_RETURN_OK)) {
+            /* go back to last position in file */
+            if (0 != fseek(file->handle, (long)file->file_position, SEEK_SET))
+                dlt_vlog(LOG_WARNING, "Seek to last file pos failed!\n");
+
+            return DLT_RETURN_ERROR;
+        }
+
         /* check the filters if message is used */
-        if (dlt_message_filter_check(&(file->msg), file->filter, verbose) == DLT_RETURN_TRUE) {
+        if (dlt_file_filter_check(file, &(file->msg), verbose) == DLT_RETURN_TRUE) {
             /* filter matched, consequently store current message */
             /* store index pointer to message position in DLT file */
             file->index[file->counter] = (long)file->file_position;
@@ -3103,7 +3541,7 @@ DltReturnValue dlt_file_read(DltFile *file, int verbose)
         }
 
         /* skip payload data */
-        if (fseek(file->handle, (long)file->msg.datasize, SEEK_CUR) != 0) {
+        if (!payload && (fseek(file->handle, (long)file->msg.datasize, SEEK_CUR) != 0)) {
             /* go back to last position in file */
             dlt_vlog(LOG_WARNING,
                      "Seek failed to skip payload data of size %u!\n",
@@ -3234,6 +3672,8 @@ DltReturnValue dlt_file_close(DltFile *file, int verbose)
     if (file == NULL)
         return DLT_RETURN_WRONG_PARAMETER;
 
+    dlt_file_unmap(file);
+
     if (file->handle)
         fclose(file->handle);
 
@@ -3249,12 +3689,30 @@ DltReturnValue dlt_file_message(DltFile *file, int index, int verbose)
     if (file == NULL)
         return DLT_RETURN_WRONG_PARAMETER;
 
+    /* extend the index on demand for memory mapped files */
+    if ((dlt_file_get_map(file) != NULL) && (index >= file->counter) && (index >= 0))
+        dlt_file_map_extend_index(file, index, verbose);
+
     /* check if message is in range */
     if (index < 0 || index >= file->counter) {
         dlt_vlog(LOG_WARNING, "Message %d out of range!\r\n", index);
         return DLT_RETURN_WRONG_PARAMETER;
     }
 
+    if (dlt_file_get_map(file) != NULL) {
+        DltMessageView view;
+
+        if (dlt_file_message_view(file, index, &view, verbose) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+
+        if (dlt_message_copy_view(&(file->msg), &view, verbose) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+
+        file->position = index;
+
+        return DLT_RETURN_OK;
+    }
+
     /* seek to position in file */
     if (fseek(file->handle, file->index[index], SEEK_SET) != 0) {
         dlt_vlog(LOG_WARNING, "Seek to message %d to position %ld failed!\r\n",
@@ -3272,54 +3730,514 @@ DltReturnValue dlt_file_message(DltFile *file, int index, int verbose)
     if (dlt_file_read_data(file, verbose) < DLT_RETURN_OK)
         return DLT_RETURN_ERROR;
 
-    /* set current position in file */
-    file->position = index;
+    /* set current position in file */
+    file->position = index;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_free(DltFile *file, int verbose)
+{
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if (file == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    /* delete index lost if exists */
+    if (file->index)
+        free(file->index);
+
+    file->index = NULL;
+
+    dlt_file_unmap(file);
+
+    dlt_file_engine_free(file);
+    free(file->priv);
+    file->priv = NULL;
+
+    /* close file */
+    if (file->handle)
+        fclose(file->handle);
+
+    file->handle = NULL;
+
+    return dlt_message_free(&(file->msg), verbose);
+}
+
+DltReturnValue dlt_file_free_v2(DltFile *file, int verbose)
+{
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if (file == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    /* delete index lost if exists */
+    if (file->index)
+        free(file->index);
+
+    file->index = NULL;
+
+    dlt_file_unmap(file);
+
+    dlt_file_engine_free(file);
+    free(file->priv);
+    file->priv = NULL;
+
+    /* close file */
+    if (file->handle)
+        fclose(file->handle);
+
+    file->handle = NULL;
+
+    return dlt_message_free_v2(&(file->msgv2), verbose);
+}
+
+DltReturnValue dlt_file_open_mmap(DltFile *file, const char *filename, int verbose)
+{
+    void *map;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if (dlt_file_open(file, filename, verbose) < DLT_RETURN_OK)
+        return DLT_RETURN_ERROR;
+
+    if (file->file_length == 0)
+        return DLT_RETURN_OK;
+
+    if (dlt_file_get_private(file) == NULL)
+        return DLT_RETURN_ERROR;
+
+    map = mmap(NULL, (size_t)file->file_length, PROT_READ, MAP_PRIVATE, fileno(file->handle), 0);
+
+    if (map == MAP_FAILED) {
+        dlt_vlog(LOG_WARNING, "File %s cannot be mapped, using stdio: %s\n", filename, strerror(errno));
+        return DLT_RETURN_OK;
+    }
+
+    madvise(map, (size_t)file->file_length, MADV_SEQUENTIAL);
+    file->priv->map = (uint8_t *)map;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_is_mapped(const DltFile *file)
+{
+    if (file == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    return (dlt_file_get_map(file) != NULL) ? DLT_RETURN_TRUE : DLT_RETURN_OK;
+}
+
+/**
+ * Part of a memory mapped file indexed by one thread.
+ * Messages starting in [begin, end) are collected.
+ */
+typedef struct
+{
+    DltFile *file;
+    uint64_t begin;
+    uint64_t end;
+    uint64_t *offsets;   /**< offsets of the found messages */
+    uint8_t *matches;    /**< filter result of the found messages */
+    int32_t count;       /**< number of found messages */
+    int32_t size;        /**< number of allocated entries */
+    uint64_t next;       /**< position after the last found message */
+    int stopped;         /**< end of file or broken message reached */
+    int error;           /**< out of memory */
+} DltFileIndexChunk;
+
+static int dlt_file_index_chunk_add(DltFileIndexChunk *chunk, uint64_t offset, uint8_t match)
+{
+    if (chunk->count == chunk->size) {
+        int32_t size = chunk->size ? chunk->size * 2 : DLT_COMMON_INDEX_ALLOC;
+        uint64_t *offsets = (uint64_t *)realloc(chunk->offsets, (size_t)size * sizeof(uint64_t));
+        uint8_t *matches;
+
+        if (offsets == NULL)
+            return -1;
+
+        chunk->offsets = offsets;
+        matches = (uint8_t *)realloc(chunk->matches, (size_t)size);
+
+        if (matches == NULL)
+            return -1;
+
+        chunk->matches = matches;
+        chunk->size = size;
+    }
+
+    chunk->offsets[chunk->count] = offset;
+    chunk->matches[chunk->count] = match;
+    chunk->count++;
+
+    return 0;
+}
+
+static void *dlt_file_index_chunk_thread(void *arg)
+{
+    DltFileIndexChunk *chunk = (DltFileIndexChunk *)arg;
+    DltFile *file = chunk->file;
+    uint64_t position = chunk->begin;
+    uint64_t offset;
+    int32_t headersize;
+    int32_t datasize;
+    uint8_t match;
+
+    while (position < chunk->end) {
+        if (dlt_file_map_next(dlt_file_get_map(file), file->file_length, position,
+                              &offset, &headersize, &datasize) < DLT_RETURN_OK) {
+            chunk->stopped = 1;
+            break;
+        }
+
+        /* message belongs to the next chunk */
+        if (offset >= chunk->end)
+            break;
+
+        match = (uint8_t)(!dlt_file_filtered(file) ||
+                          (dlt_file_map_filter_check(file, offset, headersize, datasize) == DLT_RETURN_TRUE));
+
+        if (dlt_file_index_chunk_add(chunk, offset, match) < 0) {
+            chunk->error = 1;
+            break;
+        }
+
+        position = offset + (uint64_t)headersize + (uint64_t)datasize;
+    }
+
+    chunk->next = position;
+
+    return NULL;
+}
+
+/* Find a message offset in the sorted offsets of a chunk */
+static int32_t dlt_file_index_chunk_find(const DltFileIndexChunk *chunk, uint64_t offset)
+{
+    int32_t low = 0;
+    int32_t high = chunk->count - 1;
+
+    while (low <= high) {
+        int32_t mid = low + (high - low) / 2;
+
+        if (chunk->offsets[mid] == offset)
+            return mid;
+
+        if (chunk->offsets[mid] < offset)
+            low = mid + 1;
+        else
+            high = mid - 1;
+    }
+
+    return -1;
+}
+
+/* Append a message to the index of the file, keeping the allocation scheme of dlt_file_read() */
+static DltReturnValue dlt_file_index_append(DltFile *file, uint64_t offset, uint8_t match)
+{
+    long *ptr;
+
+    if (match) {
+        if (file->counter % DLT_COMMON_INDEX_ALLOC == 0) {
+            ptr = (long *)realloc(file->index,
+                                  (size_t)((file->counter / DLT_COMMON_INDEX_ALLOC) + 1) *
+                                  (size_t)DLT_COMMON_INDEX_ALLOC * sizeof(long));
+
+            if (ptr == NULL)
+                return DLT_RETURN_ERROR;
+
+            file->index = ptr;
+        }
+
+        file->index[file->counter] = (long)offset;
+        file->counter++;
+    }
+
+    file->counter_total++;
+
+    return DLT_RETURN_OK;
+}
+
+/*
+ * Every chunk starts parsing at the first storage header pattern found after
+ * its begin, which may be located inside the payload of a message. The
+ * chunks are therefore joined sequentially: starting at the position where
+ * the previous chunk stopped, messages are parsed one by one until a message
+ * offset is reached which the chunk has found as well. From then on the
+ * result of the chunk is identical to a sequential parse and is taken over.
+ */
+static DltReturnValue dlt_file_index_join(DltFile *file, DltFileIndexChunk *chunks, int count)
+{
+    uint64_t position = 0;
+    uint64_t offset;
+    int32_t headersize;
+    int32_t datasize;
+    int32_t found;
+    int32_t i;
+    int c;
+
+    for (c = 0; c < count; c++) {
+        DltFileIndexChunk *chunk = &chunks[c];
+
+        if (chunk->error)
+            return DLT_RETURN_ERROR;
+
+        while (1) {
+            if (dlt_file_map_next(dlt_file_get_map(file), file->file_length, position,
+                                  &offset, &headersize, &datasize) < DLT_RETURN_OK) {
+                file->file_position = position;
+                return DLT_RETURN_OK;
+            }
+
+            if (offset >= chunk->end)
+                /* chunk contains no message of the sequential parse */
+                break;
+
+            found = dlt_file_index_chunk_find(chunk, offset);
+
+            if (found >= 0) {
+                for (i = found; i < chunk->count; i++)
+                    if (dlt_file_index_append(file, chunk->offsets[i], chunk->matches[i]) < DLT_RETURN_OK)
+                        return DLT_RETURN_ERROR;
+
+                position = chunk->next;
+
+                if (chunk->stopped) {
+                    file->file_position = position;
+                    return DLT_RETURN_OK;
+                }
+
+                break;
+            }
+
+            if (dlt_file_index_append(file, offset,
+                                      (uint8_t)(!dlt_file_filtered(file) ||
+                                                (dlt_file_map_filter_check(file, offset, headersize,
+                                                                           datasize) == DLT_RETURN_TRUE)))
+                < DLT_RETURN_OK)
+                return DLT_RETURN_ERROR;
+
+            position = offset + (uint64_t)headersize + (uint64_t)datasize;
+        }
+    }
+
+    file->file_position = position;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_build_index(DltFile *file, int threads, int verbose)
+{
+    DltFileIndexChunk *chunks;
+    pthread_t *tids;
+    uint64_t chunk_size;
+    DltReturnValue ret;
+    int started = 0;
+    int i;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((file == NULL) || (threads < 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (int)cpus : 1;
+    }
+
+    if ((uint64_t)threads > file->file_length / DLT_COMMON_INDEX_CHUNK_MIN)
+        threads = (int)(file->file_length / DLT_COMMON_INDEX_CHUNK_MIN);
+
+    /* restart indexing from the beginning of the file */
+    file->counter = 0;
+    file->counter_total = 0;
+    file->position = 0;
+    file->file_position = 0;
+
+    if ((dlt_file_get_map(file) == NULL) || (threads <= 1)) {
+        while (dlt_file_read(file, verbose) >= DLT_RETURN_OK) {}
+
+        return DLT_RETURN_OK;
+    }
+
+    chunks = (DltFileIndexChunk *)calloc((size_t)threads, sizeof(DltFileIndexChunk));
+    tids = (pthread_t *)calloc((size_t)threads, sizeof(pthread_t));
+
+    if ((chunks == NULL) || (tids == NULL)) {
+        free(chunks);
+        free(tids);
+        return DLT_RETURN_ERROR;
+    }
+
+    chunk_size = file->file_length / (uint64_t)threads;
+
+    for (i = 0; i < threads; i++) {
+        chunks[i].file = file;
+        chunks[i].begin = (uint64_t)i * chunk_size;
+        chunks[i].end = (i == threads - 1) ? file->file_length : (uint64_t)(i + 1) * chunk_size;
+    }
+
+    /* the first chunk is parsed by the calling thread */
+    for (i = 1; i < threads; i++) {
+        if (pthread_create(&tids[i], NULL, dlt_file_index_chunk_thread, &chunks[i]) != 0)
+            /* parse remaining chunks in the calling thread */
+            break;
+
+        started = i;
+    }
+
+    dlt_file_index_chunk_thread(&chunks[0]);
+
+    for (i = started + 1; i < threads; i++)
+        dlt_file_index_chunk_thread(&chunks[i]);
+
+    for (i = 1; i <= started; i++)
+        pthread_join(tids[i], NULL);
+
+    ret = dlt_file_index_join(file, chunks, threads);
+
+    if (file->counter > 0)
+        file->position = file->counter - 1;
+
+    if (verbose)
+        dlt_vlog(LOG_DEBUG, "Indexed %d of %d messages with %d threads\n",
+                 file->counter, file->counter_total, threads);
+
+    for (i = 0; i < threads; i++) {
+        free(chunks[i].offsets);
+        free(chunks[i].matches);
+    }
+
+    free(chunks);
+    free(tids);
+
+    return ret;
+}
+
+DltReturnValue dlt_file_message_view(DltFile *file, int index, DltMessageView *view, int verbose)
+{
+    uint64_t offset;
+    int32_t headersize;
+    int32_t datasize;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((file == NULL) || (view == NULL) || (dlt_file_get_map(file) == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if ((index >= file->counter) && (index >= 0))
+        dlt_file_map_extend_index(file, index, verbose);
+
+    /* check if message is in range */
+    if ((index < 0) || (index >= file->counter)) {
+        dlt_vlog(LOG_WARNING, "Message %d out of range!\r\n", index);
+        return DLT_RETURN_WRONG_PARAMETER;
+    }
+
+    if (dlt_file_map_next(dlt_file_get_map(file), file->file_length, (uint64_t)file->index[index],
+                          &offset, &headersize, &datasize) < DLT_RETURN_OK)
+        return DLT_RETURN_ERROR;
+
+    dlt_file_map_view(dlt_file_get_map(file), offset, headersize, datasize, view);
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_iterator_init(DltFileIterator *iterator, DltFile *file)
+{
+    if ((iterator == NULL) || (file == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    iterator->file = file;
+    iterator->position = 0;
 
     return DLT_RETURN_OK;
 }
 
-DltReturnValue dlt_file_free(DltFile *file, int verbose)
+DltReturnValue dlt_file_iterator_next(DltFileIterator *iterator, DltMessageView *view, int verbose)
 {
+    DltFile *file;
+    uint64_t offset;
+    int32_t headersize;
+    int32_t datasize;
+
     PRINT_FUNCTION_VERBOSE(verbose);
 
-    if (file == NULL)
+    if ((iterator == NULL) || (view == NULL) || (iterator->file == NULL))
         return DLT_RETURN_WRONG_PARAMETER;
 
-    /* delete index lost if exists */
-    if (file->index)
-        free(file->index);
+    file = iterator->file;
 
-    file->index = NULL;
+    if (dlt_file_get_map(file) == NULL)
+        /* empty files are not mapped */
+        return (file->file_length == 0) ? DLT_RETURN_OK : DLT_RETURN_WRONG_PARAMETER;
 
-    /* close file */
-    if (file->handle)
-        fclose(file->handle);
+    while (1) {
+        if (dlt_file_map_next(dlt_file_get_map(file), file->file_length, iterator->position,
+                              &offset, &headersize, &datasize) < DLT_RETURN_OK)
+            return DLT_RETURN_OK;
 
-    file->handle = NULL;
+        iterator->position = offset + (uint64_t)headersize + (uint64_t)datasize;
 
-    return dlt_message_free(&(file->msg), verbose);
+        if (!dlt_file_filtered(file) ||
+            (dlt_file_map_filter_check(file, offset, headersize, datasize) == DLT_RETURN_TRUE))
+            break;
+    }
+
+    dlt_file_map_view(dlt_file_get_map(file), offset, headersize, datasize, view);
+
+    return DLT_RETURN_TRUE;
 }
 
-DltReturnValue dlt_file_free_v2(DltFile *file, int verbose)
+DltReturnValue dlt_message_copy_view(DltMessage *msg, const DltMessageView *view, int verbose)
 {
     PRINT_FUNCTION_VERBOSE(verbose);
 
-    if (file == NULL)
+    /* views of received messages start with the standard header */
+    size_t storagesize = (view != NULL && view->storageheader == NULL) ? sizeof(DltStorageHeader) : 0;
+
+    if ((msg == NULL) || (view == NULL) || (view->header == NULL) ||
+        ((size_t)view->headersize + storagesize > sizeof(msg->headerbuffer)))
         return DLT_RETURN_WRONG_PARAMETER;
 
-    /* delete index lost if exists */
-    if (file->index)
-        free(file->index);
+    if (storagesize > 0)
+        memset(msg->headerbuffer, 0, storagesize);
 
-    file->index = NULL;
+    memcpy(msg->headerbuffer + storagesize, view->header, (size_t)view->headersize);
 
-    /* close file */
-    if (file->handle)
-        fclose(file->handle);
+    msg->storageheader = (DltStorageHeader *)msg->headerbuffer;
+    msg->standardheader = (DltStandardHeader *)(msg->headerbuffer + sizeof(DltStorageHeader));
+    msg->headersize = (int32_t)((size_t)view->headersize + storagesize);
+    msg->datasize = view->datasize;
+    msg->headerextra = view->headerextra;
 
-    file->handle = NULL;
+    if (view->extendedheader)
+        msg->extendedheader = (DltExtendedHeader *)(msg->headerbuffer + storagesize +
+                                                    ((const uint8_t *)view->extendedheader - view->header));
+    else
+        msg->extendedheader = NULL;
 
-    return dlt_message_free_v2(&(file->msgv2), verbose);
+    /* reuse payload buffer if big enough */
+    if (msg->databuffer && (msg->databuffersize < msg->datasize)) {
+        free(msg->databuffer);
+        msg->databuffer = NULL;
+    }
+
+    if (msg->databuffer == NULL) {
+        msg->databuffer = (uint8_t *)malloc((size_t)(msg->datasize > 0 ? msg->datasize : 1));
+        msg->databuffersize = msg->datasize;
+
+        if (msg->databuffer == NULL) {
+            dlt_vlog(LOG_WARNING,
+                     "Cannot allocate memory for payload buffer of size %u!\n",
+                     msg->datasize);
+            return DLT_RETURN_ERROR;
+        }
+    }
+
+    if (msg->datasize > 0)
+        memcpy(msg->databuffer, view->payload, (size_t)msg->datasize);
+
+    return DLT_RETURN_OK;
 }
 
 #if defined DLT_DAEMON_USE_FIFO_IPC || defined DLT_LIB_USE_FIFO_IPC
@@ -3702,6 +4620,298 @@ DltReturnValue dlt_check_storageheader_v2(DltStorageHeaderV2 *storageheader)
            ? DLT_RETURN_TRUE : DLT_RETURN_OK;
 }
 
+/*
+ * The vectorized pattern search compares the first and the last byte of the
+ * pattern for a whole vector of start positions at once. Only the positions
+ * where both bytes match are compared completely with memcmp(). The scalar
+ * functions search the remaining positions which do not fill a vector.
+ */
+static const uint8_t *dlt_find_pattern_scalar(const uint8_t *buffer,
+                                              size_t length,
+                                              const uint8_t *pattern,
+                                              size_t pattern_length)
+{
+    const uint8_t *end;
+    const uint8_t *position = buffer;
+
+    if (length < pattern_length)
+        return NULL;
+
+    end = buffer + length - pattern_length + 1;
+
+    while (position < end) {
+        position = memchr(position, pattern[0], (size_t)(end - position));
+
+        if (position == NULL)
+            return NULL;
+
+        if (memcmp(position, pattern, pattern_length) == 0)
+            return position;
+
+        position++;
+    }
+
+    return NULL;
+}
+
+static const uint8_t *dlt_find_last_pattern_scalar(const uint8_t *buffer,
+                                                   size_t length,
+                                                   const uint8_t *pattern,
+                                                   size_t pattern_length)
+{
+    size_t i;
+
+    if (length < pattern_length)
+        return NULL;
+
+    for (i = length - pattern_length + 1; i > 0; i--)
+        if ((buffer[i - 1] == pattern[0]) &&
+            (memcmp(buffer + i - 1, pattern, pattern_length) == 0))
+            return buffer + i - 1;
+
+    return NULL;
+}
+
+#ifdef DLT_PATTERN_SSE2
+static const uint8_t *dlt_find_pattern_sse2(const uint8_t *buffer,
+                                            size_t length,
+                                            const uint8_t *pattern,
+                                            size_t pattern_length)
+{
+    const __m128i first = _mm_set1_epi8((char)pattern[0]);
+    const __m128i last = _mm_set1_epi8((char)pattern[pattern_length - 1]);
+    const size_t positions = length - pattern_length + 1;
+    size_t i;
+
+    for (i = 0; i + sizeof(__m128i) <= positions; i += sizeof(__m128i)) {
+        const __m128i block_first = _mm_loadu_si128((const __m128i *)(const void *)(buffer + i));
+        const __m128i block_last =
+            _mm_loadu_si128((const __m128i *)(const void *)(buffer + i + pattern_length - 1));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                                                                  _mm_cmpeq_epi8(last, block_last)));
+
+        while (mask != 0) {
+            const size_t bit = (size_t)__builtin_ctz(mask);
+
+            if (memcmp(buffer + i + bit, pattern, pattern_length) == 0)
+                return buffer + i + bit;
+
+            mask &= mask - 1;
+        }
+    }
+
+    return dlt_find_pattern_scalar(buffer + i, length - i, pattern, pattern_length);
+}
+
+static const uint8_t *dlt_find_last_pattern_sse2(const uint8_t *buffer,
+                                                 size_t length,
+                                                 const uint8_t *pattern,
+                                                 size_t pattern_length)
+{
+    const __m128i first = _mm_set1_epi8((char)pattern[0]);
+    const __m128i last = _mm_set1_epi8((char)pattern[pattern_length - 1]);
+    size_t i = length - pattern_length + 1;
+
+    while (i >= sizeof(__m128i)) {
+        i -= sizeof(__m128i);
+
+        const __m128i block_first = _mm_loadu_si128((const __m128i *)(const void *)(buffer + i));
+        const __m128i block_last =
+            _mm_loadu_si128((const __m128i *)(const void *)(buffer + i + pattern_length - 1));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+                                                                  _mm_cmpeq_epi8(last, block_last)));
+
+        while (mask != 0) {
+            const size_t bit = (size_t)(31 - __builtin_clz(mask));
+
+            if (memcmp(buffer + i + bit, pattern, pattern_length) == 0)
+                return buffer + i + bit;
+
+            mask &= ~(1U << bit);
+        }
+    }
+
+    return dlt_find_last_pattern_scalar(buffer, i + pattern_length - 1, pattern, pattern_length);
+}
+#endif
+
+#ifdef DLT_PATTERN_AVX2
+__attribute__((target("avx2")))
+static const uint8_t *dlt_find_pattern_avx2(const uint8_t *buffer,
+                                            size_t length,
+                                            const uint8_t *pattern,
+                                            size_t pattern_length)
+{
+    const __m256i first = _mm256_set1_epi8((char)pattern[0]);
+    const __m256i last = _mm256_set1_epi8((char)pattern[pattern_length - 1]);
+    const size_t positions = length - pattern_length + 1;
+    size_t i;
+
+    for (i = 0; i + sizeof(__m256i) <= positions; i += sizeof(__m256i)) {
+        const __m256i block_first = _mm256_loadu_si256((const __m256i *)(const void *)(buffer + i));
+        const __m256i block_last =
+            _mm256_loadu_si256((const __m256i *)(const void *)(buffer + i + pattern_length - 1));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                                                                        _mm256_cmpeq_epi8(last, block_last)));
+
+        while (mask != 0) {
+            const size_t bit = (size_t)__builtin_ctz(mask);
+
+            if (memcmp(buffer + i + bit, pattern, pattern_length) == 0)
+                return buffer + i + bit;
+
+            mask &= mask - 1;
+        }
+    }
+
+    return dlt_find_pattern_scalar(buffer + i, length - i, pattern, pattern_length);
+}
+
+__attribute__((target("avx2")))
+static const uint8_t *dlt_find_last_pattern_avx2(const uint8_t *buffer,
+                                                 size_t length,
+                                                 const uint8_t *pattern,
+                                                 size_t pattern_length)
+{
+    const __m256i first = _mm256_set1_epi8((char)pattern[0]);
+    const __m256i last = _mm256_set1_epi8((char)pattern[pattern_length - 1]);
+    size_t i = length - pattern_length + 1;
+
+    while (i >= sizeof(__m256i)) {
+        i -= sizeof(__m256i);
+
+        const __m256i block_first = _mm256_loadu_si256((const __m256i *)(const void *)(buffer + i));
+        const __m256i block_last =
+            _mm256_loadu_si256((const __m256i *)(const void *)(buffer + i + pattern_length - 1));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                                                                        _mm256_cmpeq_epi8(last, block_last)));
+
+        while (mask != 0) {
+            const size_t bit = (size_t)(31 - __builtin_clz(mask));
+
+            if (memcmp(buffer + i + bit, pattern, pattern_length) == 0)
+                return buffer + i + bit;
+
+            mask &= ~(1U << bit);
+        }
+    }
+
+    return dlt_find_last_pattern_scalar(buffer, i + pattern_length - 1, pattern, pattern_length);
+}
+#endif
+
+#ifdef DLT_PATTERN_NEON
+/* NEON has no movemask, blocks with a candidate are checked position by position */
+static const uint8_t *dlt_find_pattern_neon(const uint8_t *buffer,
+                                            size_t length,
+                                            const uint8_t *pattern,
+                                            size_t pattern_length)
+{
+    const uint8x16_t first = vdupq_n_u8(pattern[0]);
+    const uint8x16_t last = vdupq_n_u8(pattern[pattern_length - 1]);
+    const size_t positions = length - pattern_length + 1;
+    uint8_t candidates[sizeof(uint8x16_t)];
+    size_t i;
+    size_t j;
+
+    for (i = 0; i + sizeof(uint8x16_t) <= positions; i += sizeof(uint8x16_t)) {
+        const uint8x16_t match = vandq_u8(vceqq_u8(first, vld1q_u8(buffer + i)),
+                                          vceqq_u8(last, vld1q_u8(buffer + i + pattern_length - 1)));
+
+        if (vmaxvq_u8(match) == 0)
+            continue;
+
+        vst1q_u8(candidates, match);
+
+        for (j = 0; j < sizeof(candidates); j++)
+            if (candidates[j] && (memcmp(buffer + i + j, pattern, pattern_length) == 0))
+                return buffer + i + j;
+    }
+
+    return dlt_find_pattern_scalar(buffer + i, length - i, pattern, pattern_length);
+}
+
+static const uint8_t *dlt_find_last_pattern_neon(const uint8_t *buffer,
+                                                 size_t length,
+                                                 const uint8_t *pattern,
+                                                 size_t pattern_length)
+{
+    const uint8x16_t first = vdupq_n_u8(pattern[0]);
+    const uint8x16_t last = vdupq_n_u8(pattern[pattern_length - 1]);
+    uint8_t candidates[sizeof(uint8x16_t)];
+    size_t i = length - pattern_length + 1;
+    size_t j;
+
+    while (i >= sizeof(uint8x16_t)) {
+        i -= sizeof(uint8x16_t);
+
+        const uint8x16_t match = vandq_u8(vceqq_u8(first, vld1q_u8(buffer + i)),
+                                          vceqq_u8(last, vld1q_u8(buffer + i + pattern_length - 1)));
+
+        if (vmaxvq_u8(match) == 0)
+            continue;
+
+        vst1q_u8(candidates, match);
+
+        for (j = sizeof(candidates); j > 0; j--)
+            if (candidates[j - 1] && (memcmp(buffer + i + j - 1, pattern, pattern_length) == 0))
+                return buffer + i + j - 1;
+    }
+
+    return dlt_find_last_pattern_scalar(buffer, i + pattern_length - 1, pattern, pattern_length);
+}
+#endif
+
+const uint8_t *dlt_find_pattern(const uint8_t *buffer,
+                                size_t length,
+                                const uint8_t *pattern,
+                                size_t pattern_length)
+{
+    if ((buffer == NULL) || (pattern == NULL) || (pattern_length == 0) || (length < pattern_length))
+        return NULL;
+
+    if (length < DLT_COMMON_PATTERN_VECTOR_MIN)
+        return dlt_find_pattern_scalar(buffer, length, pattern, pattern_length);
+
+#ifdef DLT_PATTERN_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        return dlt_find_pattern_avx2(buffer, length, pattern, pattern_length);
+#endif
+
+#if defined DLT_PATTERN_SSE2
+    return dlt_find_pattern_sse2(buffer, length, pattern, pattern_length);
+#elif defined DLT_PATTERN_NEON
+    return dlt_find_pattern_neon(buffer, length, pattern, pattern_length);
+#else
+    return dlt_find_pattern_scalar(buffer, length, pattern, pattern_length);
+#endif
+}
+
+const uint8_t *dlt_find_last_pattern(const uint8_t *buffer,
+                                     size_t length,
+                                     const uint8_t *pattern,
+                                     size_t pattern_length)
+{
+    if ((buffer == NULL) || (pattern == NULL) || (pattern_length == 0) || (length < pattern_length))
+        return NULL;
+
+    if (length < DLT_COMMON_PATTERN_VECTOR_MIN)
+        return dlt_find_last_pattern_scalar(buffer, length, pattern, pattern_length);
+
+#ifdef DLT_PATTERN_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        return dlt_find_last_pattern_avx2(buffer, length, pattern, pattern_length);
+#endif
+
+#if defined DLT_PATTERN_SSE2
+    return dlt_find_last_pattern_sse2(buffer, length, pattern, pattern_length);
+#elif defined DLT_PATTERN_NEON
+    return dlt_find_last_pattern_neon(buffer, length, pattern, pattern_length);
+#else
+    return dlt_find_last_pattern_scalar(buffer, length, pattern, pattern_length);
+#endif
+}
+
 DltReturnValue dlt_buffer_init_static_server(DltBuffer *buf, const unsigned char *ptr, uint32_t size)
 {
     if ((buf == NULL) || (ptr == NULL))
@@ -3962,7 +5172,13 @@ int dlt_buffer_increase_size(DltBuffer *buf)
     head = (DltBufferHead *)buf->shm;
     new_head = (DltBufferHead *)new_ptr;
 
-    if (head->read < head->write) {
+    if (head->count == 0) {
+        /* empty, read and write may point anywhere */
+        new_head->read = 0;
+        new_head->write = 0;
+        new_head->count = 0;
+    }
+    else if (head->read < head->write) {
         memcpy(new_ptr + sizeof(DltBufferHead), buf->mem + head->read, (size_t)(head->write - head->read));
         new_head->read = 0;
         new_head->write = head->write - head->read;
@@ -6379,9 +7595,9 @@ DltReturnValue dlt_file_quick_parsing(DltFile *file, const char *filename,
         if (ret < DLT_RETURN_OK)
             break;
 
-        if (file->filter) {
+        if (dlt_file_filtered(file)) {
             /* check the filters if message is used */
-            ret = dlt_message_filter_check(&(file->msg), file->filter, verbose);
+            ret = dlt_file_filter_check(file, &(file->msg), verbose);
 
             if (ret != DLT_RETURN_TRUE)
                 continue;
@@ -6510,14 +7726,56 @@ bool dlt_extract_base_name_without_ext(const char* const abs_file_name, char* ba
 }
 
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
+/* The time of the last update of DltTraceLoadStat.window_load is kept in units of
+ * 1 << DLT_TRACE_LOAD_TIME_SHIFT timestamps (6.4 msec). This leaves 38 bits for the bytes
+ * of the window, enough for a hard limit of UINT32_MAX bytes/sec over a window of 64 sec. */
+#define DLT_TRACE_LOAD_TIME_SHIFT   (6)
+#define DLT_TRACE_LOAD_TIME_MASK    (UINT32_MAX >> DLT_TRACE_LOAD_TIME_SHIFT)
+#define DLT_TRACE_LOAD_BYTES_BITS   (32 + DLT_TRACE_LOAD_TIME_SHIFT)
+#define DLT_TRACE_LOAD_BYTES_MAX    ((UINT64_C(1) << DLT_TRACE_LOAD_BYTES_BITS) - 1)
+#define DLT_TRACE_LOAD_WINDOW_TIME  (TIMESTAMP_BASED_WINDOW_SIZE >> DLT_TRACE_LOAD_TIME_SHIFT)
+
+#if (DLT_TRACE_LOAD_WINDOW_SIZE * DLT_TRACE_LOAD_WINDOW_RESOLUTION) > (DLT_TIMESTAMP_RESOLUTION << DLT_TRACE_LOAD_TIME_SHIFT)
+#   error "Trace load window is too large for the bytes of DltTraceLoadStat.window_load"
+#endif
+
+/* Check if timestamp is before earlier. Messages of several threads may be checked out of order,
+ * a difference larger than the window is taken as rollover of the timestamp, after ~119 hours */
+static inline bool dlt_trace_load_is_before(const uint32_t timestamp, const uint32_t earlier)
+{
+    return (uint32_t)(earlier - timestamp) - 1U < TIMESTAMP_BASED_WINDOW_SIZE;
+}
+
+/* Claim the output of a warning message, only one per frequency slots is output.
+ * The caller which swaps the timestamp of the last warning outputs it. */
+static bool dlt_trace_load_warning_due(
+    uint32_t *const last_warn,
+    const uint32_t timestamp,
+    const uint32_t frequency)
+{
+    uint32_t last = __atomic_load_n(last_warn, __ATOMIC_RELAXED);
+
+    if ((last != 0) &&
+        (((uint32_t)(timestamp - last) < frequency * DLT_TRACE_LOAD_WINDOW_RESOLUTION) ||
+         dlt_trace_load_is_before(timestamp, last)))
+    {
+        return false;
+    }
+
+    /* 0 means that no warning was output yet */
+    return __atomic_compare_exchange_n(last_warn, &last, (timestamp != 0) ? timestamp : 1U,
+                                       false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
 static int32_t dlt_output_soft_limit_over_warning(
     DltTraceLoadSettings* const tl_settings,
     DltLogInternal log_internal,
-    void *const log_params)
+    void *const log_params,
+    const uint32_t timestamp)
 {
     char local_str[255];
 
-    if (!tl_settings || !tl_settings->tl_stat.is_over_soft_limit || tl_settings->tl_stat.slot_left_soft_limit_warn)
+    if (!tl_settings || !__atomic_load_n(&tl_settings->tl_stat.is_over_soft_limit, __ATOMIC_RELAXED))
     {
         /* No need to output warning message */
         return 0;
@@ -6525,14 +7783,22 @@ static int32_t dlt_output_soft_limit_over_warning(
 
     /* Calculate extra trace load which was over limit */
     const uint64_t dropped_message_load
-        = (tl_settings->tl_stat.hard_limit_over_bytes * DLT_TIMESTAMP_RESOLUTION)
-          / TIMESTAMP_BASED_WINDOW_SIZE;
-    const uint64_t curr_trace_load = tl_settings->tl_stat.avg_trace_load + dropped_message_load;
+        = ((uint64_t)__atomic_load_n(&tl_settings->tl_stat.hard_limit_over_bytes, __ATOMIC_RELAXED)
+           * DLT_TIMESTAMP_RESOLUTION) / TIMESTAMP_BASED_WINDOW_SIZE;
+    const uint64_t curr_trace_load
+        = __atomic_load_n(&tl_settings->tl_stat.avg_trace_load, __ATOMIC_RELAXED) + dropped_message_load;
     if (curr_trace_load <= tl_settings->soft_limit) {
         /* No need to output warning message */
         return 0;
     }
 
+    if (!dlt_trace_load_warning_due(&tl_settings->tl_stat.last_soft_limit_warn, timestamp,
+                                    DLT_SOFT_LIMIT_WARN_FREQUENCY))
+    {
+        /* Warning was output recently or is output by another thread */
+        return 0;
+    }
+
     /* Warning for exceeded soft limit */
     if (tl_settings->ctid[0] == 0) {
         snprintf(local_str, sizeof(local_str),
@@ -6561,8 +7827,7 @@ static int32_t dlt_output_soft_limit_over_warning(
     }
 
     /* Turn off the flag after sending warning message */
-    tl_settings->tl_stat.is_over_soft_limit = false;
-    tl_settings->tl_stat.slot_left_soft_limit_warn = DLT_SOFT_LIMIT_WARN_FREQUENCY;
+    __atomic_store_n(&tl_settings->tl_stat.is_over_soft_limit, false, __ATOMIC_RELAXED);
 
     return sent_size;
 }
@@ -6570,10 +7835,11 @@ static int32_t dlt_output_soft_limit_over_warning(
 static int32_t dlt_output_hard_limit_warning(
     DltTraceLoadSettings* const tl_settings,
     DltLogInternal log_internal,
-    void *const log_params)
+    void *const log_params,
+    const uint32_t timestamp)
 {
     char local_str[255];
-    if (!tl_settings || !tl_settings->tl_stat.is_over_hard_limit || tl_settings->tl_stat.slot_left_hard_limit_warn)
+    if (!tl_settings || !__atomic_load_n(&tl_settings->tl_stat.is_over_hard_limit, __ATOMIC_RELAXED))
     {
         /* No need to output warning message */
         return 0;
@@ -6581,14 +7847,27 @@ static int32_t dlt_output_hard_limit_warning(
 
     /* Calculate extra trace load which was over limit */
     const uint64_t dropped_message_load
-        = (tl_settings->tl_stat.hard_limit_over_bytes * DLT_TIMESTAMP_RESOLUTION)
-          / TIMESTAMP_BASED_WINDOW_SIZE;
-    const uint64_t curr_trace_load = tl_settings->tl_stat.avg_trace_load + dropped_message_load;
+        = ((uint64_t)__atomic_load_n(&tl_settings->tl_stat.hard_limit_over_bytes, __ATOMIC_RELAXED)
+           * DLT_TIMESTAMP_RESOLUTION) / TIMESTAMP_BASED_WINDOW_SIZE;
+    const uint64_t curr_trace_load
+        = __atomic_load_n(&tl_settings->tl_stat.avg_trace_load, __ATOMIC_RELAXED) + dropped_message_load;
     if (curr_trace_load <= tl_settings->hard_limit) {
         /* No need to output warning message */
         return 0;
     }
 
+    if (!dlt_trace_load_warning_due(&tl_settings->tl_stat.last_hard_limit_warn, timestamp,
+                                    DLT_HARD_LIMIT_WARN_FREQUENCY))
+    {
+        /* Warning was output recently or is output by another thread */
+        return 0;
+    }
+
+    /* Take the discarded messages counted so far, later ones go to the next warning */
+    const uint32_t hard_limit_over_counter =
+        __atomic_exchange_n(&tl_settings->tl_stat.hard_limit_over_counter, 0U, __ATOMIC_RELAXED);
+    __atomic_store_n(&tl_settings->tl_stat.hard_limit_over_bytes, 0U, __ATOMIC_RELAXED);
+
     if (tl_settings->ctid[0] == 0) {
         snprintf(local_str, sizeof(local_str),
                  "Trace load exceeded trace hard limit on apid %.4s "
@@ -6596,7 +7875,7 @@ static int32_t dlt_output_hard_limit_warning(
                  tl_settings->apid,
                  tl_settings->hard_limit,
                  curr_trace_load,
-                 tl_settings->tl_stat.hard_limit_over_counter);
+                 hard_limit_over_counter);
     } else {
         snprintf(local_str, sizeof(local_str),
                  "Trace load exceeded trace hard limit on apid %.4s, ctid %.4s."
@@ -6605,7 +7884,7 @@ static int32_t dlt_output_hard_limit_warning(
                  tl_settings->ctid,
                  tl_settings->hard_limit,
                  curr_trace_load,
-                 tl_settings->tl_stat.hard_limit_over_counter);
+                 hard_limit_over_counter);
     }
 
     // must be signed int for error return
@@ -6618,165 +7897,77 @@ static int32_t dlt_output_hard_limit_warning(
     }
 
     /* Turn off the flag after sending warning message */
-    tl_settings->tl_stat.is_over_hard_limit = false;
-    tl_settings->tl_stat.hard_limit_over_counter = 0;
-    tl_settings->tl_stat.hard_limit_over_bytes = 0;
-    tl_settings->tl_stat.slot_left_hard_limit_warn = DLT_HARD_LIMIT_WARN_FREQUENCY;
+    __atomic_store_n(&tl_settings->tl_stat.is_over_hard_limit, false, __ATOMIC_RELAXED);
 
     return sent_size;
 }
 
-static bool dlt_user_cleanup_window(DltTraceLoadStat *const tl_stat)
-{
-    if (!tl_stat)
-    {
-        return false;
-    }
-
-    uint32_t elapsed_slots  = 0;
-    /* check if overflow of timestamp happened, after ~119 hours */
-    if (tl_stat->curr_abs_slot < tl_stat->last_abs_slot) {
-        /* calculate where the next slot starts according to the last slot
-         * This works because the value after the uint32 rollover equals is equal to the remainder that did not fit
-         * into uint32 before. Therefore, we always have slots that are DLT_TIMESTAMP_RESOLUTION long
-         * */
-        const uint32_t next_slot_start =
-            DLT_TIMESTAMP_RESOLUTION + tl_stat->last_abs_slot;
-
-        /* Check if we are already in the next slot */
-        if (next_slot_start <= tl_stat->curr_abs_slot) {
-            /* Calculate relative amount of elapsed slots */
-            elapsed_slots = (tl_stat->curr_abs_slot - next_slot_start) / DLT_TIMESTAMP_RESOLUTION + 1;
-        }
-        /* else we are not in the next slot yet */
-    } else {
-        /* no rollover, get difference between slots to get amount of elapsed slots  */
-        elapsed_slots = (tl_stat->curr_abs_slot - tl_stat->last_abs_slot);
-    }
-
-    if (!elapsed_slots)
-    {
-        /* Same slot can be still used. No need to cleanup slot */
-        return false;
-    }
-
-    /* Slot-Based Count down for next warning messages */
-    tl_stat->slot_left_soft_limit_warn = (tl_stat->slot_left_soft_limit_warn > elapsed_slots) ?
-                                                                                              (tl_stat->slot_left_soft_limit_warn - elapsed_slots) : 0;
-
-    tl_stat->slot_left_hard_limit_warn = (tl_stat->slot_left_hard_limit_warn > elapsed_slots) ?
-                                                                                              (tl_stat->slot_left_hard_limit_warn - elapsed_slots) : 0;
-
-    /* Clear whole window when time elapsed longer than window size from last message */
-    if (elapsed_slots >= DLT_TRACE_LOAD_WINDOW_SIZE)
-    {
-        tl_stat->total_bytes_of_window = 0;
-        memset(tl_stat->window, 0, sizeof(tl_stat->window));
-        return true;
-    }
-
-    /* Clear skipped no data slots */
-    uint32_t temp_slot = tl_stat->last_slot;
-    while (temp_slot != tl_stat->curr_slot)
-    {
-        temp_slot++;
-        temp_slot %= DLT_TRACE_LOAD_WINDOW_SIZE;
-        tl_stat->total_bytes_of_window -= tl_stat->window[temp_slot];
-        tl_stat->window[temp_slot] = 0;
-    }
-
-    return true;
-}
-
-static int32_t dlt_switch_slot_if_needed(
+static bool dlt_record_trace_load(
     DltTraceLoadSettings* const tl_settings,
-    DltLogInternal log_internal,
-    void* const log_internal_params,
-    const uint32_t timestamp)
+    const uint32_t timestamp,
+    const int32_t size,
+    const int32_t sent_warn_msg_bytes)
 {
-    if (!tl_settings)
-    {
-        return 0;
-    }
+    DltTraceLoadStat *const tl_stat = &tl_settings->tl_stat;
+    const uint32_t now = timestamp >> DLT_TRACE_LOAD_TIME_SHIFT;
+    uint64_t old_load = __atomic_load_n(&tl_stat->window_load, __ATOMIC_RELAXED);
+    uint64_t new_load = 0;
+    uint64_t bytes = 0;
+    bool allow_output = false;
 
-    /* Get new window slot No. */
-    tl_settings->tl_stat.curr_abs_slot = timestamp / DLT_TRACE_LOAD_WINDOW_RESOLUTION;
-    tl_settings->tl_stat.curr_slot = tl_settings->tl_stat.curr_abs_slot % DLT_TRACE_LOAD_WINDOW_SIZE;
+    do {
+        uint32_t last = (uint32_t)(old_load >> DLT_TRACE_LOAD_BYTES_BITS);
+        const uint32_t elapsed = (now - last) & DLT_TRACE_LOAD_TIME_MASK;
 
-    /* Cleanup window */
-    if (!dlt_user_cleanup_window(&tl_settings->tl_stat))
-    {
-        /* No need to switch slot because same slot can be still used */
-        return 0;
-    }
+        bytes = old_load & DLT_TRACE_LOAD_BYTES_MAX;
 
-    /* If slot is switched and trace load has been over soft/hard limit
-     * in previous slot, warning messages may be sent.
-     * The warning messages will be also counted as trace load.
-     */
-    const int32_t sent_warn_msg_bytes =
-        dlt_output_soft_limit_over_warning(tl_settings, log_internal, log_internal_params) +
-        dlt_output_hard_limit_warning(tl_settings, log_internal, log_internal_params);
-    return sent_warn_msg_bytes;
-}
+        /* Let the trace load decay by the time passed since the last message,
+         * a message older than the last one is added without decay */
+        if (((uint32_t)((last - now) & DLT_TRACE_LOAD_TIME_MASK) - 1U) >= DLT_TRACE_LOAD_WINDOW_TIME) {
+            bytes = (elapsed >= DLT_TRACE_LOAD_WINDOW_TIME) ? 0 :
+                    (bytes * (DLT_TRACE_LOAD_WINDOW_TIME - elapsed)) / DLT_TRACE_LOAD_WINDOW_TIME;
+            last = now;
+        }
 
-static void dlt_record_trace_load(DltTraceLoadStat *const tl_stat, const int32_t size)
-{
-    if (!tl_stat)
-    {
-        return;
-    }
+        /* Record trace load by message size of original message and warning message if it was sent.
+         * A message over the hard limit is discarded and not recorded. */
+        bytes += (uint64_t)sent_warn_msg_bytes;
+        allow_output = (tl_settings->hard_limit != 0) &&
+                       ((((bytes + (uint64_t)size) * DLT_TIMESTAMP_RESOLUTION) / TIMESTAMP_BASED_WINDOW_SIZE)
+                        <= tl_settings->hard_limit);
 
-    /* Record trace load to current slot by message size of
-     * original message and warning message if it was sent
-     */
-    tl_stat->window[tl_stat->curr_slot] += size;
-    tl_stat->total_bytes_of_window += size;
+        if (allow_output)
+            bytes += (uint64_t)size;
+
+        if (bytes > DLT_TRACE_LOAD_BYTES_MAX)
+            bytes = DLT_TRACE_LOAD_BYTES_MAX;
 
-    /* Keep the latest time information */
-    tl_stat->last_abs_slot = tl_stat->curr_abs_slot;
-    tl_stat->last_slot = tl_stat->curr_slot;
+        new_load = ((uint64_t)last << DLT_TRACE_LOAD_BYTES_BITS) | bytes;
+    } while (!__atomic_compare_exchange_n(&tl_stat->window_load, &old_load, new_load, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
 
     /* Calculate average trace load [bytes/sec] in window
      * The division is necessary to normalize the average to bytes per second even if
      * the slot size is not equal to 1s
      * */
-    tl_stat->avg_trace_load
-        = (tl_stat->total_bytes_of_window * DLT_TIMESTAMP_RESOLUTION) / TIMESTAMP_BASED_WINDOW_SIZE;
-}
-
-static inline bool dlt_is_over_trace_load_soft_limit(DltTraceLoadSettings* const tl_settings)
-{
-    if (tl_settings
-        && (tl_settings->tl_stat.avg_trace_load > tl_settings->soft_limit || tl_settings->soft_limit == 0))
-    {
-        /* Mark as soft limit over */
-        tl_settings->tl_stat.is_over_soft_limit = true;
-        return true;
-    }
+    const uint64_t avg_trace_load = (bytes * DLT_TIMESTAMP_RESOLUTION) / TIMESTAMP_BASED_WINDOW_SIZE;
+    __atomic_store_n(&tl_stat->avg_trace_load, avg_trace_load, __ATOMIC_RELAXED);
 
-    return false;
-}
+    /* Check if trace load is over the soft limit.
+     * Even if trace load is over the soft limit, message will not be discarded.
+     * Only the warning message will be output
+     */
+    if (!allow_output || (tl_settings->soft_limit == 0) || (avg_trace_load > tl_settings->soft_limit))
+        __atomic_store_n(&tl_stat->is_over_soft_limit, true, __ATOMIC_RELAXED);
 
-static inline bool dlt_is_over_trace_load_hard_limit(
-    DltTraceLoadSettings* const tl_settings, const int size)
-{
-    if (tl_settings
-        && (tl_settings->tl_stat.avg_trace_load > tl_settings->hard_limit
-            || tl_settings->hard_limit == 0))
-    {
+    if (!allow_output) {
         /* Mark as limit over */
-        tl_settings->tl_stat.is_over_hard_limit = true;
-        tl_settings->tl_stat.hard_limit_over_counter++;
-        tl_settings->tl_stat.hard_limit_over_bytes += size;
-
-        /* Delete size of limit over message from window */
-        tl_settings->tl_stat.window[tl_settings->tl_stat.curr_slot] -= size;
-        tl_settings->tl_stat.total_bytes_of_window -= size;
-        return true;
+        __atomic_store_n(&tl_stat->is_over_hard_limit, true, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&tl_stat->hard_limit_over_counter, 1U, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&tl_stat->hard_limit_over_bytes, (uint32_t)size, __ATOMIC_RELAXED);
     }
 
-    return false;
+    return allow_output;
 }
 
 bool dlt_check_trace_load(
@@ -6805,28 +7996,17 @@ bool dlt_check_trace_load(
         return false;
     }
 
-    /* Switch window slot according to timestamp
-     * If warning messages for hard/soft limit over are sent,
-     * the message size will be returned.
-     */
-    const int32_t sent_warn_msg_bytes = dlt_switch_slot_if_needed(
-        tl_settings, internal_dlt_log, internal_dlt_log_params, timestamp);
-
-    /* Record trace load */
-    dlt_record_trace_load(&tl_settings->tl_stat, size + sent_warn_msg_bytes);
-
-    /* Check if trace load is over the soft limit.
-     * Even if trace load is over the soft limit, message will not be discarded.
-     * Only the warning message will be output
+    /* If trace load has been over soft/hard limit, warning messages may be sent.
+     * The warning messages will be also counted as trace load.
      */
-    dlt_is_over_trace_load_soft_limit(tl_settings);
+    const int32_t sent_warn_msg_bytes =
+        dlt_output_soft_limit_over_warning(tl_settings, internal_dlt_log, internal_dlt_log_params, timestamp) +
+        dlt_output_hard_limit_warning(tl_settings, internal_dlt_log, internal_dlt_log_params, timestamp);
 
-    /* Check if trace load is over hard limit.
+    /* Record trace load and check if it is over hard limit.
      * If trace load is over the limit, message will be discarded.
      */
-    const bool allow_output = !dlt_is_over_trace_load_hard_limit(tl_settings, size);
-
-    return allow_output;
+    return dlt_record_trace_load(tl_settings, timestamp, size, sent_warn_msg_bytes);
 }
 
 DltTraceLoadSettings*
@@ -6838,7 +8018,7 @@ dlt_find_runtime_trace_load_settings(DltTraceLoadSettings *settings, uint32_t se
     size_t ctid_len = (ctid != NULL) ? strnlen(ctid, DLT_ID_SIZE) : 0;
 
     for (uint32_t i = 0; i < settings_count; ++i) {
-        if (strncmp(apid, settings->apid, DLT_ID_SIZE) != 0) {
+        if (strncmp(apid, settings[i].apid, DLT_ID_SIZE) != 0) {
             if (app_level == NULL)
                 continue;
             // settings are sorted.
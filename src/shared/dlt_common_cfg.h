@@ -86,6 +86,17 @@
 /* Number of indices to be allocated at one, if no more indeces are left */
 #define DLT_COMMON_INDEX_ALLOC       1000
 
+/* Minimum size of the chunk a memory mapped file is split into per thread
+ * when its index is built in parallel */
+#define DLT_COMMON_INDEX_CHUNK_MIN   (64 * 1024)
+
+/* Size of the block read from a DLT file at once while searching for the
+ * next header after corrupted data */
+#define DLT_COMMON_RESYNC_BUFFER_SIZE 8192
+
+/* Buffers shorter than this are searched for a pattern without vector instructions */
+#define DLT_COMMON_PATTERN_VECTOR_MIN 64
+
 /* If limited output is called,
  * this is the maximum number of characters to be printed out */
 #define DLT_COMMON_ASCII_LIMIT_MAX_CHARS 20
@@ -0,0 +1,540 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_file_index.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <syslog.h>
+#include <sys/stat.h>
+
+#include "dlt_file_index.h"
+#include "dlt_filter_engine.h"
+#include "dlt_common.h"
+
+#define DLT_FILE_INDEX_SALT_APID 0x9E3779B9U
+#define DLT_FILE_INDEX_SALT_CTID 0x85EBCA6BU
+
+static uint32_t dlt_file_index_hash_id(const char *id, uint32_t salt)
+{
+    /* build the value byte-wise, so that the bloom filter is endian independent */
+    uint32_t h = (uint32_t)(uint8_t)id[0] |
+                 ((uint32_t)(uint8_t)id[1] << 8) |
+                 ((uint32_t)(uint8_t)id[2] << 16) |
+                 ((uint32_t)(uint8_t)id[3] << 24);
+
+    /* murmur3 finalizer */
+    h ^= salt;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+
+    return h;
+}
+
+static void dlt_file_index_bloom_add(uint8_t *bloom, const char *id, uint32_t salt)
+{
+    uint32_t h = dlt_file_index_hash_id(id, salt);
+    uint32_t bit1 = h % (DLT_FILE_INDEX_BLOOM_SIZE * 8);
+    uint32_t bit2 = (h >> 16) % (DLT_FILE_INDEX_BLOOM_SIZE * 8);
+
+    bloom[bit1 / 8] = (uint8_t)(bloom[bit1 / 8] | (1U << (bit1 % 8)));
+    bloom[bit2 / 8] = (uint8_t)(bloom[bit2 / 8] | (1U << (bit2 % 8)));
+}
+
+static bool dlt_file_index_bloom_test(const uint8_t *bloom, const char *id, uint32_t salt)
+{
+    uint32_t h = dlt_file_index_hash_id(id, salt);
+    uint32_t bit1 = h % (DLT_FILE_INDEX_BLOOM_SIZE * 8);
+    uint32_t bit2 = (h >> 16) % (DLT_FILE_INDEX_BLOOM_SIZE * 8);
+
+    return (bloom[bit1 / 8] & (1U << (bit1 % 8))) &&
+           (bloom[bit2 / 8] & (1U << (bit2 % 8)));
+}
+
+static uint64_t dlt_file_index_time(uint32_t seconds, int32_t microseconds)
+{
+    return (uint64_t)seconds * 1000000U + (uint64_t)(microseconds < 0 ? 0 : microseconds);
+}
+
+static void dlt_file_index_entry_to_le(DltFileIndexEntry *entry)
+{
+    entry->offset = DLT_HTOLE_64(entry->offset);
+    entry->size = DLT_HTOLE_32(entry->size);
+    entry->messages = DLT_HTOLE_32(entry->messages);
+    entry->min_seconds = DLT_HTOLE_32(entry->min_seconds);
+    entry->min_microseconds = (int32_t)DLT_HTOLE_32((uint32_t)entry->min_microseconds);
+    entry->max_seconds = DLT_HTOLE_32(entry->max_seconds);
+    entry->max_microseconds = (int32_t)DLT_HTOLE_32((uint32_t)entry->max_microseconds);
+    entry->first_timestamp = DLT_HTOLE_32(entry->first_timestamp);
+    entry->last_timestamp = DLT_HTOLE_32(entry->last_timestamp);
+    entry->flags = DLT_HTOLE_32(entry->flags);
+}
+
+static void dlt_file_index_entry_from_le(DltFileIndexEntry *entry)
+{
+    entry->offset = DLT_LETOH_64(entry->offset);
+    entry->size = DLT_LETOH_32(entry->size);
+    entry->messages = DLT_LETOH_32(entry->messages);
+    entry->min_seconds = DLT_LETOH_32(entry->min_seconds);
+    entry->min_microseconds = (int32_t)DLT_LETOH_32((uint32_t)entry->min_microseconds);
+    entry->max_seconds = DLT_LETOH_32(entry->max_seconds);
+    entry->max_microseconds = (int32_t)DLT_LETOH_32((uint32_t)entry->max_microseconds);
+    entry->first_timestamp = DLT_LETOH_32(entry->first_timestamp);
+    entry->last_timestamp = DLT_LETOH_32(entry->last_timestamp);
+    entry->flags = DLT_LETOH_32(entry->flags);
+}
+
+DltReturnValue dlt_file_index_filename(const char *dlt_filename, char *index_filename, size_t size)
+{
+    int len;
+
+    if ((dlt_filename == NULL) || (index_filename == NULL) || (size == 0))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    len = snprintf(index_filename, size, "%s" DLT_FILE_INDEX_EXTENSION, dlt_filename);
+
+    if ((len < 0) || ((size_t)len >= size))
+        return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_index_writer_init(DltFileIndexWriter *writer,
+                                          const char *dlt_filename,
+                                          uint32_t block_messages,
+                                          uint32_t block_size)
+{
+    char filename[PATH_MAX];
+    DltFileIndexHeader header;
+
+    if ((writer == NULL) || (dlt_filename == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(writer, 0, sizeof(DltFileIndexWriter));
+
+    if (dlt_file_index_filename(dlt_filename, filename, sizeof(filename)) < DLT_RETURN_OK)
+        return DLT_RETURN_ERROR;
+
+    writer->block_messages = block_messages ? block_messages : DLT_FILE_INDEX_DEFAULT_BLOCK_MESSAGES;
+    writer->block_size = block_size ? block_size : DLT_FILE_INDEX_DEFAULT_BLOCK_SIZE;
+
+    writer->handle = fopen(filename, "wb");
+
+    if (writer->handle == NULL) {
+        dlt_vlog(LOG_WARNING, "Index file %s cannot be created!\n", filename);
+        return DLT_RETURN_ERROR;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DLT_FILE_INDEX_MAGIC, DLT_ID_SIZE);
+    header.version = DLT_FILE_INDEX_VERSION;
+    header.block_messages = DLT_HTOLE_32(writer->block_messages);
+    header.block_size = DLT_HTOLE_32(writer->block_size);
+
+    if (fwrite(&header, sizeof(header), 1, writer->handle) != 1) {
+        dlt_vlog(LOG_WARNING, "Cannot write header of index file %s!\n", filename);
+        fclose(writer->handle);
+        writer->handle = NULL;
+        return DLT_RETURN_ERROR;
+    }
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_index_writer_flush(DltFileIndexWriter *writer)
+{
+    DltFileIndexEntry entry;
+
+    if ((writer == NULL) || (writer->handle == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (writer->block.messages == 0)
+        return DLT_RETURN_OK;
+
+    entry = writer->block;
+    dlt_file_index_entry_to_le(&entry);
+    memset(&writer->block, 0, sizeof(writer->block));
+
+    if (fwrite(&entry, sizeof(entry), 1, writer->handle) != 1) {
+        dlt_log(LOG_WARNING, "Cannot write block to index file!\n");
+        return DLT_RETURN_ERROR;
+    }
+
+    if (fflush(writer->handle) != 0)
+        return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
+static DltReturnValue dlt_file_index_writer_add_sized(DltFileIndexWriter *writer,
+                                                       uint64_t offset,
+                                                       uint32_t size,
+                                                       const DltMessage *msg)
+{
+    DltFileIndexEntry *block;
+    uint64_t time;
+
+    if ((writer == NULL) || (writer->handle == NULL) || (msg == NULL) ||
+        (msg->storageheader == NULL) || (msg->standardheader == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    block = &writer->block;
+
+    /* start a new block if the current one is full */
+    if ((block->messages > 0) &&
+        ((block->messages >= writer->block_messages) ||
+         (block->size + size > writer->block_size) ||
+         (offset != block->offset + block->size))) {
+        if (dlt_file_index_writer_flush(writer) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+    }
+
+    time = dlt_file_index_time(msg->storageheader->seconds, msg->storageheader->microseconds);
+
+    if (block->messages == 0) {
+        block->offset = offset;
+        block->min_seconds = block->max_seconds = msg->storageheader->seconds;
+        block->min_microseconds = block->max_microseconds = msg->storageheader->microseconds;
+        block->first_timestamp = DLT_IS_HTYP_WTMS(msg->standardheader->htyp) ? msg->headerextra.tmsp : 0;
+    }
+    else if (time < dlt_file_index_time(block->min_seconds, block->min_microseconds)) {
+        block->min_seconds = msg->storageheader->seconds;
+        block->min_microseconds = msg->storageheader->microseconds;
+    }
+    else if (time > dlt_file_index_time(block->max_seconds, block->max_microseconds)) {
+        block->max_seconds = msg->storageheader->seconds;
+        block->max_microseconds = msg->storageheader->microseconds;
+    }
+
+    block->last_timestamp = DLT_IS_HTYP_WTMS(msg->standardheader->htyp) ? msg->headerextra.tmsp : 0;
+
+    if (DLT_IS_HTYP_UEH(msg->standardheader->htyp) && (msg->extendedheader != NULL)) {
+        dlt_file_index_bloom_add(block->id_bloom, msg->extendedheader->apid, DLT_FILE_INDEX_SALT_APID);
+        dlt_file_index_bloom_add(block->id_bloom, msg->extendedheader->ctid, DLT_FILE_INDEX_SALT_CTID);
+    }
+    else {
+        block->flags |= DLT_FILE_INDEX_FLAG_NO_EXTHEADER;
+    }
+
+    block->messages++;
+    block->size += size;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_index_writer_add(DltFileIndexWriter *writer, uint64_t offset, const DltMessage *msg)
+{
+    if (msg == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    return dlt_file_index_writer_add_sized(writer, offset,
+                                           (uint32_t)msg->headersize + (uint32_t)msg->datasize, msg);
+}
+
+DltReturnValue dlt_file_index_writer_free(DltFileIndexWriter *writer)
+{
+    DltReturnValue ret = DLT_RETURN_OK;
+
+    if (writer == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (writer->handle == NULL)
+        return DLT_RETURN_OK;
+
+    ret = dlt_file_index_writer_flush(writer);
+
+    fclose(writer->handle);
+    writer->handle = NULL;
+
+    return ret;
+}
+
+DltReturnValue dlt_file_index_build(const char *dlt_filename,
+                                    uint32_t block_messages,
+                                    uint32_t block_size,
+                                    int verbose)
+{
+    DltFile file;
+    DltFileIndexWriter writer;
+    DltReturnValue ret = DLT_RETURN_OK;
+    uint64_t offset;
+
+    if (dlt_filename == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (dlt_file_init(&file, verbose) < DLT_RETURN_OK)
+        return DLT_RETURN_ERROR;
+
+    if (dlt_file_open(&file, dlt_filename, verbose) < DLT_RETURN_OK) {
+        dlt_file_free(&file, verbose);
+        return DLT_RETURN_ERROR;
+    }
+
+    if (dlt_file_index_writer_init(&writer, dlt_filename, block_messages, block_size) < DLT_RETURN_OK) {
+        dlt_file_free(&file, verbose);
+        return DLT_RETURN_ERROR;
+    }
+
+    offset = file.file_position;
+
+    while (dlt_file_read(&file, verbose) >= DLT_RETURN_OK) {
+        /* dlt_file_read() without filter skips the extra and extended header, load them */
+        if ((fseek(file.handle, (long)file.index[file.counter - 1], SEEK_SET) != 0) ||
+            (dlt_file_read_header(&file, verbose) < DLT_RETURN_OK) ||
+            (dlt_file_read_header_extended(&file, verbose) < DLT_RETURN_OK)) {
+            ret = DLT_RETURN_ERROR;
+            break;
+        }
+
+        /* resynchronised garbage is accounted to the message following it */
+        if (dlt_file_index_writer_add_sized(&writer, offset, (uint32_t)(file.file_position - offset),
+                                            &file.msg) < DLT_RETURN_OK) {
+            ret = DLT_RETURN_ERROR;
+            break;
+        }
+
+        offset = file.file_position;
+    }
+
+    if (dlt_file_index_writer_free(&writer) < DLT_RETURN_OK)
+        ret = DLT_RETURN_ERROR;
+
+    if (verbose)
+        dlt_vlog(LOG_DEBUG, "Indexed %d messages of %s\n", file.counter_total, dlt_filename);
+
+    dlt_file_free(&file, verbose);
+
+    return ret;
+}
+
+DltReturnValue dlt_file_index_load(DltFileIndex *index, const char *dlt_filename)
+{
+    char filename[PATH_MAX];
+    struct stat st;
+    FILE *handle;
+    uint32_t i;
+
+    if ((index == NULL) || (dlt_filename == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(index, 0, sizeof(DltFileIndex));
+
+    if (dlt_file_index_filename(dlt_filename, filename, sizeof(filename)) < DLT_RETURN_OK)
+        return DLT_RETURN_ERROR;
+
+    handle = fopen(filename, "rb");
+
+    if (handle == NULL)
+        return DLT_RETURN_ERROR;
+
+    if ((fstat(fileno(handle), &st) != 0) ||
+        (fread(&index->header, sizeof(index->header), 1, handle) != 1) ||
+        (memcmp(index->header.magic, DLT_FILE_INDEX_MAGIC, DLT_ID_SIZE) != 0) ||
+        (index->header.version != DLT_FILE_INDEX_VERSION)) {
+        dlt_vlog(LOG_WARNING, "Index file %s is invalid!\n", filename);
+        fclose(handle);
+        return DLT_RETURN_ERROR;
+    }
+
+    index->header.block_messages = DLT_LETOH_32(index->header.block_messages);
+    index->header.block_size = DLT_LETOH_32(index->header.block_size);
+
+    /* ignore a partially written last entry */
+    index->count = (uint32_t)(((uint64_t)st.st_size - sizeof(DltFileIndexHeader)) / sizeof(DltFileIndexEntry));
+
+    if (index->count > 0) {
+        index->entries = (DltFileIndexEntry *)malloc(index->count * sizeof(DltFileIndexEntry));
+
+        if (index->entries == NULL) {
+            fclose(handle);
+            index->count = 0;
+            return DLT_RETURN_ERROR;
+        }
+
+        if (fread(index->entries, sizeof(DltFileIndexEntry), index->count, handle) != index->count) {
+            dlt_vlog(LOG_WARNING, "Cannot read index file %s!\n", filename);
+            fclose(handle);
+            dlt_file_index_free(index);
+            return DLT_RETURN_ERROR;
+        }
+
+        for (i = 0; i < index->count; i++)
+            dlt_file_index_entry_from_le(&index->entries[i]);
+    }
+
+    fclose(handle);
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_file_index_free(DltFileIndex *index)
+{
+    if (index == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    free(index->entries);
+    index->entries = NULL;
+    index->count = 0;
+
+    return DLT_RETURN_OK;
+}
+
+uint64_t dlt_file_index_message_time(const DltMessage *msg)
+{
+    if ((msg == NULL) || (msg->storageheader == NULL))
+        return 0;
+
+    return dlt_file_index_time(msg->storageheader->seconds, msg->storageheader->microseconds);
+}
+
+bool dlt_file_index_entry_match(const DltFileIndexEntry *entry,
+                                uint64_t begin,
+                                uint64_t end,
+                                const DltFilterEngine *engine)
+{
+    uint32_t num;
+    const DltFilterRule *rule;
+    char apid[DLT_ID_SIZE];
+    char ctid[DLT_ID_SIZE];
+
+    if (entry == NULL)
+        return false;
+
+    if (dlt_file_index_time(entry->max_seconds, entry->max_microseconds) < begin)
+        return false;
+
+    if (end && (dlt_file_index_time(entry->min_seconds, entry->min_microseconds) > end))
+        return false;
+
+    if ((engine == NULL) || (engine->count == 0) ||
+        (entry->flags & DLT_FILE_INDEX_FLAG_NO_EXTHEADER))
+        return true;
+
+    for (num = 0; num < engine->count; num++) {
+        rule = &engine->rules[num];
+        memcpy(apid, &rule->apid, DLT_ID_SIZE);
+        memcpy(ctid, &rule->ctid, DLT_ID_SIZE);
+
+        if (((rule->apid == 0) ||
+             dlt_file_index_bloom_test(entry->id_bloom, apid, DLT_FILE_INDEX_SALT_APID)) &&
+            ((rule->ctid == 0) ||
+             dlt_file_index_bloom_test(entry->id_bloom, ctid, DLT_FILE_INDEX_SALT_CTID)))
+            return true;
+    }
+
+    return false;
+}
+
+/* Read one message and drop it from the file index again if it is outside of the time window */
+static DltReturnValue dlt_file_read_in_range(DltFile *file, uint64_t begin, uint64_t end, int verbose)
+{
+    DltReturnValue ret;
+    uint64_t time;
+
+    ret = dlt_file_read(file, verbose);
+
+    if (ret == DLT_RETURN_TRUE) {
+        time = dlt_file_index_message_time(&file->msg);
+
+        if ((time < begin) || (end && (time > end))) {
+            file->counter--;
+            file->position = file->counter - 1;
+            ret = DLT_RETURN_OK;
+        }
+    }
+
+    return ret;
+}
+
+static bool dlt_file_index_entry_valid(DltFile *file, const DltFileIndexEntry *entry)
+{
+    char pattern[DLT_ID_SIZE];
+
+    if (entry->offset + entry->size > file->file_length)
+        return false;
+
+    if ((fseek(file->handle, (long)entry->offset, SEEK_SET) != 0) ||
+        (fread(pattern, sizeof(pattern), 1, file->handle) != 1))
+        return false;
+
+    return dlt_check_storageheader((DltStorageHeader *)pattern) == DLT_RETURN_TRUE;
+}
+
+DltReturnValue dlt_file_read_indexed(DltFile *file,
+                                     const DltFileIndex *index,
+                                     uint64_t begin,
+                                     uint64_t end,
+                                     int verbose)
+{
+    uint64_t tail = 0;
+    uint32_t i;
+    uint32_t m;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((file == NULL) || (file->handle == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if ((index != NULL) && (index->count > 0)) {
+        for (i = 0; i < index->count; i++) {
+            const DltFileIndexEntry *entry = &index->entries[i];
+
+            if (!dlt_file_index_entry_match(entry, begin, end, dlt_file_get_filter_engine(file)))
+                continue;
+
+            if (!dlt_file_index_entry_valid(file, entry)) {
+                dlt_log(LOG_WARNING, "Index does not match DLT file, reading whole file\n");
+                file->counter = 0;
+                file->counter_total = 0;
+                file->position = 0;
+                tail = 0;
+                break;
+            }
+
+            file->file_position = entry->offset;
+
+            for (m = 0; m < entry->messages; m++)
+                if (dlt_file_read_in_range(file, begin, end, verbose) < DLT_RETURN_OK)
+                    break;
+
+            tail = entry->offset + entry->size;
+        }
+
+        if (i == index->count)
+            tail = index->entries[index->count - 1].offset + index->entries[index->count - 1].size;
+
+        if (verbose)
+            dlt_vlog(LOG_DEBUG, "Read %d messages with index, continue at %" PRIu64 "\n",
+                     file->counter_total, tail);
+    }
+
+    /* read messages which were appended after the index was written */
+    file->file_position = tail;
+
+    while (dlt_file_read_in_range(file, begin, end, verbose) >= DLT_RETURN_OK) {}
+
+    return DLT_RETURN_OK;
+}
@@ -0,0 +1,698 @@
+/*
+ * SPDX license identifier: MPL-2.0
+ *
+ * Copyright (C) 2026, COVESA
+ *
+ * This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License (MPL), v. 2.0.
+ * If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * For further information see https://www.covesa.global/.
+ */
+
+/*!
+ * \copyright Copyright © 2026 COVESA. \n
+ * License MPL-2.0: Mozilla Public License version 2.0 http://mozilla.org/MPL/2.0/.
+ *
+ * \file dlt_filter_engine.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <syslog.h>
+
+#include "dlt_filter_engine.h"
+#include "dlt_common.h"
+
+/* Number of rules allocated at once */
+#define DLT_FILTER_ENGINE_ALLOC 32
+
+/* Minimum number of hash table slots is 1 << DLT_FILTER_ENGINE_MIN_SLOT_BITS */
+#define DLT_FILTER_ENGINE_MIN_SLOT_BITS 3
+
+/* Wildcard combinations of the keys, a message is only looked up with the used ones */
+#define DLT_FILTER_ENGINE_KEY_BOTH 0x01 /* apid and ctid */
+#define DLT_FILTER_ENGINE_KEY_APID 0x02 /* apid, any ctid */
+#define DLT_FILTER_ENGINE_KEY_CTID 0x04 /* ctid, any apid */
+#define DLT_FILTER_ENGINE_KEY_ANY  0x08 /* any apid and ctid */
+
+typedef struct
+{
+    uint64_t key;
+    uint32_t number;
+} DltFilterEngineSortEntry;
+
+static uint64_t dlt_filter_engine_key(uint32_t apid, uint32_t ctid)
+{
+    return ((uint64_t)apid << 32) | ctid;
+}
+
+static uint32_t dlt_filter_engine_key_type(uint32_t apid, uint32_t ctid)
+{
+    if (apid && ctid)
+        return DLT_FILTER_ENGINE_KEY_BOTH;
+
+    if (apid)
+        return DLT_FILTER_ENGINE_KEY_APID;
+
+    if (ctid)
+        return DLT_FILTER_ENGINE_KEY_CTID;
+
+    return DLT_FILTER_ENGINE_KEY_ANY;
+}
+
+static uint32_t dlt_filter_engine_hash(uint64_t key, uint32_t bits)
+{
+    /* Fibonacci hashing, the upper bits are well distributed */
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+}
+
+static int dlt_filter_engine_compare(const void *a, const void *b)
+{
+    const DltFilterEngineSortEntry *entry_a = (const DltFilterEngineSortEntry *)a;
+    const DltFilterEngineSortEntry *entry_b = (const DltFilterEngineSortEntry *)b;
+
+    if (entry_a->key != entry_b->key)
+        return (entry_a->key < entry_b->key) ? -1 : 1;
+
+    return (entry_a->number < entry_b->number) ? -1 : (entry_a->number > entry_b->number);
+}
+
+static int dlt_filter_engine_rule_equal(const DltFilterRule *a, const DltFilterRule *b)
+{
+    return (a->apid == b->apid) &&
+           (a->ctid == b->ctid) &&
+           (a->log_level == b->log_level) &&
+           (a->payload_min == b->payload_min) &&
+           (a->payload_max == b->payload_max) &&
+           (a->flags == b->flags) &&
+           (a->message_types == b->message_types) &&
+           (a->timestamp_min == b->timestamp_min) &&
+           (a->timestamp_max == b->timestamp_max) &&
+           (a->payload_length == b->payload_length) &&
+           ((a->payload_length == 0) || (memcmp(a->payload, b->payload, a->payload_length) == 0)) &&
+           ((a->apid2 == NULL) == (b->apid2 == NULL)) &&
+           ((a->apid2 == NULL) || ((a->apid2len == b->apid2len) && (memcmp(a->apid2, b->apid2, a->apid2len) == 0))) &&
+           ((a->ctid2 == NULL) == (b->ctid2 == NULL)) &&
+           ((a->ctid2 == NULL) || ((a->ctid2len == b->ctid2len) && (memcmp(a->ctid2, b->ctid2, a->ctid2len) == 0)));
+}
+
+/* Check an id of a DLT v2 message against the id of a rule */
+static int dlt_filter_engine_id_match_v2(uint32_t packed, const char *id2, uint8_t id2len,
+                                         const char *id, uint8_t idlen)
+{
+    char buffer[DLT_ID_SIZE] = { 0 };
+
+    if (id2 != NULL)
+        return (idlen == id2len) && (memcmp(id, id2, idlen) == 0);
+
+    if (packed == 0)
+        return 1;
+
+    if ((idlen > DLT_ID_SIZE) || (id == NULL))
+        return 0;
+
+    memcpy(buffer, id, idlen);
+
+    return memcmp(&packed, buffer, DLT_ID_SIZE) == 0;
+}
+
+/* Pack the id of a DLT v2 message, longer ids are packed like the ids of the rules */
+static uint32_t dlt_filter_engine_pack_id_v2(const char *id, uint8_t idlen)
+{
+    char buffer[DLT_ID_SIZE] = { 0 };
+    uint32_t packed;
+
+    if (id != NULL)
+        memcpy(buffer, id, (idlen < DLT_ID_SIZE) ? idlen : DLT_ID_SIZE);
+
+    memcpy(&packed, buffer, sizeof(packed));
+
+    return packed;
+}
+
+/* Get the timestamp of a message from the extra header following the standard header */
+static int dlt_filter_engine_timestamp(const DltMessage *msg, uint32_t *timestamp)
+{
+    const uint8_t *extra = (const uint8_t *)msg->standardheader + sizeof(DltStandardHeader);
+
+    if (!DLT_IS_HTYP_WTMS(msg->standardheader->htyp))
+        return 0;
+
+    if (DLT_IS_HTYP_WEID(msg->standardheader->htyp))
+        extra += DLT_SIZE_WEID;
+
+    if (DLT_IS_HTYP_WSID(msg->standardheader->htyp))
+        extra += DLT_SIZE_WSID;
+
+    memcpy(timestamp, extra, sizeof(*timestamp));
+    *timestamp = DLT_BETOH_32(*timestamp);
+
+    return 1;
+}
+
+/* Check the predicates of a rule except the ids */
+static int dlt_filter_engine_rule_match(const DltFilterRule *rule, const DltMessage *msg, int log_level)
+{
+    uint32_t timestamp;
+
+    /* ids of DLT v1 messages have at most four characters */
+    if ((rule->apid2 != NULL) || (rule->ctid2 != NULL))
+        return 0;
+
+    if ((rule->log_level != 0) && (rule->log_level != log_level))
+        return 0;
+
+    if ((rule->message_types != 0) &&
+        !(rule->message_types & (1U << DLT_GET_MSIN_MSTP(msg->extendedheader->msin))))
+        return 0;
+
+    if ((rule->payload_min != 0) && (rule->payload_min > msg->datasize))
+        return 0;
+
+    if ((rule->payload_max != 0) && (rule->payload_max < msg->datasize))
+        return 0;
+
+    if (rule->flags & DLT_FILTER_RULE_FLAG_TIMESTAMP) {
+        if (!dlt_filter_engine_timestamp(msg, &timestamp) ||
+            (timestamp < rule->timestamp_min) ||
+            ((rule->timestamp_max != 0) && (timestamp > rule->timestamp_max)))
+            return 0;
+    }
+
+    if (rule->payload_length > 0) {
+        if ((msg->databuffer == NULL) || (msg->datasize <= 0) ||
+            (dlt_find_pattern(msg->databuffer, (size_t)msg->datasize,
+                              rule->payload, rule->payload_length) == NULL))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Check all predicates of a rule with a DLT v2 message */
+static int dlt_filter_engine_rule_match_v2(const DltFilterRule *rule, const DltMessageV2 *msg, int log_level)
+{
+    if (!dlt_filter_engine_id_match_v2(rule->apid, rule->apid2, rule->apid2len,
+                                       msg->extendedheaderv2.apid, msg->extendedheaderv2.apidlen) ||
+        !dlt_filter_engine_id_match_v2(rule->ctid, rule->ctid2, rule->ctid2len,
+                                       msg->extendedheaderv2.ctid, msg->extendedheaderv2.ctidlen))
+        return 0;
+
+    if ((rule->log_level != 0) && (rule->log_level != log_level))
+        return 0;
+
+    if ((rule->message_types != 0) &&
+        !(rule->message_types & (1U << DLT_GET_MSIN_MSTP(msg->headerextrav2.msin))))
+        return 0;
+
+    if ((rule->payload_min != 0) && (rule->payload_min > msg->datasize))
+        return 0;
+
+    if ((rule->payload_max != 0) && (rule->payload_max < msg->datasize))
+        return 0;
+
+    if (rule->flags & DLT_FILTER_RULE_FLAG_TIMESTAMP)
+        return 0;
+
+    if (rule->payload_length > 0) {
+        if ((msg->databuffer == NULL) || (msg->datasize <= 0) ||
+            (dlt_find_pattern(msg->databuffer, (size_t)msg->datasize,
+                              rule->payload, rule->payload_length) == NULL))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* Release what a rule of an engine owns */
+static void dlt_filter_engine_rule_free(DltFilterRule *rule)
+{
+    free(rule->payload);
+    free(rule->apid2);
+    free(rule->ctid2);
+}
+
+/* Copy a long id of a rule */
+static int dlt_filter_engine_copy_id(char **copy, const char *id, uint8_t length)
+{
+    if (id == NULL)
+        return 0;
+
+    *copy = malloc(length);
+
+    if (*copy == NULL)
+        return -1;
+
+    memcpy(*copy, id, length);
+
+    return 0;
+}
+
+uint32_t dlt_filter_engine_pack_id(const char *id)
+{
+    char buffer[DLT_ID_SIZE] = { 0 };
+    uint32_t packed;
+    int i;
+
+    if (id == NULL)
+        return 0;
+
+    for (i = 0; (i < DLT_ID_SIZE) && (id[i] != 0); i++)
+        buffer[i] = id[i];
+
+    memcpy(&packed, buffer, sizeof(packed));
+
+    return packed;
+}
+
+DltReturnValue dlt_filter_engine_init(DltFilterEngine *engine)
+{
+    if (engine == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    memset(engine, 0, sizeof(DltFilterEngine));
+    engine->compiled = 1;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_filter_engine_free(DltFilterEngine *engine)
+{
+    uint32_t i;
+
+    if (engine == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    for (i = 0; i < engine->count; i++)
+        dlt_filter_engine_rule_free(&engine->rules[i]);
+
+    free(engine->rules);
+    free(engine->order);
+    free(engine->slots);
+
+    return dlt_filter_engine_init(engine);
+}
+
+int dlt_filter_engine_find(const DltFilterEngine *engine, const DltFilterRule *rule)
+{
+    uint32_t i;
+
+    if ((engine == NULL) || (rule == NULL))
+        return -1;
+
+    for (i = 0; i < engine->count; i++)
+        if (dlt_filter_engine_rule_equal(&engine->rules[i], rule))
+            return (int)i;
+
+    return -1;
+}
+
+DltReturnValue dlt_filter_engine_add(DltFilterEngine *engine, const DltFilterRule *rule)
+{
+    DltFilterRule *rules;
+    DltFilterRule *added;
+
+    if ((engine == NULL) || (rule == NULL) || ((rule->payload == NULL) && (rule->payload_length > 0)) ||
+        ((rule->apid2 != NULL) && (rule->apid2len == 0)) || ((rule->ctid2 != NULL) && (rule->ctid2len == 0)))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (dlt_filter_engine_find(engine, rule) >= 0)
+        return DLT_RETURN_ERROR;
+
+    if (engine->count == engine->size) {
+        rules = realloc(engine->rules, (engine->size + DLT_FILTER_ENGINE_ALLOC) * sizeof(DltFilterRule));
+
+        if (rules == NULL)
+            return DLT_RETURN_ERROR;
+
+        engine->rules = rules;
+        engine->size += DLT_FILTER_ENGINE_ALLOC;
+    }
+
+    added = &engine->rules[engine->count];
+    *added = *rule;
+    added->payload = NULL;
+    added->apid2 = NULL;
+    added->ctid2 = NULL;
+
+    if ((dlt_filter_engine_copy_id(&added->apid2, rule->apid2, rule->apid2len) < 0) ||
+        (dlt_filter_engine_copy_id(&added->ctid2, rule->ctid2, rule->ctid2len) < 0)) {
+        dlt_filter_engine_rule_free(added);
+        return DLT_RETURN_ERROR;
+    }
+
+    if (rule->payload_length > 0) {
+        added->payload = malloc(rule->payload_length);
+
+        if (added->payload == NULL) {
+            dlt_filter_engine_rule_free(added);
+            return DLT_RETURN_ERROR;
+        }
+
+        memcpy(added->payload, rule->payload, rule->payload_length);
+        engine->payload_rules++;
+    }
+
+    engine->count++;
+    engine->compiled = 0;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_filter_engine_remove(DltFilterEngine *engine, uint32_t number)
+{
+    if ((engine == NULL) || (number >= engine->count))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (engine->rules[number].payload_length > 0)
+        engine->payload_rules--;
+
+    dlt_filter_engine_rule_free(&engine->rules[number]);
+    memmove(&engine->rules[number], &engine->rules[number + 1],
+            (engine->count - number - 1) * sizeof(DltFilterRule));
+    engine->count--;
+    engine->compiled = 0;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_filter_engine_compile(DltFilterEngine *engine)
+{
+    DltFilterEngineSortEntry *entries;
+    DltFilterEngineSlot *slots = NULL;
+    uint32_t *order = NULL;
+    uint32_t distinct = 0;
+    uint32_t wildcards = 0;
+    uint32_t bits = DLT_FILTER_ENGINE_MIN_SLOT_BITS;
+    uint32_t i;
+    uint32_t j;
+    uint32_t slot;
+
+    if (engine == NULL)
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if (engine->count > 0) {
+        entries = malloc(engine->count * sizeof(DltFilterEngineSortEntry));
+
+        if (entries == NULL)
+            return DLT_RETURN_ERROR;
+
+        for (i = 0; i < engine->count; i++) {
+            entries[i].key = dlt_filter_engine_key(engine->rules[i].apid, engine->rules[i].ctid);
+            entries[i].number = i;
+            wildcards |= dlt_filter_engine_key_type(engine->rules[i].apid, engine->rules[i].ctid);
+        }
+
+        /* rules with the same key are consecutive after sorting */
+        qsort(entries, engine->count, sizeof(DltFilterEngineSortEntry), dlt_filter_engine_compare);
+
+        for (i = 0; i < engine->count; i++)
+            if ((i == 0) || (entries[i].key != entries[i - 1].key))
+                distinct++;
+
+        /* at most half of the slots are used */
+        while ((1U << bits) < 2 * distinct)
+            bits++;
+
+        slots = calloc(1U << bits, sizeof(DltFilterEngineSlot));
+        order = malloc(engine->count * sizeof(uint32_t));
+
+        if ((slots == NULL) || (order == NULL)) {
+            free(entries);
+            free(slots);
+            free(order);
+            return DLT_RETURN_ERROR;
+        }
+
+        for (i = 0; i < engine->count; i = j) {
+            for (j = i; (j < engine->count) && (entries[j].key == entries[i].key); j++)
+                order[j] = entries[j].number;
+
+            /* linear probing */
+            slot = dlt_filter_engine_hash(entries[i].key, bits);
+
+            while (slots[slot].count != 0)
+                slot = (slot + 1) & ((1U << bits) - 1);
+
+            slots[slot].key = entries[i].key;
+            slots[slot].first = i;
+            slots[slot].count = j - i;
+        }
+
+        free(entries);
+    }
+
+    free(engine->slots);
+    free(engine->order);
+    engine->slots = slots;
+    engine->order = order;
+    engine->slot_bits = bits;
+    engine->wildcards = wildcards;
+    engine->compiled = 1;
+
+    return DLT_RETURN_OK;
+}
+
+/* Check a rule with a DLT v1 or v2 message */
+static int dlt_filter_engine_rule_check(const DltFilterRule *rule,
+                                        const DltMessage *msg,
+                                        const DltMessageV2 *msgv2,
+                                        int log_level)
+{
+    if (msg != NULL)
+        return dlt_filter_engine_rule_match(rule, msg, log_level);
+
+    return dlt_filter_engine_rule_match_v2(rule, msgv2, log_level);
+}
+
+/* Check the rules with one key of a compiled engine */
+static int dlt_filter_engine_lookup(const DltFilterEngine *engine,
+                                    uint64_t key,
+                                    const DltMessage *msg,
+                                    const DltMessageV2 *msgv2,
+                                    int log_level)
+{
+    const uint32_t mask = (1U << engine->slot_bits) - 1;
+    uint32_t slot = dlt_filter_engine_hash(key, engine->slot_bits);
+    uint32_t i;
+
+    while (engine->slots[slot].count != 0) {
+        if (engine->slots[slot].key == key) {
+            for (i = 0; i < engine->slots[slot].count; i++)
+                if (dlt_filter_engine_rule_check(&engine->rules[engine->order[engine->slots[slot].first + i]],
+                                                 msg, msgv2, log_level))
+                    return 1;
+
+            return 0;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return 0;
+}
+
+/* Check the rules with the packed ids of a message and the used wildcards */
+static DltReturnValue dlt_filter_engine_match_ids(const DltFilterEngine *engine,
+                                                  uint32_t apid,
+                                                  uint32_t ctid,
+                                                  const DltMessage *msg,
+                                                  const DltMessageV2 *msgv2,
+                                                  int log_level)
+{
+    uint32_t i;
+
+    if (!engine->compiled) {
+        for (i = 0; i < engine->count; i++)
+            if (((engine->rules[i].apid == 0) || (engine->rules[i].apid == apid)) &&
+                ((engine->rules[i].ctid == 0) || (engine->rules[i].ctid == ctid)) &&
+                dlt_filter_engine_rule_check(&engine->rules[i], msg, msgv2, log_level))
+                return DLT_RETURN_TRUE;
+
+        return DLT_RETURN_OK;
+    }
+
+    if (((engine->wildcards & DLT_FILTER_ENGINE_KEY_BOTH) &&
+         dlt_filter_engine_lookup(engine, dlt_filter_engine_key(apid, ctid), msg, msgv2, log_level)) ||
+        ((engine->wildcards & DLT_FILTER_ENGINE_KEY_APID) &&
+         dlt_filter_engine_lookup(engine, dlt_filter_engine_key(apid, 0), msg, msgv2, log_level)) ||
+        ((engine->wildcards & DLT_FILTER_ENGINE_KEY_CTID) &&
+         dlt_filter_engine_lookup(engine, dlt_filter_engine_key(0, ctid), msg, msgv2, log_level)) ||
+        ((engine->wildcards & DLT_FILTER_ENGINE_KEY_ANY) &&
+         dlt_filter_engine_lookup(engine, dlt_filter_engine_key(0, 0), msg, msgv2, log_level)))
+        return DLT_RETURN_TRUE;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_filter_engine_match(const DltFilterEngine *engine, const DltMessage *msg)
+{
+    uint32_t apid;
+    uint32_t ctid;
+
+    if ((engine == NULL) || (msg == NULL) || (msg->standardheader == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if ((engine->count == 0) || !DLT_IS_HTYP_UEH(msg->standardheader->htyp))
+        /* no filter is set, or no extended header is available, so do as filter is matching */
+        return DLT_RETURN_TRUE;
+
+    memcpy(&apid, msg->extendedheader->apid, sizeof(apid));
+    memcpy(&ctid, msg->extendedheader->ctid, sizeof(ctid));
+
+    return dlt_filter_engine_match_ids(engine, apid, ctid, msg, NULL,
+                                       DLT_GET_MSIN_MTIN(msg->extendedheader->msin));
+}
+
+DltReturnValue dlt_filter_engine_match_v2(const DltFilterEngine *engine, const DltMessageV2 *msg)
+{
+    if ((engine == NULL) || (msg == NULL) || (msg->baseheaderv2 == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    if ((engine->count == 0) || !DLT_IS_HTYP2_EH(msg->baseheaderv2->htyp2))
+        /* no filter is set, or no extended header is available, so do as filter is matching */
+        return DLT_RETURN_TRUE;
+
+    return dlt_filter_engine_match_ids(engine,
+                                       dlt_filter_engine_pack_id_v2(msg->extendedheaderv2.apid,
+                                                                    msg->extendedheaderv2.apidlen),
+                                       dlt_filter_engine_pack_id_v2(msg->extendedheaderv2.ctid,
+                                                                    msg->extendedheaderv2.ctidlen),
+                                       NULL, msg, DLT_GET_MSIN_MTIN(msg->headerextrav2.msin));
+}
+
+/* Set an id of a rule, ids longer than four characters are kept as DLT v2 id */
+static void dlt_filter_engine_set_id(uint32_t *packed, char **id2, uint8_t *id2len, const char *id, uint8_t idlen)
+{
+    *packed = dlt_filter_engine_pack_id_v2(id, idlen);
+    *id2 = NULL;
+    *id2len = 0;
+
+    /* the rule only points to the id, dlt_filter_engine_add() copies it */
+    if ((id != NULL) && (idlen > DLT_ID_SIZE)) {
+        *id2 = (char *)(uintptr_t)id;
+        *id2len = idlen;
+    }
+}
+
+/* Add a rule, rules added twice are only kept once */
+static DltReturnValue dlt_filter_engine_add_once(DltFilterEngine *engine, const DltFilterRule *rule)
+{
+    if ((dlt_filter_engine_add(engine, rule) < DLT_RETURN_OK) && (dlt_filter_engine_find(engine, rule) < 0))
+        return DLT_RETURN_ERROR;
+
+    return DLT_RETURN_OK;
+}
+
+DltReturnValue dlt_filter_engine_load(DltFilterEngine *engine, const char *filename, int verbose)
+{
+    FILE *handle;
+    char apid[DLT_V2_ID_SIZE + 1];
+    char ctid[DLT_V2_ID_SIZE + 1];
+    DltFilterRule rule;
+    DltReturnValue ret = DLT_RETURN_OK;
+
+    PRINT_FUNCTION_VERBOSE(verbose);
+
+    if ((engine == NULL) || (filename == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    handle = fopen(filename, "r");
+
+    if (handle == NULL) {
+        dlt_vlog(LOG_WARNING, "Filter file %s cannot be opened!\n", filename);
+        return DLT_RETURN_ERROR;
+    }
+
+    #define DLT_FILTER_ENGINE_FORMAT_(x) "%" #x "s"
+    #define DLT_FILTER_ENGINE_FORMAT(x) DLT_FILTER_ENGINE_FORMAT_(x)
+
+    /* Reset filters */
+    dlt_filter_engine_free(engine);
+
+    while (ret == DLT_RETURN_OK) {
+        if ((fscanf(handle, DLT_FILTER_ENGINE_FORMAT(DLT_V2_ID_SIZE), apid) != 1) ||
+            (fscanf(handle, DLT_FILTER_ENGINE_FORMAT(DLT_V2_ID_SIZE), ctid) != 1))
+            break;
+
+        printf(" %s %s\r\n", apid, ctid);
+
+        /* "----" and "*" match every id */
+        if ((strcmp(apid, "----") == 0) || (strcmp(apid, "*") == 0))
+            apid[0] = 0;
+
+        if ((strcmp(ctid, "----") == 0) || (strcmp(ctid, "*") == 0))
+            ctid[0] = 0;
+
+        memset(&rule, 0, sizeof(rule));
+        dlt_filter_engine_set_id(&rule.apid, &rule.apid2, &rule.apid2len, apid, (uint8_t)strlen(apid));
+        dlt_filter_engine_set_id(&rule.ctid, &rule.ctid2, &rule.ctid2len, ctid, (uint8_t)strlen(ctid));
+        rule.payload_max = INT32_MAX;
+
+        ret = dlt_filter_engine_add_once(engine, &rule);
+    }
+
+    fclose(handle);
+
+    if (ret < DLT_RETURN_OK)
+        return ret;
+
+    return dlt_filter_engine_compile(engine);
+}
+
+DltReturnValue dlt_filter_compile(const DltFilter *filter, DltFilterEngine *engine)
+{
+    DltFilterRule rule;
+    int num;
+
+    if ((filter == NULL) || (engine == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    dlt_filter_engine_free(engine);
+
+    for (num = 0; (num < filter->counter) && (num < DLT_FILTER_MAX); num++) {
+        memset(&rule, 0, sizeof(rule));
+        rule.apid = dlt_filter_engine_pack_id(filter->apid[num]);
+        rule.ctid = dlt_filter_engine_pack_id(filter->ctid[num]);
+        rule.log_level = filter->log_level[num];
+        rule.payload_min = filter->payload_min[num];
+        rule.payload_max = filter->payload_max[num];
+
+        if (dlt_filter_engine_add_once(engine, &rule) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+    }
+
+    return dlt_filter_engine_compile(engine);
+}
+
+DltReturnValue dlt_filter_compile_v2(const DltFilter *filter, DltFilterEngine *engine)
+{
+    DltFilterRule rule;
+    int num;
+
+    if ((filter == NULL) || (engine == NULL))
+        return DLT_RETURN_WRONG_PARAMETER;
+
+    dlt_filter_engine_free(engine);
+
+    for (num = 0; (num < filter->counter) && (num < DLT_FILTER_MAX); num++) {
+        memset(&rule, 0, sizeof(rule));
+        dlt_filter_engine_set_id(&rule.apid, &rule.apid2, &rule.apid2len,
+                                 filter->apid2[num], filter->apid2len[num]);
+        dlt_filter_engine_set_id(&rule.ctid, &rule.ctid2, &rule.ctid2len,
+                                 filter->ctid2[num], filter->ctid2len[num]);
+        rule.log_level = filter->log_level[num];
+        rule.payload_min = filter->payload_min[num];
+        rule.payload_max = filter->payload_max[num];
+
+        if (dlt_filter_engine_add_once(engine, &rule) < DLT_RETURN_OK)
+            return DLT_RETURN_ERROR;
+    }
+
+    return dlt_filter_engine_compile(engine);
+}
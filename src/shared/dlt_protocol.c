@@ -61,8 +61,8 @@ const char *const dlt_user_service_names[] = {
     "DLT_SERVICE_ID_PASSIVE_NODE_CONNECTION_STATUS",
     "DLT_SERVICE_ID_SET_ALL_LOG_LEVEL",
     "DLT_SERVICE_ID_SET_ALL_TRACE_STATUS",
-    "DLT_SERVICE_ID_UNDEFINED", /* 0xF0A is not defined */
-    "DLT_SERVICE_ID_RESERVED",
+    "DLT_SERVICE_ID_SET_CLIENT_FILTER",
+    "DLT_SERVICE_ID_SET_STREAM_COMPRESSION",
     "DLT_SERVICE_ID_RESERVED",
     "DLT_SERVICE_ID_RESERVED",
     "DLT_SERVICE_ID_RESERVED"
@@ -173,6 +173,42 @@ DltReturnValue dlt_user_log_out2_with_timeout(int handle, void *ptr1, size_t len
     }
 }
 
+/* Writes larger than PIPE_BUF to a non-blocking FIFO may be partial. As the daemon
+ * already got the begin of the message, the rest has to follow, otherwise the
+ * message would be corrupted when it is buffered and sent again. */
+static DltReturnValue dlt_user_log_out_remaining(int handle, struct iovec *iov, int iovcnt, size_t written)
+{
+    struct pollfd pfd;
+    ssize_t ret;
+
+    pfd.fd = handle;
+    pfd.events = POLLOUT;
+
+    while (iovcnt > 0) {
+        if (written >= iov->iov_len) {
+            written -= iov->iov_len;
+            iov++;
+            iovcnt--;
+            continue;
+        }
+
+        iov->iov_base = (char *)iov->iov_base + written;
+        iov->iov_len -= written;
+
+        if ((poll(&pfd, 1, DLT_WRITEV_TIMEOUT_MS) <= 0) || !(pfd.revents & POLLOUT))
+            return DLT_RETURN_PIPE_ERROR;
+
+        ret = writev(handle, iov, iovcnt);
+
+        if ((ret < 0) && (errno != EAGAIN) && (errno != EINTR))
+            return DLT_RETURN_PIPE_ERROR;
+
+        written = (ret < 0) ? 0 : (size_t)ret;
+    }
+
+    return DLT_RETURN_OK;
+}
+
 DltReturnValue dlt_user_log_out3(int handle, void *ptr1, size_t len1, void *ptr2, size_t len2, void *ptr3, size_t len3)
 {
     struct iovec iov[3];
@@ -191,6 +227,9 @@ DltReturnValue dlt_user_log_out3(int handle, void *ptr1, size_t len1, void *ptr2
 
     bytes_written = (uint32_t) writev(handle, iov, 3);
 
+    if ((bytes_written > 0) && (bytes_written < (len1 + len2 + len3)))
+        return dlt_user_log_out_remaining(handle, iov, 3, bytes_written);
+
     if (bytes_written != (len1 + len2 + len3)) {
         switch (errno) {
         case ETIMEDOUT:
@@ -61,6 +61,12 @@
 #include <string.h>
 #include <inttypes.h>
 #include <poll.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#ifdef DLT_FILETRANSFER_USE_ZSTD
+#   include <zstd.h>
+#endif
 
 #include "dlt-system.h"
 #include "dlt.h"
@@ -72,6 +78,9 @@
 #endif
 #define Z_CHUNK_SZ 1024 * 128
 #define COMPRESS_EXTENSION ".gz"
+#define ZSTD_EXTENSION ".zst"
+/* Size of a data package of a file compressed while sending, as used by dlt_user_log_file_data */
+#define STREAM_PACKAGE_SIZE 1024
 #define SUBDIR_COMPRESS ".tocompress"
 #define SUBDIR_TOSEND ".tosend"
 
@@ -86,6 +95,40 @@ DLT_DECLARE_CONTEXT(filetransferContext)
 s_ft_inotify ino;
 #endif
 
+extern volatile uint8_t quit;
+
+/* File found by inotify, waiting to be sent by the filetransfer thread */
+typedef struct s_ft_job {
+    char *path;
+    int which;
+    struct s_ft_job *next;
+} s_ft_job;
+
+/* Files are compressed and sent by a thread, so that process_files only queues them */
+static struct {
+    FiletransferOptions const *opts;
+    pthread_t thread;
+    int running;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    s_ft_job *first;
+    s_ft_job *last;
+} ft_worker = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL };
+
+/* A file compressed while it is sent */
+typedef struct {
+    int compression;
+    z_stream zstream;
+#ifdef DLT_FILETRANSFER_USE_ZSTD
+    ZSTD_CCtx *zstd;
+#endif
+    unsigned char package[STREAM_PACKAGE_SIZE];
+    size_t used;
+    uint32_t serial;
+    uint32_t packages;
+    uint32_t size;
+} s_ft_stream;
+
 
 char *origin_name(char *src)
 {
@@ -132,11 +175,53 @@ char *unique_name(char *src)
  * Function which only calls the relevant part to transfer the payload
  */
 
-void send_dumped_file(FiletransferOptions const *opts, char *dst_tosend)
+/**
+ * Wait until the user buffer is less than half full
+ * @return 0 if a package can be sent, -1 if dlt-system is stopped
+ */
+static int wait_for_user_buffer(FiletransferOptions const *opts)
+{
+    int total = 2;
+    int used = 2;
+    dlt_user_check_buffer(&total, &used);
+
+    while ((total - used) < (total / 2)) {
+        struct timespec t;
+
+        if (quit)
+            return -1;
+
+        t.tv_sec = 0;
+        t.tv_nsec = 1000000ul * opts->TimeoutBetweenLogs;
+        nanosleep(&t, NULL);
+        dlt_user_log_resend_buffer();
+        dlt_user_check_buffer(&total, &used);
+    }
+
+    return 0;
+}
+
+/**
+ * Wait until a client is connected to the daemon
+ * @return 0 if a client is connected, -1 if dlt-system is stopped
+ */
+static int wait_for_client(void)
 {
     /* check if a client is connected to the deamon. If not, try again in a second */
-    while (dlt_get_log_state() != 1)
+    while (dlt_get_log_state() != 1) {
+        if (quit)
+            return -1;
+
         sleep(1);
+    }
+
+    return 0;
+}
+
+void send_dumped_file(FiletransferOptions const *opts, char *dst_tosend)
+{
+    if (wait_for_client() < 0)
+        return;
 
     char *fn = origin_name(dst_tosend);
     DLT_LOG(dltsystem, DLT_LOG_DEBUG,
@@ -148,17 +233,9 @@ void send_dumped_file(FiletransferOptions const *opts, char *dst_tosend)
         int success = 1;
 
         while (lastpkg < pkgcount) {
-            int total = 2;
-            int used = 2;
-            dlt_user_check_buffer(&total, &used);
-
-            while ((total - used) < (total / 2)) {
-                struct timespec t;
-                t.tv_sec = 0;
-                t.tv_nsec = 1000000ul * opts->TimeoutBetweenLogs;
-                nanosleep(&t, NULL);
-                dlt_user_log_resend_buffer();
-                dlt_user_check_buffer(&total, &used);
+            if (wait_for_user_buffer(opts) < 0) {
+                success = 0;
+                break;
             }
 
             lastpkg++;
@@ -243,6 +320,282 @@ int compress_file_to(char *src, char *dst, int level)
     return 0;
 }
 
+/**
+ * Send the collected compressed data as FLDA package
+ */
+static void stream_send_package(s_ft_stream *stream)
+{
+    stream->packages++;
+    stream->size += (uint32_t)stream->used;
+
+    DLT_LOG(filetransferContext, DLT_LOG_INFO,
+            DLT_STRING("FLDA"),
+            DLT_UINT(stream->serial),
+            DLT_UINT(stream->packages),
+            DLT_RAW(stream->package, (uint16_t)stream->used),
+            DLT_STRING("FLDA"));
+
+    stream->used = 0;
+}
+
+/**
+ * Compress data and send every full package
+ * @param stream compression state
+ * @param opts FiletransferOptions
+ * @param data uncompressed data
+ * @param len length of data
+ * @param finish set for the last data of the file, the rest is compressed and sent
+ * @return 0 if ok, -1 on error or if dlt-system is stopped
+ */
+static int stream_compress(s_ft_stream *stream, FiletransferOptions const *opts,
+                           unsigned char *data, size_t len, int finish)
+{
+    int done = 0;
+
+#ifdef DLT_FILETRANSFER_USE_ZSTD
+    if (stream->compression == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM) {
+        ZSTD_inBuffer in = { data, len, 0 };
+
+        while (!done) {
+            ZSTD_outBuffer out = { stream->package, STREAM_PACKAGE_SIZE, stream->used };
+            size_t remaining = ZSTD_compressStream2(stream->zstd, &out, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+
+            if (ZSTD_isError(remaining)) {
+                DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                        DLT_STRING("dlt-system-filetransfer, zstd compression failed:"),
+                        DLT_STRING(ZSTD_getErrorName(remaining)));
+                return -1;
+            }
+
+            stream->used = out.pos;
+            done = finish ? (remaining == 0) : (in.pos == in.size);
+
+            if (stream->used == STREAM_PACKAGE_SIZE) {
+                if (wait_for_user_buffer(opts) < 0)
+                    return -1;
+
+                stream_send_package(stream);
+            }
+        }
+
+        return 0;
+    }
+#endif
+
+    stream->zstream.next_in = data;
+    stream->zstream.avail_in = (uInt)len;
+
+    while (!done) {
+        stream->zstream.next_out = stream->package + stream->used;
+        stream->zstream.avail_out = (uInt)(STREAM_PACKAGE_SIZE - stream->used);
+
+        int ret = deflate(&stream->zstream, finish ? Z_FINISH : Z_NO_FLUSH);
+
+        if ((ret != Z_OK) && (ret != Z_STREAM_END) && (ret != Z_BUF_ERROR)) {
+            DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                    DLT_STRING("dlt-system-filetransfer, deflate failed:"), DLT_INT(ret));
+            return -1;
+        }
+
+        stream->used = STREAM_PACKAGE_SIZE - stream->zstream.avail_out;
+        done = finish ? (ret == Z_STREAM_END) : (stream->zstream.avail_in == 0);
+
+        if (stream->used == STREAM_PACKAGE_SIZE) {
+            if (wait_for_user_buffer(opts) < 0)
+                return -1;
+
+            stream_send_package(stream);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Initialise the compression of a file
+ * @return 0 if ok, -1 on error
+ */
+static int stream_init(s_ft_stream *stream, int compression, int level)
+{
+    memset(stream, 0, sizeof(s_ft_stream));
+    stream->compression = compression;
+
+#ifdef DLT_FILETRANSFER_USE_ZSTD
+    if (compression == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM) {
+        stream->zstd = ZSTD_createCCtx();
+
+        if ((stream->zstd == NULL) ||
+            ZSTD_isError(ZSTD_CCtx_setParameter(stream->zstd, ZSTD_c_compressionLevel, level))) {
+            ZSTD_freeCCtx(stream->zstd);
+            return -1;
+        }
+
+        return 0;
+    }
+#endif
+
+    /* 16 added to the window bits writes a gzip header, the result is the same as of compress_file_to */
+    if (deflateInit2(&stream->zstream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return -1;
+
+    return 0;
+}
+
+static void stream_free(s_ft_stream *stream)
+{
+#ifdef DLT_FILETRANSFER_USE_ZSTD
+    if (stream->compression == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM) {
+        ZSTD_freeCCtx(stream->zstd);
+        return;
+    }
+#endif
+
+    deflateEnd(&stream->zstream);
+}
+
+/**
+ * Compress a file while sending it, without a temporary compressed file.
+ * The size of the compressed file is not known when the header is sent, so the
+ * FLST package announces 0 packages and the FLFI package carries the size and
+ * the number of packages.
+ * The file is deleted after it was sent.
+ *  @param opts FiletransferOptions
+ *  @param which which directory is affected -> position in list of opts->Directory
+ *  @param dst_tosend File to be sent
+ *  @return 0 if the file was sent, -1 otherwise
+ */
+int send_streamed_file(FiletransferOptions const *opts, int which, char *dst_tosend)
+{
+    s_ft_stream stream;
+    struct stat st;
+    struct tm ts;
+    char fcreationdate[50] = { 0 };
+    char alias[NAME_MAX + 1];
+    unsigned char *buf;
+    int ok = 0;
+    int ret = 0;
+    int err = 0;
+    int fd;
+
+    if (wait_for_client() < 0)
+        return -1;
+
+    char *fn = origin_name(dst_tosend);
+
+    if (fn == NULL)
+        return -1;
+
+    snprintf(alias, sizeof(alias), "%s%s", fn,
+             (opts->Compression[which] == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM) ? ZSTD_EXTENSION : COMPRESS_EXTENSION);
+
+    DLT_LOG(dltsystem, DLT_LOG_DEBUG,
+            DLT_STRING("dlt-system-filetransfer, compressing and sending file:"), DLT_STRING(alias));
+
+    fd = open(dst_tosend, O_RDONLY | O_CLOEXEC);
+
+    if ((fd < 0) || (fstat(fd, &st) < 0)) {
+        DLT_LOG(filetransferContext, DLT_LOG_ERROR,
+                DLT_STRING("FLER"),
+                DLT_INT(DLT_FILETRANSFER_ERROR_FILE_HEAD),
+                DLT_INT(-errno),
+                DLT_STRING(alias),
+                DLT_STRING("FLER"));
+
+        if (fd >= 0)
+            close(fd);
+
+        return -1;
+    }
+
+    if (stream_init(&stream, opts->Compression[which], opts->CompressionLevel[which]) < 0) {
+        DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                DLT_STRING("dlt-system-filetransfer, could not initialise compression for"), DLT_STRING(alias));
+        close(fd);
+        return -1;
+    }
+
+    buf = malloc(Z_CHUNK_SZ);
+    MALLOC_ASSERT(buf);
+
+    stream.serial = getFileSerialNumber(dst_tosend, &ok);
+    localtime_r(&st.st_ctime, &ts);
+    asctime_r(&ts, fcreationdate);
+
+    DLT_LOG(filetransferContext, DLT_LOG_INFO,
+            DLT_STRING("FLST"),
+            DLT_UINT(stream.serial),
+            DLT_STRING(alias),
+            DLT_UINT(0),
+            DLT_STRING(fcreationdate),
+            DLT_UINT(0),
+            DLT_UINT(STREAM_PACKAGE_SIZE),
+            DLT_STRING("FLST"));
+
+    while (ret == 0) {
+        ssize_t len = read(fd, buf, Z_CHUNK_SZ);
+
+        if (len < 0) {
+            err = errno;
+            ret = -1;
+            break;
+        }
+
+        ret = stream_compress(&stream, opts, buf, (size_t)len, len == 0);
+
+        if (len == 0)
+            break;
+    }
+
+    if ((ret == 0) && (stream.used > 0)) {
+        ret = wait_for_user_buffer(opts);
+
+        if (ret == 0)
+            stream_send_package(&stream);
+    }
+
+    free(buf);
+    stream_free(&stream);
+    close(fd);
+
+    if (ret < 0) {
+        DLT_LOG(filetransferContext, DLT_LOG_ERROR,
+                DLT_STRING("FLER"),
+                DLT_INT(DLT_FILETRANSFER_ERROR_FILE_DATA),
+                DLT_INT(-err),
+                DLT_STRING(alias),
+                DLT_STRING("FLER"));
+        return -1;
+    }
+
+    DLT_LOG(filetransferContext, DLT_LOG_INFO,
+            DLT_STRING("FLFI"),
+            DLT_UINT(stream.serial),
+            DLT_UINT(stream.size),
+            DLT_UINT(stream.packages),
+            DLT_STRING("FLFI"));
+
+    if (remove(dst_tosend) < 0)
+        DLT_LOG(dltsystem, DLT_LOG_WARN, DLT_STRING("Could not remove file"), DLT_STRING(dst_tosend));
+
+    DLT_LOG(dltsystem, DLT_LOG_DEBUG,
+            DLT_STRING("dlt-system-filetransfer, sent compressed file:"), DLT_STRING(alias),
+            DLT_STRING("size:"), DLT_UINT(stream.size));
+
+    return 0;
+}
+
+/**
+ * Send a file from the tosend directory, compressed while sending if configured
+ */
+static void send_tosend_file(FiletransferOptions const *opts, int which, char *dst_tosend)
+{
+    if ((opts->Compression[which] == DLT_SYSTEM_COMPRESSION_GZIP_STREAM) ||
+        (opts->Compression[which] == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM))
+        send_streamed_file(opts, which, dst_tosend);
+    else
+        send_dumped_file(opts, dst_tosend);
+}
+
 /*!Sends one file over DLT. */
 /**
  * If configured in opts, compresses it, then sends it.
@@ -283,7 +636,7 @@ int send_one(char *src, FiletransferOptions const *opts, int which)
     }
 
     /* Compress if needed */
-    if (opts->Compression[which] > 0) {
+    if (opts->Compression[which] == DLT_SYSTEM_COMPRESSION_GZIP) {
         DLT_LOG(dltsystem, DLT_LOG_DEBUG,
                 DLT_STRING("dlt-system-filetransfer, Moving file to tmp directory for compressing it."));
 
@@ -353,7 +706,7 @@ int send_one(char *src, FiletransferOptions const *opts, int which)
     DLT_LOG(dltsystem, DLT_LOG_DEBUG,
             DLT_STRING("dlt-system-filetransfer, File ready to send"));
 
-    send_dumped_file(opts, dst_tosend);
+    send_tosend_file(opts, which, dst_tosend);
 
 
     free(rn);
@@ -364,7 +717,7 @@ int send_one(char *src, FiletransferOptions const *opts, int which)
 }
 
 
-int flush_dir_send(FiletransferOptions const *opts, const char *compress_dir, const char *send_dir)
+int flush_dir_send(FiletransferOptions const *opts, int which, const char *compress_dir, const char *send_dir)
 {
     struct dirent *dp;
     DIR *dir;
@@ -438,7 +791,7 @@ int flush_dir_send(FiletransferOptions const *opts, const char *compress_dir, co
                 DLT_LOG(dltsystem, DLT_LOG_DEBUG,
                         DLT_STRING("dlt-system-filetransfer, Sending uncompressed file from previous LC."),
                         DLT_STRING(fn));
-                send_dumped_file(opts, fn);
+                send_tosend_file(opts, which, fn);
             }
 
             free(fn);
@@ -575,7 +928,7 @@ int flush_dir(FiletransferOptions const *opts, int which)
     snprintf(send_dir, len, "%s/%s", opts->Directory[which], SUBDIR_TOSEND);
 
     /*1st: scan the tosend directory. */
-    if (0 != flush_dir_send(opts, compress_dir, send_dir)) {
+    if (0 != flush_dir_send(opts, which, compress_dir, send_dir)) {
         free(send_dir);
         free(compress_dir);
         return -1;
@@ -598,6 +951,104 @@ int flush_dir(FiletransferOptions const *opts, int which)
     return 0;
 }
 
+/*!Sends the files found by process_files */
+/**
+ * Flushes the surveyed directories first, then waits for queued files until dlt-system is stopped.
+ * Files still queued then stay in the directories and are sent after the next start.
+ * @param arg FiletransferOptions
+ */
+static void *filetransfer_thread(void *arg)
+{
+    FiletransferOptions const *opts = arg;
+    int i;
+
+    for (i = 0; (i < opts->Count) && !quit; i++)
+        flush_dir(opts, i);
+
+    pthread_mutex_lock(&ft_worker.mutex);
+
+    while (!quit) {
+        s_ft_job *job = ft_worker.first;
+
+        if (job == NULL) {
+            pthread_cond_wait(&ft_worker.cond, &ft_worker.mutex);
+            continue;
+        }
+
+        ft_worker.first = job->next;
+
+        if (ft_worker.first == NULL)
+            ft_worker.last = NULL;
+
+        pthread_mutex_unlock(&ft_worker.mutex);
+
+        send_one(job->path, opts, job->which);
+        free(job->path);
+        free(job);
+
+        pthread_mutex_lock(&ft_worker.mutex);
+    }
+
+    pthread_mutex_unlock(&ft_worker.mutex);
+
+    return NULL;
+}
+
+/*!Hands a new file over to the filetransfer thread */
+/**
+ * @param path file to send, owned by the filetransfer thread afterwards
+ * @param which which directory is affected -> position in list of opts->Directory
+ */
+static void queue_file(char *path, int which)
+{
+    if (!ft_worker.running) {
+        send_one(path, ft_worker.opts, which);
+        free(path);
+        return;
+    }
+
+    s_ft_job *job = malloc(sizeof(s_ft_job));
+    MALLOC_ASSERT(job);
+    job->path = path;
+    job->which = which;
+    job->next = NULL;
+
+    pthread_mutex_lock(&ft_worker.mutex);
+
+    if (ft_worker.last != NULL)
+        ft_worker.last->next = job;
+    else
+        ft_worker.first = job;
+
+    ft_worker.last = job;
+    pthread_cond_signal(&ft_worker.cond);
+    pthread_mutex_unlock(&ft_worker.mutex);
+}
+
+/*!Stops the filetransfer thread */
+/**
+ * Must be called after quit was set.
+ */
+void cleanup_filetransfer(void)
+{
+    if (ft_worker.running) {
+        pthread_mutex_lock(&ft_worker.mutex);
+        pthread_cond_broadcast(&ft_worker.cond);
+        pthread_mutex_unlock(&ft_worker.mutex);
+        pthread_join(ft_worker.thread, NULL);
+        ft_worker.running = 0;
+    }
+
+    while (ft_worker.first != NULL) {
+        s_ft_job *job = ft_worker.first;
+        ft_worker.first = job->next;
+        free(job->path);
+        free(job);
+    }
+
+    ft_worker.last = NULL;
+}
+
 /*!Initializes the surveyed directories */
 /**On startup, the inotifiy handlers are created, and existing files shall be sent into DLT stream
  * @param config DltSystemConfiguration
@@ -610,6 +1061,8 @@ int init_filetransfer_dirs(DltSystemConfiguration *config)
     DLT_LOG(dltsystem, DLT_LOG_DEBUG,
             DLT_STRING("dlt-system-filetransfer, initializing inotify on directories."));
     int i;
+    ft_worker.opts = opts;
+
 #ifdef linux
     ino.handle = inotify_init();
 
@@ -663,6 +1116,15 @@ int init_filetransfer_dirs(DltSystemConfiguration *config)
 
         free(subdirpath);
 
+#ifndef DLT_FILETRANSFER_USE_ZSTD
+        if (opts->Compression[i] == DLT_SYSTEM_COMPRESSION_ZSTD_STREAM) {
+            DLT_LOG(dltsystem, DLT_LOG_WARN,
+                    DLT_STRING("dlt-system-filetransfer, built without zstd, using gzip instead for"),
+                    DLT_STRING(opts->Directory[i]));
+            config->Filetransfer.Compression[i] = DLT_SYSTEM_COMPRESSION_GZIP_STREAM;
+        }
+#endif
+
 #ifdef linux
         ino.fd[i] = inotify_add_watch(ino.handle, opts->Directory[i],
                                       IN_CLOSE_WRITE | IN_MOVED_TO);
@@ -677,10 +1139,20 @@ int init_filetransfer_dirs(DltSystemConfiguration *config)
         }
 
 #endif
+    }
 
-        flush_dir(opts, i);
+    /* existing files are sent by the thread as well, so that startup is not delayed */
+    if (pthread_create(&ft_worker.thread, NULL, filetransfer_thread, (void *)(uintptr_t)opts) == 0) {
+        ft_worker.running = 1;
+    }
+    else {
+        DLT_LOG(dltsystem, DLT_LOG_WARN,
+                DLT_STRING("dlt-system-filetransfer, could not create thread, sending files directly."));
 
+        for (i = 0; i < opts->Count; i++)
+            flush_dir(opts, i);
     }
+
     return 0;
 }
 
@@ -724,9 +1196,9 @@ int process_files(FiletransferOptions const *opts)
                         }
 
                         char *tosend = malloc(length);
+                        MALLOC_ASSERT(tosend);
                         snprintf(tosend, length, "%s/%s", opts->Directory[j], ie->name);
-                        send_one(tosend, opts, j);
-                        free(tosend);
+                        queue_file(tosend, j);
                     }
             }
         }
@@ -49,6 +49,7 @@
 #include <netinet/in.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "dlt-system.h"
 
@@ -64,15 +65,80 @@
 #define DLT_SYSTEM_JOURNAL_ASCII_FIRST_VISIBLE_CHARACTER 31
 #define DLT_SYSTEM_JOURNAL_BOOT_ID_MAX_LENGTH 9 + 32 + 1
 
+/* Number of entries read from the journal before the user buffer is checked */
+#define DLT_SYSTEM_JOURNAL_BATCH_SIZE 64
+
+/* Maximum time the journal thread waits for new entries */
+#define DLT_SYSTEM_JOURNAL_POLL_TIMEOUT_MS 1000
+
+/* Time to wait for the daemon when the user buffer is half full */
+#define DLT_SYSTEM_JOURNAL_BUFFER_WAIT_MS 20
+
+/* Number of slots of an intern table, must be a power of two */
+#define DLT_SYSTEM_JOURNAL_INTERN_SIZE 256
+
+/* True if a field returned by sd_journal_enumerate_data() is "name=..." */
+#define DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, name) \
+    (((length) >= sizeof(name) - 1) && (memcmp((data), (name), sizeof(name) - 1) == 0))
+
 typedef struct
 {
     char real[DLT_SYSTEM_JOURNAL_BUFFER_SIZE];
     char monotonic[DLT_SYSTEM_JOURNAL_BUFFER_SIZE];
 } MessageTimestamp;
 
+/*
+ * A value of a journal field which repeats in most entries, like _COMM or
+ * _SYSTEMD_UNIT. It is stored once and found again by its hash. The entries
+ * of the unit table also hold the rate limit state of the unit.
+ */
+typedef struct
+{
+    char *value;                /* NULL if the slot is free */
+    size_t length;
+    uint32_t hash;
+    uint64_t last_use;          /* use of the table when the value was last returned */
+    uint64_t interval_start;    /* begin of the rate limit interval in us */
+    unsigned int count;         /* entries logged in the interval */
+    unsigned int suppressed;    /* entries dropped in the interval */
+} JournalInternEntry;
+
+typedef struct
+{
+    JournalInternEntry entry[DLT_SYSTEM_JOURNAL_INTERN_SIZE];
+    unsigned int used;
+    uint64_t uses;              /* number of values returned */
+} JournalInternTable;
+
+/* The fields of a journal entry which are logged */
+typedef struct
+{
+    JournalInternEntry *comm;
+    JournalInternEntry *transport;
+    JournalInternEntry *unit;
+    char pid[DLT_SYSTEM_JOURNAL_BUFFER_SIZE];
+    char message[DLT_SYSTEM_JOURNAL_BUFFER_SIZE_BIG];
+    int priority;
+    int has_realtime;
+    int has_monotonic;
+    uint64_t realtime;
+    uint64_t monotonic;
+} JournalEntry;
+
 DLT_IMPORT_CONTEXT(dltsystem)
 DLT_DECLARE_CONTEXT(journalContext)
 
+extern volatile uint8_t quit;
+
+/* only used by the journal thread */
+static JournalInternTable journal_comm;
+static JournalInternTable journal_transport;
+static JournalInternTable journal_unit;
+
+/* localtime of the last formatted second, reset with every batch */
+static time_t journal_cached_secs = -1;
+static char journal_cached_time[64];
+
 int journal_checkUserBufferForFreeSpace()
 {
     int total_size, used_size;
@@ -85,131 +151,293 @@ int journal_checkUserBufferForFreeSpace()
     return 1;
 }
 
-int dlt_system_journal_get(sd_journal *j, char *target, const char *field, size_t max_size)
+/* Wait until the user buffer is at most half full, no entries are dropped while the daemon is busy */
+static void journal_wait_for_user_buffer(void)
 {
-    char *data;
-    size_t length;
-    int error_code;
-    size_t field_size;
+    struct timespec t;
 
-    /* pre check parameters */
-    if ((max_size < 1) || (target == 0) || (field == 0) || (j == 0))
-        return -1;
+    t.tv_sec = 0;
+    t.tv_nsec = 1000000l * DLT_SYSTEM_JOURNAL_BUFFER_WAIT_MS;
+
+    while (!quit && (journal_checkUserBufferForFreeSpace() == -1)) {
+        nanosleep(&t, NULL);
+
+        /* buffered messages are only sent with the next message otherwise */
+        dlt_user_log_resend_buffer();
+    }
+}
+
+/* Log the number of entries of a unit dropped in its current interval */
+static void journal_report_suppressed(JournalInternEntry *unit)
+{
+    if (unit->suppressed > 0)
+        DLT_LOG(journalContext, DLT_LOG_WARN,
+                DLT_STRING("dlt-system-journal, suppressed"),
+                DLT_UINT(unit->suppressed),
+                DLT_STRING("messages of"),
+                DLT_STRING(unit->value));
+
+    unit->suppressed = 0;
+}
+
+/*
+ * Remove the value which was not used for the longest time. Its pending
+ * rate limit report is logged first. The following entries of the probe
+ * sequence are moved back, so no gap breaks it.
+ */
+static void journal_intern_evict(JournalInternTable *table)
+{
+    const unsigned int mask = DLT_SYSTEM_JOURNAL_INTERN_SIZE - 1;
+    unsigned int index = 0;
+    unsigned int next;
+    unsigned int home;
+    unsigned int i;
+
+    for (i = 0; i < DLT_SYSTEM_JOURNAL_INTERN_SIZE; i++)
+        if ((table->entry[i].value != NULL) &&
+            ((table->entry[index].value == NULL) || (table->entry[i].last_use < table->entry[index].last_use)))
+            index = i;
+
+    journal_report_suppressed(&table->entry[index]);
+    free(table->entry[index].value);
+
+    for (next = (index + 1) & mask; table->entry[next].value != NULL; next = (next + 1) & mask) {
+        home = table->entry[next].hash & mask;
+
+        /* an entry can fill the gap if its home slot is not between the gap and itself */
+        if (((next - home) & mask) >= ((next - index) & mask)) {
+            table->entry[index] = table->entry[next];
+            index = next;
+        }
+    }
 
-    /* intialise empty target */
-    target[0] = 0;
+    memset(&table->entry[index], 0, sizeof(JournalInternEntry));
+    table->used--;
+}
 
-    /* get data from journal */
-    error_code = sd_journal_get_data(j, field, (const void **)&data, &length);
+/*
+ * Return the entry of a value, add it if it is not in the table yet.
+ * When the table is three quarters full, the value not used for the longest
+ * time is removed and other entries may move, so entries stay valid only
+ * until the next call. Returns NULL if out of memory.
+ */
+static JournalInternEntry *journal_intern(JournalInternTable *table, const char *value, size_t length)
+{
+    JournalInternEntry *entry;
+    uint32_t hash = 2166136261u;
+    uint32_t index;
+    size_t i;
+
+    if (length >= DLT_SYSTEM_JOURNAL_BUFFER_SIZE)
+        length = DLT_SYSTEM_JOURNAL_BUFFER_SIZE - 1;
+
+    /* FNV-1a */
+    for (i = 0; i < length; i++) {
+        hash ^= (uint8_t)value[i];
+        hash *= 16777619u;
+    }
 
-    /* check if an error */
-    if (error_code)
-        return error_code;
+    index = hash & (DLT_SYSTEM_JOURNAL_INTERN_SIZE - 1);
 
-    /* calculate field size */
-    field_size = strlen(field) + 1;
+    while (table->entry[index].value != NULL) {
+        entry = &table->entry[index];
 
-    /*check length */
-    if (length < field_size)
-        return -1;
+        if ((entry->hash == hash) && (entry->length == length) && (memcmp(entry->value, value, length) == 0)) {
+            entry->last_use = ++table->uses;
+            return entry;
+        }
 
-    /* copy string */
-    if (max_size <= (length - field_size)) {
-        /* truncate */
-        strncpy(target, data + field_size, max_size - 1);
-        target[max_size - 1] = 0;
+        index = (index + 1) & (DLT_SYSTEM_JOURNAL_INTERN_SIZE - 1);
     }
-    else {
-        /* full copy */
-        strncpy(target, data + field_size, length - field_size);
-        target[length - field_size] = 0;
 
+    if (table->used >= DLT_SYSTEM_JOURNAL_INTERN_SIZE / 4 * 3) {
+        journal_intern_evict(table);
+
+        /* the free slot may have moved */
+        index = hash & (DLT_SYSTEM_JOURNAL_INTERN_SIZE - 1);
+
+        while (table->entry[index].value != NULL)
+            index = (index + 1) & (DLT_SYSTEM_JOURNAL_INTERN_SIZE - 1);
     }
 
-    /* debug messages */
-    /*printf("%s = %s\n",field,target); */
+    entry = &table->entry[index];
+    entry->value = malloc(length + 1);
+
+    if (entry->value == NULL)
+        return NULL;
+
+    memcpy(entry->value, value, length);
+    entry->value[length] = 0;
+    entry->length = length;
+    entry->hash = hash;
+    entry->last_use = ++table->uses;
+    table->used++;
 
-    /* Success */
-    return 0;
+    return entry;
 }
 
-void dlt_system_journal_get_timestamp(sd_journal *journal, MessageTimestamp *timestamp)
+static void journal_copy(char *target, size_t max_size, const char *value, size_t length)
 {
-    int ret = 0;
-    time_t time_secs = 0;
-    uint64_t time_usecs = 0;
-    struct tm timeinfo;
+    if (length >= max_size)
+        length = max_size - 1;
+
+    memcpy(target, value, length);
+    target[length] = 0;
+}
+
+/* Parse a decimal number, returns 0 if the value does not start with a digit */
+static int journal_parse_u64(const char *value, size_t length, uint64_t *result)
+{
+    size_t i;
 
-    char buffer_realtime[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 };
-    char buffer_realtime_formatted[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 };
-    char buffer_monotime[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 };
+    *result = 0;
 
-    /* Try to get realtime from message source and if not successful try to get realtime from journal entry */
-    ret = dlt_system_journal_get(journal, buffer_realtime, "_SOURCE_REALTIME_TIMESTAMP", sizeof(buffer_realtime));
+    for (i = 0; (i < length) && (value[i] >= '0') && (value[i] <= '9'); i++)
+        *result = *result * 10 + (uint64_t)(value[i] - '0');
 
-    if ((ret == 0) && (strlen(buffer_realtime) > 0)) {
-        errno = 0;
-        time_usecs = strtoull(buffer_realtime, NULL, 10);
+    return i > 0;
+}
 
-        if (errno != 0)
-            time_usecs = 0;
+/*
+ * Read all fields of the current journal entry in one pass. The data returned
+ * by sd_journal_enumerate_data() is only valid until the next call, so the
+ * values are copied or interned right away.
+ */
+static void journal_read_entry(sd_journal *j, JournalEntry *entry)
+{
+    const void *field;
+    const char *data;
+    size_t length;
+    uint64_t number;
+    int ret;
+
+    entry->comm = NULL;
+    entry->transport = NULL;
+    entry->unit = NULL;
+    entry->pid[0] = 0;
+    entry->message[0] = 0;
+    entry->priority = 0;
+    entry->has_realtime = 0;
+    entry->has_monotonic = 0;
+
+    SD_JOURNAL_FOREACH_DATA(j, field, length) {
+        data = field;
+
+        if (data[0] != '_') {
+            if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "MESSAGE="))
+                journal_copy(entry->message, sizeof(entry->message), data + 8, length - 8);
+            else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "PRIORITY="))
+                entry->priority = journal_parse_u64(data + 9, length - 9, &number) ? (int)(number & 0xff) : 0;
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_PID=")) {
+            journal_copy(entry->pid, sizeof(entry->pid), data + 5, length - 5);
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_COMM=")) {
+            entry->comm = journal_intern(&journal_comm, data + 6, length - 6);
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_TRANSPORT=")) {
+            entry->transport = journal_intern(&journal_transport, data + 11, length - 11);
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_SYSTEMD_UNIT=")) {
+            entry->unit = journal_intern(&journal_unit, data + 14, length - 14);
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_SOURCE_REALTIME_TIMESTAMP=")) {
+            entry->has_realtime = journal_parse_u64(data + 27, length - 27, &entry->realtime);
+        }
+        else if (DLT_SYSTEM_JOURNAL_FIELD_IS(data, length, "_SOURCE_MONOTONIC_TIMESTAMP=")) {
+            entry->has_monotonic = journal_parse_u64(data + 28, length - 28, &entry->monotonic);
+        }
     }
-    else if ((ret = sd_journal_get_realtime_usec(journal, &time_usecs)) < 0)
-    {
+
+    /* Use the realtime from message source if available, otherwise the realtime of the journal entry */
+    if (!entry->has_realtime && ((ret = sd_journal_get_realtime_usec(j, &entry->realtime)) < 0)) {
         DLT_LOG(dltsystem, DLT_LOG_WARN,
                 DLT_STRING("dlt-system-journal failed to get realtime: "),
                 DLT_STRING(strerror(-ret)));
 
         /* just to be sure to have a defined value */
-        time_usecs = 0;
+        entry->realtime = 0;
     }
 
-    time_secs = (time_t)(time_usecs / 1000000);
-    tzset();
-    localtime_r(&time_secs, &timeinfo);
-    strftime(buffer_realtime_formatted, sizeof(buffer_realtime_formatted), "%Y/%m/%d %H:%M:%S", &timeinfo);
-
-    snprintf(timestamp->real, sizeof(timestamp->real), "%s.%06" PRIu64, buffer_realtime_formatted,
-             time_usecs % 1000000);
+    /* entries without unit are rate limited by their process name */
+    if (entry->unit == NULL) {
+        if ((entry->transport != NULL) && (strcmp(entry->transport->value, "kernel") == 0))
+            entry->unit = journal_intern(&journal_unit, "kernel", 6);
+        else if (entry->comm != NULL)
+            entry->unit = journal_intern(&journal_unit, entry->comm->value, entry->comm->length);
+    }
+}
 
-    /* Try to get monotonic time from message source and if not successful try to get monotonic time from journal entry */
-    ret = dlt_system_journal_get(journal, buffer_monotime, "_SOURCE_MONOTONIC_TIMESTAMP", sizeof(buffer_monotime));
+void dlt_system_journal_get_timestamp(sd_journal *journal, JournalEntry *entry, MessageTimestamp *timestamp)
+{
+    int ret = 0;
+    time_t time_secs = 0;
+    struct tm timeinfo;
 
-    if ((ret == 0) && (strlen(buffer_monotime) > 0)) {
-        errno = 0;
-        time_usecs = strtoull(buffer_monotime, NULL, 10);
+    /* the realtime was already resolved by journal_read_entry(),
+     * entries of a batch are close together, so most of them share the second */
+    time_secs = (time_t)(entry->realtime / 1000000);
 
-        if (errno != 0)
-            time_usecs = 0;
+    if (time_secs != journal_cached_secs) {
+        localtime_r(&time_secs, &timeinfo);
+        strftime(journal_cached_time, sizeof(journal_cached_time), "%Y/%m/%d %H:%M:%S", &timeinfo);
+        journal_cached_secs = time_secs;
     }
-    else if ((ret = sd_journal_get_monotonic_usec(journal, &time_usecs, NULL)) < 0)
-    {
+
+    snprintf(timestamp->real, sizeof(timestamp->real), "%s.%06" PRIu64, journal_cached_time,
+             entry->realtime % 1000000);
+
+    /* Use the monotonic time from message source if available, otherwise the one of the journal entry */
+    if (!entry->has_monotonic && ((ret = sd_journal_get_monotonic_usec(journal, &entry->monotonic, NULL)) < 0)) {
         DLT_LOG(dltsystem, DLT_LOG_WARN,
                 DLT_STRING("dlt-system-journal failed to get monotonic time: "),
                 DLT_STRING(strerror(-ret)));
 
         /* just to be sure to have a defined value */
-        time_usecs = 0;
+        entry->monotonic = 0;
     }
 
     snprintf(timestamp->monotonic,
              sizeof(timestamp->monotonic),
-             "%" PRId64 ".%06" PRIu64,
-             time_usecs / 1000000,
-             time_usecs % 1000000);
+             "%" PRIu64 ".%06" PRIu64,
+             entry->monotonic / 1000000,
+             entry->monotonic % 1000000);
 }
 
-void get_journal_msg(sd_journal *j, DltSystemConfiguration *config) 
-{   
-    uint32_t ts;
-    int r;
+/*
+ * Returns 1 if the entry exceeds the burst of its unit in the current
+ * interval and has to be dropped. When a new interval starts, the number of
+ * entries dropped in the last one is logged.
+ */
+static int journal_rate_limit(DltSystemConfiguration *config, JournalInternEntry *unit, uint64_t now)
+{
+    uint64_t interval;
+
+    if ((config->Journal.RateLimitInterval <= 0) || (config->Journal.RateLimitBurst <= 0) || (unit == NULL))
+        return 0;
 
+    interval = (uint64_t)config->Journal.RateLimitInterval * 1000000;
+
+    if ((now < unit->interval_start) || (now - unit->interval_start >= interval)) {
+        journal_report_suppressed(unit);
+        unit->interval_start = now;
+        unit->count = 0;
+    }
+
+    if (unit->count < (unsigned int)config->Journal.RateLimitBurst) {
+        unit->count++;
+        return 0;
+    }
+
+    unit->suppressed++;
+    return 1;
+}
+
+static void journal_log_entry(sd_journal *j, DltSystemConfiguration *config, JournalEntry *entry)
+{
+    uint32_t ts;
     char buffer_process[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 },
-         buffer_priority[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 },
-         buffer_pid[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 },
-         buffer_comm[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 },
-         buffer_message[DLT_SYSTEM_JOURNAL_BUFFER_SIZE_BIG] = { 0 },
-         buffer_transport[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 };
+         buffer_priority[DLT_SYSTEM_JOURNAL_BUFFER_SIZE] = { 0 };
 
     MessageTimestamp timestamp;
 
@@ -217,117 +445,120 @@ void get_journal_msg(sd_journal *j, DltSystemConfiguration *config)
     char *systemd_log_levels[] =
     { "Emergency", "Alert", "Critical", "Error", "Warning", "Notice", "Informational", "Debug" };
 
-    for(;;)
-    {
-        r = sd_journal_next(j);
-        if (r < 0) {
-            DLT_LOG(dltsystem, DLT_LOG_ERROR,
-                    DLT_STRING("dlt-system-journal failed to get next entry:"), DLT_STRING(strerror(-r)));
-            sd_journal_close(j);
-            return;
-        }
-        else if (r == 0) {
-            return;
-        }
-
-        #if defined(DLT_SYSTEMD_WATCHDOG_ENFORCE_MSG_RX_ENABLE_DLT_SYSTEM) && defined(DLT_SYSTEMD_JOURNAL_ENABLE)
-        config->Journal.MessageReceived = 1;
-        #endif
-
-        /* get all data from current journal entry */
-        dlt_system_journal_get_timestamp(j, &timestamp);
-
-        /* get data from journal entry, empty string if invalid fields */
-        dlt_system_journal_get(j, buffer_comm, "_COMM", sizeof(buffer_comm));
-        dlt_system_journal_get(j, buffer_pid, "_PID", sizeof(buffer_pid));
-        dlt_system_journal_get(j, buffer_priority, "PRIORITY", sizeof(buffer_priority));
-        dlt_system_journal_get(j, buffer_message, "MESSAGE", sizeof(buffer_message));
-        dlt_system_journal_get(j, buffer_transport, "_TRANSPORT", sizeof(buffer_transport));
-
-        /* prepare process string */
-        if (strcmp(buffer_transport, "kernel") == 0)
-            snprintf(buffer_process, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "kernel:");
-        else
-            snprintf(buffer_process, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "%s[%s]:", buffer_comm, buffer_pid);
-
-        /* map log level on demand */
-        loglevel = DLT_LOG_INFO;
-        systemd_loglevel = atoi(buffer_priority);
-
-        if (config->Journal.MapLogLevels) {
-            /* Map log levels from journal to DLT */
-            switch (systemd_loglevel) {
-            case 0:     /* Emergency */
-            case 1:     /* Alert */
-            case 2:     /* Critical */
-                loglevel = DLT_LOG_FATAL;
-                break;
-            case 3:     /* Error */
-                loglevel = DLT_LOG_ERROR;
-                break;
-            case 4:     /* Warning */
-                loglevel = DLT_LOG_WARN;
-                break;
-            case 5:     /* Notice */
-            case 6:     /* Informational */
-                loglevel = DLT_LOG_INFO;
-                break;
-            case 7:     /* Debug */
-                loglevel = DLT_LOG_DEBUG;
-                break;
-            default:
-                loglevel = DLT_LOG_INFO;
-                break;
-            }
+    if (journal_rate_limit(config, entry->unit, entry->realtime))
+        return;
+
+    dlt_system_journal_get_timestamp(j, entry, &timestamp);
+
+    /* prepare process string */
+    if ((entry->transport != NULL) && (strcmp(entry->transport->value, "kernel") == 0))
+        snprintf(buffer_process, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "kernel:");
+    else
+        snprintf(buffer_process, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "%s[%s]:",
+                 (entry->comm != NULL) ? entry->comm->value : "", entry->pid);
+
+    /* map log level on demand */
+    loglevel = DLT_LOG_INFO;
+    systemd_loglevel = entry->priority;
+
+    if (config->Journal.MapLogLevels) {
+        /* Map log levels from journal to DLT */
+        switch (systemd_loglevel) {
+        case 0:     /* Emergency */
+        case 1:     /* Alert */
+        case 2:     /* Critical */
+            loglevel = DLT_LOG_FATAL;
+            break;
+        case 3:     /* Error */
+            loglevel = DLT_LOG_ERROR;
+            break;
+        case 4:     /* Warning */
+            loglevel = DLT_LOG_WARN;
+            break;
+        case 5:     /* Notice */
+        case 6:     /* Informational */
+            loglevel = DLT_LOG_INFO;
+            break;
+        case 7:     /* Debug */
+            loglevel = DLT_LOG_DEBUG;
+            break;
+        default:
+            loglevel = DLT_LOG_INFO;
+            break;
         }
+    }
 
-        if ((systemd_loglevel >= 0) && (systemd_loglevel <= 7))
-            snprintf(buffer_priority, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "%s:", systemd_log_levels[systemd_loglevel]);
-        else
-            snprintf(buffer_priority, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "prio_unknown:");
-
-        if (config->Journal.UseUptimeOnly == 1) {
-            /* write log entry (uptime only, no timestamp) */
+    if ((systemd_loglevel >= 0) && (systemd_loglevel <= 7))
+        snprintf(buffer_priority, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "%s:", systemd_log_levels[systemd_loglevel]);
+    else
+        snprintf(buffer_priority, DLT_SYSTEM_JOURNAL_BUFFER_SIZE, "prio_unknown:");
+
+    if (config->Journal.UseUptimeOnly == 1) {
+        /* write log entry (uptime only, no timestamp) */
+        DLT_LOG(journalContext, loglevel,
+                    DLT_STRING(timestamp.monotonic),
+                    DLT_STRING(buffer_process),
+                    DLT_STRING(buffer_priority),
+                    DLT_STRING(entry->message)
+                    );
+    }
+    else {
+        /* write log entry (including timestamp) */
+        if (config->Journal.UseOriginalTimestamp == 0) {
             DLT_LOG(journalContext, loglevel,
-                        DLT_STRING(timestamp.monotonic),
-                        DLT_STRING(buffer_process),
-                        DLT_STRING(buffer_priority),
-                        DLT_STRING(buffer_message)
-                        );
+                    DLT_STRING(timestamp.real),
+                    DLT_STRING(timestamp.monotonic),
+                    DLT_STRING(buffer_process),
+                    DLT_STRING(buffer_priority),
+                    DLT_STRING(entry->message)
+                    );
+
         }
         else {
-            /* write log entry (including timestamp) */
-            if (config->Journal.UseOriginalTimestamp == 0) {
-                DLT_LOG(journalContext, loglevel,
+            /* since we are talking about points in time, I'd prefer truncating over arithmetic rounding */
+            ts = (uint32_t)(entry->monotonic / 100);
+            DLT_LOG_TS(journalContext, loglevel, ts,
                         DLT_STRING(timestamp.real),
-                        DLT_STRING(timestamp.monotonic),
                         DLT_STRING(buffer_process),
                         DLT_STRING(buffer_priority),
-                        DLT_STRING(buffer_message)
+                        DLT_STRING(entry->message)
                         );
+        }
+    }
+}
 
+void get_journal_msg(sd_journal *j, DltSystemConfiguration *config)
+{
+    JournalEntry entry;
+    int r;
+    int i;
+
+    while (!quit) {
+        /* the time zone is read once per batch instead of once per entry */
+        tzset();
+        journal_cached_secs = -1;
+
+        for (i = 0; i < DLT_SYSTEM_JOURNAL_BATCH_SIZE; i++) {
+            r = sd_journal_next(j);
+            if (r < 0) {
+                DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                        DLT_STRING("dlt-system-journal failed to get next entry:"), DLT_STRING(strerror(-r)));
+                sd_journal_close(j);
+                return;
             }
-            else {
-                /* since we are talking about points in time, I'd prefer truncating over arithmetic rounding */
-                ts = (uint32_t)(atof(timestamp.monotonic) * 10000);
-                DLT_LOG_TS(journalContext, loglevel, ts,
-                            DLT_STRING(timestamp.real),
-                            DLT_STRING(buffer_process),
-                            DLT_STRING(buffer_priority),
-                            DLT_STRING(buffer_message)
-                            );
+            else if (r == 0) {
+                return;
             }
-        }
 
+            #if defined(DLT_SYSTEMD_WATCHDOG_ENFORCE_MSG_RX_ENABLE_DLT_SYSTEM) && defined(DLT_SYSTEMD_JOURNAL_ENABLE)
+            config->Journal.MessageReceived = 1;
+            #endif
 
-        if (journal_checkUserBufferForFreeSpace() == -1) {
-            /* buffer is nearly full */
-            /* wait 500ms for writing next entry */
-            struct timespec t;
-            t.tv_sec = 0;
-            t.tv_nsec = 1000000ul * 500;
-            nanosleep(&t, NULL);
+            journal_read_entry(j, &entry);
+            journal_log_entry(j, config, &entry);
         }
+
+        journal_wait_for_user_buffer();
     }
 }
 
@@ -339,7 +570,14 @@ void register_journal_fd(sd_journal **j, struct pollfd *pollfd, int i,  DltSyste
     sd_id128_t boot_id;
     int r;
 
-    r = sd_journal_open(&j_tmp, SD_JOURNAL_LOCAL_ONLY /*SD_JOURNAL_LOCAL_ONLY|SD_JOURNAL_RUNTIME_ONLY*/);
+    if (config->Journal.File != NULL) {
+        /* read a single journal file, e.g. copied from another system */
+        const char *paths[] = { config->Journal.File, NULL };
+        r = sd_journal_open_files(&j_tmp, paths, 0);
+    }
+    else {
+        r = sd_journal_open(&j_tmp, SD_JOURNAL_LOCAL_ONLY /*SD_JOURNAL_LOCAL_ONLY|SD_JOURNAL_RUNTIME_ONLY*/);
+    }
     printf("journal open return %d\n", r);
     if (r < 0) {
         DLT_LOG(dltsystem, DLT_LOG_ERROR,
@@ -347,6 +585,10 @@ void register_journal_fd(sd_journal **j, struct pollfd *pollfd, int i,  DltSyste
         printf("journal open failed: %s\n", strerror(-r));
         j_tmp = NULL;
     }
+    else {
+        /* larger fields are truncated anyway, do not decompress more of them */
+        sd_journal_set_data_threshold(j_tmp, DLT_SYSTEM_JOURNAL_BUFFER_SIZE_BIG);
+    }
 
     if (config->Journal.CurrentBoot) {
         /* show only current boot entries */
@@ -407,16 +649,29 @@ void* journal_thread(void* journalParams)
     struct journal_fd_params* params = (struct journal_fd_params*)journalParams;
 
     int ready;
+
+    /* log the entries which are already in the journal */
+    if (params->j != NULL)
+        get_journal_msg(params->j, params->config);
+
     while (*params->quit == 0) {
-        ready = poll(params->journalPollFd, 1, -1);
+        /* wake up regularly, otherwise quit is not noticed before the next entry */
+        ready = poll(params->journalPollFd, 1, DLT_SYSTEM_JOURNAL_POLL_TIMEOUT_MS);
         if (ready == -1) {
             DLT_LOG(dltsystem, DLT_LOG_ERROR, DLT_STRING("Error while poll. Exit with: "),
                 DLT_STRING(strerror(ready)));
             continue;
         }
 
+        if (ready == 0) {
+            /* send what is left in the user buffer after the last entries */
+            dlt_user_log_resend_buffer();
+            continue;
+        }
+
         if(params->journalPollFd->revents & POLLIN) {
-            if (sd_journal_process(params->j) == SD_JOURNAL_APPEND) {
+            /* entries may also be added when the journal files were rotated */
+            if (sd_journal_process(params->j) > SD_JOURNAL_NOP) {
                 get_journal_msg(params->j, params->config);
             }
         }
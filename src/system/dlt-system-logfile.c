@@ -45,18 +45,57 @@
 
 
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
 #include "dlt-system.h"
 
 /* Modes of sending */
 #define SEND_MODE_OFF  0
 #define SEND_MODE_ONCE 1
 #define SEND_MODE_ON   2
+#define SEND_MODE_TAIL 3
+
+/* Bytes read at once from a file in tail mode, also the longest line */
+#define TAIL_BUFFER_SIZE (64 * 1024)
+/* longest string that fits into the payload of one message, with type info,
+ * length and terminating zero */
+#define TAIL_CHUNK_SIZE (DLT_USER_BUF_MAX_SIZE - sizeof(uint32_t) - sizeof(uint16_t) - 1)
+
+#define TAIL_EVENTS_SIZE (16 * (sizeof(struct inotify_event) + NAME_MAX + 1))
+
+/* Waits of 20 ms for the user buffer to drain, before the lines are left in the file */
+#define TAIL_BUFFER_WAIT_US    (20 * 1000)
+#define TAIL_BUFFER_WAIT_COUNT 10
 
 DLT_IMPORT_CONTEXT(dltsystem)
 
 DltContext logfileContext[DLT_SYSTEM_LOG_FILE_MAX];
 int logfile_delays[DLT_SYSTEM_LOG_FILE_MAX];
 
+/* A file logged line by line as it grows */
+typedef struct {
+    int fd;             /* -1 while the file does not exist */
+    int wd;             /* watch of the file */
+    int dir_wd;         /* watch of the directory, to find the file again after rotation */
+    int rotated;        /* file was renamed or removed, read until its end */
+    char *name;         /* name of the file in its directory */
+    dev_t dev;
+    ino_t ino;
+    off_t offset;       /* offset of the next byte to read */
+    off_t saved;        /* offset written to the state file */
+    size_t used;        /* bytes of an incomplete line in buffer */
+    char *buffer;
+} LogFileTail;
+
+static LogFileTail logfile_tail[DLT_SYSTEM_LOG_FILE_MAX];
+static int logfile_inotify = -1;
+
 void send_file(LogFileOptions const *fileopt, int n)
 {
     DLT_LOG(dltsystem, DLT_LOG_DEBUG,
@@ -119,6 +158,398 @@ void logfile_init(void *v_conf)
         logfile_delays[i] = conf->LogFile.TimeDelay[i];
 }
 
+/* Check that the user buffer of the library is at most half full */
+static int tail_user_buffer_free(void)
+{
+    int total_size, used_size;
+
+    dlt_user_check_buffer(&total_size, &used_size);
+
+    return (total_size - used_size) >= (total_size / 2);
+}
+
+/*
+ * Log a line, a line longer than the payload of a message is logged in parts.
+ */
+static void tail_log_line(int n, const char *line, size_t length)
+{
+    size_t chunk;
+
+    do {
+        chunk = (length > TAIL_CHUNK_SIZE) ? TAIL_CHUNK_SIZE : length;
+        DLT_LOG(logfileContext[n], DLT_LOG_INFO, DLT_SIZED_STRING(line, (uint16_t)chunk));
+        line += chunk;
+        length -= chunk;
+    } while (length > 0);
+}
+
+/*
+ * Log the complete lines in the buffer, an incomplete last line is kept if
+ * flush is not set. Return 0 if logging stopped for a full user buffer.
+ */
+static int tail_log_lines(int n, int flush)
+{
+    LogFileTail *tail = &logfile_tail[n];
+    char *line = tail->buffer;
+    char *end = tail->buffer + tail->used;
+    char *newline;
+    size_t length;
+    int result = 1;
+
+    while ((newline = memchr(line, '\n', (size_t)(end - line))) != NULL) {
+        if (!tail_user_buffer_free()) {
+            result = 0;
+            break;
+        }
+
+        length = (size_t)(newline - line);
+
+        if ((length > 0) && (line[length - 1] == '\r'))
+            length--;
+
+        tail_log_line(n, line, length);
+        line = newline + 1;
+    }
+
+    length = (size_t)(end - line);
+
+    /* a line longer than the buffer is logged in parts */
+    if (result && (length > 0) && (flush || (length == TAIL_BUFFER_SIZE))) {
+        tail_log_line(n, line, length);
+        length = 0;
+    }
+
+    memmove(tail->buffer, line, length);
+    tail->used = length;
+
+    return result;
+}
+
+/*
+ * Log what was appended to a file since the last call. Return 1 if the end of
+ * the file was reached, 0 if the rest stays in the file until the daemon has
+ * read the user buffer.
+ */
+static int tail_read(int n)
+{
+    LogFileTail *tail = &logfile_tail[n];
+    struct stat st;
+    ssize_t bytes;
+    int wait = 0;
+
+    if (tail->fd < 0)
+        return 1;
+
+    /* truncated in place, e.g. by logrotate with copytruncate */
+    if ((fstat(tail->fd, &st) == 0) && (st.st_size < tail->offset)) {
+        DLT_LOG(dltsystem, DLT_LOG_INFO,
+                DLT_STRING("dlt-system-logfile, file truncated:"),
+                DLT_STRING(tail->name));
+        tail->offset = 0;
+        tail->used = 0;
+    }
+
+    for (;;) {
+        if (!tail_log_lines(n, 0)) {
+            if (++wait > TAIL_BUFFER_WAIT_COUNT)
+                return 0;
+
+            usleep(TAIL_BUFFER_WAIT_US);
+            dlt_user_log_resend_buffer();
+            continue;
+        }
+
+        wait = 0;
+        bytes = pread(tail->fd, tail->buffer + tail->used, TAIL_BUFFER_SIZE - tail->used, tail->offset);
+
+        if (bytes <= 0) {
+            if (bytes < 0)
+                DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                        DLT_STRING("dlt-system-logfile, failed to read file:"),
+                        DLT_STRING(tail->name),
+                        DLT_STRING(strerror(errno)));
+
+            return 1;
+        }
+
+        tail->offset += bytes;
+        tail->used += (size_t)bytes;
+    }
+}
+
+/* Return the offset stored for a file in the state file, -1 if there is none */
+static off_t tail_load_offset(LogFileOptions const *fileopts, dev_t dev, ino_t ino)
+{
+    FILE *file;
+    unsigned long long file_dev, file_ino;
+    long long offset;
+    off_t result = -1;
+
+    if (fileopts->TailStateFile == NULL)
+        return -1;
+
+    file = fopen(fileopts->TailStateFile, "r");
+
+    if (file == NULL)
+        return -1;
+
+    while (fscanf(file, "%llu %llu %lld%*[^\n]", &file_dev, &file_ino, &offset) == 3)
+        if ((file_dev == (unsigned long long)dev) && (file_ino == (unsigned long long)ino)) {
+            result = (off_t)offset;
+            break;
+        }
+
+    fclose(file);
+    return result;
+}
+
+/* Write the offsets of all files in tail mode into the state file */
+static void tail_save_offsets(LogFileOptions const *fileopts)
+{
+    char path[PATH_MAX];
+    FILE *file;
+    int changed = 0;
+    int i;
+
+    if (fileopts->TailStateFile == NULL)
+        return;
+
+    for (i = 0; i < fileopts->Count; i++)
+        if ((logfile_tail[i].buffer != NULL) &&
+            (logfile_tail[i].saved != logfile_tail[i].offset - (off_t)logfile_tail[i].used))
+            changed = 1;
+
+    if (!changed)
+        return;
+
+    /* replaced at once, so a crash never leaves a half written file */
+    snprintf(path, sizeof(path), "%s.tmp", fileopts->TailStateFile);
+    file = fopen(path, "w");
+
+    if (file == NULL) {
+        DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                DLT_STRING("dlt-system-logfile, failed to write state file:"),
+                DLT_STRING(path));
+        return;
+    }
+
+    for (i = 0; i < fileopts->Count; i++) {
+        LogFileTail *tail = &logfile_tail[i];
+
+        if ((tail->buffer == NULL) || (tail->fd < 0))
+            continue;
+
+        tail->saved = tail->offset - (off_t)tail->used;
+        fprintf(file, "%llu %llu %lld %s\n", (unsigned long long)tail->dev, (unsigned long long)tail->ino,
+                (long long)tail->saved, fileopts->Filename[i]);
+    }
+
+    fclose(file);
+
+    if (rename(path, fileopts->TailStateFile) != 0)
+        DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                DLT_STRING("dlt-system-logfile, failed to replace state file:"),
+                DLT_STRING(fileopts->TailStateFile));
+}
+
+/*
+ * Open a file in tail mode. A file known from the state file continues at the
+ * stored offset, a file which appeared while dlt-system runs is read from the
+ * start, any other file from its end.
+ */
+static void tail_open(LogFileOptions const *fileopts, int n, int from_start)
+{
+    LogFileTail *tail = &logfile_tail[n];
+    struct stat st;
+    off_t offset;
+
+    tail->fd = open(fileopts->Filename[n], O_RDONLY | O_CLOEXEC);
+
+    if (tail->fd < 0)
+        return;
+
+    if (fstat(tail->fd, &st) != 0) {
+        close(tail->fd);
+        tail->fd = -1;
+        return;
+    }
+
+    tail->dev = st.st_dev;
+    tail->ino = st.st_ino;
+    tail->used = 0;
+    offset = tail_load_offset(fileopts, st.st_dev, st.st_ino);
+
+    if ((offset >= 0) && (offset <= st.st_size))
+        tail->offset = offset;
+    else
+        tail->offset = from_start ? 0 : st.st_size;
+
+    tail->saved = -1;
+    tail->rotated = 0;
+    tail->wd = inotify_add_watch(logfile_inotify, fileopts->Filename[n], IN_MODIFY | IN_MOVE_SELF | IN_DELETE_SELF);
+
+    if (tail->wd < 0)
+        DLT_LOG(dltsystem, DLT_LOG_WARN,
+                DLT_STRING("dlt-system-logfile, failed to watch file, reading it every second:"),
+                DLT_STRING(fileopts->Filename[n]));
+}
+
+/*
+ * Read a file. A rotated file is read until its end and replaced with the new
+ * file, once that exists.
+ */
+static void tail_follow(LogFileOptions const *fileopts, int n)
+{
+    LogFileTail *tail = &logfile_tail[n];
+    struct stat st;
+
+    if (tail->fd < 0) {
+        tail_open(fileopts, n, 1);
+
+        if (tail->fd < 0)
+            return;
+    }
+
+    /* a removed file which is still open gets no event, compare the inode */
+    if (!tail->rotated &&
+        ((stat(fileopts->Filename[n], &st) != 0) || (st.st_dev != tail->dev) || (st.st_ino != tail->ino)))
+        tail->rotated = 1;
+
+    if (!tail_read(n) || !tail->rotated || (access(fileopts->Filename[n], F_OK) != 0))
+        return;
+
+    tail_log_lines(n, 1);
+
+    if (tail->wd >= 0)
+        inotify_rm_watch(logfile_inotify, tail->wd);
+
+    close(tail->fd);
+    tail->fd = -1;
+    tail->wd = -1;
+
+    tail_open(fileopts, n, 1);
+
+    if (tail->fd >= 0)
+        tail_read(n);
+}
+
+int register_logfile_fd(struct pollfd *pollfd, int i, DltSystemConfiguration *config)
+{
+    LogFileOptions *fileopts = &(config->LogFile);
+    char dir[PATH_MAX];
+    int n;
+
+    for (n = 0; n < fileopts->Count; n++)
+        if (fileopts->Mode[n] == SEND_MODE_TAIL)
+            break;
+
+    if (n == fileopts->Count)
+        return 0;
+
+    logfile_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (logfile_inotify < 0) {
+        DLT_LOG(dltsystem, DLT_LOG_ERROR,
+                DLT_STRING("dlt-system-logfile, failed to initialize inotify:"),
+                DLT_STRING(strerror(errno)));
+        return -1;
+    }
+
+    for (n = 0; n < fileopts->Count; n++) {
+        LogFileTail *tail = &logfile_tail[n];
+
+        tail->fd = -1;
+        tail->wd = -1;
+        tail->dir_wd = -1;
+
+        if (fileopts->Mode[n] != SEND_MODE_TAIL)
+            continue;
+
+        tail->buffer = malloc(TAIL_BUFFER_SIZE);
+        MALLOC_ASSERT(tail->buffer);
+
+        /* dirname() and basename() may modify their argument */
+        strncpy(dir, fileopts->Filename[n], sizeof(dir) - 1);
+        dir[sizeof(dir) - 1] = 0;
+        tail->name = strdup(basename(dir));
+        MALLOC_ASSERT(tail->name);
+
+        strncpy(dir, fileopts->Filename[n], sizeof(dir) - 1);
+        dir[sizeof(dir) - 1] = 0;
+        tail->dir_wd = inotify_add_watch(logfile_inotify, dirname(dir), IN_CREATE | IN_MOVED_TO);
+
+        tail_open(fileopts, n, 0);
+    }
+
+    pollfd[i].fd = logfile_inotify;
+    pollfd[i].events = POLLIN;
+
+    return logfile_inotify;
+}
+
+void logfile_tail_fd_handler(DltSystemConfiguration *config)
+{
+    LogFileOptions *fileopts = &(config->LogFile);
+    static char events[TAIL_EVENTS_SIZE] __attribute__((aligned(__alignof__(struct inotify_event))));
+    const struct inotify_event *event;
+    ssize_t length;
+    ssize_t i;
+    int n;
+
+    while ((length = read(logfile_inotify, events, sizeof(events))) > 0) {
+        for (i = 0; i < length; i += (ssize_t)(sizeof(struct inotify_event) + event->len)) {
+            event = (const struct inotify_event *)&events[i];
+
+            for (n = 0; n < fileopts->Count; n++) {
+                LogFileTail *tail = &logfile_tail[n];
+
+                if (tail->buffer == NULL)
+                    continue;
+
+                if ((event->wd == tail->wd) && (tail->fd >= 0)) {
+                    if (event->mask & (IN_MOVE_SELF | IN_DELETE_SELF))
+                        tail->rotated = 1;
+
+                    /* the watch of a removed file is gone */
+                    if (event->mask & IN_IGNORED)
+                        tail->wd = -1;
+
+                    tail_follow(fileopts, n);
+                }
+                else if ((event->wd == tail->dir_wd) && (event->len > 0) &&
+                         (strcmp(event->name, tail->name) == 0)) {
+                    tail_follow(fileopts, n);
+                }
+            }
+        }
+    }
+}
+
+void cleanup_logfile(DltSystemConfiguration *config)
+{
+    LogFileOptions *fileopts = &(config->LogFile);
+    int n;
+
+    tail_save_offsets(fileopts);
+
+    /* the inotify handle is closed with the other file descriptors of the poll */
+    for (n = 0; n < fileopts->Count; n++) {
+        LogFileTail *tail = &logfile_tail[n];
+
+        if (tail->buffer == NULL)
+            continue;
+
+        if (tail->fd >= 0)
+            close(tail->fd);
+
+        free(tail->buffer);
+        free(tail->name);
+        tail->buffer = NULL;
+        tail->name = NULL;
+        tail->fd = -1;
+    }
+}
+
 void logfile_fd_handler(void *v_conf)
 {
     DltSystemConfiguration *conf = (DltSystemConfiguration *)v_conf;
@@ -126,6 +557,16 @@ void logfile_fd_handler(void *v_conf)
         if (conf->LogFile.Mode[i] == SEND_MODE_OFF)
             continue;
 
+        if (conf->LogFile.Mode[i] == SEND_MODE_TAIL) {
+            /* catch up with what was left for a full user buffer or missed by inotify */
+            if (logfile_tail[i].buffer != NULL) {
+                dlt_user_log_resend_buffer();
+                tail_follow(&(conf->LogFile), i);
+            }
+
+            continue;
+        }
+
         if (logfile_delays[i] <= 0) {
             send_file(&(conf->LogFile), i);
             logfile_delays[i] = conf->LogFile.TimeDelay[i];
@@ -137,5 +578,7 @@ void logfile_fd_handler(void *v_conf)
             logfile_delays[i]--;
         }
     }
+
+    tail_save_offsets(&(conf->LogFile));
 }
 
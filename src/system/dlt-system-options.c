@@ -143,6 +143,15 @@ void init_configuration(DltSystemConfiguration *config)
     config->Syslog.Enable = 0;
     strncpy(config->Syslog.ContextId, "SYSL", DLT_ID_SIZE);
     config->Syslog.Port = 47111;
+    config->Syslog.Parse = 0;
+    config->Syslog.MapLogLevels = 1;
+    config->Syslog.ReceiveBufferSize = 0;
+    config->Syslog.TagCount = 0;
+
+    for (i = 0; i < DLT_SYSTEM_SYSLOG_TAG_MAX; i++) {
+        config->Syslog.Tag[i] = NULL;
+        memset(config->Syslog.TagContextId[i], 0, DLT_ID_SIZE);
+    }
 
     /* Journal */
     config->Journal.Enable = 0;
@@ -151,6 +160,9 @@ void init_configuration(DltSystemConfiguration *config)
     config->Journal.Follow = 0;
     config->Journal.MapLogLevels = 1;
     config->Journal.UseOriginalTimestamp = 1;
+    config->Journal.RateLimitInterval = 0;
+    config->Journal.RateLimitBurst = 0;
+    config->Journal.File = NULL;
 
     /* File transfer */
     config->Filetransfer.Enable = 0;
@@ -168,6 +180,7 @@ void init_configuration(DltSystemConfiguration *config)
     /* Log file */
     config->LogFile.Enable = 0;
     config->LogFile.Count = 0;
+    config->LogFile.TailStateFile = NULL;
 
     for (i = 0; i < DLT_SYSTEM_LOG_FILE_MAX; i++) {
         strncpy(config->LogFile.ContextId[i], "\0", DLT_ID_SIZE);
@@ -263,6 +276,40 @@ int read_configuration_file(DltSystemConfiguration *config, char *file_name)
             {
                 config->Syslog.Port = atoi(value);
             }
+            else if (strcmp(token, "SyslogParse") == 0)
+            {
+                config->Syslog.Parse = atoi(value);
+            }
+            else if (strcmp(token, "SyslogMapLogLevels") == 0)
+            {
+                config->Syslog.MapLogLevels = atoi(value);
+            }
+            else if (strcmp(token, "SyslogReceiveBufferSize") == 0)
+            {
+                config->Syslog.ReceiveBufferSize = atoi(value);
+            }
+            else if (strcmp(token, "SyslogTag") == 0)
+            {
+                free(config->Syslog.Tag[config->Syslog.TagCount]);
+                config->Syslog.Tag[config->Syslog.TagCount] = malloc(strlen(value) + 1);
+                MALLOC_ASSERT(config->Syslog.Tag[config->Syslog.TagCount]);
+                strcpy(config->Syslog.Tag[config->Syslog.TagCount], value); /* strcpy unritical here, because size matches exactly the size to be copied */
+            }
+            else if (strcmp(token, "SyslogTagContextId") == 0)
+            {
+                strncpy(config->Syslog.TagContextId[config->Syslog.TagCount], value, DLT_ID_SIZE);
+
+                if (config->Syslog.TagCount < (DLT_SYSTEM_SYSLOG_TAG_MAX - 1)) {
+                    config->Syslog.TagCount++;
+                }
+                else {
+                    fprintf(stderr,
+                            "Too many syslog tags configured. Maximum: %d\n",
+                            DLT_SYSTEM_SYSLOG_TAG_MAX);
+                    ret = -1;
+                    break;
+                }
+            }
 
             /* Journal */
             else if (strcmp(token, "JournalEnable") == 0)
@@ -293,6 +340,21 @@ int read_configuration_file(DltSystemConfiguration *config, char *file_name)
             {
                 config->Journal.UseUptimeOnly = atoi(value);
             }
+            else if (strcmp(token, "JournalRateLimitInterval") == 0)
+            {
+                config->Journal.RateLimitInterval = atoi(value);
+            }
+            else if (strcmp(token, "JournalRateLimitBurst") == 0)
+            {
+                config->Journal.RateLimitBurst = atoi(value);
+            }
+            else if (strcmp(token, "JournalFile") == 0)
+            {
+                free(config->Journal.File);
+                config->Journal.File = malloc(strlen(value) + 1);
+                MALLOC_ASSERT(config->Journal.File);
+                strcpy(config->Journal.File, value); /* strcpy unritical here, because size matches exactly the size to be copied */
+            }
 
             /* File transfer */
             else if (strcmp(token, "FiletransferEnable") == 0)
@@ -356,6 +418,13 @@ int read_configuration_file(DltSystemConfiguration *config, char *file_name)
             {
                 config->LogFile.TimeDelay[config->LogFile.Count] = atoi(value);
             }
+            else if (strcmp(token, "LogFileTailStateFile") == 0)
+            {
+                free(config->LogFile.TailStateFile);
+                config->LogFile.TailStateFile = malloc(strlen(value) + 1);
+                MALLOC_ASSERT(config->LogFile.TailStateFile);
+                strcpy(config->LogFile.TailStateFile, value); /* strcpy unritical here, because size matches exactly the size to be copied */
+            }
             else if (strcmp(token, "LogFileContextId") == 0)
             {
                 strncpy(config->LogFile.ContextId[config->LogFile.Count], value, DLT_ID_SIZE);
@@ -431,6 +500,23 @@ void cleanup_config(DltSystemConfiguration *config, DltSystemCliOptions *options
         options->ConfigurationFileName = NULL;
     }
 
+    /* Syslog */
+    for(int i = 0 ; i < DLT_SYSTEM_SYSLOG_TAG_MAX ; i++)
+    {
+        if ((config->Syslog.Tag[i]) != NULL)
+        {
+            free(config->Syslog.Tag[i]);
+            config->Syslog.Tag[i] = NULL;
+        }
+    }
+
+    /* Journal */
+    if ((config->Journal.File) != NULL)
+    {
+        free(config->Journal.File);
+        config->Journal.File = NULL;
+    }
+
     /* File transfer */
     for(int i = 0 ; i < DLT_SYSTEM_LOG_DIRS_MAX ; i++)
     {
@@ -442,6 +528,12 @@ void cleanup_config(DltSystemConfiguration *config, DltSystemCliOptions *options
     }
 
     /* Log files */
+    if ((config->LogFile.TailStateFile) != NULL)
+    {
+        free(config->LogFile.TailStateFile);
+        config->LogFile.TailStateFile = NULL;
+    }
+
     for(int i = 0 ; i < DLT_SYSTEM_LOG_FILE_MAX ; i++)
     {
         if ((config->LogFile.Filename[i]) != NULL)
@@ -59,7 +59,6 @@
 #include <errno.h>
 
 DLT_IMPORT_CONTEXT(dltsystem)
-DLT_IMPORT_CONTEXT(syslogContext)
 DLT_IMPORT_CONTEXT(journalContext)
 DLT_IMPORT_CONTEXT(watchdogContext)
 DLT_IMPORT_CONTEXT(procContext)
@@ -126,7 +125,7 @@ void cleanup_processes(struct pollfd *pollfd, struct pollfd *journalPollFd, sd_j
 {
     //Syslog cleanup
     if (config->Syslog.Enable)
-        DLT_UNREGISTER_CONTEXT(syslogContext);
+        cleanup_syslog(config);
 
     //Journal cleanup
 #if defined(DLT_SYSTEMD_JOURNAL_ENABLE)
@@ -145,6 +144,8 @@ void cleanup_processes(struct pollfd *pollfd, struct pollfd *journalPollFd, sd_j
 
     //Logfile cleanup
     if (config->LogFile.Enable) {
+        cleanup_logfile(config);
+
         for (int i = 0; i < config->LogFile.Count; i++)
             DLT_UNREGISTER_CONTEXT(logfileContext[i]);
     }
@@ -162,6 +163,7 @@ void cleanup_processes(struct pollfd *pollfd, struct pollfd *journalPollFd, sd_j
     //FileTransfer cleanup
 #if defined(DLT_FILETRANSFER_ENABLE)
     if (config->Filetransfer.Enable) {
+        cleanup_filetransfer();
         DLT_UNREGISTER_CONTEXT(filetransferContext);
     }
 #endif
@@ -243,6 +245,12 @@ void start_dlt_system_processes(DltSystemConfiguration *config)
         }
     }
 
+    //init FD for LogFile in tail mode
+    if (config->LogFile.Enable && (register_logfile_fd(pollfd, fdcnt, config) > 0)) {
+        fdType[fdcnt] = fdType_logfile;
+        fdcnt++;
+    }
+
     //init FD for Syslog
     int syslogSock = 0;
     if (config->Syslog.Enable) {
@@ -299,7 +307,10 @@ void start_dlt_system_processes(DltSystemConfiguration *config)
         for (int i = 0; i < MAX_FD_NUMBER; i++) {
             if(pollfd[i].revents & POLLIN){
                 if (fdType[i] == fdType_syslog && syslogSock > 0) {
-                    syslog_fd_handler(syslogSock);
+                    syslog_fd_handler(syslogSock, config);
+                }
+                else if (fdType[i] == fdType_logfile) {
+                    logfile_tail_fd_handler(config);
                 }
                 else if (fdType[i] == fdType_timer) {
                     timer_fd_handler(pollfd[i].fd, config);
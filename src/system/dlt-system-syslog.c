@@ -45,6 +45,7 @@
 
 
 #include <unistd.h>
+#include <stdlib.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <string.h>
@@ -57,7 +58,46 @@
 
 DLT_IMPORT_CONTEXT(dltsystem)
 DLT_DECLARE_CONTEXT(syslogContext)
-#define RECV_BUF_SZ 1024
+
+/* RFC 5424 receivers should accept messages of 2048 bytes */
+#define RECV_BUF_SZ 2048
+
+/* Number of datagrams received with one recvmmsg() call */
+#define DLT_SYSTEM_SYSLOG_BATCH 32
+
+/* Maximum number of recvmmsg() calls per wake-up, so that the other
+ * file descriptors of the main loop are served during bursts */
+#define DLT_SYSTEM_SYSLOG_ROUNDS 8
+
+/* A syslog message split into its parts, all pointing into the receive buffer */
+typedef struct
+{
+    int facility;
+    int severity;
+    char *tag;
+    char *pid;
+    char *message;
+} SyslogMessage;
+
+static DltContext syslogTagContext[DLT_SYSTEM_SYSLOG_TAG_MAX];
+
+static char syslog_buffer[DLT_SYSTEM_SYSLOG_BATCH][RECV_BUF_SZ];
+static struct iovec syslog_iov[DLT_SYSTEM_SYSLOG_BATCH];
+static struct mmsghdr syslog_msgs[DLT_SYSTEM_SYSLOG_BATCH];
+
+static const char *syslog_facilities[] = {
+    "kern", "user", "mail", "daemon", "auth", "syslog", "lpr", "news",
+    "uucp", "cron", "authpriv", "ftp", "ntp", "security", "console", "solaris-cron",
+    "local0", "local1", "local2", "local3", "local4", "local5", "local6", "local7"
+};
+
+static const char *syslog_severities[] = {
+    "Emergency", "Alert", "Critical", "Error", "Warning", "Notice", "Informational", "Debug"
+};
+
+static const char *syslog_months[] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
 
 int init_socket(SyslogOptions opts)
 {
@@ -83,6 +123,13 @@ int init_socket(SyslogOptions opts)
         return -1;
     }
 
+    /* a larger buffer keeps bursts of messages until they are read */
+    if ((opts.ReceiveBufferSize > 0) &&
+        (setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &opts.ReceiveBufferSize, sizeof(opts.ReceiveBufferSize)) == -1))
+        DLT_LOG(syslogContext, DLT_LOG_WARN,
+                DLT_STRING("Unable to set receive buffer size for SYSLOG, error description: "),
+                DLT_STRING(strerror(errno)));
+
     /* initialize struct syslog_addr */
     memset(&syslog_addr, 0, sizeof(syslog_addr));
 #ifdef DLT_USE_IPv6
@@ -109,41 +156,264 @@ int init_socket(SyslogOptions opts)
     return sock;
 }
 
-int read_socket(int sock)
+/* Terminate the word at p and return the begin of the next one */
+static char *syslog_next_word(char *p)
+{
+    p += strcspn(p, " ");
+
+    if (*p == ' ')
+        *p++ = '\0';
+
+    return p;
+}
+
+/* True if p starts with a RFC 3164 timestamp "Mmm dd hh:mm:ss " */
+static int syslog_is_bsd_timestamp(const char *p)
+{
+    int i;
+
+    for (i = 0; i < 12; i++)
+        if (strncmp(p, syslog_months[i], 3) == 0)
+            break;
+
+    return (i < 12) && (strnlen(p, 16) == 16) && (p[3] == ' ') && (p[6] == ' ') &&
+           (p[9] == ':') && (p[12] == ':') && (p[15] == ' ');
+}
+
+/*
+ * Split "TAG[PID]: MSG" or "TAG: MSG" of a RFC 3164 message. If there is no
+ * tag, the whole text is the message.
+ */
+static void syslog_parse_tag(char *p, SyslogMessage *msg)
+{
+    char *end = p + strcspn(p, "[: ");
+    char *close;
+
+    msg->message = p;
+
+    if ((*end == '[') && (end != p)) {
+        close = strchr(end + 1, ']');
+
+        if ((close == NULL) || (close[1] != ':'))
+            return;
+
+        *end = '\0';
+        *close = '\0';
+        msg->tag = p;
+        msg->pid = end + 1;
+        msg->message = close + 2;
+    }
+    else if ((*end == ':') && (end != p)) {
+        *end = '\0';
+        msg->tag = p;
+        msg->message = end + 1;
+    }
+
+    if (*msg->message == ' ')
+        msg->message++;
+}
+
+/* Skip the structured data of a RFC 5424 message, "-" or a list of "[...]" */
+static char *syslog_skip_structured_data(char *p)
+{
+    int quoted = 0;
+
+    if (*p == '-')
+        return p + 1;
+
+    while (*p == '[') {
+        for (p++; (*p != '\0') && (quoted || (*p != ']')); p++) {
+            if ((*p == '\\') && (p[1] != '\0'))
+                p++;
+            else if (*p == '"')
+                quoted = !quoted;
+        }
+
+        if (*p == ']')
+            p++;
+    }
+
+    return p;
+}
+
+/*
+ * Parse a RFC 5424 or RFC 3164 message in place. Returns -1 if the data
+ * does not start with a priority, then it is logged as it is.
+ */
+static int syslog_parse(char *data, size_t length, SyslogMessage *msg)
+{
+    char *p = data;
+    char *app;
+    char *procid;
+    size_t word;
+    int pri = 0;
+    int digits;
+
+    if (*p++ != '<')
+        return -1;
+
+    for (digits = 0; (digits < 3) && (*p >= '0') && (*p <= '9'); digits++)
+        pri = pri * 10 + (*p++ - '0');
+
+    if ((digits == 0) || (*p++ != '>') || (pri > 191))
+        return -1;
+
+    /* the newline added by some senders is not part of the message */
+    while ((length > 0) && ((data[length - 1] == '\n') || (data[length - 1] == '\r')))
+        data[--length] = '\0';
+
+    msg->facility = pri >> 3;
+    msg->severity = pri & 7;
+    msg->tag = "";
+    msg->pid = "";
+
+    if ((p[0] == '1') && (p[1] == ' ')) {
+        /* RFC 5424: VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID SD MSG */
+        p = syslog_next_word(p + 2);
+        p = syslog_next_word(p);
+        app = p;
+        p = syslog_next_word(p);
+        procid = p;
+        p = syslog_next_word(p);
+        p = syslog_next_word(p);
+        p = syslog_skip_structured_data(p);
+
+        if (*p == ' ')
+            p++;
+
+        /* UTF-8 byte order mark */
+        if (strncmp(p, "\xEF\xBB\xBF", 3) == 0)
+            p += 3;
+
+        if (strcmp(app, "-") != 0)
+            msg->tag = app;
+
+        if (strcmp(procid, "-") != 0)
+            msg->pid = procid;
+
+        msg->message = p;
+    }
+    else {
+        /* RFC 3164: TIMESTAMP HOSTNAME TAG[PID]: MSG, timestamp and hostname may be missing */
+        if (syslog_is_bsd_timestamp(p)) {
+            p += 16;
+
+            /* a hostname is followed by a space, a tag by '[' or ':' */
+            word = strcspn(p, " [");
+
+            if ((p[word] == ' ') && (word > 0) && (p[word - 1] != ':'))
+                p += word + 1;
+        }
+
+        syslog_parse_tag(p, msg);
+    }
+
+    return 0;
+}
+
+/* Log level of a syslog severity, the same as in the journal adapter */
+static DltLogLevelType syslog_log_level(int severity)
+{
+    switch (severity) {
+    case 0:     /* Emergency */
+    case 1:     /* Alert */
+    case 2:     /* Critical */
+        return DLT_LOG_FATAL;
+    case 3:     /* Error */
+        return DLT_LOG_ERROR;
+    case 4:     /* Warning */
+        return DLT_LOG_WARN;
+    case 7:     /* Debug */
+        return DLT_LOG_DEBUG;
+    default:    /* Notice, Informational */
+        return DLT_LOG_INFO;
+    }
+}
+
+static DltContext *syslog_context(const char *tag, DltSystemConfiguration *config)
+{
+    int i;
+
+    for (i = 0; i < config->Syslog.TagCount; i++)
+        if (strcmp(tag, config->Syslog.Tag[i]) == 0)
+            return &syslogTagContext[i];
+
+    return &syslogContext;
+}
+
+static void log_message(char *data, size_t length, DltSystemConfiguration *config)
+{
+    SyslogMessage msg;
+    DltContext *context;
+
+    if (!config->Syslog.Parse || (syslog_parse(data, length, &msg) < 0)) {
+        DLT_LOG(syslogContext, DLT_LOG_INFO, DLT_STRING(data));
+        return;
+    }
+
+    context = syslog_context(msg.tag, config);
+
+    DLT_LOG(*context, config->Syslog.MapLogLevels ? syslog_log_level(msg.severity) : DLT_LOG_INFO,
+            DLT_STRING(syslog_facilities[msg.facility]),
+            DLT_STRING(syslog_severities[msg.severity]),
+            DLT_STRING(msg.tag),
+            DLT_STRING(msg.pid),
+            DLT_STRING(msg.message));
+}
+
+int read_socket(int sock, DltSystemConfiguration *config)
 {
     DLT_LOG(dltsystem, DLT_LOG_DEBUG,
             DLT_STRING("dlt-system-syslog, read socket"));
-    char recv_data[RECV_BUF_SZ];
-    struct sockaddr_in client_addr;
-    socklen_t addr_len = sizeof(struct sockaddr_in);
+    int total = 0;
+    int round;
+    int received;
+    int i;
 
-    int bytes_read = recvfrom(sock, recv_data, RECV_BUF_SZ, 0,
-                              (struct sockaddr *)&client_addr, &addr_len);
-
-    if (bytes_read == -1) {
-        if (errno == EINTR) {
-            return 0;
+    /* read everything that arrived since the last wake-up, a batch at once */
+    for (round = 0; round < DLT_SYSTEM_SYSLOG_ROUNDS; round++) {
+        for (i = 0; i < DLT_SYSTEM_SYSLOG_BATCH; i++) {
+            syslog_iov[i].iov_base = syslog_buffer[i];
+            syslog_iov[i].iov_len = RECV_BUF_SZ - 1;
+            memset(&syslog_msgs[i], 0, sizeof(struct mmsghdr));
+            syslog_msgs[i].msg_hdr.msg_iov = &syslog_iov[i];
+            syslog_msgs[i].msg_hdr.msg_iovlen = 1;
         }
-        else {
+
+        received = recvmmsg(sock, syslog_msgs, DLT_SYSTEM_SYSLOG_BATCH, MSG_DONTWAIT, NULL);
+
+        if (received == -1) {
+            if ((errno == EINTR) || (errno == EAGAIN) || (errno == EWOULDBLOCK))
+                break;
+
             DLT_LOG(syslogContext, DLT_LOG_FATAL,
                     DLT_STRING("Read from socket failed in SYSLOG."));
             return -1;
         }
-    }
 
-    recv_data[bytes_read] = '\0';
+        for (i = 0; i < received; i++) {
+            syslog_buffer[i][syslog_msgs[i].msg_len] = '\0';
+
+            if (syslog_msgs[i].msg_len != 0)
+                log_message(syslog_buffer[i], syslog_msgs[i].msg_len, config);
+        }
+
+        total += received;
 
-    if (bytes_read != 0)
-    {
-        DLT_LOG(syslogContext, DLT_LOG_INFO, DLT_STRING(recv_data));
+        if (received < DLT_SYSTEM_SYSLOG_BATCH)
+            break;
     }
 
-    return bytes_read;
+    return total;
 }
 
 int register_syslog_fd(struct pollfd *pollfd, int i, DltSystemConfiguration *config)
 {
     DLT_REGISTER_CONTEXT(syslogContext, config->Syslog.ContextId, "SYSLOG Adapter");
+
+    for (int j = 0; j < config->Syslog.TagCount; j++)
+        DLT_REGISTER_CONTEXT(syslogTagContext[j], config->Syslog.TagContextId[j], config->Syslog.Tag[j]);
+
     int syslogSock = init_socket(config->Syslog);
     if (syslogSock < 0) {
         DLT_LOG(dltsystem, DLT_LOG_ERROR, DLT_STRING("Could not init syslog socket\n"));
@@ -154,7 +424,15 @@ int register_syslog_fd(struct pollfd *pollfd, int i, DltSystemConfiguration *con
     return syslogSock;
 }
 
-void syslog_fd_handler(int syslogSock)
+void syslog_fd_handler(int syslogSock, DltSystemConfiguration *config)
+{
+    read_socket(syslogSock, config);
+}
+
+void cleanup_syslog(DltSystemConfiguration *config)
 {
-    read_socket(syslogSock);
-}
\ No newline at end of file
+    for (int i = 0; i < config->Syslog.TagCount; i++)
+        DLT_UNREGISTER_CONTEXT(syslogTagContext[i]);
+
+    DLT_UNREGISTER_CONTEXT(syslogContext);
+}
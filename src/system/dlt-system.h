@@ -66,20 +66,29 @@
 #define DLT_SYSTEM_LOG_FILE_MAX 32
 #define DLT_SYSTEM_LOG_DIRS_MAX 32
 #define DLT_SYSTEM_LOG_PROCESSES_MAX 32
+#define DLT_SYSTEM_SYSLOG_TAG_MAX 32
 
 #define DLT_SYSTEM_MODE_OFF 0
 #define DLT_SYSTEM_MODE_STARTUP 1
 #define DLT_SYSTEM_MODE_REGULAR 2
+#define DLT_SYSTEM_MODE_TAIL 3
 
 #define MAX_LINE 1024
 
+/* Values of FiletransferCompression */
+#define DLT_SYSTEM_COMPRESSION_OFF 0
+#define DLT_SYSTEM_COMPRESSION_GZIP 1           /* compress into a .gz file, then send it */
+#define DLT_SYSTEM_COMPRESSION_GZIP_STREAM 2    /* compress with gzip while sending */
+#define DLT_SYSTEM_COMPRESSION_ZSTD_STREAM 3    /* compress with zstd while sending */
+
 /** Total number of file descriptors needed for processing all features:
 *   - Syslog file descriptor
 *   - Timer file descriptor for processing LogFile and LogProcesses every second
 *   - Inotify file descriptor for FileTransfer
+*   - Inotify file descriptor for LogFile in tail mode
 *   - Timer file descriptor for Watchdog 
 */
-#define MAX_FD_NUMBER   4
+#define MAX_FD_NUMBER   5
 
 /* Macros */
 #define MALLOC_ASSERT(x) if (x == NULL) { \
@@ -92,6 +101,7 @@ enum fdType {
     fdType_filetransfer,
     fdType_timer,
     fdType_watchdog,
+    fdType_logfile,
 };
 
 /**
@@ -116,6 +126,14 @@ typedef struct {
     int Enable;
     char ContextId[DLT_ID_SIZE];
     int Port;
+    int Parse;
+    int MapLogLevels;
+    int ReceiveBufferSize;
+
+    /* Variable number of tags logged with their own context */
+    int TagCount;
+    char *Tag[DLT_SYSTEM_SYSLOG_TAG_MAX];
+    char TagContextId[DLT_SYSTEM_SYSLOG_TAG_MAX][DLT_ID_SIZE];
 } SyslogOptions;
 
 /* Configuration journal options */
@@ -127,6 +145,9 @@ typedef struct {
     int MapLogLevels;
     int UseOriginalTimestamp;
     int UseUptimeOnly;
+    int RateLimitInterval;
+    int RateLimitBurst;
+    char *File;
 #ifdef DLT_SYSTEMD_WATCHDOG_ENFORCE_MSG_RX_ENABLE_DLT_SYSTEM
     int MessageReceived;
 #endif
@@ -159,6 +180,9 @@ typedef struct {
     char *Filename[DLT_SYSTEM_LOG_FILE_MAX];
     int Mode[DLT_SYSTEM_LOG_FILE_MAX];
     int TimeDelay[DLT_SYSTEM_LOG_FILE_MAX];
+
+    /* Offsets of the files in tail mode, kept over restarts */
+    char *TailStateFile;
 } LogFileOptions;
 
 typedef struct {
@@ -203,13 +227,17 @@ void start_dlt_system_processes(DltSystemConfiguration *config);
 /* Init process, create file descriptors and register them into main pollfd. */
 int register_watchdog_fd(struct pollfd *pollfd, int fdcnt);
 int init_filetransfer_dirs(DltSystemConfiguration *config);
+void cleanup_filetransfer(void);
 void logfile_init(void *v_conf);
+int register_logfile_fd(struct pollfd *pollfd, int i, DltSystemConfiguration *config);
+void cleanup_logfile(DltSystemConfiguration *config);
 void logprocess_init(void *v_conf);
 void register_journal_fd(sd_journal **j, struct pollfd *pollfd, int i,  DltSystemConfiguration *config);
 int register_syslog_fd(struct pollfd *pollfd, int i, DltSystemConfiguration *config);
 
 /* Routines that are called, when a fd event was raised. */
 void logfile_fd_handler(void *v_conf);
+void logfile_tail_fd_handler(DltSystemConfiguration *config);
 void logprocess_fd_handler(void *v_conf);
 void filetransfer_fd_handler(DltSystemConfiguration *config);
 #if defined(DLT_SYSTEMD_WATCHDOG_ENFORCE_MSG_RX_ENABLE_DLT_SYSTEM) && defined(DLT_SYSTEMD_JOURNAL_ENABLE)
@@ -225,6 +253,7 @@ struct journal_fd_params {
     DltSystemConfiguration *config;
 };
 void *journal_thread(void* journalParams);
-void syslog_fd_handler(int syslogSock);
+void syslog_fd_handler(int syslogSock, DltSystemConfiguration *config);
+void cleanup_syslog(DltSystemConfiguration *config);
 
 #endif /* DLT_SYSTEM_H_ */
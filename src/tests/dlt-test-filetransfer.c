@@ -55,6 +55,7 @@
 
 #include <dlt_filetransfer.h>     /*Needed for transferring files with the dlt protocol*/
 #include <dlt.h>                /*Needed for dlt logging*/
+#include <time.h>               /*Needed for measuring the throughput*/
 
 /*!Declare some context for the main program. It's a must have to do this, when you want to log with dlt. */
 DLT_DECLARE_CONTEXT(mainContext)
@@ -72,6 +73,8 @@ char *file3_1;
 char *file3_2;
 /*!Not existing file which will be transferred. */
 char *file3_3;
+/*!Big file, e.g. a core dump, to measure the throughput. Optional. */
+char *file4 = NULL;
 /*!Just some variables */
 int i, countPackages, transferResult;
 static int g_numFailed = 0;
@@ -373,6 +376,65 @@ int testFile3Run3(void)
     return 0;
 }
 
+/*!Test the throughput of dlt_user_log_file_transfer with a big file. Skipped if no file is given with -b. */
+int testFile4Run1(void)
+{
+    struct timespec start, end;
+    struct stat st;
+    bool cancel = false;
+    double seconds;
+
+    if (file4 == NULL)
+        return 0;
+
+    if (stat(file4, &st) != 0) {
+        printf("Error: %s does not exist\n", file4);
+        printTestResultPositiveExpected(__func__, -1);
+        return -1;
+    }
+
+    /*Just some log to the main context */
+    DLT_LOG(mainContext, DLT_LOG_INFO, DLT_STRING("Started testF4P1 - dlt_user_log_file_transfer"), DLT_STRING(file4));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    transferResult = dlt_user_log_file_transfer(&fileContext, file4, NULL, 1, 0, 20, &cancel);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("dlt_user_log_file_transfer: %lld bytes in %.2f s, %.2f MB/s\n",
+           (long long)st.st_size, seconds, seconds > 0 ? (double)st.st_size / seconds / 1e6 : 0.0);
+
+    if (transferResult < 0)
+        printf("Error: dlt_user_log_file_transfer: %d\n", transferResult);
+
+    /*Just some log to the main context */
+    DLT_LOG(mainContext, DLT_LOG_INFO, DLT_STRING("Finished testF4P1"), DLT_STRING(file4));
+    printTestResultPositiveExpected(__func__, transferResult);
+    return transferResult;
+}
+
+/*!Test resuming a transfer of the big file with dlt_user_log_file_transfer from the second package. Skipped if no file is given with -b. */
+int testFile4Run2(void)
+{
+    bool cancel = false;
+
+    if (file4 == NULL)
+        return 0;
+
+    /*Just some log to the main context */
+    DLT_LOG(mainContext, DLT_LOG_INFO, DLT_STRING("Started testF4P2 - resume dlt_user_log_file_transfer"), DLT_STRING(file4));
+
+    transferResult = dlt_user_log_file_transfer(&fileContext, file4, NULL, 2, 0, 20, &cancel);
+
+    if (transferResult < 0)
+        printf("Error: dlt_user_log_file_transfer: %d\n", transferResult);
+
+    /*Just some log to the main context */
+    DLT_LOG(mainContext, DLT_LOG_INFO, DLT_STRING("Finished testF4P2"), DLT_STRING(file4));
+    printTestResultPositiveExpected(__func__, transferResult);
+    return transferResult;
+}
+
 void usage(void)
 {
     char version[255];
@@ -386,6 +448,7 @@ void usage(void)
     printf("    -h          display help information\n");
     printf("    -t <path>   absolute path to a text file\n");
     printf("    -i <path>   absolute path to an image file\n");
+    printf("    -b <path>   absolute path to a big file to measure the throughput of dlt_user_log_file_transfer\n");
 }
 
 /*!Main program dlt-test-filestransfer starts here */
@@ -403,7 +466,7 @@ int main(int argc, char* argv[])
     /*Third file doesn't exist. Just to test the reaction when the file isn't available. */
     file3_3 = "dlt-test-filetransfer-doesntExist_3";
 
-    while((c = getopt(argc, argv, "ht:i:")) != -1)
+    while((c = getopt(argc, argv, "ht:i:b:")) != -1)
     {
         switch (c)
         {
@@ -417,6 +480,11 @@ int main(int argc, char* argv[])
                 file2 = optarg;
                 break;
             }
+            case 'b':
+            {
+                file4 = optarg;
+                break;
+            }
             case 'h':
             {
                 usage();
@@ -447,6 +515,8 @@ int main(int argc, char* argv[])
     testFile3Run1();
     testFile3Run2();
     testFile3Run3();
+    testFile4Run1();
+    testFile4Run2();
 
     /*Unregister the context in which the file transfer happened from the dlt-daemon */
     DLT_UNREGISTER_CONTEXT(fileContext);
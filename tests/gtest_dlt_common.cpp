@@ -27,6 +27,8 @@
 #include <gtest/gtest.h>
 #include <limits.h>
 #include <syslog.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #define MAX_LINE 200
 #define BINARY_FILE_NAME "/testfile.dlt"
@@ -40,6 +42,8 @@ extern "C"
 #include "dlt_version.h"
 #include "dlt_client.h"
 #include "dlt_protocol.h"
+#include "dlt_file_index.h"
+#include "dlt_filter_engine.h"
 
 int dlt_buffer_increase_size(DltBuffer *);
 int dlt_buffer_minimize_size(DltBuffer *);
@@ -199,6 +203,27 @@ TEST(t_dlt_buffer_increase_size, normal)
 
     EXPECT_LE(DLT_RETURN_OK, dlt_buffer_free_dynamic(&buf));
 }
+TEST(t_dlt_buffer_increase_size, empty)
+{
+    DltBuffer buf;
+    unsigned char small[16] = { 0 };
+    unsigned char big[DLT_USER_RINGBUFFER_MIN_SIZE + 100];
+    unsigned char result[sizeof(big)];
+
+    memset(big, 0xaa, sizeof(big));
+
+    /* Empty buffer with read and write pointer in the middle, a message bigger than the buffer has to
+     * increase the size and must be read again unchanged */
+    EXPECT_LE(DLT_RETURN_OK,
+              dlt_buffer_init_dynamic(&buf, DLT_USER_RINGBUFFER_MIN_SIZE, DLT_USER_RINGBUFFER_MAX_SIZE,
+                                      DLT_USER_RINGBUFFER_STEP_SIZE));
+    EXPECT_LE(DLT_RETURN_OK, dlt_buffer_push(&buf, small, sizeof(small)));
+    EXPECT_EQ((int)sizeof(small), dlt_buffer_pull(&buf, result, sizeof(result)));
+    EXPECT_LE(DLT_RETURN_OK, dlt_buffer_push(&buf, big, sizeof(big)));
+    EXPECT_EQ((int)sizeof(big), dlt_buffer_pull(&buf, result, sizeof(result)));
+    EXPECT_EQ(0, memcmp(big, result, sizeof(big)));
+    EXPECT_LE(DLT_RETURN_OK, dlt_buffer_free_dynamic(&buf));
+}
 TEST(t_dlt_buffer_increase_size, abnormal)
 {
     DltBuffer buf;
@@ -1462,6 +1487,441 @@ TEST(t_dlt_file_quick_parsing, abnormal)
 
 
 
+/* Begin Method: dlt_common::dlt_file_index_build */
+TEST(t_dlt_file_index_build, normal)
+{
+    DltFileIndex index;
+    uint32_t messages = 0;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+    char indexfile[MAX_LINE+sizeof(BINARY_FILE_NAME)+sizeof(DLT_FILE_INDEX_EXTENSION)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    sprintf(indexfile, "%s" BINARY_FILE_NAME DLT_FILE_INDEX_EXTENSION, pwd);
+    /*---------------------------------------*/
+
+    /* Normal Use-Case, 105 messages in blocks of 10 messages */
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_build(openfile, 10, 0, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_load(&index, openfile));
+    EXPECT_EQ(10U, index.header.block_messages);
+    EXPECT_EQ(11U, index.count);
+
+    for (uint32_t i = 0; i < index.count; i++) {
+        messages += index.entries[i].messages;
+        if (i > 0) {
+            EXPECT_EQ(index.entries[i - 1].offset + index.entries[i - 1].size, index.entries[i].offset);
+        }
+    }
+
+    EXPECT_EQ(105U, messages);
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_free(&index));
+    unlink(indexfile);
+}
+TEST(t_dlt_file_index_build, nullpointer)
+{
+    DltFileIndex index;
+
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_index_build(NULL, 0, 0, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_index_load(NULL, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_index_load(&index, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_index_load(&index, "This Path doesn't exist!!"));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_index_free(NULL));
+}
+/* End Method: dlt_common::dlt_file_index_build */
+
+
+
+
+/* Begin Method: dlt_common::dlt_file_read_indexed */
+TEST(t_dlt_file_read_indexed, normal)
+{
+    DltFile file;
+    DltFile indexed;
+    DltFileIndex index;
+    DltFilter filter;
+    uint64_t begin;
+    int expected = 0;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+    char indexfile[MAX_LINE+sizeof(BINARY_FILE_NAME)+sizeof(DLT_FILE_INDEX_EXTENSION)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    sprintf(indexfile, "%s" BINARY_FILE_NAME DLT_FILE_INDEX_EXTENSION, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_build(openfile, 10, 0, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_load(&index, openfile));
+
+    /* sequential reference: all messages from the time of message 50 on */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, 50, 0));
+    begin = dlt_file_index_message_time(&file.msg);
+
+    for (int i = 0; i < file.counter; i++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, i, 0));
+        if (dlt_file_index_message_time(&file.msg) >= begin)
+            expected++;
+    }
+
+    /* Normal Use-Case, time window */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&indexed, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&indexed, openfile, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_read_indexed(&indexed, &index, begin, 0, 0));
+    EXPECT_EQ(expected, indexed.counter);
+    EXPECT_GT(file.counter_total, indexed.counter_total);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&indexed, 0));
+
+    /* Normal Use-Case, filter on ids */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "LOG-", "TES2", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&file, &filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&indexed, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&indexed, &filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&indexed, openfile, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_read_indexed(&indexed, &index, 0, 0, 0));
+    EXPECT_EQ(file.counter, indexed.counter);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&indexed, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+
+    /* Without index the whole file is read */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&indexed, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&indexed, openfile, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_read_indexed(&indexed, NULL, 0, 0, 0));
+    EXPECT_EQ(105, indexed.counter);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&indexed, 0));
+
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_index_free(&index));
+    unlink(indexfile);
+}
+TEST(t_dlt_file_read_indexed, nullpointer)
+{
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_read_indexed(NULL, NULL, 0, 0, 0));
+    EXPECT_FALSE(dlt_file_index_entry_match(NULL, 0, 0, NULL));
+}
+/* End Method: dlt_common::dlt_file_read_indexed */
+
+
+
+/* Begin Method: dlt_common::dlt_file_open_mmap */
+TEST(t_dlt_file_open_mmap, normal)
+{
+    DltFile file;
+    DltFile mapped;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+
+    /* Normal Use-Case, messages are indexed on demand */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&mapped, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&mapped, openfile, 0));
+    EXPECT_EQ(DLT_RETURN_TRUE, dlt_file_is_mapped(&mapped));
+    EXPECT_EQ(0, mapped.counter);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&mapped, 50, 0));
+    EXPECT_EQ(51, mapped.counter);
+
+    while (dlt_file_read(&mapped, 0) >= 0) {}
+
+    EXPECT_EQ(file.counter, mapped.counter);
+    EXPECT_EQ(file.counter_total, mapped.counter_total);
+    EXPECT_EQ(file.file_position, mapped.file_position);
+
+    for (int i = 0; i < file.counter; i++) {
+        EXPECT_EQ(file.index[i], mapped.index[i]);
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, i, 0));
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&mapped, i, 0));
+        EXPECT_EQ(file.msg.headersize, mapped.msg.headersize);
+        EXPECT_EQ(file.msg.datasize, mapped.msg.datasize);
+        EXPECT_EQ(0, memcmp(file.msg.headerbuffer, mapped.msg.headerbuffer, (size_t)file.msg.headersize));
+        EXPECT_EQ(0, memcmp(file.msg.databuffer, mapped.msg.databuffer, (size_t)file.msg.datasize));
+        if (DLT_IS_HTYP_WTMS(file.msg.standardheader->htyp)) {
+            EXPECT_EQ(file.msg.headerextra.tmsp, mapped.msg.headerextra.tmsp);
+        }
+    }
+
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_message(&mapped, file.counter, 0));
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&mapped, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_is_mapped(&mapped));
+    EXPECT_EQ((struct sDltFilePrivate *)NULL, mapped.priv);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+TEST(t_dlt_file_open_mmap, nullpointer)
+{
+    DltFile file;
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_open_mmap(NULL, NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_open_mmap(&file, NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_open_mmap(&file, "/nonexistent/file.dlt", 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_is_mapped(NULL));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+/* End Method: dlt_common::dlt_file_open_mmap */
+
+
+
+
+/* Begin Method: dlt_common::dlt_file_build_index */
+TEST(t_dlt_file_build_index, normal)
+{
+    DltFile file;
+    DltFile mapped;
+    DltFilter filter;
+    FILE *in;
+    FILE *out;
+    static char buffer[8192];
+    size_t size;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+    const char *bigfile = "/tmp/dlt_build_index_testfile.dlt";
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    /* file large enough to be split into several chunks, with garbage in between */
+    in = fopen(openfile, "rb");
+    ASSERT_NE((FILE *)NULL, in);
+    size = fread(buffer, 1, sizeof(buffer), in);
+    fclose(in);
+    out = fopen(bigfile, "wb");
+    ASSERT_NE((FILE *)NULL, out);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(size, fwrite(buffer, 1, size, out));
+        EXPECT_EQ((size_t)3, fwrite("DLT", 1, 3, out));
+    }
+    fclose(out);
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "LOG-", "TES2", 0, 0, INT32_MAX, 0));
+
+    for (int filtered = 0; filtered < 2; filtered++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&mapped, 0));
+
+        if (filtered) {
+            EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&file, &filter, 0));
+            EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&mapped, &filter, 0));
+        }
+
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, bigfile, 0));
+        while (dlt_file_read(&file, 0) >= 0) {}
+
+        /* Normal Use-Case, parallel index equals sequential read */
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&mapped, bigfile, 0));
+        EXPECT_EQ(DLT_RETURN_OK, dlt_file_build_index(&mapped, 4, 0));
+        EXPECT_EQ(file.counter, mapped.counter);
+        EXPECT_EQ(file.counter_total, mapped.counter_total);
+        EXPECT_EQ(file.file_position, mapped.file_position);
+
+        /* stdio stores the position where the resync started, mmap the found message */
+        for (int i = 0; i < file.counter; i++) {
+            EXPECT_LE(file.index[i], mapped.index[i]);
+            EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, i, 0));
+            EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&mapped, i, 0));
+            ASSERT_EQ(0, memcmp(file.msg.headerbuffer, mapped.msg.headerbuffer, (size_t)file.msg.headersize));
+        }
+
+        /* reading continues after the index */
+        EXPECT_GE(DLT_RETURN_ERROR, dlt_file_read(&mapped, 0));
+        EXPECT_EQ(file.counter, mapped.counter);
+
+        /* index can also be built with stdio */
+        EXPECT_EQ(DLT_RETURN_OK, dlt_file_build_index(&file, 4, 0));
+        EXPECT_EQ(mapped.counter, file.counter);
+
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&mapped, 0));
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    }
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+    unlink(bigfile);
+}
+TEST(t_dlt_file_build_index, nullpointer)
+{
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_build_index(NULL, 0, 0));
+}
+/* End Method: dlt_common::dlt_file_build_index */
+
+
+
+
+/* Begin Method: dlt_common::dlt_file_iterator_next */
+TEST(t_dlt_file_iterator_next, normal)
+{
+    DltFile file;
+    DltFile mapped;
+    DltFileIterator iterator;
+    DltMessageView view;
+    DltFilter filter;
+    int num = 0;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+
+    /* Normal Use-Case, views point to the same content as loaded messages */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&mapped, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&mapped, openfile, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_iterator_init(&iterator, &mapped));
+
+    while (dlt_file_iterator_next(&iterator, &view, 0) == DLT_RETURN_TRUE) {
+        ASSERT_LT(num, file.counter);
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, num, 0));
+        EXPECT_EQ((uint64_t)file.index[num], view.offset);
+        EXPECT_EQ(file.msg.headersize, view.headersize);
+        EXPECT_EQ(file.msg.datasize, view.datasize);
+        EXPECT_EQ(0, memcmp(file.msg.headerbuffer, view.header, (size_t)view.headersize));
+        EXPECT_EQ(0, memcmp(file.msg.databuffer, view.payload, (size_t)view.datasize));
+        if (DLT_IS_HTYP_WTMS(file.msg.standardheader->htyp)) {
+            EXPECT_EQ(file.msg.headerextra.tmsp, view.headerextra.tmsp);
+        }
+        EXPECT_EQ(DLT_IS_HTYP_UEH(file.msg.standardheader->htyp) != 0, view.extendedheader != NULL);
+        num++;
+    }
+
+    EXPECT_EQ(file.counter, num);
+    /* iterating does not change the index */
+    EXPECT_EQ(0, mapped.counter);
+
+    /* Normal Use-Case, view selected by index */
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_message_view(&mapped, 10, &view, 0));
+    EXPECT_EQ((uint64_t)file.index[10], view.offset);
+
+    /* Normal Use-Case, filter */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "LOG-", "TES2", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&file, &filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&mapped, &filter, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_iterator_init(&iterator, &mapped));
+    num = 0;
+    while (dlt_file_iterator_next(&iterator, &view, 0) == DLT_RETURN_TRUE)
+        num++;
+    EXPECT_EQ(file.counter, num);
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&mapped, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+TEST(t_dlt_file_iterator_next, nullpointer)
+{
+    DltFile file;
+    DltFileIterator iterator;
+    DltMessageView view;
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_iterator_init(NULL, &file));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_iterator_init(&iterator, NULL));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_file_iterator_init(&iterator, &file));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_iterator_next(&iterator, NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_iterator_next(NULL, &view, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_message_view(NULL, 0, &view, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_message_view(&file, 0, NULL, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+/* End Method: dlt_common::dlt_file_iterator_next */
+
+
+
+
+/* Begin Method: dlt_common::dlt_message_copy_view */
+TEST(t_dlt_message_copy_view, normal)
+{
+    DltFile file;
+    DltFile mapped;
+    DltMessageView view;
+    DltMessage msg;
+    static char text[DLT_DAEMON_TEXTSIZE];
+    static char expected[DLT_DAEMON_TEXTSIZE];
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&mapped, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&mapped, openfile, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_message_init(&msg, 0));
+
+    /* Normal Use-Case, copied message formats like the loaded message */
+    for (int i = 0; i < file.counter; i++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, i, 0));
+        EXPECT_EQ(DLT_RETURN_OK, dlt_file_message_view(&mapped, i, &view, 0));
+        EXPECT_EQ(DLT_RETURN_OK, dlt_message_copy_view(&msg, &view, 0));
+        EXPECT_EQ(file.msg.headersize, msg.headersize);
+        EXPECT_EQ(file.msg.datasize, msg.datasize);
+        EXPECT_LE(DLT_RETURN_OK, dlt_message_header(&file.msg, expected, DLT_DAEMON_TEXTSIZE, 0));
+        EXPECT_LE(DLT_RETURN_OK, dlt_message_header(&msg, text, DLT_DAEMON_TEXTSIZE, 0));
+        EXPECT_STREQ(expected, text);
+        EXPECT_LE(DLT_RETURN_OK, dlt_message_payload(&file.msg, expected, DLT_DAEMON_TEXTSIZE, DLT_OUTPUT_ASCII, 0));
+        EXPECT_LE(DLT_RETURN_OK, dlt_message_payload(&msg, text, DLT_DAEMON_TEXTSIZE, DLT_OUTPUT_ASCII, 0));
+        EXPECT_STREQ(expected, text);
+    }
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_message_free(&msg, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&mapped, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+TEST(t_dlt_message_copy_view, nullpointer)
+{
+    DltMessage msg;
+    DltMessageView view;
+
+    memset(&view, 0, sizeof(view));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_message_copy_view(NULL, &view, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_message_copy_view(&msg, NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_message_copy_view(&msg, &view, 0));
+}
+/* End Method: dlt_common::dlt_message_copy_view */
+
+
+
 
 /* Begin Method: dlt_common::dlt_message_print_ascii*/
 TEST(t_dlt_message_print_ascii, normal)
@@ -3252,11 +3712,445 @@ TEST(t_dlt_message_read, nullpointer)
     EXPECT_GE(DLT_RETURN_ERROR, dlt_message_read(&file.msg, (uint8_t *)&buf, 0, 0, 0));
 
 }
+TEST(t_dlt_message_read, resync)
+{
+    DltFile file;
+    DltMessage msg;
+    /* Get PWD so file can be used */
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+    uint8_t buffer[1024];
+    size_t garbage = 300;
+    size_t size;
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_read(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, 0, 0));
+
+    /* corrupted data containing parts of the serial header, then a message with serial header */
+    for (size_t i = 0; i < garbage; i++)
+        buffer[i] = (uint8_t)"DLSx"[i % 4];
+
+    size = garbage;
+    memcpy(buffer + size, dltSerialHeader, sizeof(dltSerialHeader));
+    size += sizeof(dltSerialHeader);
+    memcpy(buffer + size, file.msg.headerbuffer + sizeof(DltStorageHeader),
+           (size_t)file.msg.headersize - sizeof(DltStorageHeader));
+    size += (size_t)file.msg.headersize - sizeof(DltStorageHeader);
+    memcpy(buffer + size, file.msg.databuffer, (size_t)file.msg.datasize);
+    size += (size_t)file.msg.datasize;
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_message_init(&msg, 0));
+    EXPECT_EQ(DLT_MESSAGE_ERROR_OK, dlt_message_read(&msg, buffer, (unsigned int)size, 1, 0));
+    EXPECT_EQ(1, msg.found_serialheader);
+    EXPECT_EQ((int32_t)garbage, msg.resync_offset);
+    EXPECT_EQ(file.msg.datasize, msg.datasize);
+    EXPECT_EQ(0, memcmp(msg.databuffer, file.msg.databuffer, (size_t)msg.datasize));
+
+    /* no serial header at all, everything except the last bytes is skipped */
+    EXPECT_EQ(DLT_MESSAGE_ERROR_SIZE, dlt_message_read(&msg, buffer, (unsigned int)garbage, 1, 0));
+    EXPECT_EQ(0, msg.found_serialheader);
+    EXPECT_EQ((int32_t)(garbage - sizeof(dltSerialHeader) + 1), msg.resync_offset);
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_message_free(&msg, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
 /* End Method:dlt_common::dlt_message_read */
 
 
 
 
+/* Begin Method:dlt_common::dlt_find_pattern */
+static const uint8_t *find_pattern_reference(const uint8_t *buffer, size_t length,
+                                             const uint8_t *pattern, size_t pattern_length, bool last)
+{
+    const uint8_t *found = NULL;
+
+    for (size_t i = 0; i + pattern_length <= length; i++) {
+        if (memcmp(buffer + i, pattern, pattern_length) == 0) {
+            found = buffer + i;
+
+            if (!last)
+                break;
+        }
+    }
+
+    return found;
+}
+
+TEST(t_dlt_find_pattern, normal)
+{
+    const uint8_t pattern[] = { 'D', 'L', 'T', 0x01 };
+    uint8_t buffer[300];
+
+    /* small alphabet, so that partial and complete matches are frequent */
+    srand(42);
+
+    for (int run = 0; run < 200; run++) {
+        for (size_t i = 0; i < sizeof(buffer); i++)
+            buffer[i] = (uint8_t)"DLT\x01xD"[rand() % 6];
+
+        for (size_t start = 0; start < 40; start += 7) {
+            for (size_t length = 0; start + length <= sizeof(buffer); length += 13) {
+                EXPECT_EQ(find_pattern_reference(buffer + start, length, pattern, sizeof(pattern), false),
+                          dlt_find_pattern(buffer + start, length, pattern, sizeof(pattern)));
+                EXPECT_EQ(find_pattern_reference(buffer + start, length, pattern, sizeof(pattern), true),
+                          dlt_find_last_pattern(buffer + start, length, pattern, sizeof(pattern)));
+            }
+        }
+    }
+
+    /* pattern at the very beginning and end of a buffer longer than one vector */
+    memset(buffer, 'x', sizeof(buffer));
+    memcpy(buffer, pattern, sizeof(pattern));
+    memcpy(buffer + sizeof(buffer) - sizeof(pattern), pattern, sizeof(pattern));
+    EXPECT_EQ(buffer, dlt_find_pattern(buffer, sizeof(buffer), pattern, sizeof(pattern)));
+    EXPECT_EQ(buffer + sizeof(buffer) - sizeof(pattern),
+              dlt_find_last_pattern(buffer, sizeof(buffer), pattern, sizeof(pattern)));
+    EXPECT_EQ(buffer + sizeof(buffer) - sizeof(pattern),
+              dlt_find_pattern(buffer + 1, sizeof(buffer) - 1, pattern, sizeof(pattern)));
+    EXPECT_EQ(buffer, dlt_find_last_pattern(buffer, sizeof(buffer) - 1, pattern, sizeof(pattern)));
+    EXPECT_EQ(NULL, dlt_find_pattern(buffer + 1, sizeof(buffer) - 2, pattern, sizeof(pattern)));
+
+    /* single byte pattern */
+    EXPECT_EQ(buffer + sizeof(pattern), dlt_find_pattern(buffer, sizeof(buffer), (const uint8_t *)"x", 1));
+}
+TEST(t_dlt_find_pattern, nullpointer)
+{
+    const uint8_t pattern[] = { 'D', 'L', 'T', 0x01 };
+
+    EXPECT_EQ(NULL, dlt_find_pattern(NULL, 10, pattern, sizeof(pattern)));
+    EXPECT_EQ(NULL, dlt_find_pattern(pattern, sizeof(pattern), NULL, 1));
+    EXPECT_EQ(NULL, dlt_find_pattern(pattern, sizeof(pattern), pattern, 0));
+    EXPECT_EQ(NULL, dlt_find_last_pattern(NULL, 10, pattern, sizeof(pattern)));
+    EXPECT_EQ(NULL, dlt_find_last_pattern(pattern, sizeof(pattern), NULL, 1));
+    EXPECT_EQ(NULL, dlt_find_last_pattern(pattern, sizeof(pattern), pattern, 0));
+}
+/* End Method:dlt_common::dlt_find_pattern */
+
+
+
+
+/* Begin Method:dlt_common::dlt_filter_engine */
+static int t_dlt_filter_engine_count(const char *filename, const DltFilterEngine *engine, int mapped)
+{
+    DltFile file;
+    int counter;
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter_engine(&file, engine, 0));
+    EXPECT_NE((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+    if (mapped) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&file, filename, 0));
+    }
+    else {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, filename, 0));
+    }
+    while (dlt_file_read(&file, 0) >= 0) {}
+    counter = file.counter;
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+
+    return counter;
+}
+static void t_dlt_filter_engine_rule(DltFilterRule *rule, const char *apid, const char *ctid)
+{
+    memset(rule, 0, sizeof(DltFilterRule));
+    rule->apid = dlt_filter_engine_pack_id(apid);
+    rule->ctid = dlt_filter_engine_pack_id(ctid);
+    rule->payload_max = INT32_MAX;
+}
+TEST(t_dlt_filter_engine, normal)
+{
+    DltFile file;
+    DltFilterEngine engine;
+    DltFilterEngine linear;
+    DltFilterRule rule;
+    char apid[DLT_ID_SIZE + 1];
+    char ctid[DLT_ID_SIZE + 1];
+    uint8_t payload[] = { 'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    /* Normal Use-Case, more rules than DLT_FILTER_MAX */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&engine));
+    for (int i = 0; i < 500; i++) {
+        snprintf(apid, sizeof(apid), "A%03d", i);
+        snprintf(ctid, sizeof(ctid), "C%03d", i);
+        t_dlt_filter_engine_rule(&rule, apid, ctid);
+        EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    }
+    t_dlt_filter_engine_rule(&rule, "LOG", "TES2");
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_EQ(501u, engine.count);
+    EXPECT_EQ(500, dlt_filter_engine_find(&engine, &rule));
+    EXPECT_EQ(0, engine.compiled);
+    /* 16 messages of LOG/TES2 and 53 messages without extended header */
+    EXPECT_EQ(69, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_EQ(69, t_dlt_filter_engine_count(openfile, &engine, 1));
+
+    /* wildcards */
+    t_dlt_filter_engine_rule(&rule, "", "TES3");
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_EQ(76, t_dlt_filter_engine_count(openfile, &engine, 0));
+    t_dlt_filter_engine_rule(&rule, "APP", "");
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_EQ(84, t_dlt_filter_engine_count(openfile, &engine, 0));
+
+    /* compiled and linear check agree on every message */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&linear));
+    for (uint32_t i = 0; i < engine.count; i++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&linear, &engine.rules[i]));
+    }
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_compile(&engine));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    for (int i = 0; i < file.counter; i++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(&file, i, 0));
+        EXPECT_EQ(dlt_filter_engine_match(&linear, &file.msg),
+                  dlt_filter_engine_match(&engine, &file.msg));
+    }
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&linear));
+
+    /* remove */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_remove(&engine, 500));
+    EXPECT_EQ(502u, engine.count);
+    EXPECT_EQ(68, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+    EXPECT_EQ(0u, engine.count);
+
+    /* payload substring, 19 messages with "Hello world" */
+    memset(&rule, 0, sizeof(rule));
+    rule.payload = payload;
+    rule.payload_length = sizeof(payload);
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_EQ(1u, engine.payload_rules);
+    EXPECT_EQ(72, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_EQ(72, t_dlt_filter_engine_count(openfile, &engine, 1));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+
+    /* timestamp range, 4 of the 8 messages with timestamp */
+    memset(&rule, 0, sizeof(rule));
+    rule.timestamp_min = 1066000000;
+    rule.flags = DLT_FILTER_RULE_FLAG_TIMESTAMP;
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_EQ(57, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_EQ(57, t_dlt_filter_engine_count(openfile, &engine, 1));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+}
+TEST(t_dlt_filter_engine, load)
+{
+    DltFilterEngine engine;
+    FILE *handle;
+    const char *filterfile = "t_dlt_filter_engine.txt";
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    /* more rules than DLT_FILTER_MAX, wildcards and a rule given twice */
+    handle = fopen(filterfile, "w");
+    ASSERT_NE((FILE *)NULL, handle);
+    for (int i = 0; i < 100; i++) {
+        fprintf(handle, "A%03d C%03d\n", i, i);
+    }
+    fprintf(handle, "LOG TES2\n---- TES3\nLOG TES2\nLONGAPPID *\n");
+    fclose(handle);
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&engine));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_load(&engine, filterfile, 0));
+    EXPECT_EQ(103u, engine.count);
+    EXPECT_EQ(1, engine.compiled);
+    EXPECT_EQ(0u, engine.rules[101].apid);
+    EXPECT_EQ(9, engine.rules[102].apid2len);
+    EXPECT_EQ(0u, engine.rules[102].ctid);
+    EXPECT_EQ(76, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_EQ(76, t_dlt_filter_engine_count(openfile, &engine, 1));
+
+    /* the rules are replaced */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_load(&engine, filterfile, 0));
+    EXPECT_EQ(103u, engine.count);
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+
+    remove(filterfile);
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_load(&engine, filterfile, 0));
+}
+TEST(t_dlt_filter_engine, compile)
+{
+    DltFile file;
+    DltFilter filter;
+    DltFilterEngine engine;
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "LOG", "TES2", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "", "TES3", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&engine));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_compile(&filter, &engine));
+    EXPECT_EQ(2u, engine.count);
+    EXPECT_EQ(1, engine.compiled);
+    EXPECT_EQ(dlt_filter_engine_pack_id("TES3"), engine.rules[1].ctid);
+    EXPECT_EQ(0u, engine.rules[1].apid);
+    EXPECT_EQ(76, t_dlt_filter_engine_count(openfile, &engine, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+
+    /* the file compiles the filter when it is set */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&file, &filter, 0));
+    EXPECT_NE((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+    EXPECT_EQ(2u, dlt_file_get_filter_engine(&file)->count);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_EQ(76, file.counter);
+
+    /* a filter changed after it was set is checked rule by rule */
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add(&filter, "APP", "", 0, 0, INT32_MAX, 0));
+    EXPECT_EQ((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_EQ(84, file.counter);
+
+    /* as is a filter assigned directly */
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter(&file, NULL, 0));
+    EXPECT_EQ((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+    file.filter = &filter;
+    EXPECT_EQ((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open_mmap(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+    EXPECT_EQ(84, file.counter);
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+}
+static DltReturnValue t_dlt_filter_engine_check_v2(const DltFilterEngine *engine, const char *apid, const char *ctid)
+{
+    DltMessageV2 msg;
+    DltBaseHeaderV2 baseheader;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&baseheader, 0, sizeof(baseheader));
+    baseheader.htyp2 = DLT_HTYP2_EH;
+    msg.baseheaderv2 = &baseheader;
+    msg.headerextrav2.msin = (uint8_t)((DLT_TYPE_LOG << DLT_MSIN_MSTP_SHIFT) | (DLT_LOG_INFO << DLT_MSIN_MTIN_SHIFT));
+    msg.extendedheaderv2.apid = (char *)(uintptr_t)apid;
+    msg.extendedheaderv2.apidlen = (uint8_t)strlen(apid);
+    msg.extendedheaderv2.ctid = (char *)(uintptr_t)ctid;
+    msg.extendedheaderv2.ctidlen = (uint8_t)strlen(ctid);
+
+    return dlt_filter_engine_match_v2(engine, &msg);
+}
+TEST(t_dlt_filter_engine, v2)
+{
+    DltFilter filter;
+    DltFilterEngine engine;
+    DltFilterRule rule;
+
+    memset(&filter, 0, sizeof(filter));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add_v2(&filter, "APP", "CTX", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_add_v2(&filter, "LONGAPPID", "CTX", 0, 0, INT32_MAX, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&engine));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_compile_v2(&filter, &engine));
+    EXPECT_EQ(2u, engine.count);
+    EXPECT_EQ((char *)NULL, engine.rules[0].apid2);
+    EXPECT_EQ(9, engine.rules[1].apid2len);
+    EXPECT_EQ(DLT_RETURN_TRUE, t_dlt_filter_engine_check_v2(&engine, "APP", "CTX"));
+    EXPECT_EQ(DLT_RETURN_TRUE, t_dlt_filter_engine_check_v2(&engine, "LONGAPPID", "CTX"));
+    EXPECT_EQ(DLT_RETURN_OK, t_dlt_filter_engine_check_v2(&engine, "LONG", "CTX"));
+    EXPECT_EQ(DLT_RETURN_OK, t_dlt_filter_engine_check_v2(&engine, "APPX", "CTX"));
+
+    /* the long id is copied, the filter can be released */
+    for (int i = 0; i < filter.counter; i++) {
+        free(filter.apid2[i]);
+        free(filter.ctid2[i]);
+    }
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+    EXPECT_EQ(DLT_RETURN_TRUE, t_dlt_filter_engine_check_v2(&engine, "LONGAPPID", "CTX"));
+
+    /* rules beyond DLT_FILTER_MAX are checked for v2 messages as well */
+    for (int i = 0; i < DLT_FILTER_MAX; i++) {
+        memset(&rule, 0, sizeof(rule));
+        rule.apid = dlt_filter_engine_pack_id("LOAD");
+        rule.log_level = i + 10;
+        EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    }
+    memset(&rule, 0, sizeof(rule));
+    rule.apid = dlt_filter_engine_pack_id("LAST");
+    rule.apid2 = (char *)(uintptr_t)"LASTAPPLICATION";
+    rule.apid2len = 15;
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_add(&engine, &rule));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_compile(&engine));
+    EXPECT_EQ(DLT_RETURN_TRUE, t_dlt_filter_engine_check_v2(&engine, "LASTAPPLICATION", "ANY"));
+    EXPECT_EQ(DLT_RETURN_OK, t_dlt_filter_engine_check_v2(&engine, "LASTAPP", "ANY"));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_remove(&engine, 1));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_compile(&engine));
+    EXPECT_EQ(DLT_RETURN_OK, t_dlt_filter_engine_check_v2(&engine, "LONGAPPID", "CTX"));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_free(&engine));
+
+    /* an empty engine matches every message */
+    EXPECT_EQ(DLT_RETURN_TRUE, t_dlt_filter_engine_check_v2(&engine, "ANY", "ANY"));
+}
+TEST(t_dlt_filter_engine, nullpointer)
+{
+    DltFile file;
+    DltFilter filter;
+    DltFilterEngine engine;
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_init(&filter, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_engine_init(&engine));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+
+    EXPECT_EQ(0u, dlt_filter_engine_pack_id(NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_init(NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_compile(NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_match(NULL, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_load(NULL, "filter.txt", 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_engine_load(&engine, NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_compile(NULL, &engine));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_compile(&filter, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_compile_v2(NULL, &engine));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_filter_compile_v2(&filter, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_file_set_filter_engine(NULL, &engine, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_set_filter_engine(&file, NULL, 0));
+    EXPECT_EQ((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(NULL));
+    EXPECT_EQ((const DltFilterEngine *)NULL, dlt_file_get_filter_engine(&file));
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_filter_free(&filter, 0));
+}
+/* End Method:dlt_common::dlt_filter_engine */
+
+
+
+
 /* Begin Method:dlt_common::dlt_message_argument_print */
 TEST(t_dlt_message_argument_print, normal)
 {
@@ -4087,6 +4981,152 @@ TEST(dlt_client_parse_get_log_info_resp_text, normal)
     EXPECT_EQ(DLT_RETURN_OK,ret);
 }
 
+/* Begin Method: dlt_client::dlt_client_stream */
+typedef struct
+{
+    DltFile *file;
+    int num;
+    int batches;
+    int stop;
+} t_dlt_client_stream_data;
+
+static int t_dlt_client_stream_callback(DltClient *client, const DltMessageView *views, uint32_t count, void *data)
+{
+    t_dlt_client_stream_data *expected = (t_dlt_client_stream_data *)data;
+
+    EXPECT_TRUE(client != NULL);
+    EXPECT_GE(7u, count);
+    expected->batches++;
+
+    for (uint32_t i = 0; i < count; i++) {
+        DltFile *file = expected->file;
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(file, expected->num, 0));
+        EXPECT_TRUE(views[i].storageheader == NULL);
+        EXPECT_EQ(file->msg.headersize, views[i].headersize + (int32_t)sizeof(DltStorageHeader));
+        EXPECT_EQ(file->msg.datasize, views[i].datasize);
+        EXPECT_EQ(0, memcmp(file->msg.headerbuffer + sizeof(DltStorageHeader), views[i].header,
+                            (size_t)views[i].headersize));
+        EXPECT_EQ(0, memcmp(file->msg.databuffer, views[i].payload, (size_t)views[i].datasize));
+        expected->num++;
+    }
+
+    return (expected->stop > 0) && (expected->batches >= expected->stop);
+}
+
+static void t_dlt_client_stream_send(DltFile *file, int sock, int serial)
+{
+    static uint8_t buffer[64 * 1024];
+    size_t size = 0;
+    uint8_t garbage[] = { 'D', 'L', 'T', 0x01, 0x35 };
+
+    /* data before the first serial header is skipped */
+    if (serial) {
+        memcpy(buffer, garbage, sizeof(garbage));
+        size += sizeof(garbage);
+    }
+
+    for (int i = 0; i < file->counter; i++) {
+        EXPECT_LE(DLT_RETURN_OK, dlt_file_message(file, i, 0));
+        size_t headersize = (size_t)file->msg.headersize - sizeof(DltStorageHeader);
+
+        ASSERT_GE(sizeof(buffer), size + sizeof(dltSerialHeader) + headersize + (size_t)file->msg.datasize);
+
+        if (serial) {
+            memcpy(buffer + size, dltSerialHeader, sizeof(dltSerialHeader));
+            size += sizeof(dltSerialHeader);
+        }
+
+        memcpy(buffer + size, file->msg.headerbuffer + sizeof(DltStorageHeader), headersize);
+        size += headersize;
+        memcpy(buffer + size, file->msg.databuffer, (size_t)file->msg.datasize);
+        size += (size_t)file->msg.datasize;
+    }
+
+    EXPECT_EQ((ssize_t)size, send(sock, buffer, size, 0));
+}
+
+TEST(t_dlt_client_stream, normal)
+{
+    DltFile file;
+    DltClient client;
+    DltClientStream stream;
+    t_dlt_client_stream_data data;
+    int sv[2];
+    /* Get PWD so file can be used*/
+    char pwd[MAX_LINE];
+    char openfile[MAX_LINE+sizeof(BINARY_FILE_NAME)];
+
+    /* ignore returned value from getcwd */
+    if (getcwd(pwd, MAX_LINE) == NULL) {}
+
+    sprintf(openfile, "%s" BINARY_FILE_NAME, pwd);
+    /*---------------------------------------*/
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_init(&file, 0));
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_open(&file, openfile, 0));
+    while (dlt_file_read(&file, 0) >= 0) {}
+
+    /* Normal Use-Case, all messages are delivered in batches */
+    for (int serial = 0; serial <= 1; serial++) {
+        memset(&client, 0, sizeof(client));
+        EXPECT_LE(DLT_RETURN_OK, dlt_client_init(&client, 0));
+        client.resync_serial_header = serial;
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+        client.receiver.fd = sv[0];
+        client.receiver.type = DLT_RECEIVE_SOCKET;
+
+        t_dlt_client_stream_send(&file, sv[1], serial);
+        close(sv[1]);
+
+        memset(&data, 0, sizeof(data));
+        data.file = &file;
+        EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_init(&stream, &client, 0, 7, t_dlt_client_stream_callback, &data));
+        EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_loop(&stream, 0));
+        EXPECT_EQ(file.counter, data.num);
+        EXPECT_EQ((file.counter + 6) / 7, data.batches);
+        EXPECT_EQ((uint64_t)file.counter, stream.messages);
+        EXPECT_EQ(serial ? 5u : 0u, stream.skipped);
+        EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_free(&stream));
+        close(sv[0]);
+    }
+
+    /* Normal Use-Case, callback stops the stream */
+    memset(&client, 0, sizeof(client));
+    EXPECT_LE(DLT_RETURN_OK, dlt_client_init(&client, 0));
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+    client.receiver.fd = sv[0];
+    client.receiver.type = DLT_RECEIVE_SOCKET;
+    t_dlt_client_stream_send(&file, sv[1], 0);
+
+    memset(&data, 0, sizeof(data));
+    data.file = &file;
+    data.stop = 2;
+    EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_init(&stream, &client, 0, 7, t_dlt_client_stream_callback, &data));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_loop(&stream, 0));
+    EXPECT_EQ(14, data.num);
+    EXPECT_EQ(DLT_RETURN_OK, dlt_client_stream_free(&stream));
+    close(sv[1]);
+    close(sv[0]);
+
+    EXPECT_LE(DLT_RETURN_OK, dlt_file_free(&file, 0));
+}
+TEST(t_dlt_client_stream, nullpointer)
+{
+    DltClient client;
+    DltClientStream stream;
+
+    memset(&client, 0, sizeof(client));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_init(NULL, &client, 0, 0, t_dlt_client_stream_callback, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_init(&stream, NULL, 0, 0, t_dlt_client_stream_callback, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_init(&stream, &client, 0, 0, NULL, NULL));
+    /* buffer too small for a message of maximum size */
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_init(&stream, &client, 1024, 0, t_dlt_client_stream_callback, NULL));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_process(NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_loop(NULL, 0));
+    EXPECT_GE(DLT_RETURN_ERROR, dlt_client_stream_free(NULL));
+}
+/* End Method: dlt_client::dlt_client_stream */
+
 TEST(dlt_getloginfo_conv_ascii_to_string, normal)
 {
     /* NULL-Pointer, expect exeption */
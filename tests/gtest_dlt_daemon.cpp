@@ -38,7 +38,13 @@ extern "C"
 #include "dlt_version.h"
 #include "dlt_client.h"
 #include "dlt_protocol.h"
+#include "dlt_filter_engine.h"
+#include "dlt_daemon_connection.h"
+#include "dlt_daemon_event_handler.h"
+#include "dlt_daemon_client.h"
 }
+#include <poll.h>
+#include <sys/socket.h>
 #ifdef DLT_TRACE_LOAD_CTRL_ENABLE
 
 const int _trace_load_send_size = 100;
@@ -240,7 +246,7 @@ TEST(t_trace_load_config_file_parser, errors)
     // Test case 13: data longer than value length
     char long_data[4096];
     memset(long_data, 'A', sizeof(long_data));
-    fprintf(temp, "%s 100 200 APP2 300 400\n", long_data);
+    fprintf(temp, "%.*s 100 200 APP2 300 400\n", (int)sizeof(long_data), long_data);
 
     // Test case 14: tabs
     fprintf(temp, "APP1\t100\t200\n");
@@ -260,8 +266,9 @@ TEST(t_trace_load_config_file_parser, errors)
 }
 
 static void matches_default_element(DltDaemonApplication *app, DltTraceLoadSettings *settings) {
-    EXPECT_STREQ(settings->apid, app->apid);
-    EXPECT_STREQ(settings->ctid, "");
+    /* the ids are not terminated */
+    EXPECT_EQ(strncmp(settings->apid, app->apid, DLT_ID_SIZE), 0);
+    EXPECT_EQ(settings->ctid[0], '\0');
     EXPECT_EQ(settings->soft_limit, DLT_TRACE_LOAD_DAEMON_SOFT_LIMIT_DEFAULT);
     EXPECT_EQ(settings->hard_limit, DLT_TRACE_LOAD_DAEMON_HARD_LIMIT_DEFAULT);
 }
@@ -269,7 +276,7 @@ static void matches_default_element(DltDaemonApplication *app, DltTraceLoadSetti
 TEST(t_find_runtime_trace_load_settings, normal) {
     DltDaemon daemon;
     const int num_apps = 4;
-    const char* app_ids[num_apps] = {"APP0", "APP1", "APP2", "APP3"};
+    char app_ids[num_apps][DLT_ID_SIZE + 1] = {"APP0", "APP1", "APP2", "APP3"};
     DltDaemonApplication *apps[num_apps] = {};
 
     DltTraceLoadSettings* settings;
@@ -277,13 +284,13 @@ TEST(t_find_runtime_trace_load_settings, normal) {
 
     pid_t pid = 0;
     int fd = 15;
-    const char *desc = "HELLO_TEST";
+    char desc[] = "HELLO_TEST";
 
     init_daemon(&daemon, ecu);
     setup_trace_load_settings(daemon);
 
     for (int i = 0; i < num_apps; i++) {
-        apps[i] = dlt_daemon_application_add(&daemon, (char *)app_ids[i], pid, (char *)desc, fd, ecu, 0);
+        apps[i] = dlt_daemon_application_add(&daemon, app_ids[i], pid, desc, fd, ecu, 0);
         EXPECT_FALSE(apps[i]->trace_load_settings == NULL);
     }
 
@@ -356,34 +363,41 @@ TEST(t_find_runtime_trace_load_settings, normal) {
 
     // remove application, add it again and check if the settings are still there
     dlt_daemon_application_del(&daemon, apps[0], ecu, 0);
-    apps[0] = dlt_daemon_application_add(&daemon, (char *)app_ids[0], pid, (char *)desc, fd, ecu, 0);
+    apps[0] = dlt_daemon_application_add(&daemon, app_ids[0], pid, desc, fd, ecu, 0);
     settings = dlt_find_runtime_trace_load_settings(
         apps[0]->trace_load_settings, apps[0]->trace_load_settings_count,
         apps[0]->apid, "FOO");
     EXPECT_EQ(memcmp(settings, &daemon.preconfigured_trace_load_settings[0], sizeof(DltTraceLoadSettings)), 0);
 
     EXPECT_EQ(0, dlt_daemon_free(&daemon, 0));
+    free(daemon.preconfigured_trace_load_settings);
 
-    // Test after freeing daemon
-    settings = dlt_find_runtime_trace_load_settings(
-        apps[0]->trace_load_settings, apps[0]->trace_load_settings_count,
-        apps[0]->apid, NULL);
+    // Test after freeing daemon, the applications and their settings are freed
+    settings = dlt_find_runtime_trace_load_settings(NULL, 0, app_ids[0], NULL);
     EXPECT_TRUE(settings == NULL);
-    EXPECT_TRUE(apps[0]->trace_load_settings == NULL);
+}
+
+static void t_trace_load_context_add(DltDaemon *daemon, char *apid, const char *ctid) {
+    char id[DLT_ID_SIZE + 1] = {};
+    char desc[] = "";
+    char ecu[] = "ECU1";
+
+    strncpy(id, ctid, DLT_ID_SIZE);
+    dlt_daemon_context_add(daemon, apid, id, DLT_LOG_VERBOSE, 0, 0, 0, desc, ecu, 0);
 }
 
 TEST(t_trace_load_keep_message, normal) {
     DltDaemon daemon;
     DltDaemonLocal daemon_local = {};
     const int num_apps = 4;
-    const char* app_ids[num_apps] = {"APP0", "APP1", "APP2", "APP3"};
+    char app_ids[num_apps][DLT_ID_SIZE + 1] = {"APP0", "APP1", "APP2", "APP3"};
     DltDaemonApplication *apps[num_apps] = {};
 
     char ecu[DLT_ID_SIZE] = {};
 
     pid_t pid = 0;
     int fd = 15;
-    const char *desc = "HELLO_TEST";
+    char desc[] = "HELLO_TEST";
 
     for (auto& app_id : app_ids) {
         dlt_register_app(app_id, app_id);
@@ -396,7 +410,7 @@ TEST(t_trace_load_keep_message, normal) {
     };
 
     const auto set_extended_header_log_level = [&daemon_local](unsigned int log_level) {
-        daemon_local.msg.extendedheader->msin = ((daemon_local.msg.extendedheader->msin) & ~DLT_MSIN_MTIN) | ((log_level) << DLT_MSIN_MTIN_SHIFT);
+        daemon_local.msg.extendedheader->msin = (uint8_t)(((daemon_local.msg.extendedheader->msin) & ~DLT_MSIN_MTIN) | ((log_level) << DLT_MSIN_MTIN_SHIFT));
     };
 
     const auto log_until_hard_limit_reached = [&daemon, &daemon_local] (DltDaemonApplication *app) {
@@ -422,7 +436,7 @@ TEST(t_trace_load_keep_message, normal) {
     setup_trace_load_settings(daemon);
 
     for (int i = 0; i < num_apps; i++) {
-        apps[i] = dlt_daemon_application_add(&daemon, (char *)app_ids[i], pid, (char *)desc, fd, ecu, 0);
+        apps[i] = dlt_daemon_application_add(&daemon, app_ids[i], pid, desc, fd, ecu, 0);
         EXPECT_FALSE(apps[i]->trace_load_settings == NULL);
     }
 
@@ -440,8 +454,8 @@ TEST(t_trace_load_keep_message, normal) {
 
     // Test if hard limit is reached for applications that only configure an application id
     // Meaning that the limit is shared between all contexts
-    dlt_daemon_context_add(&daemon, apps[0]->apid, "CT01", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
-    dlt_daemon_context_add(&daemon, apps[0]->apid, "CT02", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
+    t_trace_load_context_add(&daemon, apps[0]->apid, "CT01");
+    t_trace_load_context_add(&daemon, apps[0]->apid, "CT02");
     memcpy(daemon_local.msg.extendedheader->ctid, "CT01", DLT_ID_SIZE);
     log_until_hard_limit_reached(apps[0]);
     EXPECT_FALSE(trace_load_keep_message(apps[0], _trace_load_send_size, &daemon, &daemon_local, 0));
@@ -454,8 +468,8 @@ TEST(t_trace_load_keep_message, normal) {
     memcpy(daemon_local.msg.extendedheader->ctid, "CT01", DLT_ID_SIZE);
     memcpy(daemon_local.msg.extendedheader->apid, apps[1], DLT_ID_SIZE);
 
-    dlt_daemon_context_add(&daemon, apps[1]->apid, "CT02", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
-    dlt_daemon_context_add(&daemon, apps[1]->apid, "CT02", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
+    t_trace_load_context_add(&daemon, apps[1]->apid, "CT02");
+    t_trace_load_context_add(&daemon, apps[1]->apid, "CT02");
 
     log_until_hard_limit_reached(apps[1]);
     EXPECT_FALSE(trace_load_keep_message(apps[1], _trace_load_send_size, &daemon, &daemon_local, 0));
@@ -470,8 +484,8 @@ TEST(t_trace_load_keep_message, normal) {
     // Exhaust app limit first
     memcpy(daemon_local.msg.extendedheader->ctid, "CTXX", DLT_ID_SIZE);
     memcpy(daemon_local.msg.extendedheader->apid, apps[2], DLT_ID_SIZE);
-    dlt_daemon_context_add(&daemon, apps[2]->apid, "CTXX", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
-    dlt_daemon_context_add(&daemon, apps[2]->apid, "CT01", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
+    t_trace_load_context_add(&daemon, apps[2]->apid, "CTXX");
+    t_trace_load_context_add(&daemon, apps[2]->apid, "CT01");
 
     log_until_hard_limit_reached(apps[2]);
     EXPECT_FALSE(trace_load_keep_message(apps[2], _trace_load_send_size, &daemon, &daemon_local, 0));
@@ -482,17 +496,297 @@ TEST(t_trace_load_keep_message, normal) {
     // Test not configured context
     memcpy(daemon_local.msg.extendedheader->ctid, "CTXX", DLT_ID_SIZE);
     memcpy(daemon_local.msg.extendedheader->apid, apps[1], DLT_ID_SIZE);
-    dlt_daemon_context_add(&daemon, apps[1]->apid, "CTXX", DLT_LOG_VERBOSE, 0, 0, 0, "", "ECU1", 0);
+    t_trace_load_context_add(&daemon, apps[1]->apid, "CTXX");
 
     EXPECT_EQ(
             trace_load_keep_message(apps[1], _trace_load_send_size, &daemon, &daemon_local, 0),
             DLT_TRACE_LOAD_DAEMON_HARD_LIMIT_DEFAULT != 0);
 
     EXPECT_EQ(0, dlt_daemon_free(&daemon, 0));
+    free(daemon.preconfigured_trace_load_settings);
+}
+
+static DltReturnValue t_trace_load_log_internal(DltLogLevelType, const char *, void *) {
+    return DLT_RETURN_OK;
+}
+
+TEST(t_trace_load_keep_message, high_limit) {
+    // 200 MB/s are more than 4 GiB in a window of 60 seconds
+    DltTraceLoadSettings settings = {};
+    const int32_t size = 1000000;
+    const uint32_t expected = (uint32_t)((uint64_t)200000000 * DLT_TRACE_LOAD_WINDOW_SIZE / size);
+    uint32_t kept = 0;
+
+    settings.soft_limit = 200000000;
+    settings.hard_limit = 200000000;
+
+    while (kept <= expected &&
+           dlt_check_trace_load(&settings, DLT_LOG_INFO, 1000, size, t_trace_load_log_internal, NULL))
+        kept++;
+
+    EXPECT_LE(kept, expected);
+    EXPECT_GE(kept, expected - 1);
+    EXPECT_FALSE(dlt_check_trace_load(&settings, DLT_LOG_INFO, 1000, size, t_trace_load_log_internal, NULL));
+
+    // The recorded bytes decay after the window
+    EXPECT_TRUE(dlt_check_trace_load(&settings, DLT_LOG_INFO,
+                                     1000 + DLT_TRACE_LOAD_WINDOW_SIZE * DLT_TRACE_LOAD_WINDOW_RESOLUTION,
+                                     size, t_trace_load_log_internal, NULL));
 }
 
 #endif
 
+/* Begin Method: dlt_daemon_client::dlt_daemon_control_set_client_filter */
+static void t_client_filter_request(DltDaemon *daemon, DltDaemonLocal *daemon_local, int sock,
+                                    const DltServiceClientFilterRule *rules, uint16_t count)
+{
+    uint8_t data[sizeof(DltServiceSetClientFilter) + 4 * sizeof(DltServiceClientFilterRule)];
+    DltServiceSetClientFilter *req = (DltServiceSetClientFilter *)data;
+    DltStandardHeader standardheader;
+    DltMessage msg;
+
+    memset(&standardheader, 0, sizeof(standardheader));
+    standardheader.htyp = DLT_HTYP_UEH | DLT_HTYP_PROTOCOL_VERSION1;
+    memset(&msg, 0, sizeof(msg));
+    msg.standardheader = &standardheader;
+    msg.databuffer = data;
+    msg.datasize = (int32_t)(sizeof(DltServiceSetClientFilter) + count * sizeof(DltServiceClientFilterRule));
+
+    req->service_id = DLT_SERVICE_ID_SET_CLIENT_FILTER;
+    req->count = count;
+    memcpy(data + sizeof(DltServiceSetClientFilter), rules, count * sizeof(DltServiceClientFilterRule));
+
+    dlt_daemon_control_set_client_filter(sock, daemon, daemon_local, &msg, 0);
+}
+
+static ssize_t t_client_filter_send(DltDaemon *daemon, DltDaemonLocal *daemon_local, int peer,
+                                    const char *apid, const char *ctid, uint8_t mstp, uint8_t mtin)
+{
+    uint8_t header[sizeof(DltStandardHeader) + sizeof(DltExtendedHeader)];
+    uint8_t payload[4] = { 0 };
+    uint8_t buffer[256];
+    DltStandardHeader *standardheader = (DltStandardHeader *)header;
+    DltExtendedHeader *extendedheader = (DltExtendedHeader *)(header + sizeof(DltStandardHeader));
+
+    memset(header, 0, sizeof(header));
+    standardheader->htyp = DLT_HTYP_UEH | DLT_HTYP_PROTOCOL_VERSION1;
+    standardheader->len = DLT_HTOBE_16(sizeof(header) + sizeof(payload));
+    extendedheader->msin = (uint8_t)((mstp << DLT_MSIN_MSTP_SHIFT) | (mtin << DLT_MSIN_MTIN_SHIFT));
+    dlt_set_id(extendedheader->apid, apid);
+    dlt_set_id(extendedheader->ctid, ctid);
+
+    EXPECT_EQ(DLT_DAEMON_ERROR_OK,
+              dlt_daemon_client_send(DLT_DAEMON_SEND_TO_ALL, daemon, daemon_local, NULL, 0,
+                                     header, sizeof(header), payload, sizeof(payload), 0));
+
+    return recv(peer, buffer, sizeof(buffer), MSG_DONTWAIT);
+}
+
+TEST(t_dlt_daemon_control_set_client_filter, normal)
+{
+    DltDaemon daemon;
+    DltDaemonLocal daemon_local;
+    DltConnection *con;
+    DltServiceClientFilterRule rules[2];
+    uint8_t buffer[256];
+    int fds[2];
+
+    memset(&daemon, 0, sizeof(daemon));
+    memset(&daemon_local, 0, sizeof(daemon_local));
+    memset(rules, 0, sizeof(rules));
+    dlt_set_id(daemon.ecuid, "ECU1");
+    daemon.mode = DLT_USER_MODE_EXTERNAL;
+    daemon.state = DLT_DAEMON_STATE_SEND_DIRECT;
+
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_daemon_prepare_event_handling(&daemon_local.pEvent));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_connection_create(&daemon_local, &daemon_local.pEvent, fds[0], POLLIN,
+                                                   DLT_CONNECTION_CLIENT_MSG_TCP));
+    con = dlt_event_handler_find_connection(&daemon_local.pEvent, fds[0]);
+    ASSERT_NE((DltConnection *)NULL, con);
+
+    /* Without filter every message is sent */
+    EXPECT_LT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP3", "CTX3", DLT_TYPE_LOG, DLT_LOG_INFO));
+
+    /* APP1 with any context, or CTX2 of any application with log level warning */
+    dlt_set_id(rules[0].apid, "APP1");
+    dlt_set_id(rules[1].ctid, "CTX2");
+    rules[1].log_level = DLT_LOG_WARN;
+    rules[1].message_types = 1 << DLT_TYPE_LOG;
+    t_client_filter_request(&daemon, &daemon_local, fds[0], rules, 2);
+    ASSERT_NE((DltFilterEngine *)NULL, con->filter);
+    EXPECT_EQ(2u, con->filter->count);
+    /* response */
+    EXPECT_LT(0, recv(fds[1], buffer, sizeof(buffer), MSG_DONTWAIT));
+
+    EXPECT_LT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP1", "CTX1", DLT_TYPE_LOG, DLT_LOG_INFO));
+    EXPECT_GT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP2", "CTX2", DLT_TYPE_LOG, DLT_LOG_INFO));
+    EXPECT_LT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP2", "CTX2", DLT_TYPE_LOG, DLT_LOG_WARN));
+    EXPECT_GT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP2", "CTX2", DLT_TYPE_APP_TRACE, DLT_LOG_WARN));
+    EXPECT_GT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP3", "CTX3", DLT_TYPE_LOG, DLT_LOG_INFO));
+    /* control messages always pass */
+    EXPECT_LT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP3", "CTX3", DLT_TYPE_CONTROL,
+                                      DLT_CONTROL_RESPONSE));
+
+    /* An empty filter removes the filter */
+    t_client_filter_request(&daemon, &daemon_local, fds[0], rules, 0);
+    EXPECT_EQ((DltFilterEngine *)NULL, con->filter);
+    EXPECT_LT(0, recv(fds[1], buffer, sizeof(buffer), MSG_DONTWAIT));
+    EXPECT_LT(0, t_client_filter_send(&daemon, &daemon_local, fds[1], "APP3", "CTX3", DLT_TYPE_LOG, DLT_LOG_INFO));
+
+    /* Filter is freed with the connection */
+    t_client_filter_request(&daemon, &daemon_local, fds[0], rules, 2);
+    EXPECT_NE((DltFilterEngine *)NULL, con->filter);
+    dlt_event_handler_unregister_connection(&daemon_local.pEvent, &daemon_local, fds[0]);
+    close(fds[1]);
+    free(daemon_local.pEvent.pfd);
+}
+TEST(t_dlt_daemon_control_set_client_filter, abnormal)
+{
+    DltDaemon daemon;
+    DltDaemonLocal daemon_local;
+    DltServiceClientFilterRule rules[1];
+    uint8_t buffer[256];
+    int fds[2];
+
+    memset(&daemon, 0, sizeof(daemon));
+    memset(&daemon_local, 0, sizeof(daemon_local));
+    memset(rules, 0, sizeof(rules));
+    dlt_set_id(daemon.ecuid, "ECU1");
+
+    /* Not a client connection, only the error response is sent */
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_daemon_prepare_event_handling(&daemon_local.pEvent));
+    t_client_filter_request(&daemon, &daemon_local, fds[0], rules, 1);
+    EXPECT_LT(0, recv(fds[1], buffer, sizeof(buffer), MSG_DONTWAIT));
+
+    dlt_daemon_control_set_client_filter(fds[0], &daemon, &daemon_local, NULL, 0);
+    dlt_daemon_control_set_client_filter(fds[0], NULL, &daemon_local, NULL, 0);
+    EXPECT_GT(0, recv(fds[1], buffer, sizeof(buffer), MSG_DONTWAIT));
+
+    close(fds[0]);
+    close(fds[1]);
+    free(daemon_local.pEvent.pfd);
+}
+/* End Method: dlt_daemon_client::dlt_daemon_control_set_client_filter */
+
+/* Begin Method: dlt_daemon_load_shedding */
+TEST(t_dlt_daemon_load_shedding_fair_share, normal)
+{
+    const uint64_t demands[4] = { 100, 200, 1000, 3000 };
+
+    /* sufficient budget, every demand is met */
+    EXPECT_EQ(3000U, dlt_daemon_load_shedding_fair_share(demands, 4, 5000));
+    /* 100 and 200 are met, 1000 and 3000 share the rest */
+    EXPECT_EQ(850U, dlt_daemon_load_shedding_fair_share(demands, 4, 2000));
+    /* equal shares only */
+    EXPECT_EQ(50U, dlt_daemon_load_shedding_fair_share(demands, 4, 200));
+    EXPECT_EQ(0U, dlt_daemon_load_shedding_fair_share(demands, 4, 0));
+    EXPECT_EQ(0U, dlt_daemon_load_shedding_fair_share(NULL, 4, 200));
+    EXPECT_EQ(0U, dlt_daemon_load_shedding_fair_share(demands, 0, 200));
+}
+
+TEST(t_dlt_daemon_load_shedding_keep_message, normal)
+{
+    DltDaemonLoadShedding ls;
+    DltDaemonApplication app;
+
+    memset(&ls, 0, sizeof(ls));
+    memset(&app, 0, sizeof(app));
+
+    /* nothing is shed without pressure */
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_VERBOSE, 100, DLT_LOG_ERROR));
+
+    /* two levels shed: verbose and debug */
+    ls.shed_levels = 2;
+    EXPECT_FALSE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_VERBOSE, 100, DLT_LOG_ERROR));
+    EXPECT_FALSE(dlt_daemon_load_shedding_keep_message(&ls, NULL, DLT_TYPE_LOG, DLT_LOG_DEBUG, 100, DLT_LOG_ERROR));
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_INFO, 100, DLT_LOG_ERROR));
+    /* not a log message */
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_APP_TRACE, DLT_LOG_VERBOSE, 100,
+                                                      DLT_LOG_ERROR));
+    EXPECT_EQ(2U, ls.shed_messages);
+    EXPECT_EQ(1U, app.load_shed_messages);
+    EXPECT_EQ(200U, app.load_demand_bytes);
+    EXPECT_EQ(500U, ls.ingest_bytes);
+    EXPECT_EQ(300U, ls.kept_bytes);
+    EXPECT_EQ(100U, ls.protected_bytes);
+
+    /* the quota applies above the keep level only */
+    ls.app_quota = 250;
+    EXPECT_FALSE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_WARN, 100, DLT_LOG_ERROR));
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_WARN, 50, DLT_LOG_ERROR));
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_ERROR, 100, DLT_LOG_ERROR));
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_FATAL, 100, DLT_LOG_ERROR));
+    EXPECT_EQ(2U, app.load_shed_messages);
+    EXPECT_EQ(350U, app.load_demand_bytes);
+    EXPECT_EQ(250U, app.load_kept_bytes);
+
+    /* a full ring buffer sheds everything above the keep level at once */
+    dlt_daemon_load_shedding_overload(&ls, DLT_LOG_ERROR);
+    EXPECT_EQ(DLT_LOG_VERBOSE - DLT_LOG_ERROR, ls.shed_levels);
+    EXPECT_FALSE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_WARN, 10, DLT_LOG_ERROR));
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(&ls, &app, DLT_TYPE_LOG, DLT_LOG_ERROR, 10, DLT_LOG_ERROR));
+
+    EXPECT_TRUE(dlt_daemon_load_shedding_keep_message(NULL, &app, DLT_TYPE_LOG, DLT_LOG_VERBOSE, 100, DLT_LOG_ERROR));
+}
+
+TEST(t_dlt_daemon_load_shedding_update, normal)
+{
+    DltDaemon daemon;
+    DltDaemonRegisteredUsers user_list;
+    DltDaemonApplication apps[2];
+    DltDaemonLoadShedding ls;
+    uint64_t now = 1000000;
+    int i = 0;
+
+    memset(&daemon, 0, sizeof(daemon));
+    memset(&user_list, 0, sizeof(user_list));
+    memset(apps, 0, sizeof(apps));
+    memset(&ls, 0, sizeof(ls));
+    user_list.applications = apps;
+    user_list.num_applications = 2;
+    daemon.user_list = &user_list;
+    daemon.num_user_lists = 1;
+
+    /* a full ring buffer sheds one more level per interval, up to the keep level */
+    for (i = 0; i < 6; i++)
+        dlt_daemon_load_shedding_update(&ls, &daemon, 90, 0, now += 1000000, 75, 25, DLT_LOG_ERROR);
+
+    EXPECT_EQ(DLT_LOG_VERBOSE - DLT_LOG_ERROR, ls.shed_levels);
+    EXPECT_EQ(0U, ls.app_quota);
+
+    /* levels are given back after some calm intervals */
+    dlt_daemon_load_shedding_update(&ls, &daemon, 50, 0, now += 1000000, 75, 25, DLT_LOG_ERROR);
+
+    for (i = 0; i < DLT_DAEMON_LOAD_SHEDDING_CALM_INTERVALS; i++)
+        dlt_daemon_load_shedding_update(&ls, &daemon, 10, 0, now += 1000000, 75, 25, DLT_LOG_ERROR);
+
+    EXPECT_EQ(DLT_LOG_VERBOSE - DLT_LOG_ERROR - 1, ls.shed_levels);
+
+    /* a client which took 10000 bytes in 0.9 s of sending, the budget at 50% is
+     * 5555 bytes per second, shared by a small and a large application */
+    ls.shed_levels = 1;
+    ls.sink_bytes = 10000;
+    ls.busy_us = 900000;
+    apps[0].load_demand_bytes = 1000;
+    apps[0].load_shed_messages = 3;
+    apps[1].load_demand_bytes = 9000;
+    dlt_daemon_load_shedding_update(&ls, &daemon, 0, 1, now += 1000000, 75, 25, DLT_LOG_ERROR);
+
+    EXPECT_EQ(2, ls.shed_levels);
+    EXPECT_EQ(11111U, ls.capacity);
+    EXPECT_EQ(4555U, ls.app_quota);
+    EXPECT_EQ(0U, apps[0].load_demand_bytes);
+    EXPECT_EQ(0U, apps[0].load_shed_messages);
+    EXPECT_EQ(0U, ls.sink_bytes);
+    EXPECT_EQ(0U, ls.busy_us);
+
+    dlt_daemon_load_shedding_update(NULL, &daemon, 0, 1, now, 75, 25, DLT_LOG_ERROR);
+    dlt_daemon_load_shedding_update(&ls, NULL, 0, 1, now, 75, 25, DLT_LOG_ERROR);
+}
+/* End Method: dlt_daemon_load_shedding */
+
 /*##############################################################################################################################*/
 /*##############################################################################################################################*/
 /*##############################################################################################################################*/
@@ -61,10 +61,12 @@ extern "C"
 {
     #include "dlt_daemon_event_handler.h"
     #include "dlt_daemon_connection.h"
+    #include "dlt_daemon_serial.h"
     #include <netdb.h>
     #include <netinet/in.h>
     #include <sys/types.h>
     #include <sys/socket.h>
+    #include <unistd.h>
 }
 
 /* Begin Method: dlt_daemon_event_handler::t_dlt_daemon_prepare_event_handling*/
@@ -647,6 +649,94 @@ TEST(t_dlt_connection_send_multiple, nullpointer)
     EXPECT_EQ(DLT_RETURN_ERROR, ret);
 }
 
+/* Begin Method: dlt_daemon_serial::t_dlt_daemon_serial_sink_send*/
+TEST(t_dlt_daemon_serial_sink_send, normal)
+{
+    DltDaemonSerialSink sink;
+    int fds[2];
+    char buffer[64] = { 0 };
+    char expected[64] = { 0 };
+    ssize_t length;
+    int i;
+
+    ASSERT_EQ(0, pipe(fds));
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_serial_sink_init(&sink, fds[1], 16));
+
+    /* the ring buffer wraps, the writer keeps the order */
+    for (i = 0; i < 4; i++) {
+        char header[2] = { (char)('a' + i), (char)('A' + i) };
+        char payload[3] = { (char)('0' + i), (char)('0' + i), (char)('0' + i) };
+
+        EXPECT_EQ(DLT_DAEMON_ERROR_OK, dlt_daemon_serial_sink_send(&sink, header, 2, payload, 3, 1));
+        memcpy(expected + i * 9, dltSerialHeader, sizeof(dltSerialHeader));
+        memcpy(expected + i * 9 + 4, header, 2);
+        memcpy(expected + i * 9 + 6, payload, 3);
+
+        /* wait until the writer has written the message */
+        while (1) {
+            pthread_mutex_lock(&sink.mutex);
+            length = sink.used;
+            pthread_mutex_unlock(&sink.mutex);
+
+            if (length == 0)
+                break;
+
+            usleep(1000);
+        }
+    }
+
+    dlt_daemon_serial_sink_free(&sink);
+    EXPECT_EQ(4u, sink.messages);
+    EXPECT_EQ(36u, sink.bytes);
+    EXPECT_EQ(0u, sink.dropped);
+
+    close(fds[1]);
+    length = read(fds[0], buffer, sizeof(buffer));
+    EXPECT_EQ(36, length);
+    EXPECT_EQ(0, memcmp(expected, buffer, 36));
+    close(fds[0]);
+}
+
+TEST(t_dlt_daemon_serial_sink_send, dropped)
+{
+    DltDaemonSerialSink sink;
+    int fds[2];
+    char data[32] = { 0 };
+    char buffer[64] = { 0 };
+
+    ASSERT_EQ(0, pipe(fds));
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_serial_sink_init(&sink, fds[1], 16));
+
+    /* a message bigger than the ring buffer is dropped as a whole */
+    EXPECT_EQ(DLT_DAEMON_ERROR_OK, dlt_daemon_serial_sink_send(&sink, data, 10, data, 10, 0));
+    EXPECT_EQ(DLT_DAEMON_ERROR_OK, dlt_daemon_serial_sink_send(&sink, data, 8, NULL, 0, 0));
+
+    dlt_daemon_serial_sink_free(&sink);
+    EXPECT_EQ(1u, sink.messages);
+    EXPECT_EQ(8u, sink.bytes);
+    EXPECT_EQ(1u, sink.dropped);
+    EXPECT_EQ(20u, sink.dropped_bytes);
+
+    close(fds[1]);
+    EXPECT_EQ(8, read(fds[0], buffer, sizeof(buffer)));
+    close(fds[0]);
+}
+
+TEST(t_dlt_daemon_serial_sink_send, nullpointer)
+{
+    DltDaemonSerialSink sink;
+    char data[4] = { 0 };
+
+    memset(&sink, 0, sizeof(sink));
+
+    EXPECT_EQ(DLT_RETURN_WRONG_PARAMETER, dlt_daemon_serial_sink_init(NULL, 1, 16));
+    EXPECT_EQ(DLT_RETURN_WRONG_PARAMETER, dlt_daemon_serial_sink_init(&sink, -1, 16));
+    EXPECT_EQ(DLT_DAEMON_ERROR_UNKNOWN, dlt_daemon_serial_sink_send(NULL, data, 4, NULL, 0, 0));
+    EXPECT_EQ(DLT_DAEMON_ERROR_UNKNOWN, dlt_daemon_serial_sink_send(&sink, data, 4, NULL, 0, 0));
+    dlt_daemon_serial_sink_free(NULL);
+    dlt_daemon_serial_sink_free(&sink);
+}
+
 int connectServer(void)
 {
     int sockfd = 0, portno = 0;
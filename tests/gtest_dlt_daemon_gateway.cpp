@@ -55,12 +55,17 @@
 
 #include <gtest/gtest.h>
 #include <limits.h>
+#include <poll.h>
 #include <syslog.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 extern "C"
 {
 #include "dlt_gateway.h"
 #include "dlt_gateway_internal.h"
+#include "dlt_daemon_connection.h"
+#include "dlt_daemon_event_handler.h"
 }
 
 /* Begin Method: dlt_gateway::t_dlt_gateway_init*/
@@ -238,6 +243,29 @@ TEST(t_dlt_gateway_check_send_serial, nullpointer)
     EXPECT_EQ(DLT_RETURN_WRONG_PARAMETER, dlt_gateway_check_send_serial(NULL, NULL));
 }
 
+/* Begin Method: dlt_gateway::t_dlt_gateway_check_compression*/
+TEST(t_dlt_gateway_check_compression, normal)
+{
+    DltGatewayConnection tmp;
+    char value[DLT_CONFIG_FILE_ENTRY_MAX_LEN] = "0";
+
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_check_compression(&tmp, value));
+    EXPECT_EQ(0, tmp.compression);
+}
+
+TEST(t_dlt_gateway_check_compression, abnormal)
+{
+    DltGatewayConnection tmp;
+    char value[DLT_CONFIG_FILE_ENTRY_MAX_LEN] = "10";
+
+    EXPECT_EQ(DLT_RETURN_ERROR, dlt_gateway_check_compression(&tmp, value));
+}
+
+TEST(t_dlt_gateway_check_compression, nullpointer)
+{
+    EXPECT_EQ(DLT_RETURN_WRONG_PARAMETER, dlt_gateway_check_compression(NULL, NULL));
+}
+
 /* Begin Method: dlt_gateway::t_dlt_gateway_allocate_control_messages*/
 TEST(t_dlt_gateway_allocate_control_messages, normal)
 {
@@ -386,7 +414,8 @@ TEST(t_dlt_gateway_establish_connections, normal)
     int port = 3491;
     DltDaemonLocal daemon_local;
     DltGateway *gateway = &daemon_local.pGateway;
-    DltGatewayConnection connections;
+    DltGatewayConnection connections = {};
+    EXPECT_EQ(DLT_RETURN_OK, dlt_client_init(&connections.client, 0));
     gateway->num_connections = 1;
     gateway->connections = &connections;
     gateway->connections->status = DLT_GATEWAY_INITIALIZED;
@@ -396,6 +425,11 @@ TEST(t_dlt_gateway_establish_connections, normal)
     gateway->connections->client.port = static_cast<uint16_t>(port);
 
     EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_establish_connections(gateway, &daemon_local, 0));
+
+    /* a connection which is still in progress is given up */
+    dlt_client_connect_free(&connections.connect_state);
+    if (connections.client.sock >= 0)
+        close(connections.client.sock);
 }
 
 TEST(t_dlt_gateway_establish_connections, nullpointer)
@@ -581,6 +615,181 @@ TEST(t_dlt_gateway_process_passive_node_messages, normal)
     EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, &receiver, 1));
 }
 
+TEST(t_dlt_gateway_process_passive_node_messages, forward)
+{
+    DltDaemon daemon;
+    DltDaemonLocal daemon_local;
+    DltReceiver receiver;
+    DltGatewayConnection connections;
+    char ecuid[] = "ECU2";
+    int fds[2];
+    /* message with ECU id, message without ECU id and a partial message */
+    uint8_t data[] = {
+        DLT_HTYP_PROTOCOL_VERSION1 | DLT_HTYP_WEID, 0, 0, 12, 'E', 'C', 'U', '2', 1, 2, 3, 4,
+        DLT_HTYP_PROTOCOL_VERSION1, 1, 0, 8, 5, 6, 7, 8,
+        DLT_HTYP_PROTOCOL_VERSION1, 2, 0, 8, 9
+    };
+    memset(&daemon, 0, sizeof(DltDaemon));
+    memset(&daemon_local, 0, sizeof(DltDaemonLocal));
+    memset(&receiver, 0, sizeof(DltReceiver));
+    memset(&connections, 0, sizeof(DltGatewayConnection));
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    ASSERT_EQ(DLT_RETURN_OK, dlt_receiver_init(&receiver, fds[0], DLT_RECEIVE_SOCKET, 1024));
+    daemon_local.pGateway.connections = &connections;
+    daemon_local.pGateway.num_connections = 1;
+    connections.status = DLT_GATEWAY_CONNECTED;
+    connections.ecuid = ecuid;
+    connections.client.sock = fds[0];
+
+    ASSERT_EQ((ssize_t)sizeof(data), send(fds[1], data, sizeof(data), 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, &receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_CONNECTED, connections.status);
+    EXPECT_EQ(5, receiver.bytesRcvd);
+
+    /* rest of the partial message and a message of another ECU, which
+     * disconnects the passive node */
+    data[5] = '3';
+    memmove(data + 3, data, 12);
+    data[0] = 10;
+    data[1] = 11;
+    data[2] = 12;
+    ASSERT_EQ(15, send(fds[1], data, 15, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, &receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_DISCONNECTED, connections.status);
+    EXPECT_EQ(DLT_GATEWAY_DISABLED, connections.trigger);
+    EXPECT_EQ(0, receiver.bytesRcvd);
+
+    dlt_receiver_free(&receiver);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#ifdef DLT_STREAM_COMPRESSION
+/* Passive node connection with compressed frames, registered in the event handler */
+static void t_gateway_compressed_setup(DltDaemonLocal *daemon_local, DltGatewayConnection *con,
+                                       char *ecuid, int *fds)
+{
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    ASSERT_EQ(DLT_RETURN_OK, dlt_receiver_init(&con->client.receiver, fds[0], DLT_RECEIVE_SOCKET,
+                                               DLT_GATEWAY_RECEIVE_BUFSIZE));
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_decompression_init(&con->decompression, 1024));
+    daemon_local->pGateway.connections = con;
+    daemon_local->pGateway.num_connections = 1;
+    con->status = DLT_GATEWAY_CONNECTED;
+    con->trigger = DLT_GATEWAY_ON_STARTUP;
+    con->ecuid = ecuid;
+    con->client.sock = fds[0];
+    con->compression = 1;
+    con->compressed = 1;
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_prepare_event_handling(&daemon_local->pEvent));
+    ASSERT_EQ(0, dlt_connection_create(daemon_local, &daemon_local->pEvent, fds[0], POLLIN,
+                                       DLT_CONNECTION_GATEWAY));
+}
+
+/* Append count messages as one frame to stream */
+static uint32_t t_gateway_compressed_frame(DltDaemonCompression *compression, const uint8_t *message,
+                                           int size, int count, uint8_t *stream)
+{
+    const uint8_t *frame = NULL;
+    uint32_t length = 0;
+
+    for (int i = 0; i < count; i++)
+        EXPECT_EQ(DLT_RETURN_OK, dlt_daemon_compression_add(compression, message, size, NULL, 0, 1));
+
+    EXPECT_EQ(DLT_RETURN_OK, dlt_daemon_compression_pack(compression, &frame, &length));
+    EXPECT_GT(length, sizeof(DltCompressionFrameHeader));
+    memcpy(stream, frame, length);
+
+    return length;
+}
+
+TEST(t_dlt_gateway_process_passive_node_messages, compressed)
+{
+    DltDaemon daemon = {};
+    DltDaemonLocal daemon_local = {};
+    DltGatewayConnection connections = {};
+    DltDaemonCompression compression;
+    DltReceiver *receiver = &connections.client.receiver;
+    char ecuid[] = "ECU2";
+    int fds[2];
+    uint8_t stream[1024];
+    uint32_t length = 0;
+    uint32_t sent = 0;
+    uint8_t message[] = {
+        DLT_HTYP_PROTOCOL_VERSION1 | DLT_HTYP_WEID, 0, 0, 12, 'E', 'C', 'U', '2', 1, 2, 3, 4
+    };
+    t_gateway_compressed_setup(&daemon_local, &connections, ecuid, fds);
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_compression_init(&compression, 1, 1024));
+
+    /* three frames with one send, the last one incomplete */
+    length += t_gateway_compressed_frame(&compression, message, 12, 2, stream + length);
+    length += t_gateway_compressed_frame(&compression, message, 12, 1, stream + length);
+    sent = length + 5;
+    length += t_gateway_compressed_frame(&compression, message, 12, 3, stream + length);
+    ASSERT_EQ((ssize_t)sent, send(fds[1], stream, sent, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_CONNECTED, connections.status);
+    EXPECT_EQ(5, receiver->bytesRcvd);
+
+    /* rest of the last frame and the next one */
+    length += t_gateway_compressed_frame(&compression, message, 12, 1, stream + length);
+    ASSERT_EQ((ssize_t)(length - sent), send(fds[1], stream + sent, length - sent, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_CONNECTED, connections.status);
+    EXPECT_EQ(0, receiver->bytesRcvd);
+
+    /* uncompressed data where a frame is expected closes the connection */
+    ASSERT_EQ((ssize_t)sizeof(message), send(fds[1], message, sizeof(message), 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_DISCONNECTED, connections.status);
+    EXPECT_EQ(DLT_GATEWAY_ON_STARTUP, connections.trigger);
+    EXPECT_EQ((DltConnection *)NULL, dlt_event_handler_find_connection(&daemon_local.pEvent, fds[0]));
+    EXPECT_EQ(0, receiver->bytesRcvd);
+
+    dlt_daemon_compression_free(&compression);
+    dlt_daemon_decompression_free(&connections.decompression);
+    dlt_receiver_free(receiver);
+    dlt_event_handler_cleanup_connections(&daemon_local.pEvent);
+    close(fds[1]);
+}
+
+TEST(t_dlt_gateway_process_passive_node_messages, compressed_ecuid)
+{
+    DltDaemon daemon = {};
+    DltDaemonLocal daemon_local = {};
+    DltGatewayConnection connections = {};
+    DltDaemonCompression compression;
+    DltReceiver *receiver = &connections.client.receiver;
+    char ecuid[] = "ECU2";
+    int fds[2];
+    uint8_t stream[1024];
+    uint32_t length = 0;
+    uint8_t message[] = {
+        DLT_HTYP_PROTOCOL_VERSION1 | DLT_HTYP_WEID, 0, 0, 12, 'E', 'C', 'U', '2', 1, 2, 3, 4
+    };
+    t_gateway_compressed_setup(&daemon_local, &connections, ecuid, fds);
+    ASSERT_EQ(DLT_RETURN_OK, dlt_daemon_compression_init(&compression, 1, 1024));
+
+    /* a frame of the passive node, followed by a frame of another ECU and
+     * the begin of the next frame, the passive node is not connected again */
+    length += t_gateway_compressed_frame(&compression, message, 12, 1, stream + length);
+    message[7] = '3';
+    length += t_gateway_compressed_frame(&compression, message, 12, 1, stream + length);
+    ASSERT_EQ((ssize_t)(length + 5), send(fds[1], stream, length + 5, 0));
+    EXPECT_EQ(DLT_RETURN_OK, dlt_gateway_process_passive_node_messages(&daemon, &daemon_local, receiver, 0));
+    EXPECT_EQ(DLT_GATEWAY_DISCONNECTED, connections.status);
+    EXPECT_EQ(DLT_GATEWAY_DISABLED, connections.trigger);
+    EXPECT_EQ((DltConnection *)NULL, dlt_event_handler_find_connection(&daemon_local.pEvent, fds[0]));
+    EXPECT_EQ(0, receiver->bytesRcvd);
+
+    dlt_daemon_compression_free(&compression);
+    dlt_daemon_decompression_free(&connections.decompression);
+    dlt_receiver_free(receiver);
+    dlt_event_handler_cleanup_connections(&daemon_local.pEvent);
+    close(fds[1]);
+}
+#endif
+
 TEST(t_dlt_gateway_process_passive_node_messages, nullpointer)
 {
     EXPECT_EQ(DLT_RETURN_WRONG_PARAMETER, dlt_gateway_process_passive_node_messages(NULL, NULL, NULL, 0));
@@ -595,8 +804,9 @@ TEST(t_dlt_gateway_process_gateway_timer, normal)
     DltDaemon daemon;
     DltDaemonLocal daemon_local;
     DltReceiver receiver;
-    DltGatewayConnection connections;
+    DltGatewayConnection connections = {};
     DltConnection connections1;
+    EXPECT_EQ(DLT_RETURN_OK, dlt_client_init(&connections.client, 0));
     daemon_local.pGateway.connections = &connections;
     daemon_local.pGateway.num_connections = 1;
     DltLogStorage storage_handle;
@@ -615,6 +825,11 @@ TEST(t_dlt_gateway_process_gateway_timer, normal)
 
     EXPECT_EQ(DLT_RETURN_OK,
               dlt_gateway_process_gateway_timer(&daemon, &daemon_local, daemon_local.pEvent.connections->receiver, 1));
+
+    /* a connection which is still in progress is given up */
+    dlt_client_connect_free(&connections.connect_state);
+    if (connections.client.sock >= 0)
+        close(connections.client.sock);
 }
 
 TEST(t_dlt_gateway_process_gateway_timer, nullpointer)
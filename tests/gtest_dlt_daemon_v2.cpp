@@ -73,7 +73,7 @@ const int _trace_load_send_size = 100;
 
 static void init_daemon(DltDaemon* daemon, char* ecu) {
     DltGateway gateway;
-    strcpy(ecu, "ECU1");
+    strncpy(ecu, "ECU1", DLT_ID_SIZE);
 
     EXPECT_EQ(0,
               dlt_daemon_init(daemon, DLT_DAEMON_RINGBUFFER_MIN_SIZE, DLT_DAEMON_RINGBUFFER_MAX_SIZE,
@@ -81,6 +81,8 @@ static void init_daemon(DltDaemon* daemon, char* ecu) {
                               DLT_TRACE_STATUS_OFF, 0, 0));
 
     dlt_set_id(daemon->ecuid, ecu);
+    dlt_set_id_v2(daemon->ecuid2, ecu, DLT_ID_SIZE);
+    daemon->ecuid2len = DLT_ID_SIZE;
     EXPECT_EQ(0, dlt_daemon_init_user_information(daemon, &gateway, 0, 0));
 }
 
@@ -92,33 +94,33 @@ static void setup_trace_load_settings(DltDaemon& daemon)
     memset(daemon.preconfigured_trace_load_settings, 0, daemon.preconfigured_trace_load_settings_count * sizeof(DltTraceLoadSettings));
 
     // APP0 only has app id
-    strcpy(daemon.preconfigured_trace_load_settings[0].apid, "APP0");
+    strncpy(daemon.preconfigured_trace_load_settings[0].apid, "APP0", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[0].soft_limit = 1000;
     daemon.preconfigured_trace_load_settings[0].hard_limit = 2987;
 
     // APP1 has only three contexts, no app id
-    strcpy(daemon.preconfigured_trace_load_settings[1].apid, "APP1");
-    strcpy(daemon.preconfigured_trace_load_settings[1].ctid, "CT01");
+    strncpy(daemon.preconfigured_trace_load_settings[1].apid, "APP1", DLT_ID_SIZE);
+    strncpy(daemon.preconfigured_trace_load_settings[1].ctid, "CT01", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[1].soft_limit = 100;
     daemon.preconfigured_trace_load_settings[1].hard_limit = 200;
 
-    strcpy(daemon.preconfigured_trace_load_settings[2].apid, "APP1");
-    strcpy(daemon.preconfigured_trace_load_settings[2].ctid, "CT02");
+    strncpy(daemon.preconfigured_trace_load_settings[2].apid, "APP1", DLT_ID_SIZE);
+    strncpy(daemon.preconfigured_trace_load_settings[2].ctid, "CT02", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[2].soft_limit = 300;
     daemon.preconfigured_trace_load_settings[2].hard_limit = 400;
 
-    strcpy(daemon.preconfigured_trace_load_settings[3].apid, "APP1");
-    strcpy(daemon.preconfigured_trace_load_settings[3].ctid, "CT03");
+    strncpy(daemon.preconfigured_trace_load_settings[3].apid, "APP1", DLT_ID_SIZE);
+    strncpy(daemon.preconfigured_trace_load_settings[3].ctid, "CT03", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[3].soft_limit = 500;
     daemon.preconfigured_trace_load_settings[3].hard_limit = 600;
 
     // APP2 has app id and context
-    strcpy(daemon.preconfigured_trace_load_settings[4].apid, "APP2");
-    strcpy(daemon.preconfigured_trace_load_settings[4].ctid, "CT01");
+    strncpy(daemon.preconfigured_trace_load_settings[4].apid, "APP2", DLT_ID_SIZE);
+    strncpy(daemon.preconfigured_trace_load_settings[4].ctid, "CT01", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[4].soft_limit = 700;
     daemon.preconfigured_trace_load_settings[4].hard_limit = 800;
 
-    strcpy(daemon.preconfigured_trace_load_settings[5].apid, "APP2");
+    strncpy(daemon.preconfigured_trace_load_settings[5].apid, "APP2", DLT_ID_SIZE);
     daemon.preconfigured_trace_load_settings[5].soft_limit = 900;
     daemon.preconfigured_trace_load_settings[5].hard_limit = 1000;
 
@@ -133,24 +135,29 @@ static void setup_trace_load_settings(DltDaemon& daemon)
 TEST(t_trace_load_keep_message_v2, normal) {
     DltDaemon daemon;
     DltDaemonLocal daemon_local = {};
+    DltMessageV2 *msg = &daemon_local.msgv2;
     const int num_apps = 4;
-    const char* app_ids[num_apps] = {"APP0", "APP1", "APP2", "APP3"};
+    char app_ids[num_apps][DLT_ID_SIZE + 1] = {"APP0", "APP1", "APP2", "APP3"};
+    char unknown_app_id[] = "APPX";
+    char ctid[DLT_ID_SIZE + 1] = {};
     DltDaemonApplication *apps[num_apps] = {};
 
-    char ecu[DLT_ID_SIZE] = {};
+    char ecu[DLT_ID_SIZE + 1] = {};
 
     pid_t pid = 0;
     int fd = 15;
-    const char *desc = "HELLO_TEST";
-
-    const auto set_extended_header = [&daemon_local]() {
-        daemon_local.msg.extendedheader = (DltExtendedHeaderV2 *)(daemon_local.msg.headerbuffer + sizeof(DltStorageHeaderV2) +
-                                                               sizeof(DltStandardHeaderV2));
-        memset(daemon_local.msg.extendedheader, 0, sizeof(DltExtendedHeaderV2));
+    char desc[] = "HELLO_TEST";
+
+    const auto set_message_ids = [msg, &ctid](char *apid, const char *context_id) {
+        strncpy(ctid, context_id, DLT_ID_SIZE);
+        msg->extendedheaderv2.apidlen = DLT_ID_SIZE;
+        msg->extendedheaderv2.apid = apid;
+        msg->extendedheaderv2.ctidlen = DLT_ID_SIZE;
+        msg->extendedheaderv2.ctid = ctid;
     };
 
-    const auto set_extended_header_log_level = [&daemon_local](unsigned int log_level) {
-        daemon_local.msg.extendedheader->msin = ((daemon_local.msg.extendedheader->msin) & ~DLT_MSIN_MTIN) | ((log_level) << DLT_MSIN_MTIN_SHIFT);
+    const auto set_log_level = [msg](unsigned int log_level) {
+        msg->headerextrav2.msin = (uint8_t)((DLT_TYPE_LOG << DLT_MSIN_MSTP_SHIFT) | (log_level << DLT_MSIN_MTIN_SHIFT));
     };
 
     const auto log_until_hard_limit_reached = [&daemon, &daemon_local] (DltDaemonApplication *app) {
@@ -159,54 +166,54 @@ TEST(t_trace_load_keep_message_v2, normal) {
 
     const auto check_debug_and_trace_can_log = [&](DltDaemonApplication* app) {
         // messages for debug and verbose logs are never dropped
-        set_extended_header_log_level(DLT_LOG_VERBOSE);
+        set_log_level(DLT_LOG_VERBOSE);
         EXPECT_TRUE(trace_load_keep_message_v2(app,
-                                            app->trace_load_settings->hard_limit * 10,
-                                            &daemon, &daemon_local, 0));
-        set_extended_header_log_level(DLT_LOG_DEBUG);
+                                               app->trace_load_settings->hard_limit * 10,
+                                               &daemon, &daemon_local, 0));
+        set_log_level(DLT_LOG_DEBUG);
         EXPECT_TRUE(trace_load_keep_message_v2(app,
-                                            app->trace_load_settings->hard_limit * 10,
-                                            &daemon, &daemon_local, 0));
+                                               app->trace_load_settings->hard_limit * 10,
+                                               &daemon, &daemon_local, 0));
 
-        set_extended_header_log_level(DLT_LOG_INFO);
+        set_log_level(DLT_LOG_INFO);
     };
 
-    init_daemon_v2(&daemon, ecu);
-    setup_trace_load_settings_v2(daemon);
+    init_daemon(&daemon, ecu);
+    setup_trace_load_settings(daemon);
 
     for (int i = 0; i < num_apps; i++) {
-        apps[i] = dlt_daemon_application_add_v2(&daemon, (char *)app_ids[i], pid, (char *)desc, fd, ecu, 0);
+        apps[i] = dlt_daemon_application_add_v2(&daemon, DLT_ID_SIZE, app_ids[i], pid, desc, fd,
+                                                DLT_ID_SIZE, ecu, 0);
+        ASSERT_FALSE(apps[i] == NULL);
         EXPECT_FALSE(apps[i]->trace_load_settings == NULL);
     }
 
     // messages without extended header will be kept
-    daemon_local.msg.extendedheader = NULL;
     EXPECT_TRUE(trace_load_keep_message_v2(
         apps[0], apps[0]->trace_load_settings->soft_limit, &daemon, &daemon_local, 0));
 
-    set_extended_header_v2();
-    check_debug_and_trace_can_log(apps[0]);
+    set_log_level(DLT_LOG_INFO);
 
     // messages for apps that have not been registered should be dropped
-    DltDaemonApplication app = {};
-    EXPECT_FALSE(trace_load_keep_message_v2(&app, 42, &daemon, &daemon_local, 0));
+    set_message_ids(unknown_app_id, "CT01");
+    EXPECT_FALSE(trace_load_keep_message_v2(apps[0], 42, &daemon, &daemon_local, 0));
 
     // Test if hard limit is reached for applications that only configure an application id
     // Meaning that the limit is shared between all contexts
-    memcpy(daemon_local.msg.extendedheader->ctid, "CT01", DLT_ID_SIZE);
+    set_message_ids(apps[0]->apid2, "CT01");
     log_until_hard_limit_reached(apps[0]);
     EXPECT_FALSE(trace_load_keep_message_v2(apps[0], _trace_load_send_size, &daemon, &daemon_local, 0));
-    memcpy(daemon_local.msg.extendedheader->ctid, "CT02", DLT_ID_SIZE);
+    set_message_ids(apps[0]->apid2, "CT02");
     EXPECT_FALSE(trace_load_keep_message_v2(apps[0], _trace_load_send_size, &daemon, &daemon_local, 0));
     // Even after exhausting the limits, make sure debug and trace still work
     check_debug_and_trace_can_log(apps[0]);
 
     // APP1 has only three contexts, no app id
-    memcpy(daemon_local.msg.extendedheader->ctid, "CT01", DLT_ID_SIZE);
+    set_message_ids(apps[1]->apid2, "CT01");
     log_until_hard_limit_reached(apps[1]);
     EXPECT_FALSE(trace_load_keep_message_v2(apps[1], _trace_load_send_size, &daemon, &daemon_local, 0));
     // CT01 has reached its limit, make sure CT02 still can log
-    memcpy(daemon_local.msg.extendedheader->ctid, "CT02", DLT_ID_SIZE);
+    set_message_ids(apps[1]->apid2, "CT02");
     EXPECT_TRUE(trace_load_keep_message_v2(apps[1], _trace_load_send_size, &daemon, &daemon_local, 0));
     // Set CT02 to hard limit to hard limit 0, which should drop all messages
     apps[1]->trace_load_settings[2].hard_limit = 0;
@@ -214,20 +221,21 @@ TEST(t_trace_load_keep_message_v2, normal) {
 
     // APP2 has context and app id configured
     // Exhaust app limit first
-    memcpy(daemon_local.msg.extendedheader->ctid, "CTXX", DLT_ID_SIZE);
+    set_message_ids(apps[2]->apid2, "CTXX");
     log_until_hard_limit_reached(apps[2]);
     EXPECT_FALSE(trace_load_keep_message_v2(apps[2], _trace_load_send_size, &daemon, &daemon_local, 0));
     // Context logging should still be possible
-    memcpy(daemon_local.msg.extendedheader->ctid, "CT01", DLT_ID_SIZE);
+    set_message_ids(apps[2]->apid2, "CT01");
     EXPECT_TRUE(trace_load_keep_message_v2(apps[2], _trace_load_send_size, &daemon, &daemon_local, 0));
 
     // Test not configured context
-    memcpy(daemon_local.msg.extendedheader->ctid, "CTXX", DLT_ID_SIZE);
+    set_message_ids(apps[1]->apid2, "CTXX");
     EXPECT_EQ(
             trace_load_keep_message_v2(apps[1], _trace_load_send_size, &daemon, &daemon_local, 0),
             DLT_TRACE_LOAD_DAEMON_HARD_LIMIT_DEFAULT != 0);
 
     EXPECT_EQ(0, dlt_daemon_free(&daemon, 0));
+    free(daemon.preconfigured_trace_load_settings);
 }
 #endif
 
@@ -0,0 +1,199 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-adaptor-stdin-benchmark.sh
+#
+#Description     : Measure the throughput of dlt-adaptor-stdin. A synthetic
+#                  text file of the given size is piped through the adaptor,
+#                  once in line mode and once in bulk mode (-B), and
+#                  dlt-receive in collector mode counts the messages which
+#                  arrive at the client. The time until the adaptor has read
+#                  the file, the time until the last message arrived, the CPU
+#                  time of the adaptor and the number of received lines are
+#                  printed. Line mode discards messages when the daemon cannot
+#                  keep up, bulk mode slows down reading instead.
+#                  The library of the adaptor uses the default IPC path, so no
+#                  other dlt-daemon may run while the benchmark runs.
+#
+#Usage           : dlt-adaptor-stdin-benchmark.sh [-a dlt-adaptor-stdin]
+#                  [-d dlt-daemon] [-R dlt-receive] [-s size_mb]
+#                  [-m "line bulk"] [-p port] [-w workdir]
+################################################################################
+DLT_ADAPTOR="dlt-adaptor-stdin"
+DLT_DAEMON="dlt-daemon"
+DLT_RECEIVE="dlt-receive"
+SIZE_MB=1024
+MODES="line bulk"
+PORT=13500
+WORKDIR="/tmp/dlt-adaptor-stdin-benchmark"
+
+usage()
+{
+    echo "Usage: $0 [-a dlt-adaptor-stdin] [-d dlt-daemon] [-R dlt-receive] [-s size_mb] [-m modes] [-p port] [-w workdir]"
+    echo "  -a  dlt-adaptor-stdin binary to use (default: dlt-adaptor-stdin from PATH)"
+    echo "  -d  dlt-daemon binary to use (default: dlt-daemon from PATH)"
+    echo "  -R  dlt-receive binary to use (default: dlt-receive from PATH)"
+    echo "  -s  size of the text file in MB (default: ${SIZE_MB})"
+    echo "  -m  modes to measure (default: \"${MODES}\")"
+    echo "  -p  TCP port of the dlt-daemon (default: ${PORT})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "a:d:R:s:m:p:w:h" opt; do
+    case $opt in
+        a) DLT_ADAPTOR="$OPTARG" ;;
+        d) DLT_DAEMON="$OPTARG" ;;
+        R) DLT_RECEIVE="$OPTARG" ;;
+        s) SIZE_MB="$OPTARG" ;;
+        m) MODES="$OPTARG" ;;
+        p) PORT="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+PIDS=()
+
+################################################################################
+# Function:    -cleanup()
+#
+# Description  -Stop all processes started by the benchmark
+#
+cleanup()
+{
+    local pid
+
+    for pid in "${PIDS[@]}"; do
+        kill "$pid" 2> /dev/null
+    done
+
+    wait 2> /dev/null
+    PIDS=()
+}
+
+trap cleanup EXIT
+
+################################################################################
+# Function:    -received()
+#
+# Description  -Print the number of adaptor messages dlt-receive got so far
+#
+received()
+{
+    local lines
+
+    kill -USR1 "$RECEIVE_PID" 2> /dev/null
+    sleep 0.1
+    lines=$(grep -c "" "${WORKDIR}/receive.log")
+    awk -v lines="$lines" 'NR == lines { print $8 }' "${WORKDIR}/receive.log"
+}
+
+################################################################################
+# Function:    -create_input()
+#
+# Description  -Write the text file: lines of 20 to 200 characters, a block
+#               of 1 MB is repeated up to the requested size
+#
+create_input()
+{
+    local i
+
+    awk 'BEGIN {
+        srand(1)
+        size = 0
+        while (size < 1048576) {
+            line = sprintf("%08d tool output", NR++)
+            len = 20 + int(rand() * 180)
+            while (length(line) < len)
+                line = line " word" int(rand() * 1000)
+            line = substr(line, 1, len)
+            print line
+            size += len + 1
+        }
+    }' > "${WORKDIR}/block.txt"
+
+    : > "${WORKDIR}/input.txt"
+
+    for ((i = 0; i < SIZE_MB; i++)); do
+        cat "${WORKDIR}/block.txt"
+    done >> "${WORKDIR}/input.txt"
+}
+
+rm -rf "$WORKDIR"
+mkdir -p "$WORKDIR" || exit 1
+
+create_input
+EXPECTED=$(grep -c "" "${WORKDIR}/input.txt")
+
+cat > "${WORKDIR}/dlt.conf" << EOF
+ControlSocketPath=${WORKDIR}/dlt-ctrl.sock
+LoggingMode=2
+LoggingFilename=${WORKDIR}/dlt-daemon.log
+RingbufferMinSize=500000
+RingbufferMaxSize=10000000
+RingbufferStepSize=500000
+EOF
+
+echo "SINA SINC" > "${WORKDIR}/filter.txt"
+
+for mode in $MODES; do
+    case $mode in
+        line) flags="-b" ;;
+        bulk) flags="-b -B" ;;
+        *) echo "Unknown mode $mode"; exit 1 ;;
+    esac
+
+    "$DLT_DAEMON" -c "${WORKDIR}/dlt.conf" -p "$PORT" > /dev/null 2>&1 &
+    PIDS+=($!)
+    sleep 1
+
+    "$DLT_RECEIVE" -M -f "${WORKDIR}/filter.txt" -o /dev/null "tcp:127.0.0.1:${PORT}" > /dev/null 2> "${WORKDIR}/receive.log" &
+    RECEIVE_PID=$!
+    PIDS+=($RECEIVE_PID)
+    sleep 1
+
+    start=$(date +%s.%N)
+    TIMEFORMAT="%U %S"
+    { time "$DLT_ADAPTOR" $flags < "${WORKDIR}/input.txt" > /dev/null 2>&1 ; } 2> "${WORKDIR}/time.txt"
+    read_end=$(date +%s.%N)
+    cpu=$(awk '{ printf "%.2f", $1 + $2 }' "${WORKDIR}/time.txt")
+
+    # the rest is still on its way through the daemon
+    count=0
+    end=$read_end
+    idle=0
+
+    while [ "${count:-0}" -lt "$EXPECTED" ] && [ "$idle" -lt 20 ]; do
+        last=${count:-0}
+        count=$(received)
+
+        if [ "${count:-0}" -gt "$last" ]; then
+            end=$(date +%s.%N)
+            idle=0
+        else
+            idle=$((idle + 1))
+        fi
+    done
+
+    cleanup
+
+    awk -v mode="$mode" -v start="$start" -v read_end="$read_end" -v end="$end" -v count="${count:-0}" \
+        -v expected="$EXPECTED" -v cpu="$cpu" -v mb="$SIZE_MB" \
+        'BEGIN { printf "dlt-adaptor-stdin %-4s  read %8.2f s  %7.1f MB/s  received %8.2f s  %s of %s lines  cpu %s s\n",
+                 mode, read_end - start, mb / (read_end - start), end - start, count, expected, cpu }'
+done
+
+exit 0
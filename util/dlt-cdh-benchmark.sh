@@ -0,0 +1,186 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-cdh-benchmark.sh
+#
+#Description     : Measure how long dlt-cdh needs to write a coredump. A
+#                  synthetic ELF core of the given size is created: a
+#                  NT_PRSTATUS note and PT_LOAD segments, filled with a mix of
+#                  zero, text and random pages. It is piped to dlt-cdh like
+#                  the kernel does, for a sleeping process which stands in for
+#                  the crashed one. The time until dlt-cdh exits, the
+#                  throughput and the size of the compressed core are printed,
+#                  and the unpacked core is compared with the input.
+#                  With -m sparse dlt-cdh writes a sparse coredump
+#                  (CoreDumpMode = 1), the unpacked core is checked for the
+#                  note which lists the skipped memory ranges instead.
+#                  dlt-cdh writes to /var/core, so the benchmark must run as
+#                  root. The files it creates there are removed again.
+#
+#Usage           : dlt-cdh-benchmark.sh [-c dlt-cdh] [-s size_mb] [-m mode]
+#                  [-w workdir]
+################################################################################
+DLT_CDH="dlt-cdh"
+SIZE_MB=1024
+MODE="full"
+WORKDIR="/tmp/dlt-cdh-benchmark"
+CORE_DIRECTORY="/var/core"
+
+usage()
+{
+    echo "Usage: $0 [-c dlt-cdh] [-s size_mb] [-m mode] [-w workdir]"
+    echo "  -c  dlt-cdh binary to use (default: dlt-cdh from PATH)"
+    echo "  -s  size of the core in MB (default: ${SIZE_MB})"
+    echo "  -m  full or sparse coredump (default: ${MODE})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "c:s:m:w:h" opt; do
+    case $opt in
+        c) DLT_CDH="$OPTARG" ;;
+        s) SIZE_MB="$OPTARG" ;;
+        m) MODE="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+################################################################################
+# Function:    -create_core()
+#
+# Description  -Write a synthetic ELF core of SIZE_MB MB to the work directory
+#
+create_core()
+{
+    python3 - "$SIZE_MB" "${WORKDIR}/core" << 'EOF'
+import os
+import struct
+import sys
+
+size_mb = int(sys.argv[1])
+segment_mb = 64
+page = 4096
+chunk = 1024 * 1024
+
+segments = max(1, size_mb // segment_mb)
+phnum = 1 + segments
+
+# NT_PRSTATUS of x86_64: pr_pid at 32, pr_reg at 112, rip is register 16
+desc = bytearray(336)
+base = 0x400000
+struct.pack_into("<i", desc, 32, 4242)
+struct.pack_into("<Q", desc, 112 + 16 * 8, base + 0x1234)
+struct.pack_into("<Q", desc, 112 + 19 * 8, base + segment_mb * chunk - 0x100)
+note = struct.pack("<III", 5, len(desc), 1) + b"CORE\0\0\0\0" + bytes(desc)
+
+note_offset = 64 + phnum * 56
+data_offset = (note_offset + len(note) + page - 1) // page * page
+
+phdrs = struct.pack("<IIQQQQQQ", 4, 0, note_offset, 0, 0, len(note), 0, 1)
+
+for i in range(segments):
+    phdrs += struct.pack("<IIQQQQQQ", 1, 6, data_offset + i * segment_mb * chunk,
+                         base + i * segment_mb * chunk, 0, segment_mb * chunk, segment_mb * chunk, page)
+
+ehdr = b"\x7fELF" + bytes([2, 1, 1, 0]) + bytes(8)
+ehdr += struct.pack("<HHIQQQIHHHHHH", 4, 62, 1, 0, 64, 0, 0, 64, 56, phnum, 64, 0, 0)
+
+zero = bytes(chunk)
+line = b"heap object 00000001: name=session value=0x00000002 state=idle\n"
+text = (line * (chunk // len(line) + 1))[:chunk]
+rand = os.urandom(chunk)
+pattern = [zero, text, rand, zero, text, zero, text, zero]
+
+with open(sys.argv[2], "wb") as f:
+    f.write(ehdr + phdrs + note)
+    f.write(bytes(data_offset - f.tell()))
+
+    for i in range(segments * segment_mb):
+        f.write(pattern[i % len(pattern)])
+EOF
+}
+
+case $MODE in
+    full) CORE_DUMP_MODE=0 ;;
+    sparse) CORE_DUMP_MODE=1 ;;
+    *) usage; exit 1 ;;
+esac
+
+if [ "$(id -u)" -ne 0 ]; then
+    echo "ERROR: dlt-cdh writes to ${CORE_DIRECTORY}, run as root"
+    exit 1
+fi
+
+rm -rf "$WORKDIR"
+mkdir -p "$WORKDIR" || exit 1
+
+create_core || exit 1
+CORE_SIZE=$(stat -c %s "${WORKDIR}/core")
+
+echo "CoreDumpMode = ${CORE_DUMP_MODE}" > "${WORKDIR}/dlt-cdh.conf"
+
+# stands in for the crashed process, dlt-cdh reads its /proc entries
+sleep 600 &
+PID=$!
+TIMESTAMP=$(date +%s)
+
+# the page cache is warm, so the input side costs as little as possible
+cat "${WORKDIR}/core" > /dev/null
+
+start=$(date +%s.%N)
+TIMEFORMAT="%U %S"
+{ time cat "${WORKDIR}/core" | "$DLT_CDH" "$TIMESTAMP" "$PID" 11 sleep "${WORKDIR}/dlt-cdh.conf" ; } 2> "${WORKDIR}/time.txt"
+end=$(date +%s.%N)
+
+kill "$PID" 2> /dev/null
+wait 2> /dev/null
+
+OUTPUT=$(ls "${CORE_DIRECTORY}"/core."${TIMESTAMP}".*."${PID}".gz 2> /dev/null | head -1)
+
+if [ -z "$OUTPUT" ]; then
+    echo "ERROR: no coredump written to ${CORE_DIRECTORY}"
+    exit 1
+fi
+
+OUTPUT_SIZE=$(stat -c %s "$OUTPUT")
+
+if [ "$MODE" = "full" ]; then
+    if zcat "$OUTPUT" | cmp -s - "${WORKDIR}/core"; then
+        result="identical"
+    else
+        result="DIFFERENT"
+    fi
+else
+    zcat "$OUTPUT" > "${WORKDIR}/sparse-core"
+
+    if readelf -n "${WORKDIR}/sparse-core" 2> /dev/null | grep -q "DLTCDH.*0x44430001"; then
+        result="sparse $(awk '{ printf "%.1f MB", $1 / 1048576 }' <<< "$(stat -c %s "${WORKDIR}/sparse-core")")"
+    else
+        result="INVALID"
+    fi
+
+    rm -f "${WORKDIR}/sparse-core"
+fi
+
+rm -f "${CORE_DIRECTORY}"/core."${TIMESTAMP}".*."${PID}".gz "${CORE_DIRECTORY}"/context."${TIMESTAMP}".*."${PID}".txt
+
+awk -v start="$start" -v end="$end" -v size="$CORE_SIZE" -v out="$OUTPUT_SIZE" -v result="$result" \
+    -v cpu="$(awk '{ printf "%.2f", $1 + $2 }' "${WORKDIR}/time.txt")" \
+    -v mode="$MODE" \
+    'BEGIN { printf "dlt-cdh %-6s %8.2f s  %7.1f MB/s  core %.0f MB  compressed %.1f MB  cpu %s s  unpacked core %s\n",
+             mode, end - start, size / 1048576 / (end - start), size / 1048576, out / 1048576, cpu, result }'
+
+[ "$result" != "DIFFERENT" ] && [ "$result" != "INVALID" ]
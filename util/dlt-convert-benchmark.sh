@@ -0,0 +1,137 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-convert-benchmark.sh
+#
+#Description     : Compare sequential and parallel (-j) conversion of a
+#                  synthetic multi-GB DLT trace to ASCII with dlt-convert.
+#                  The trace is created by concatenating a source DLT file
+#                  until the requested size is reached. Both outputs are
+#                  compared to make sure the parallel output is ordered.
+#
+#Usage           : dlt-convert-benchmark.sh [-c dlt-convert] [-s size in MB]
+#                  [-i source.dlt] [-j threads] [-k] [-w workdir]
+################################################################################
+BASEDIR="$(realpath "$(dirname "$0")")"
+DLT_CONVERT="dlt-convert"
+SIZE_MB=2048
+SOURCE="${BASEDIR}/../tests/testfile.dlt"
+JOBS="$(nproc)"
+KEEP=0
+WORKDIR="/tmp"
+
+usage()
+{
+    echo "Usage: $0 [-c dlt-convert] [-s size in MB] [-i source.dlt] [-j threads] [-k] [-w workdir]"
+    echo "  -c  dlt-convert binary to use (default: dlt-convert from PATH)"
+    echo "  -s  size of the synthetic trace in MB (default: ${SIZE_MB})"
+    echo "  -i  DLT file the trace is created from (default: tests/testfile.dlt)"
+    echo "  -j  number of threads for the parallel run (default: number of CPUs)"
+    echo "  -k  keep the synthetic trace and the outputs"
+    echo "  -w  directory for the trace and the outputs (default: ${WORKDIR})"
+}
+
+while getopts "c:s:i:j:kw:h" opt; do
+    case $opt in
+        c) DLT_CONVERT="$OPTARG" ;;
+        s) SIZE_MB="$OPTARG" ;;
+        i) SOURCE="$OPTARG" ;;
+        j) JOBS="$OPTARG" ;;
+        k) KEEP=1 ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+TRACE="${WORKDIR}/dlt-convert-benchmark.dlt"
+OUT_SEQ="${WORKDIR}/dlt-convert-benchmark-seq.txt"
+OUT_PAR="${WORKDIR}/dlt-convert-benchmark-par.txt"
+
+if [ ! -f "$SOURCE" ]; then
+    echo "ERROR: source file $SOURCE not found"
+    exit 1
+fi
+
+################################################################################
+# Function:    -create_trace()
+#
+# Description  -Concatenate the source file until the trace has the requested
+#               size. The content is doubled in every step to be fast.
+#
+create_trace()
+{
+    local target=$((SIZE_MB * 1024 * 1024))
+    local size
+
+    cp "$SOURCE" "$TRACE" || exit 1
+    size=$(stat -c %s "$TRACE")
+
+    while [ "$size" -lt "$target" ]; do
+        if [ $((size * 2)) -le "$target" ]; then
+            cat "$TRACE" "$TRACE" > "${TRACE}.tmp" || exit 1
+            mv "${TRACE}.tmp" "$TRACE"
+        else
+            cat "$SOURCE" >> "$TRACE" || exit 1
+        fi
+        size=$(stat -c %s "$TRACE")
+    done
+}
+
+################################################################################
+# Function:    -run()
+#
+# Description  -Convert the trace to ASCII and print the elapsed time
+#
+run()
+{
+    local name="$1"
+    local output="$2"
+    shift 2
+    local start end
+
+    start=$(date +%s.%N)
+    "$DLT_CONVERT" "$@" -a "$TRACE" > "$output" 2> /dev/null
+    end=$(date +%s.%N)
+
+    awk -v name="$name" -v start="$start" -v end="$end" 'BEGIN { printf "%-24s %8.2f s\n", name, end - start }'
+}
+
+if [ ! -f "$TRACE" ]; then
+    echo "Creating ${SIZE_MB} MB trace ${TRACE} from ${SOURCE}"
+    create_trace
+fi
+
+echo "Trace: $(stat -c %s "$TRACE") bytes, $("$DLT_CONVERT" -M -c "$TRACE" | sed -n 's/Total number of messages: //p') messages"
+
+# read the trace once, so that both runs start with a warm page cache
+cat "$TRACE" > /dev/null
+
+run "sequential" "$OUT_SEQ"
+run "parallel (-j ${JOBS})" "$OUT_PAR" -j "$JOBS"
+
+if cmp -s "$OUT_SEQ" "$OUT_PAR"; then
+    echo "Outputs are identical"
+    RESULT=0
+else
+    echo "ERROR: outputs differ"
+    RESULT=1
+fi
+
+if [ "$KEEP" -eq 0 ]; then
+    rm -f "$TRACE" "$OUT_SEQ" "$OUT_PAR"
+fi
+
+exit $RESULT
@@ -0,0 +1,240 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-gateway-benchmark.sh
+#
+#Description     : Measure how fast a dlt-daemon in gateway mode forwards the
+#                  messages of its passive nodes. A number of fake passive
+#                  nodes is started, each of them a small python server which
+#                  sends a fixed number of log messages with its own ECU id as
+#                  fast as possible. The gateway daemon connects to all of
+#                  them and forwards their messages to a dlt-receive in
+#                  collector mode, which counts them. The time from the start
+#                  of sending until all messages arrived is printed. If a
+#                  reference dlt-daemon is given, e.g. built from an older
+#                  version, it is measured as well.
+#                  The daemons are started with FIFO IPC in the work
+#                  directory (-t), so no other daemon is disturbed.
+#
+#Usage           : dlt-gateway-benchmark.sh [-d dlt-daemon] [-R dlt-receive]
+#                  [-r reference] [-n nodes] [-m messages] [-l length]
+#                  [-p port] [-a address] [-w workdir]
+################################################################################
+DLT_DAEMON="dlt-daemon"
+DLT_RECEIVE="dlt-receive"
+REFERENCE=""
+NODES=8
+MESSAGES=200000
+LENGTH=64
+PORT=13490
+ADDRESS="::1"
+WORKDIR="/tmp/dlt-gateway-benchmark"
+TIMEOUT=120
+
+usage()
+{
+    echo "Usage: $0 [-d dlt-daemon] [-R dlt-receive] [-r reference] [-n nodes] [-m messages] [-l length] [-p port] [-a address] [-w workdir]"
+    echo "  -d  dlt-daemon binary to use (default: dlt-daemon from PATH)"
+    echo "  -R  dlt-receive binary to use (default: dlt-receive from PATH)"
+    echo "  -r  reference dlt-daemon binary to compare with (default: none)"
+    echo "  -n  number of passive nodes (default: ${NODES})"
+    echo "  -m  number of messages sent by every passive node (default: ${MESSAGES})"
+    echo "  -l  payload length of the messages in bytes (default: ${LENGTH})"
+    echo "  -p  first TCP port, the passive nodes use the following ones (default: ${PORT})"
+    echo "  -a  address of the passive nodes, IPv6 unless dlt-daemon is built without DLT_USE_IPv6 (default: ${ADDRESS})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "d:R:r:n:m:l:p:a:w:h" opt; do
+    case $opt in
+        d) DLT_DAEMON="$OPTARG" ;;
+        R) DLT_RECEIVE="$OPTARG" ;;
+        r) REFERENCE="$OPTARG" ;;
+        n) NODES="$OPTARG" ;;
+        m) MESSAGES="$OPTARG" ;;
+        l) LENGTH="$OPTARG" ;;
+        p) PORT="$OPTARG" ;;
+        a) ADDRESS="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+TRIGGER="${WORKDIR}/start"
+PIDS=()
+
+################################################################################
+# Function:    -cleanup()
+#
+# Description  -Stop all processes started by the benchmark
+#
+cleanup()
+{
+    local pid
+
+    for pid in "${PIDS[@]}"; do
+        kill "$pid" 2> /dev/null
+    done
+
+    wait 2> /dev/null
+    PIDS=()
+}
+
+trap cleanup EXIT
+
+################################################################################
+# Function:    -start_node()
+#
+# Description  -Start a fake passive node on a port. It waits for a connection
+#               and the trigger file, sends its messages and keeps the
+#               connection open until it is stopped.
+#
+start_node()
+{
+    local port="$1"
+    local ecu="$2"
+
+    python3 - "$ADDRESS" "$port" "$ecu" "$MESSAGES" "$LENGTH" "$TRIGGER" << 'EOF' &
+import os, socket, struct, sys, time
+
+address, port, ecu, count, length, trigger = (sys.argv[1], int(sys.argv[2]), sys.argv[3].encode(),
+                                              int(sys.argv[4]), int(sys.argv[5]), sys.argv[6])
+server = socket.socket(socket.AF_INET6 if ":" in address else socket.AF_INET, socket.SOCK_STREAM)
+server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+server.bind((address, port))
+server.listen(1)
+
+# version 1, extended header, ECU id and timestamp
+htyp = 0x20 | 0x01 | 0x04 | 0x10
+size = 4 + 4 + 4 + 10 + 4 + length
+# non verbose info log message
+extended = bytes([0x40, 0]) + b"BNCH" + b"TEST"
+payload = bytes(length)
+batch = b"".join(struct.pack(">BBH", htyp, n & 0xff, size) + ecu + struct.pack(">I", n) + extended +
+                 struct.pack("<I", n) + payload for n in range(256))
+
+while True:
+    con, _ = server.accept()
+
+    while not os.path.exists(trigger):
+        time.sleep(0.01)
+
+    sent = 0
+
+    while sent < count:
+        n = min(256, count - sent)
+        con.sendall(batch if n == 256 else batch[:n * size])
+        sent += n
+
+    while True:
+        time.sleep(1)
+EOF
+    PIDS+=($!)
+}
+
+################################################################################
+# Function:    -received()
+#
+# Description  -Print the number of messages dlt-receive got so far
+#
+received()
+{
+    local lines
+
+    kill -USR1 "$RECEIVE_PID" 2> /dev/null
+    sleep 0.1
+    lines=$(grep -c "" "${WORKDIR}/receive.log")
+    awk -v lines="$lines" 'NR == lines { print $6 }' "${WORKDIR}/receive.log"
+}
+
+################################################################################
+# Function:    -run()
+#
+# Description  -Start the passive nodes, the gateway daemon and dlt-receive,
+#               trigger the sending and print the elapsed time
+#
+run()
+{
+    local name="$1"
+    local daemon="$2"
+    local expected=$((NODES * MESSAGES))
+    local gateway="${WORKDIR}/dlt_gateway.conf"
+    local i count start end deadline
+
+    rm -rf "$WORKDIR"
+    mkdir -p "$WORKDIR" || exit 1
+
+    printf "[General]\nInterval=1\n" > "$gateway"
+
+    for i in $(seq 1 "$NODES"); do
+        printf "\n[PassiveNode%d]\nIPaddress=%s\nPort=%d\nEcuID=E%03d\nTimeout=0\n" \
+            "$i" "$ADDRESS" $((PORT + i)) "$i" >> "$gateway"
+        start_node $((PORT + i)) "$(printf "E%03d" "$i")"
+    done
+
+    cat > "${WORKDIR}/dlt.conf" << EOF
+GatewayMode=1
+GatewayConfigFile=${gateway}
+ControlSocketPath=${WORKDIR}/dlt-ctrl.sock
+LoggingMode=2
+LoggingFilename=${WORKDIR}/dlt-daemon.log
+RingbufferMinSize=500000
+RingbufferMaxSize=10000000
+RingbufferStepSize=500000
+EOF
+
+    "$daemon" -c "${WORKDIR}/dlt.conf" -p "$PORT" -t "$WORKDIR" > /dev/null 2>&1 &
+    PIDS+=($!)
+    sleep 1
+
+    "$DLT_RECEIVE" -M -o /dev/null "tcp:127.0.0.1:${PORT}" 2> "${WORKDIR}/receive.log" &
+    RECEIVE_PID=$!
+    PIDS+=($RECEIVE_PID)
+
+    # give the gateway time to connect to all passive nodes
+    sleep 3
+
+    start=$(date +%s.%N)
+    touch "$TRIGGER"
+    deadline=$(($(date +%s) + TIMEOUT))
+    count=0
+
+    while [ "${count:-0}" -lt "$expected" ] && [ "$(date +%s)" -lt "$deadline" ]; do
+        count=$(received)
+    done
+
+    end=$(date +%s.%N)
+    cleanup
+
+    awk -v name="$name" -v start="$start" -v end="$end" -v count="${count:-0}" -v expected="$expected" \
+        'BEGIN { printf "%-24s %8.2f s  %s of %s messages  %.0f msgs/s\n",
+                 name, end - start, count, expected, count / (end - start) }'
+
+    if [ "${count:-0}" -lt "$expected" ]; then
+        echo "ERROR: not all messages received within ${TIMEOUT} s"
+        RESULT=1
+    fi
+}
+
+RESULT=0
+
+run "gateway" "$DLT_DAEMON"
+
+if [ -n "$REFERENCE" ]; then
+    run "reference gateway" "$REFERENCE"
+fi
+
+exit $RESULT
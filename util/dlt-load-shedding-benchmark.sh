@@ -0,0 +1,146 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-load-shedding-benchmark.sh
+#
+#Description     : Show what the load shedding of the dlt-daemon (LoadShedding)
+#                  keeps when the daemon is overloaded. Three applications log
+#                  while no client is connected, so everything goes to a small
+#                  ring buffer: VERB floods with verbose messages, INFO logs
+#                  info messages and ERRS logs a few errors. Afterwards
+#                  dlt-receive connects and the messages received per
+#                  application and the sum of the "messages shed" summaries of
+#                  the daemon are printed. Without load shedding the buffer runs full and
+#                  later errors are lost, with load shedding the verbose and
+#                  info messages are shed first.
+#                  The applications use the default IPC path, so no other
+#                  dlt-daemon may run while the benchmark runs.
+#
+#Usage           : dlt-load-shedding-benchmark.sh [-d dlt-daemon]
+#                  [-u dlt-example-user] [-R dlt-receive] [-C dlt-convert]
+#                  [-n messages] [-m "off on"] [-p port] [-w workdir]
+################################################################################
+DLT_DAEMON="dlt-daemon"
+DLT_USER="dlt-example-user"
+DLT_RECEIVE="dlt-receive"
+DLT_CONVERT="dlt-convert"
+MESSAGES=10000
+MODES="off on"
+PORT=13500
+WORKDIR="/tmp/dlt-load-shedding-benchmark"
+
+usage()
+{
+    echo "Usage: $0 [-d dlt-daemon] [-u dlt-example-user] [-R dlt-receive] [-C dlt-convert] [-n messages] [-m modes] [-p port] [-w workdir]"
+    echo "  -d  dlt-daemon binary to use (default: dlt-daemon from PATH)"
+    echo "  -u  dlt-example-user binary to use (default: dlt-example-user from PATH)"
+    echo "  -R  dlt-receive binary to use (default: dlt-receive from PATH)"
+    echo "  -C  dlt-convert binary to use (default: dlt-convert from PATH)"
+    echo "  -n  verbose messages of VERB, INFO logs a half and ERRS a hundredth (default: ${MESSAGES})"
+    echo "  -m  modes to measure (default: \"${MODES}\")"
+    echo "  -p  TCP port of the dlt-daemon (default: ${PORT})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "d:u:R:C:n:m:p:w:h" opt; do
+    case $opt in
+        d) DLT_DAEMON="$OPTARG" ;;
+        u) DLT_USER="$OPTARG" ;;
+        R) DLT_RECEIVE="$OPTARG" ;;
+        C) DLT_CONVERT="$OPTARG" ;;
+        n) MESSAGES="$OPTARG" ;;
+        m) MODES="$OPTARG" ;;
+        p) PORT="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+PIDS=()
+
+################################################################################
+# Function:    -cleanup()
+#
+# Description  -Stop all processes started by the benchmark
+#
+cleanup()
+{
+    local pid
+
+    for pid in "${PIDS[@]}"; do
+        kill "$pid" 2> /dev/null
+    done
+
+    wait 2> /dev/null
+    PIDS=()
+}
+
+trap cleanup EXIT
+
+rm -rf "$WORKDIR"
+mkdir -p "$WORKDIR" || exit 1
+
+for mode in $MODES; do
+    case $mode in
+        off) shedding=0 ;;
+        on) shedding=1 ;;
+        *) echo "Unknown mode $mode"; exit 1 ;;
+    esac
+
+    cat > "${WORKDIR}/dlt.conf" << EOF
+ControlSocketPath=${WORKDIR}/dlt-ctrl.sock
+LoggingMode=2
+LoggingFilename=${WORKDIR}/dlt-daemon.log
+ContextLogLevel=6
+RingbufferMinSize=1000000
+RingbufferMaxSize=1000000
+RingbufferStepSize=500000
+LoadShedding=${shedding}
+EOF
+
+    "$DLT_DAEMON" -c "${WORKDIR}/dlt.conf" -p "$PORT" > /dev/null 2>&1 &
+    PIDS+=($!)
+    sleep 1
+
+    start=$(date +%s.%N)
+    "$DLT_USER" -A VERB -l 6 -d 1 -n "$MESSAGES" -r 200 > /dev/null 2>&1 &
+    verb=$!
+    "$DLT_USER" -A INFO -l 4 -d 2 -n $((MESSAGES / 2)) -r 200 > /dev/null 2>&1 &
+    info=$!
+    "$DLT_USER" -A ERRS -l 2 -d 100 -n $((MESSAGES / 100)) error > /dev/null 2>&1
+    wait "$verb" "$info"
+    end=$(date +%s.%N)
+
+    # the daemon reports what was shed in the last second
+    sleep 2
+
+    "$DLT_RECEIVE" -o "${WORKDIR}/receive-${mode}.dlt" -p "$PORT" 127.0.0.1 > /dev/null 2>&1 &
+    PIDS+=($!)
+    sleep 3
+    cleanup
+
+    out="${WORKDIR}/receive-${mode}.txt"
+    "$DLT_CONVERT" -a "${WORKDIR}/receive-${mode}.dlt" > "$out"
+    shed=$(grep -o "[0-9]* messages shed for app" "$out" | awk '{ n += $1 } END { print n + 0 }')
+
+    awk -v mode="$mode" -v start="$start" -v end="$end" -v n="$MESSAGES" -v shed="$shed" \
+        -v verb="$(grep -c ' VERB TEST ' "$out")" -v info="$(grep -c ' INFO TEST ' "$out")" \
+        -v errs="$(grep -c ' ERRS TEST ' "$out")" \
+        'BEGIN { printf "load shedding %-3s  %6.2f s  received VERB %d of %d  INFO %d of %d  ERRS %d of %d  reported shed %d\n",
+                 mode, end - start, verb, n, info, n / 2, errs, n / 100, shed }'
+done
+
+exit 0
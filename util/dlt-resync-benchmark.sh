@@ -0,0 +1,156 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-resync-benchmark.sh
+#
+#Description     : Measure how fast a corrupted DLT file is read, which is
+#                  dominated by the search for the next storage header after
+#                  corrupted data. The synthetic trace alternates a source DLT
+#                  file with blocks of random data. It is counted with
+#                  dlt-convert using stdio (dlt_file_read_header) and the
+#                  memory mapped reader. If a reference dlt-convert is given,
+#                  e.g. built from an older version, it is measured as well and
+#                  the message counts are compared.
+#
+#Usage           : dlt-resync-benchmark.sh [-c dlt-convert] [-r reference]
+#                  [-s size in MB] [-g garbage in KB] [-i source.dlt] [-k]
+#                  [-w workdir]
+################################################################################
+BASEDIR="$(realpath "$(dirname "$0")")"
+DLT_CONVERT="dlt-convert"
+REFERENCE=""
+SIZE_MB=1024
+GARBAGE_KB=64
+SOURCE="${BASEDIR}/../tests/testfile.dlt"
+KEEP=0
+WORKDIR="/tmp"
+
+usage()
+{
+    echo "Usage: $0 [-c dlt-convert] [-r reference] [-s size in MB] [-g garbage in KB] [-i source.dlt] [-k] [-w workdir]"
+    echo "  -c  dlt-convert binary to use (default: dlt-convert from PATH)"
+    echo "  -r  reference dlt-convert binary to compare with (default: none)"
+    echo "  -s  size of the synthetic trace in MB (default: ${SIZE_MB})"
+    echo "  -g  size of the random data after every copy of the source in KB (default: ${GARBAGE_KB})"
+    echo "  -i  DLT file the trace is created from (default: tests/testfile.dlt)"
+    echo "  -k  keep the synthetic trace"
+    echo "  -w  directory for the trace (default: ${WORKDIR})"
+}
+
+while getopts "c:r:s:g:i:kw:h" opt; do
+    case $opt in
+        c) DLT_CONVERT="$OPTARG" ;;
+        r) REFERENCE="$OPTARG" ;;
+        s) SIZE_MB="$OPTARG" ;;
+        g) GARBAGE_KB="$OPTARG" ;;
+        i) SOURCE="$OPTARG" ;;
+        k) KEEP=1 ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+TRACE="${WORKDIR}/dlt-resync-benchmark.dlt"
+
+if [ ! -f "$SOURCE" ]; then
+    echo "ERROR: source file $SOURCE not found"
+    exit 1
+fi
+
+################################################################################
+# Function:    -create_trace()
+#
+# Description  -Append the source file and a block of random data until the
+#               trace has the requested size. The content is doubled in every
+#               step to be fast.
+#
+create_trace()
+{
+    local target=$((SIZE_MB * 1024 * 1024))
+    local size
+
+    cp "$SOURCE" "$TRACE" || exit 1
+    head -c $((GARBAGE_KB * 1024)) /dev/urandom >> "$TRACE" || exit 1
+    size=$(stat -c %s "$TRACE")
+
+    while [ "$size" -lt "$target" ]; do
+        if [ $((size * 2)) -le "$target" ]; then
+            cat "$TRACE" "$TRACE" > "${TRACE}.tmp" || exit 1
+            mv "${TRACE}.tmp" "$TRACE"
+        else
+            head -c $((target - size)) "$TRACE" > "${TRACE}.tmp" || exit 1
+            cat "${TRACE}.tmp" >> "$TRACE"
+            rm -f "${TRACE}.tmp"
+        fi
+        size=$(stat -c %s "$TRACE")
+    done
+}
+
+################################################################################
+# Function:    -run()
+#
+# Description  -Count the messages of the trace, print the elapsed time and
+#               remember the number of messages in COUNT
+#
+run()
+{
+    local name="$1"
+    local binary="$2"
+    shift 2
+    local start end
+
+    start=$(date +%s.%N)
+    COUNT=$("$binary" "$@" -c "$TRACE" 2> /dev/null | sed -n 's/Total number of messages: //p')
+    end=$(date +%s.%N)
+
+    awk -v name="$name" -v start="$start" -v end="$end" -v count="$COUNT" \
+        'BEGIN { printf "%-24s %8.2f s  %s messages\n", name, end - start, count }'
+}
+
+if [ ! -f "$TRACE" ]; then
+    echo "Creating ${SIZE_MB} MB trace ${TRACE} from ${SOURCE} with ${GARBAGE_KB} KB random data per copy"
+    create_trace
+fi
+
+# read the trace once, so that all runs start with a warm page cache
+cat "$TRACE" > /dev/null
+
+RESULT=0
+
+run "stdio" "$DLT_CONVERT"
+COUNT_STDIO="$COUNT"
+run "mmap (-M)" "$DLT_CONVERT" -M
+COUNT_MMAP="$COUNT"
+
+if [ "$COUNT_STDIO" != "$COUNT_MMAP" ]; then
+    echo "ERROR: message counts differ"
+    RESULT=1
+fi
+
+if [ -n "$REFERENCE" ]; then
+    run "reference stdio" "$REFERENCE"
+
+    if [ "$COUNT" != "$COUNT_STDIO" ]; then
+        echo "ERROR: message count differs from reference"
+        RESULT=1
+    fi
+fi
+
+if [ "$KEEP" -eq 0 ]; then
+    rm -f "$TRACE"
+fi
+
+exit $RESULT
@@ -0,0 +1,199 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-system-journal-benchmark.sh
+#
+#Description     : Measure how fast the journal adapter of dlt-system forwards
+#                  the entries of a journal file. dlt-system reads the file
+#                  given with -f (JournalFile, opened with
+#                  sd_journal_open_files) from its start and logs every entry,
+#                  dlt-receive in collector mode counts the messages of the
+#                  journal context. The time until all entries arrived, or
+#                  until no more arrived for 3 s if a rate limit is set, and
+#                  the CPU time used by dlt-system are printed.
+#                  A journal file can be taken from /var/log/journal, or
+#                  created with
+#                  journalctl -o export | systemd-journal-remote -o test.journal -
+#                  The library of dlt-system uses the default IPC path, so no
+#                  other dlt-daemon may run while the benchmark runs.
+#
+#Usage           : dlt-system-journal-benchmark.sh -f journal [-s dlt-system]
+#                  [-d dlt-daemon] [-R dlt-receive] [-i interval] [-b burst]
+#                  [-p port] [-w workdir]
+################################################################################
+DLT_SYSTEM="dlt-system"
+DLT_DAEMON="dlt-daemon"
+DLT_RECEIVE="dlt-receive"
+JOURNAL_FILE=""
+INTERVAL=0
+BURST=0
+PORT=13500
+WORKDIR="/tmp/dlt-system-journal-benchmark"
+TIMEOUT=300
+
+usage()
+{
+    echo "Usage: $0 -f journal [-s dlt-system] [-d dlt-daemon] [-R dlt-receive] [-i interval] [-b burst] [-p port] [-w workdir]"
+    echo "  -f  journal file to read"
+    echo "  -s  dlt-system binary to use (default: dlt-system from PATH)"
+    echo "  -d  dlt-daemon binary to use (default: dlt-daemon from PATH)"
+    echo "  -R  dlt-receive binary to use (default: dlt-receive from PATH)"
+    echo "  -i  JournalRateLimitInterval in seconds (default: ${INTERVAL})"
+    echo "  -b  JournalRateLimitBurst (default: ${BURST})"
+    echo "  -p  TCP port of the dlt-daemon (default: ${PORT})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "f:s:d:R:i:b:p:w:h" opt; do
+    case $opt in
+        f) JOURNAL_FILE="$OPTARG" ;;
+        s) DLT_SYSTEM="$OPTARG" ;;
+        d) DLT_DAEMON="$OPTARG" ;;
+        R) DLT_RECEIVE="$OPTARG" ;;
+        i) INTERVAL="$OPTARG" ;;
+        b) BURST="$OPTARG" ;;
+        p) PORT="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+if [ ! -r "$JOURNAL_FILE" ]; then
+    usage
+    exit 1
+fi
+
+JOURNAL_FILE=$(realpath "$JOURNAL_FILE")
+PIDS=()
+
+################################################################################
+# Function:    -cleanup()
+#
+# Description  -Stop all processes started by the benchmark
+#
+cleanup()
+{
+    local pid
+
+    for pid in "${PIDS[@]}"; do
+        kill "$pid" 2> /dev/null
+    done
+
+    wait 2> /dev/null
+    PIDS=()
+}
+
+trap cleanup EXIT
+
+################################################################################
+# Function:    -received()
+#
+# Description  -Print the number of journal messages dlt-receive got so far
+#
+received()
+{
+    local lines
+
+    kill -USR1 "$RECEIVE_PID" 2> /dev/null
+    sleep 0.1
+    lines=$(grep -c "" "${WORKDIR}/receive.log")
+    awk -v lines="$lines" 'NR == lines { print $8 }' "${WORKDIR}/receive.log"
+}
+
+################################################################################
+# Function:    -cpu_time()
+#
+# Description  -Print the user and system CPU time of a process in seconds
+#
+cpu_time()
+{
+    awk -v hz="$(getconf CLK_TCK)" '{ sub(/^.*\) /, ""); printf "%.2f", ($12 + $13) / hz }' "/proc/$1/stat"
+}
+
+rm -rf "$WORKDIR"
+mkdir -p "$WORKDIR" || exit 1
+
+EXPECTED=$(journalctl --file "$JOURNAL_FILE" -o json 2> /dev/null | grep -c "")
+
+# debug entries are logged too
+cat > "${WORKDIR}/dlt.conf" << EOF
+ContextLogLevel=6
+ControlSocketPath=${WORKDIR}/dlt-ctrl.sock
+LoggingMode=2
+LoggingFilename=${WORKDIR}/dlt-daemon.log
+RingbufferMinSize=500000
+RingbufferMaxSize=10000000
+RingbufferStepSize=500000
+EOF
+
+cat > "${WORKDIR}/dlt-system.conf" << EOF
+ApplicationId = SYS
+JournalEnable = 1
+JournalContextId = JOUR
+JournalCurrentBoot = 0
+JournalFollow = 0
+JournalFile = ${JOURNAL_FILE}
+JournalRateLimitInterval = ${INTERVAL}
+JournalRateLimitBurst = ${BURST}
+EOF
+
+echo "SYS JOUR" > "${WORKDIR}/filter.txt"
+
+"$DLT_DAEMON" -c "${WORKDIR}/dlt.conf" -p "$PORT" > /dev/null 2>&1 &
+PIDS+=($!)
+sleep 1
+
+"$DLT_RECEIVE" -M -f "${WORKDIR}/filter.txt" -o /dev/null "tcp:127.0.0.1:${PORT}" > /dev/null 2> "${WORKDIR}/receive.log" &
+RECEIVE_PID=$!
+PIDS+=($RECEIVE_PID)
+sleep 1
+
+start=$(date +%s.%N)
+DLT_INITIAL_LOG_LEVEL="SYS:JOUR:6" "$DLT_SYSTEM" -c "${WORKDIR}/dlt-system.conf" > "${WORKDIR}/dlt-system.log" 2>&1 &
+SYSTEM_PID=$!
+PIDS+=($SYSTEM_PID)
+
+deadline=$(($(date +%s) + TIMEOUT))
+count=0
+end=$start
+idle=0
+
+# with a rate limit not all entries arrive, stop when nothing arrived for 3 s
+while [ "${count:-0}" -lt "$EXPECTED" ] && [ "$(date +%s)" -lt "$deadline" ] && [ "$idle" -lt 30 ]; do
+    last=${count:-0}
+    count=$(received)
+
+    if [ "${count:-0}" -gt "$last" ]; then
+        end=$(date +%s.%N)
+        idle=0
+    elif [ "${count:-0}" -gt 0 ]; then
+        idle=$((idle + 1))
+    fi
+done
+
+cpu=$(cpu_time "$SYSTEM_PID")
+cleanup
+
+awk -v start="$start" -v end="$end" -v count="${count:-0}" -v expected="$EXPECTED" -v cpu="$cpu" \
+    'BEGIN { printf "dlt-system journal %8.2f s  %s of %s entries  %.0f msgs/s  cpu %s s\n",
+             end - start, count, expected, count / (end - start), cpu }'
+
+if [ "$INTERVAL" -eq 0 ] && [ "${count:-0}" -lt "$EXPECTED" ]; then
+    echo "ERROR: not all entries received"
+    exit 1
+fi
+
+exit 0
@@ -0,0 +1,138 @@
+#!/bin/bash
+################################################################################
+# SPDX license identifier: MPL-2.0
+#
+# Copyright (C) 2026, COVESA
+#
+# This file is part of COVESA Project DLT - Diagnostic Log and Trace.
+#
+# This Source Code Form is subject to the terms of the
+# Mozilla Public License (MPL), v. 2.0.
+# If a copy of the MPL was not distributed with this file,
+# You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# For further information see https://www.covesa.global/.
+################################################################################
+################################################################################
+#file            : dlt-trace-load-benchmark.sh
+#
+#Description     : Measure the cost of the trace load limits
+#                  (WITH_DLT_TRACE_LOAD_CTRL) for many threads. One process of
+#                  dlt-test-multi-process logs with the given number of threads,
+#                  each to its own context, as fast as it can. The dlt-daemon
+#                  gets a trace load configuration with the given limits for the
+#                  application. The time the threads need for their messages and
+#                  the CPU time of the application and the daemon are printed.
+#                  Run it with the binaries of two builds to compare them, the
+#                  library is taken from LD_LIBRARY_PATH.
+#                  The library uses the default IPC path, so no other dlt-daemon
+#                  may run while the benchmark runs.
+#
+#Usage           : dlt-trace-load-benchmark.sh [-d dlt-daemon]
+#                  [-T dlt-test-multi-process] [-t threads] [-m messages]
+#                  [-s soft_limit] [-H hard_limit] [-r runs] [-w workdir]
+################################################################################
+DLT_DAEMON="dlt-daemon"
+DLT_TEST="dlt-test-multi-process"
+THREADS=64
+MESSAGES=20000
+SOFT_LIMIT=1000000000
+HARD_LIMIT=2000000000
+RUNS=3
+WORKDIR="/tmp/dlt-trace-load-benchmark"
+
+usage()
+{
+    echo "Usage: $0 [-d dlt-daemon] [-T dlt-test-multi-process] [-t threads] [-m messages] [-s soft_limit] [-H hard_limit] [-r runs] [-w workdir]"
+    echo "  -d  dlt-daemon binary to use (default: dlt-daemon from PATH)"
+    echo "  -T  dlt-test-multi-process binary to use (default: from PATH)"
+    echo "  -t  number of threads, max 100 (default: ${THREADS})"
+    echo "  -m  messages per thread (default: ${MESSAGES})"
+    echo "  -s  soft limit of the application in bytes/s (default: ${SOFT_LIMIT})"
+    echo "  -H  hard limit of the application in bytes/s (default: ${HARD_LIMIT})"
+    echo "  -r  number of runs (default: ${RUNS})"
+    echo "  -w  work directory (default: ${WORKDIR})"
+}
+
+while getopts "d:T:t:m:s:H:r:w:h" opt; do
+    case $opt in
+        d) DLT_DAEMON="$OPTARG" ;;
+        T) DLT_TEST="$OPTARG" ;;
+        t) THREADS="$OPTARG" ;;
+        m) MESSAGES="$OPTARG" ;;
+        s) SOFT_LIMIT="$OPTARG" ;;
+        H) HARD_LIMIT="$OPTARG" ;;
+        r) RUNS="$OPTARG" ;;
+        w) WORKDIR="$OPTARG" ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+DAEMON_PID=""
+
+################################################################################
+# Function:    -cleanup()
+#
+# Description  -Stop the dlt-daemon started by the benchmark
+#
+cleanup()
+{
+    if [ -n "$DAEMON_PID" ]; then
+        kill "$DAEMON_PID" 2> /dev/null
+        wait "$DAEMON_PID" 2> /dev/null
+        DAEMON_PID=""
+    fi
+}
+
+trap cleanup EXIT
+
+################################################################################
+# Function:    -cpu_time()
+#
+# Description  -Print the CPU time of a process in seconds
+#
+cpu_time()
+{
+    awk -v hz="$(getconf CLK_TCK)" '{ sub(/^.*\) /, ""); printf "%.2f", ($12 + $13) / hz }' "/proc/$1/stat"
+}
+
+rm -rf "$WORKDIR"
+mkdir -p "$WORKDIR" || exit 1
+
+# the application of dlt-test-multi-process with a single process is MT00
+echo "MT00 ${SOFT_LIMIT} ${HARD_LIMIT}" > "${WORKDIR}/dlt-trace-load.conf"
+
+cat > "${WORKDIR}/dlt.conf" << EOF
+ControlSocketPath=${WORKDIR}/dlt-ctrl.sock
+LoggingMode=2
+LoggingFilename=${WORKDIR}/dlt-daemon.log
+RingbufferMinSize=500000
+RingbufferMaxSize=10000000
+RingbufferStepSize=500000
+EOF
+
+for ((run = 1; run <= RUNS; run++)); do
+    "$DLT_DAEMON" -c "${WORKDIR}/dlt.conf" -l "${WORKDIR}/dlt-trace-load.conf" > /dev/null 2>&1 &
+    DAEMON_PID=$!
+    sleep 1
+
+    if ! kill -0 "$DAEMON_PID" 2> /dev/null; then
+        echo "ERROR: dlt-daemon did not start, is it built with WITH_DLT_TRACE_LOAD_CTRL?"
+        exit 1
+    fi
+
+    start=$(date +%s.%N)
+    TIMEFORMAT="%U %S"
+    { time "$DLT_TEST" -p 1 -t "$THREADS" -m "$MESSAGES" -d 0 -f 0 -g > /dev/null 2>&1 ; } 2> "${WORKDIR}/time.txt"
+    end=$(date +%s.%N)
+
+    daemon_cpu=$(cpu_time "$DAEMON_PID")
+    cleanup
+
+    awk -v run="$run" -v start="$start" -v end="$end" -v threads="$THREADS" -v msgs="$MESSAGES" \
+        -v cpu="$(awk '{ printf "%.2f", $1 + $2 }' "${WORKDIR}/time.txt")" -v daemon_cpu="$daemon_cpu" \
+        'BEGIN { printf "run %d  %d threads  %8.2f s  %9.0f msg/s  cpu %s s  daemon cpu %s s\n",
+                 run, threads, end - start, threads * msgs / (end - start), cpu, daemon_cpu }'
+done
+
+exit 0